@@ -311,6 +311,8 @@ namespace AppInstaller::CLI
             return { type, "output"_liv, 'o' };
         case Execution::Args::Type::Correlation:
             return { type, "correlation"_liv };
+        case Execution::Args::Type::Profile:
+            return { type, "profile"_liv };
 
         case Execution::Args::Type::DependencySource:
             return { type, "dependency-source"_liv, ArgTypeCategory::ExtendedSource };
@@ -506,6 +508,8 @@ namespace AppInstaller::CLI
             return Argument{ type, Resource::String::FontDetailsArgumentDescription, ArgumentType::Flag, false };
         case Args::Type::Correlation:
             return Argument{ type, Resource::String::CorrelationArgumentDescription, ArgumentType::Standard, Argument::Visibility::Hidden };
+        case Args::Type::Profile:
+            return Argument{ type, Resource::String::ProfileArgumentDescription, ArgumentType::Flag, Argument::Visibility::Help };
         case Args::Type::ListDetails:
             return Argument{ type, Resource::String::ListDetailsArgumentDescription, ArgumentType::Flag, Argument::Visibility::Help };
         default:
@@ -528,6 +532,7 @@ namespace AppInstaller::CLI
         args.push_back(ForType(Args::Type::Proxy));
         args.push_back(ForType(Args::Type::NoProxy));
         args.push_back(ForType(Args::Type::Correlation));
+        args.push_back(ForType(Args::Type::Profile));
     }
 
     std::string Argument::GetUsageString() const
@@ -16,22 +16,59 @@ namespace AppInstaller::CLI::Execution
         m_nullIn.reset(new std::istream(&m_nullStreamBuf));
     }
 
+    namespace
+    {
+        // The minimum time between publishing intermediate progress ticks to the callbacks.
+        constexpr int64_t s_progressPublishIntervalMilliseconds = 100;
+    }
+
     void COMContext::AddProgressCallbackFunction(ProgressCallBackFunction&& f)
     {
         std::lock_guard<std::mutex> lock{ m_callbackLock };
-        m_comProgressCallbacks.push_back(std::move(f));
+
+        auto currentCallbacks = std::atomic_load(&m_comProgressCallbacks);
+        auto updatedCallbacks = std::make_shared<std::vector<ProgressCallBackFunction>>(currentCallbacks ? *currentCallbacks : std::vector<ProgressCallBackFunction>{});
+        updatedCallbacks->push_back(std::move(f));
+
+        std::atomic_store(&m_comProgressCallbacks, std::shared_ptr<const std::vector<ProgressCallBackFunction>>{ std::move(updatedCallbacks) });
     }
 
     void COMContext::FireCallbacks(ReportType reportType, uint64_t current, uint64_t maximum, ProgressType progressType, ::AppInstaller::CLI::Workflow::ExecutionStage executionPhase)
     {
-        // Lock around iterating through the list. Callbacks should not do long running tasks.
-        std::lock_guard<std::mutex> lock{ m_callbackLock };
-        for (auto& callback : m_comProgressCallbacks)
+        // Iterate over a snapshot of the list rather than taking a lock; progress ticks can arrive
+        // at a very high rate and must not serialize the operations running on the COM server.
+        auto callbacks = std::atomic_load(&m_comProgressCallbacks);
+        if (!callbacks)
+        {
+            return;
+        }
+
+        for (const auto& callback : *callbacks)
         {
             callback(reportType, current, maximum, progressType, executionPhase);
         }
     };
 
+    bool COMContext::ShouldPublishProgress(uint64_t current, uint64_t maximum)
+    {
+        // Always publish the final tick so that consumers see completion.
+        if (maximum != 0 && current >= maximum)
+        {
+            return true;
+        }
+
+        int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t last = m_lastProgressPublishMilliseconds.load(std::memory_order_relaxed);
+
+        if (now - last < s_progressPublishIntervalMilliseconds)
+        {
+            return false;
+        }
+
+        // If another thread wins the exchange, it publishes this interval's tick instead.
+        return m_lastProgressPublishMilliseconds.compare_exchange_strong(last, now, std::memory_order_relaxed);
+    }
+
     void COMContext::BeginProgress()
     {
         FireCallbacks(ReportType::BeginProgress, 0, 0, ProgressType::None, m_executionStage);
@@ -39,7 +76,10 @@ namespace AppInstaller::CLI::Execution
 
     void COMContext::OnProgress(uint64_t current, uint64_t maximum, ProgressType progressType)
     {
-        FireCallbacks(ReportType::Progressing, current, maximum, progressType, m_executionStage);
+        if (ShouldPublishProgress(current, maximum))
+        {
+            FireCallbacks(ReportType::Progressing, current, maximum, progressType, m_executionStage);
+        }
     }
 
     void COMContext::SetProgressMessage(std::string_view)
@@ -91,16 +131,23 @@ namespace AppInstaller::CLI::Execution
 
         Logging::OutputDebugStringLogger::Remove();
 
-#ifndef AICLI_DISABLE_TEST_HOOKS
-        if (!Settings::User().Get<Settings::Setting::KeepAllLogFiles>())
-#endif
-        {
-            // Initiate the background cleanup of the log file location.
-            Logging::FileLogger::BeginCleanup();
-        }
-
         Logging::TraceLogger::Add();
 
-        Logging::EnableWilFailureTelemetry();
+        // The remaining pieces are process wide; repeating them for every context only adds
+        // to the per call setup latency (the log cleanup in particular walks the log directory).
+        static std::once_flag s_processWideSetup;
+        std::call_once(s_processWideSetup, []()
+            {
+#ifndef AICLI_DISABLE_TEST_HOOKS
+                if (!Settings::User().Get<Settings::Setting::KeepAllLogFiles>())
+#endif
+                {
+                    // Initiate the background cleanup of the log file location.
+                    Logging::FileLogger::BeginCleanup();
+                }
+
+                Logging::EnableWilFailureTelemetry();
+                Logging::EnableAsyncTelemetryEmission();
+            });
     }
 }
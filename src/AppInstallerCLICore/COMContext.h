@@ -77,9 +77,15 @@ namespace AppInstaller::CLI::Execution
     private:
         void FireCallbacks(ReportType reportType, uint64_t current, uint64_t maximum, ProgressType progressType, ::AppInstaller::CLI::Workflow::ExecutionStage executionPhase);
 
+        // Determines whether a progress tick should be published to the callbacks.
+        bool ShouldPublishProgress(uint64_t current, uint64_t maximum);
+
         CLI::Workflow::ExecutionStage m_executionStage = CLI::Workflow::ExecutionStage::Initial;
-        std::vector<ProgressCallBackFunction> m_comProgressCallbacks;
+        // The callback list is copied on write and read through an atomic snapshot so that
+        // progress ticks do not take a lock; the lock only serializes writers.
+        std::shared_ptr<const std::vector<ProgressCallBackFunction>> m_comProgressCallbacks;
         std::wstring m_correlationData = L"";
         std::mutex m_callbackLock;
+        std::atomic<int64_t> m_lastProgressPublishMilliseconds{ 0 };
     };
 }
@@ -5,6 +5,8 @@
 #include "Command.h"
 #include "ExecutionContextData.h"
 #include <AppInstallerRuntime.h>
+#include <winget/ManifestYamlParser.h>
+#include <winget/ManifestYamlWriter.h>
 
 using namespace AppInstaller::CLI;
 using namespace AppInstaller::Repository::Microsoft;
@@ -17,6 +19,75 @@ namespace AppInstaller::Checkpoints
     constexpr std::string_view s_AutomaticCheckpoint = "automatic"sv;
     constexpr std::string_view s_CheckpointsFileName = "checkpoints.db"sv;
 
+    namespace
+    {
+        // All persisted context data is packed into a single versioned blob written as one row,
+        // so that checkpoint cost does not grow with the number of context fields.
+        // The blob is a version line followed by one record per data item:
+        //   <data type> <payload size>\n<payload>\n
+        // Records with unknown data types are skipped on read and an unknown version skips the
+        // whole blob; in both cases the resumed command recomputes the missing data.
+        constexpr std::string_view s_ContextDataBlobVersion = "1"sv;
+
+        // The data type value used for the blob row; distinct from any Execution::Data value.
+        constexpr Execution::Data s_ContextDataBlob = static_cast<Execution::Data>(-1);
+
+        void AppendContextDataRecord(std::string& blob, Execution::Data data, const std::string& payload)
+        {
+            blob += std::to_string(static_cast<int>(data));
+            blob += ' ';
+            blob += std::to_string(payload.size());
+            blob += '\n';
+            blob += payload;
+            blob += '\n';
+        }
+
+        std::map<Execution::Data, std::string> ParseContextDataBlob(const std::string& blob)
+        {
+            std::map<Execution::Data, std::string> result;
+
+            size_t lineEnd = blob.find('\n');
+            if (lineEnd == std::string::npos || blob.substr(0, lineEnd) != s_ContextDataBlobVersion)
+            {
+                AICLI_LOG(CLI, Warning, << "Unknown context data format in checkpoint; the resumed command will recompute its data.");
+                return result;
+            }
+
+            size_t position = lineEnd + 1;
+            while (position < blob.size())
+            {
+                lineEnd = blob.find('\n', position);
+                if (lineEnd == std::string::npos)
+                {
+                    break;
+                }
+
+                std::string header = blob.substr(position, lineEnd - position);
+                size_t separator = header.find(' ');
+                if (separator == std::string::npos)
+                {
+                    break;
+                }
+
+                int dataType = std::stoi(header.substr(0, separator));
+                size_t payloadSize = static_cast<size_t>(std::stoull(header.substr(separator + 1)));
+
+                position = lineEnd + 1;
+                if (payloadSize > blob.size() - position)
+                {
+                    break;
+                }
+
+                result.emplace(static_cast<Execution::Data>(dataType), blob.substr(position, payloadSize));
+
+                // Skip the payload and its trailing newline
+                position += payloadSize + 1;
+            }
+
+            return result;
+        }
+    }
+
     std::filesystem::path CheckpointManager::GetCheckpointDatabasePath(const std::string_view& resumeId, bool createCheckpointDirectory)
     {
         const auto checkpointsDirectory = Runtime::GetPathTo(Runtime::PathName::CheckpointsLocation) / resumeId;
@@ -59,12 +130,16 @@ namespace AppInstaller::Checkpoints
         CheckpointDatabase::IdType startCheckpointId = m_checkpointDatabase->AddCheckpoint(s_AutomaticCheckpoint);
         Checkpoint<AutomaticCheckpointData> automaticCheckpoint{ m_checkpointDatabase, startCheckpointId };
 
-        automaticCheckpoint.Set(AutomaticCheckpointData::ClientVersion, {}, AppInstaller::Runtime::GetClientVersion());
+        // Gather all of the field values first so that they can be written in a single transaction,
+        // rather than paying a commit for every field on the workflow thread.
+        std::vector<Checkpoint<AutomaticCheckpointData>::FieldValue> fieldValues;
+
+        fieldValues.push_back({ AutomaticCheckpointData::ClientVersion, {}, { AppInstaller::Runtime::GetClientVersion() } });
 
         const auto& executingCommand = context.GetExecutingCommand();
         if (executingCommand != nullptr)
         {
-            automaticCheckpoint.Set(AutomaticCheckpointData::Command, {}, std::string{ executingCommand->FullName() });
+            fieldValues.push_back({ AutomaticCheckpointData::Command, {}, { std::string{ executingCommand->FullName() } } });
         }
 
         const auto& argTypes = context.Args.GetTypes();
@@ -75,16 +150,18 @@ namespace AppInstaller::Checkpoints
 
             if (argumentType == ArgumentType::Flag)
             {
-                automaticCheckpoint.Set(AutomaticCheckpointData::Arguments, argument, {});
+                fieldValues.push_back({ AutomaticCheckpointData::Arguments, argument, { std::string{} } });
             }
             else
             {
                 const auto& values = *context.Args.GetArgs(type);
-                automaticCheckpoint.SetMany(AutomaticCheckpointData::Arguments, argument, values);
+                fieldValues.push_back({ AutomaticCheckpointData::Arguments, argument, values });
             }
         }
 
-        automaticCheckpoint.Set(AutomaticCheckpointData::ResumeCount, {}, std::to_string(0));
+        fieldValues.push_back({ AutomaticCheckpointData::ResumeCount, {}, { std::to_string(0) } });
+
+        automaticCheckpoint.SetAll(fieldValues);
     }
 
     void LoadCommandArgsFromAutomaticCheckpoint(CLI::Execution::Context& context, Checkpoint<AutomaticCheckpointData>& automaticCheckpoint)
@@ -109,6 +186,95 @@ namespace AppInstaller::Checkpoints
         }
     }
 
+    void SaveContextDataToCheckpoint(CLI::Execution::Context& context, Checkpoint<CLI::Execution::Data>& checkpoint, const std::vector<CLI::Execution::Data>& contextData)
+    {
+        // Pack all of the data into a single blob so that the write is one row and one
+        // transaction regardless of how many context fields a checkpoint captures.
+        std::string blob{ s_ContextDataBlobVersion };
+        blob += '\n';
+        bool hasData = false;
+
+        for (auto data : contextData)
+        {
+            switch (data)
+            {
+            case Execution::Data::Manifest:
+                // A context that was converted to an upgrade depends on the installed package state,
+                // which is not captured with the manifest; let the resumed command search again.
+                if (WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::InstallerExecutionUseUpdate))
+                {
+                    break;
+                }
+
+                if (context.Contains(Execution::Data::Manifest) &&
+                    context.Contains(Execution::Data::Installer) &&
+                    context.Get<Execution::Data::Installer>().has_value())
+                {
+                    AppendContextDataRecord(blob, data,
+                        Manifest::YamlWriter::ManifestToYamlString(context.Get<Execution::Data::Manifest>(), context.Get<Execution::Data::Installer>().value()));
+                    hasData = true;
+                }
+                break;
+            default:
+                AICLI_LOG(CLI, Warning, << "Context data type is not supported for checkpoints: " << static_cast<size_t>(data));
+                break;
+            }
+        }
+
+        if (hasData)
+        {
+            checkpoint.Set(s_ContextDataBlob, {}, blob);
+        }
+    }
+
+    void LoadContextDataFromCheckpoint(CLI::Execution::Context& context, Checkpoint<CLI::Execution::Data>& checkpoint)
+    {
+        try
+        {
+            if (checkpoint.Has(s_ContextDataBlob, {}))
+            {
+                for (const auto& [data, payload] : ParseContextDataBlob(checkpoint.Get(s_ContextDataBlob, {})))
+                {
+                    switch (data)
+                    {
+                    case Execution::Data::Manifest:
+                    {
+                        Manifest::Manifest manifest = Manifest::YamlParser::Create(payload);
+
+                        // The manifest is written with only the installer that had been selected.
+                        if (!manifest.Installers.empty())
+                        {
+                            context.Add<Execution::Data::Installer>(manifest.Installers[0]);
+                        }
+
+                        context.Add<Execution::Data::Manifest>(std::move(manifest));
+                        break;
+                    }
+                    default:
+                        AICLI_LOG(CLI, Warning, << "Ignoring unknown context data type in checkpoint: " << static_cast<int>(data));
+                        break;
+                    }
+                }
+            }
+            else if (checkpoint.Has(Execution::Data::Manifest, {}))
+            {
+                // Checkpoints written before the blob format stored one row per data field.
+                Manifest::Manifest manifest = Manifest::YamlParser::Create(checkpoint.Get(Execution::Data::Manifest, {}));
+
+                if (!manifest.Installers.empty())
+                {
+                    context.Add<Execution::Data::Installer>(manifest.Installers[0]);
+                }
+
+                context.Add<Execution::Data::Manifest>(std::move(manifest));
+            }
+        }
+        catch (...)
+        {
+            AICLI_LOG(CLI, Warning, << "Failed to load context data from checkpoint; the resumed command will recompute it.");
+        }
+    }
+
     std::optional<Checkpoint<AutomaticCheckpointData>> CheckpointManager::GetAutomaticCheckpoint()
     {
         const auto& checkpointIds = m_checkpointDatabase->GetCheckpointIds();
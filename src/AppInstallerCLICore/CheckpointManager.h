@@ -11,6 +11,13 @@ namespace AppInstaller::Checkpoints
     // Reads the command arguments from the automatic checkpoint and populates the context.
     void LoadCommandArgsFromAutomaticCheckpoint(CLI::Execution::Context& context, Checkpoint<AutomaticCheckpointData>& automaticCheckpoint);
 
+    // Writes the requested context data items from the context to the checkpoint.
+    // Data types that cannot be persisted are skipped; the resumed command recomputes them.
+    void SaveContextDataToCheckpoint(CLI::Execution::Context& context, Checkpoint<CLI::Execution::Data>& checkpoint, const std::vector<CLI::Execution::Data>& contextData);
+
+    // Reads the context data items from the checkpoint and populates the context.
+    void LoadContextDataFromCheckpoint(CLI::Execution::Context& context, Checkpoint<CLI::Execution::Data>& checkpoint);
+
     // Owns the lifetime of a checkpoint data base and creates the checkpoints.
     struct CheckpointManager
     {
@@ -4,9 +4,11 @@
 #include "Command.h"
 #include "Resources.h"
 #include "Sixel.h"
+#include "TableOutput.h"
 #include <winget/UserSettings.h>
 #include <AppInstallerRuntime.h>
 #include <winget/Locale.h>
+#include <winget/PerformanceTrace.h>
 #include <winget/Reboot.h>
 #include <winget/Authentication.h>
 
@@ -33,6 +35,57 @@ namespace AppInstaller::CLI
             }
             CATCH_LOG();
         }
+
+        // Formats a duration in tenths of a millisecond for the profile summary.
+        std::string FormatProfileDuration(std::chrono::microseconds duration)
+        {
+            std::ostringstream strstr;
+            strstr << (duration.count() / 1000) << '.' << ((duration.count() / 100) % 10) << " ms";
+            return std::move(strstr).str();
+        }
+
+        // Formats a byte count in tenths of a megabyte for the profile summary.
+        std::string FormatProfileMemory(uint64_t bytes)
+        {
+            std::ostringstream strstr;
+            strstr << (bytes >> 20) << '.' << (((bytes * 10) >> 20) % 10) << " MB";
+            return std::move(strstr).str();
+        }
+
+        // Formats a signed byte delta in tenths of a megabyte for the profile summary.
+        std::string FormatProfileMemoryDelta(int64_t bytes)
+        {
+            uint64_t magnitude = static_cast<uint64_t>(bytes < 0 ? -bytes : bytes);
+            std::ostringstream strstr;
+            strstr << (bytes < 0 ? '-' : '+') << (magnitude >> 20) << '.' << (((magnitude * 10) >> 20) % 10) << " MB";
+            return std::move(strstr).str();
+        }
+
+        // Outputs the per-task measurements collected during a profiled execution.
+        void OutputTaskProfileSummary(Execution::Context& context)
+        {
+            const auto& profiles = context.GetTaskProfiles();
+            if (profiles.empty())
+            {
+                return;
+            }
+
+            context.Reporter.Info() << std::endl;
+            Execution::TableOutput<5> table(context.Reporter,
+                { Resource::String::ProfileTask, Resource::String::ProfileWallTime, Resource::String::ProfileCpuTime, Resource::String::ProfileMemoryDelta, Resource::String::ProfilePeakMemory });
+
+            for (const auto& profile : profiles)
+            {
+                table.OutputLine({
+                    profile.Name,
+                    FormatProfileDuration(profile.WallTime),
+                    FormatProfileDuration(profile.CpuTime),
+                    FormatProfileMemoryDelta(profile.PrivateUsageDeltaInBytes),
+                    FormatProfileMemory(profile.PeakWorkingSetInBytes) });
+            }
+
+            table.Complete();
+        }
     }
 
     Command::Command(
@@ -369,13 +422,13 @@ namespace AppInstaller::CLI
     // and determine the likely state of the word to be completed.
     struct ParseArgumentsStateMachine
     {
-        ParseArgumentsStateMachine(Invocation& inv, Execution::Args& execArgs, std::vector<CLI::Argument> arguments);
+        ParseArgumentsStateMachine(Invocation& inv, Execution::Args& execArgs, const std::vector<CLI::Argument>& arguments);
 
         ParseArgumentsStateMachine(const ParseArgumentsStateMachine&) = delete;
         ParseArgumentsStateMachine& operator=(const ParseArgumentsStateMachine&) = delete;
 
         ParseArgumentsStateMachine(ParseArgumentsStateMachine&&) = default;
-        ParseArgumentsStateMachine& operator=(ParseArgumentsStateMachine&&) = default;
+        ParseArgumentsStateMachine& operator=(ParseArgumentsStateMachine&&) = delete;
 
         // Processes the next argument from the invocation.
         // Returns true if there was an argument to process;
@@ -424,22 +477,41 @@ namespace AppInstaller::CLI
 
         Invocation& m_invocation;
         Execution::Args& m_executionArgs;
-        std::vector<CLI::Argument> m_arguments;
+        const std::vector<CLI::Argument>& m_arguments;
+
+        // Lookup tables built once so that each token is matched with a single lookup
+        // rather than a case insensitive scan over every argument.
+        std::map<std::string, const CLI::Argument*, std::less<>> m_nameLookup;
+        std::map<char, const CLI::Argument*> m_aliasLookup;
 
         Invocation::iterator m_invocationItr;
-        std::vector<CLI::Argument>::iterator m_positionalSearchItr;
+        std::vector<CLI::Argument>::const_iterator m_positionalSearchItr;
         bool m_onlyPositionalArgumentsRemain = false;
 
         State m_state;
     };
 
-    ParseArgumentsStateMachine::ParseArgumentsStateMachine(Invocation& inv, Execution::Args& execArgs, std::vector<CLI::Argument> arguments) :
+    ParseArgumentsStateMachine::ParseArgumentsStateMachine(Invocation& inv, Execution::Args& execArgs, const std::vector<CLI::Argument>& arguments) :
         m_invocation(inv),
         m_executionArgs(execArgs),
-        m_arguments(std::move(arguments)),
+        m_arguments(arguments),
         m_invocationItr(m_invocation.begin()),
         m_positionalSearchItr(m_arguments.begin())
     {
+        for (const auto& arg : m_arguments)
+        {
+            m_nameLookup.emplace(Utility::ToLower(arg.Name()), &arg);
+
+            if (!arg.AlternateName().empty())
+            {
+                m_nameLookup.emplace(Utility::ToLower(arg.AlternateName()), &arg);
+            }
+
+            if (arg.Alias() != Argument::NoAlias)
+            {
+                m_aliasLookup.emplace(arg.Alias(), &arg);
+            }
+        }
     }
 
     bool ParseArgumentsStateMachine::Step()
@@ -530,32 +602,32 @@ namespace AppInstaller::CLI
             // Parse the single character alias argument
             char currChar = currArg[1];
 
-            auto itr = std::find_if(m_arguments.begin(), m_arguments.end(), [&](const Argument& arg) { return (currChar == arg.Alias()); });
-            if (itr == m_arguments.end())
+            auto itr = m_aliasLookup.find(currChar);
+            if (itr == m_aliasLookup.end())
             {
                 return CommandException(Resource::String::InvalidAliasError(currArg));
             }
 
-            if (itr->Type() == ArgumentType::Flag)
+            if (itr->second->Type() == ArgumentType::Flag)
             {
-                m_executionArgs.AddArg(itr->ExecArgType());
+                m_executionArgs.AddArg(itr->second->ExecArgType());
 
                 for (size_t i = 2; i < currArg.length(); ++i)
                 {
                     currChar = currArg[i];
 
-                    auto itr2 = std::find_if(m_arguments.begin(), m_arguments.end(), [&](const Argument& arg) { return (currChar == arg.Alias()); });
-                    if (itr2 == m_arguments.end())
+                    auto itr2 = m_aliasLookup.find(currChar);
+                    if (itr2 == m_aliasLookup.end())
                     {
                         return CommandException(Resource::String::AdjoinedNotFoundError(currArg));
                     }
-                    else if (itr2->Type() != ArgumentType::Flag)
+                    else if (itr2->second->Type() != ArgumentType::Flag)
                     {
                         return CommandException(Resource::String::AdjoinedNotFlagError(currArg));
                     }
                     else
                     {
-                        m_executionArgs.AddArg(itr2->ExecArgType());
+                        m_executionArgs.AddArg(itr2->second->ExecArgType());
                     }
                 }
             }
@@ -563,7 +635,7 @@ namespace AppInstaller::CLI
             {
                 if (currArg[2] == APPINSTALLER_CLI_ARGUMENT_SPLIT_CHAR)
                 {
-                    ProcessAdjoinedValue(itr->ExecArgType(), currArg.substr(3));
+                    ProcessAdjoinedValue(itr->second->ExecArgType(), currArg.substr(3));
                 }
                 else
                 {
@@ -572,7 +644,7 @@ namespace AppInstaller::CLI
             }
             else
             {
-                return { itr->ExecArgType(), currArg };
+                return { itr->second->ExecArgType(), currArg };
             }
         }
         // The currentArg is at least 2 chars, both of which are --
@@ -587,8 +659,6 @@ namespace AppInstaller::CLI
             // Skip the double arg identifier chars.
             size_t argStart = currArg.find_first_not_of(APPINSTALLER_CLI_ARGUMENT_IDENTIFIER_CHAR);
             std::string_view argName = currArg.substr(argStart);
-            bool argFound = false;
-
             bool hasValue = false;
             std::string_view argValue;
             size_t splitChar = argName.find_first_of(APPINSTALLER_CLI_ARGUMENT_SPLIT_CHAR);
@@ -599,38 +669,30 @@ namespace AppInstaller::CLI
                 argName = argName.substr(0, splitChar);
             }
 
-            for (const auto& arg : m_arguments)
+            auto nameItr = m_nameLookup.find(Utility::ToLower(argName));
+            if (nameItr == m_nameLookup.end())
             {
-                if (
-                    Utility::CaseInsensitiveEquals(argName, arg.Name()) ||
-                    Utility::CaseInsensitiveEquals(argName, arg.AlternateName())
-                   )
-                {
-                    if (arg.Type() == ArgumentType::Flag)
-                    {
-                        if (hasValue)
-                        {
-                            return CommandException(Resource::String::FlagContainAdjoinedError(currArg));
-                        }
+                return CommandException(Resource::String::InvalidNameError(currArg));
+            }
 
-                        m_executionArgs.AddArg(arg.ExecArgType());
-                    }
-                    else if (hasValue)
-                    {
-                        ProcessAdjoinedValue(arg.ExecArgType(), argValue);
-                    }
-                    else
-                    {
-                        return { arg.ExecArgType(), currArg };
-                    }
-                    argFound = true;
-                    break;
+            const CLI::Argument& arg = *nameItr->second;
+
+            if (arg.Type() == ArgumentType::Flag)
+            {
+                if (hasValue)
+                {
+                    return CommandException(Resource::String::FlagContainAdjoinedError(currArg));
                 }
-            }
 
-            if (!argFound)
+                m_executionArgs.AddArg(arg.ExecArgType());
+            }
+            else if (hasValue)
             {
-                return CommandException(Resource::String::InvalidNameError(currArg));
+                ProcessAdjoinedValue(arg.ExecArgType(), argValue);
+            }
+            else
+            {
+                return { arg.ExecArgType(), currArg };
             }
         }
 
@@ -649,12 +711,21 @@ namespace AppInstaller::CLI
         m_executionArgs.AddArg(type, std::string{ value });
     }
 
-    void Command::ParseArguments(Invocation& inv, Execution::Args& execArgs) const
+    const std::vector<Argument>& Command::GetArgumentsWithCommon() const
     {
-        auto definedArgs = GetArguments();
-        Argument::GetCommon(definedArgs);
+        if (!m_argumentsWithCommon)
+        {
+            std::vector<Argument> arguments = GetArguments();
+            Argument::GetCommon(arguments);
+            m_argumentsWithCommon = std::move(arguments);
+        }
 
-        ParseArgumentsStateMachine stateMachine{ inv, execArgs, std::move(definedArgs) };
+        return *m_argumentsWithCommon;
+    }
+
+    void Command::ParseArguments(Invocation& inv, Execution::Args& execArgs) const
+    {
+        ParseArgumentsStateMachine stateMachine{ inv, execArgs, GetArgumentsWithCommon() };
 
         while (stateMachine.Step())
         {
@@ -675,8 +746,7 @@ namespace AppInstaller::CLI
         }
 
         // Common arguments need to be validated with command arguments, as there may be common arguments blocked by Experimental Feature or Group Policy
-        auto allArgs = GetArguments();
-        Argument::GetCommon(allArgs);
+        const auto& allArgs = GetArgumentsWithCommon();
 
         for (const auto& arg : allArgs)
         {
@@ -857,10 +927,7 @@ namespace AppInstaller::CLI
         }
 
         // Consume what remains, if any, of the preceding values to determine what type the word is.
-        auto definedArgs = GetArguments();
-        Argument::GetCommon(definedArgs);
-
-        ParseArgumentsStateMachine stateMachine{ data.BeforeWord(), context.Args, std::move(definedArgs) };
+        ParseArgumentsStateMachine stateMachine{ data.BeforeWord(), context.Args, GetArgumentsWithCommon() };
 
         // We don't care if there are errors along the way, just do the best that can be done and try to
         // complete whatever would be next if the bad strings were simply ignored. To do that we just spin
@@ -944,6 +1011,7 @@ namespace AppInstaller::CLI
         }
 
         AICLI_LOG(CLI, Info, << "Executing command: " << Name());
+        Logging::PerformanceTraceSpan commandSpan{ FullName() };
         if (context.Args.Contains(Execution::Args::Type::Help))
         {
             OutputHelp(context.Reporter);
@@ -953,6 +1021,11 @@ namespace AppInstaller::CLI
             ExecuteInternal(context);
         }
 
+        if (context.IsProfilingEnabled())
+        {
+            OutputTaskProfileSummary(context);
+        }
+
         // NOTE: Reboot logic will still run even if the context is terminated (not including unhandled exceptions).
         if (context.Args.Contains(Execution::Args::Type::AllowReboot) &&
             WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::RebootRequired))
@@ -1044,8 +1117,7 @@ namespace AppInstaller::CLI
 
     std::vector<Argument> Command::GetVisibleArguments() const
     {
-        auto arguments = GetArguments();
-        Argument::GetCommon(arguments);
+        std::vector<Argument> arguments = GetArgumentsWithCommon();
 
         arguments.erase(
             std::remove_if(
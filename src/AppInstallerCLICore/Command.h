@@ -99,6 +99,9 @@ namespace AppInstaller::CLI
 
         virtual std::vector<std::unique_ptr<Command>> GetCommands() const { return {}; }
         virtual std::vector<Argument> GetArguments() const { return {}; }
+        // Gets the arguments for this command together with the common arguments,
+        // built once per command object rather than once per use.
+        const std::vector<Argument>& GetArgumentsWithCommon() const;
         std::vector<std::unique_ptr<Command>> GetVisibleCommands() const;
         std::vector<Argument> GetVisibleArguments() const;
 
@@ -136,6 +139,7 @@ namespace AppInstaller::CLI
         CommandOutputFlags m_outputFlags;
         bool m_selectCurrentCommandIfUnrecognizedSubcommandFound = false;
         std::string m_commandArguments;
+        mutable std::optional<std::vector<Argument>> m_argumentsWithCommon;
     };
 
     template <typename Container>
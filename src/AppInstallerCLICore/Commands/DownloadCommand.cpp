@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "DownloadCommand.h"
 #include "Workflows/CompletionFlow.h"
+#include "Workflows/DependenciesFlow.h"
 #include "Workflows/DownloadFlow.h"
 #include "Workflows/InstallFlow.h"
 #include "Workflows/PromptFlow.h"
@@ -111,7 +112,7 @@ namespace AppInstaller::CLI
     {
         context.SetFlags(AppInstaller::CLI::Execution::ContextFlag::InstallerDownloadOnly);
 
-        context << Workflow::InitializeInstallerDownloadAuthenticatorsMap;
+        context << Workflow::InitializeInstallerDownloadAuthenticatorsMap << Workflow::InitializeDependencyNodeResultsMap;
 
         if (context.Args.Contains(Execution::Args::Type::Manifest))
         {
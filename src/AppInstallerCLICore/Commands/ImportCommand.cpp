@@ -4,6 +4,7 @@
 #include "ImportCommand.h"
 #include "Workflows/DownloadFlow.h"
 #include "Workflows/CompletionFlow.h"
+#include "Workflows/DependenciesFlow.h"
 #include "Workflows/ImportExportFlow.h"
 #include "Workflows/MultiQueryFlow.h"
 #include "Workflows/WorkflowBase.h"
@@ -44,6 +45,7 @@ namespace AppInstaller::CLI
     {
         context <<
             Workflow::InitializeInstallerDownloadAuthenticatorsMap <<
+            Workflow::InitializeDependencyNodeResultsMap <<
             Workflow::ReportExecutionStage(Workflow::ExecutionStage::Discovery) <<
             Workflow::VerifyFile(Execution::Args::Type::ImportFile) <<
             Workflow::ReadImportFile <<
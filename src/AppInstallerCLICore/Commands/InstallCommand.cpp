@@ -5,6 +5,7 @@
 #include "CheckpointManager.h"
 #include "InstallCommand.h"
 #include "Workflows/CompletionFlow.h"
+#include "Workflows/DependenciesFlow.h"
 #include "Workflows/DownloadFlow.h"
 #include "Workflows/InstallFlow.h"
 #include "Workflows/UpdateFlow.h"
@@ -112,15 +113,34 @@ namespace AppInstaller::CLI
 
     void InstallCommand::Resume(Context& context) const
     {
-        // TODO: Load context data from checkpoint for install command.
-        ExecuteInternal(context);
+        for (auto& checkpoint : context.GetCheckpoints())
+        {
+            Checkpoints::LoadContextDataFromCheckpoint(context, checkpoint);
+        }
+
+        if (context.Contains(Execution::Data::Manifest) && context.Contains(Execution::Data::Installer))
+        {
+            // The package selection from the original invocation was restored from the checkpoint;
+            // skip source discovery and search and proceed directly to installation.
+            context.SetFlags(ContextFlag::ShowSearchResultsOnPartialFailure);
+
+            context <<
+                InitializeInstallerDownloadAuthenticatorsMap <<
+                InitializeDependencyNodeResultsMap <<
+                EnsureApplicableInstaller <<
+                InstallSinglePackage;
+        }
+        else
+        {
+            ExecuteInternal(context);
+        }
     }
 
     void InstallCommand::ExecuteInternal(Context& context) const
     {
         context.SetFlags(ContextFlag::ShowSearchResultsOnPartialFailure);
 
-        context << InitializeInstallerDownloadAuthenticatorsMap;
+        context << InitializeInstallerDownloadAuthenticatorsMap << InitializeDependencyNodeResultsMap;
 
         if (context.Args.Contains(Execution::Args::Type::Manifest))
         {
@@ -129,11 +149,17 @@ namespace AppInstaller::CLI
                 GetManifestFromArg <<
                 SelectInstaller <<
                 EnsureApplicableInstaller <<
-                Checkpoint("PreInstallCheckpoint", {}) << // TODO: Capture context data
+                Checkpoint("PreInstallCheckpoint", { Execution::Data::Manifest }) <<
                 InstallSinglePackage;
         }
         else
         {
+            if (!context.Args.Contains(Execution::Args::Type::Force))
+            {
+                // Begin opening the installed source while the available source opens below.
+                context << OpenPredefinedSourceInBackground(DetermineInstalledSource(context));
+            }
+
             context <<
                 ReportExecutionStage(ExecutionStage::Discovery) <<
                 OpenSource();
@@ -165,7 +191,7 @@ namespace AppInstaller::CLI
             else
             {
                 context <<
-                    Checkpoint("PreInstallCheckpoint", {}) << // TODO: Capture context data
+                    Checkpoint("PreInstallCheckpoint", {}) <<
                     InstallOrUpgradeSinglePackage(OperationType::Install);
             }
         }
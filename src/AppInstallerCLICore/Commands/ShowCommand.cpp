@@ -100,11 +100,15 @@ namespace AppInstaller::CLI
         }
         else
         {
+            // Render an uncached icon in the background while the textual output is produced.
+            context.SetFlags(Execution::ContextFlag::DeferIconDisplay);
+
             context <<
                 GetManifest( /* considerPins */ false) <<
                 Workflow::ReportManifestIdentity <<
                 Workflow::SelectInstaller <<
-                Workflow::ShowManifestInfo;
+                Workflow::ShowManifestInfo <<
+                Workflow::ShowDeferredIcon;
         }
     }
 }
@@ -159,7 +159,10 @@ namespace AppInstaller::CLI
 
         context <<
             InitializeInstallerDownloadAuthenticatorsMap <<
+            InitializeDependencyNodeResultsMap <<
             ReportExecutionStage(ExecutionStage::Discovery) <<
+            // Begin opening the installed source while the available source opens.
+            OpenPredefinedSourceInBackground(DetermineInstalledSource(context)) <<
             OpenSource() <<
             OpenCompositeSource(DetermineInstalledSource(context));
 
@@ -170,7 +173,8 @@ namespace AppInstaller::CLI
                 SearchSourceForMany <<
                 HandleSearchResultFailures <<
                 EnsureMatchesFromSearchResult(OperationType::Upgrade) <<
-                ReportListResult(true);
+                ReportListResult(true) <<
+                PrefetchUpgradeInstallers;
         }
         else if (context.Args.Contains(Execution::Args::Type::All))
         {
@@ -50,7 +50,7 @@ namespace AppInstaller::CLI
                 validateOption.ThrowOnWarning = !(context.Args.Contains(Execution::Args::Type::IgnoreWarnings));
                 auto manifest = YamlParser::CreateFromPath(inputFile, validateOption);
 
-                context.Add<Execution::Data::Manifest>(manifest);
+                context.Add<Execution::Data::Manifest>(std::move(manifest));
                 context <<
                     Workflow::GetInstallersDependenciesFromManifest <<
                     Workflow::ReportDependencies(Resource::String::ValidateCommandReportDependencies);
@@ -28,6 +28,9 @@ namespace AppInstaller::CLI::ConfigurationRemoting
         // The string used to divide the arguments sent to the remote server
         constexpr std::wstring_view s_ArgumentsDivider = L"\n~~~~~~\n"sv;
 
+        // The prefix indicating that the bulk payload is in a shared memory section rather than on the command line.
+        constexpr std::wstring_view s_SharedMemoryPrefix = L"sharedmemory:"sv;
+
         // A helper with a convenient function that we use to receive the remote factory object.
         struct RemoteFactoryCallback : winrt::implements<RemoteFactoryCallback, IConfigurationStatics>
         {
@@ -161,18 +164,43 @@ namespace AppInstaller::CLI::ConfigurationRemoting
                 // This will be presented to the user so it must be formatted nicely.
                 // Arguments are:
                 // server.exe <marshalled callback object> <completion event name> <this process id>
-                // 
+                //
                 // Optionally, we may also place additional data that limits what the server may do as:
                 // ~~~~~~
-                // { "JSON properties" }
-                // ~~~~~~
-                // YAML configuration set definition
+                // sharedmemory:<section name>
+                // The section contains two little-endian 64-bit lengths followed by the JSON properties
+                // and the YAML configuration set definition. Passing the bulk payload out of band keeps
+                // the user visible command line small and clear of the 32K argument limit, and avoids
+                // marshaling large sets through the process launch path.
                 std::wostringstream argumentsStream;
                 argumentsStream << s_RemoteServerFileName << L' ' << marshalledCallback << L' ' << completionEventName << L' ' << GetCurrentProcessId() << L' ' << ToString(processorEngine);
 
                 if (!properties.empty() && !restrictions.empty())
                 {
-                    argumentsStream << L' ' << s_ArgumentsDivider << Utility::ConvertToUTF16(properties) << s_ArgumentsDivider << Utility::ConvertToUTF16(restrictions);
+                    std::wstring sectionName = Utility::CreateNewGuidNameWString();
+
+                    uint64_t propertiesSize = properties.size();
+                    uint64_t restrictionsSize = restrictions.size();
+                    uint64_t totalSize = (2 * sizeof(uint64_t)) + propertiesSize + restrictionsSize;
+
+                    m_limitationSection.reset(CreateFileMappingW(
+                        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                        static_cast<DWORD>(totalSize >> 32), static_cast<DWORD>(totalSize), sectionName.c_str()));
+                    THROW_LAST_ERROR_IF_NULL(m_limitationSection);
+
+                    wil::unique_mapview_ptr<uint8_t> view{ reinterpret_cast<uint8_t*>(MapViewOfFile(m_limitationSection.get(), FILE_MAP_WRITE, 0, 0, 0)) };
+                    THROW_LAST_ERROR_IF_NULL(view);
+
+                    uint8_t* target = view.get();
+                    memcpy(target, &propertiesSize, sizeof(propertiesSize));
+                    target += sizeof(propertiesSize);
+                    memcpy(target, &restrictionsSize, sizeof(restrictionsSize));
+                    target += sizeof(restrictionsSize);
+                    memcpy(target, properties.data(), properties.size());
+                    target += properties.size();
+                    memcpy(target, restrictions.data(), restrictions.size());
+
+                    argumentsStream << L' ' << s_ArgumentsDivider << s_SharedMemoryPrefix << sectionName;
                 }
 
                 std::wstring arguments = argumentsStream.str();
@@ -318,6 +346,7 @@ namespace AppInstaller::CLI::ConfigurationRemoting
         private:
             IConfigurationSetProcessorFactory m_remoteFactory;
             wil::unique_event m_completionEvent;
+            wil::unique_handle m_limitationSection;
             Collections::IVector<winrt::hstring> m_additionalModulePaths{ winrt::single_threaded_vector<winrt::hstring>() };
             Collections::IVector<winrt::hstring> m_remoteAdditionalModulePaths{ winrt::single_threaded_vector<winrt::hstring>() };
         };
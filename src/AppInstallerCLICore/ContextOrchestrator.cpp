@@ -16,6 +16,12 @@ namespace AppInstaller::CLI::Execution
         // Operation command queue used by install, uninstall and repair commands.
         constexpr static std::string_view OperationCommandQueueName = "operation"sv;
 
+        // Operation command queues for installer technologies that do not contend with the
+        // Windows Installer machine-wide mutex. Installs within each class still serialize,
+        // but MSIX deployments and portable installs can proceed alongside an MSI install.
+        constexpr static std::string_view MsixOperationCommandQueueName = "operation-msix"sv;
+        constexpr static std::string_view PortableOperationCommandQueueName = "operation-portable"sv;
+
         // Callback function used by worker threads in the queue.
         // context must be a pointer to a queue item.
         void CALLBACK OrchestratorQueueWorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK)
@@ -28,11 +34,35 @@ namespace AppInstaller::CLI::Execution
             }
         }
 
-        // Get command queue name based on command name.
-        std::string_view GetCommandQueueName(std::string_view commandName)
+        // Get command queue name based on command name and the context that will run it.
+        std::string_view GetCommandQueueName(std::string_view commandName, COMContext& context)
         {
             if (commandName == COMInstallCommand::CommandName || commandName == COMUninstallCommand::CommandName || commandName == COMRepairCommand::CommandName)
             {
+                // By the time the install command is enqueued the download stage has selected the
+                // installer, so installs can be routed by the technology they will actually use.
+                // Uninstall and repair remain on the default queue as their technology is not
+                // resolved until the command runs.
+                if (commandName == COMInstallCommand::CommandName && context.Contains(Data::Installer))
+                {
+                    const auto& installer = context.Get<Data::Installer>();
+                    if (installer)
+                    {
+                        switch (installer->EffectiveInstallerType())
+                        {
+                        case Manifest::InstallerTypeEnum::Msix:
+                        case Manifest::InstallerTypeEnum::MSStore:
+                            return MsixOperationCommandQueueName;
+                        case Manifest::InstallerTypeEnum::Portable:
+                            return PortableOperationCommandQueueName;
+                        default:
+                            // Everything else (including exe based installers that may wrap an MSI)
+                            // stays serialized on the default operation queue.
+                            break;
+                        }
+                    }
+                }
+
                 return OperationCommandQueueName;
             }
 
@@ -55,7 +85,9 @@ namespace AppInstaller::CLI::Execution
         m_installingWriteableSource.Open(progress);
 
         // Decide how many threads to use for each command.
-        // We always allow only one install at a time.
+        // We always allow only one install at a time per installer technology class;
+        // classes that do not contend for the Windows Installer mutex get their own queue
+        // so that MSIX and portable installs are not stuck behind an MSI install.
         // For download, if we can find the number of supported concurrent threads,
         // use that as the maximum (up to 3); otherwise use a single thread.
         const UINT32 maxDownloadThreads = 3;
@@ -64,6 +96,8 @@ namespace AppInstaller::CLI::Execution
 
         AddCommandQueue(COMDownloadCommand::CommandName, downloadThreads);
         AddCommandQueue(OperationCommandQueueName, operationThreads);
+        AddCommandQueue(MsixOperationCommandQueueName, operationThreads);
+        AddCommandQueue(PortableOperationCommandQueueName, operationThreads);
     }
 
     void ContextOrchestrator::AddCommandQueue(std::string_view commandName, UINT32 allowedThreads)
@@ -108,7 +142,7 @@ namespace AppInstaller::CLI::Execution
             item->HandleItemCompletion(*this);
         }
 
-        std::string commandQueueName{ GetCommandQueueName(item->GetNextCommand().Name()) };
+        std::string commandQueueName{ GetCommandQueueName(item->GetNextCommand().Name(), item->GetContext()) };
         m_commandQueues.at(commandQueueName)->EnqueueAndRunItem(item);
     }
 
@@ -6,6 +6,9 @@
 #include "ExecutionContext.h"
 #include "Workflows/WorkflowBase.h"
 #include <winget/UserSettings.h>
+#include <winget/GroupPolicy.h>
+#include <winget/HttpClientHelper.h>
+#include <winget/RepositorySource.h>
 #include "Commands/InstallCommand.h"
 #include "COMContext.h"
 #include <AppInstallerFileLogger.h>
@@ -78,6 +81,43 @@ namespace AppInstaller::CLI
             main.Wait = WaitOnMainWaitEvent;
             ShutdownMonitoring::ServerShutdownSynchronization::AddComponent(main);
         }
+
+        // Starts background connection warmup to the configured source endpoints that the
+        // command may use. The first request of a cold command otherwise pays for DNS, TCP,
+        // and the TLS handshake serially; starting them here lets that setup overlap the
+        // remaining startup work and the source open.
+        void WarmUpSourceConnections(const Execution::Context& context, const Command& command) try
+        {
+            // Only commands that accept a source argument reach out to sources.
+            const std::vector<Argument>& arguments = command.GetArgumentsWithCommon();
+            if (std::none_of(arguments.begin(), arguments.end(),
+                [](const Argument& argument) { return argument.ExecArgType() == Execution::Args::Type::Source; }))
+            {
+                return;
+            }
+
+            std::string_view requestedSource;
+            if (context.Args.Contains(Execution::Args::Type::Source))
+            {
+                requestedSource = context.Args.GetArg(Execution::Args::Type::Source);
+            }
+
+            Http::HttpClientHelper clientHelper;
+
+            for (const auto& details : Repository::Source::GetCurrentSources())
+            {
+                if (!requestedSource.empty() && !Utility::CaseInsensitiveEquals(requestedSource, details.Name))
+                {
+                    continue;
+                }
+
+                if (Utility::CaseInsensitiveStartsWith(details.Arg, "http"))
+                {
+                    clientHelper.WarmUp(Utility::ConvertToUTF16(details.Arg));
+                }
+            }
+        }
+        CATCH_LOG()
     }
 
     int CoreMain(int argc, wchar_t const** argv) try
@@ -119,6 +159,7 @@ namespace AppInstaller::CLI
         Logging::FileLogger::Add();
         Logging::OutputDebugStringLogger::Remove();
         Logging::EnableWilFailureTelemetry();
+        Logging::EnableAsyncTelemetryEmission();
 
         // Set output to UTF8
         ConsoleOutputCPRestore utf8CP(CP_UTF8);
@@ -180,6 +221,9 @@ namespace AppInstaller::CLI
             context.UpdateForArgs();
             context.SetExecutingCommand(command.get());
             command->ValidateArguments(context.Args);
+
+            // Let connection setup to the source endpoints overlap the rest of startup.
+            WarmUpSourceConnections(context, *command);
         }
         // Exceptions specific to parsing the arguments of a command
         catch (const CommandException& ce)
@@ -229,6 +273,37 @@ namespace AppInstaller::CLI
         AppInstaller::CLI::Execution::COMContext::SetLoggers();
     }
 
+    void ServerWarmUp()
+    {
+        // Force the settings and policy singletons to load so that the first client call
+        // does not pay for them.
+        Settings::User();
+        Settings::GroupPolicies();
+
+        if (!Settings::GroupPolicies().IsEnabled(Settings::TogglePolicy::Policy::WinGet))
+        {
+            return;
+        }
+
+        // Open the configured sources and hold them for the server lifetime; the shared
+        // index source pooling serves later client connections from these same objects.
+        // Failures only cost the warm start, so they are logged and ignored.
+        static std::vector<Repository::Source> s_warmSources;
+
+        for (const auto& details : Repository::Source::GetCurrentSources())
+        {
+            try
+            {
+                Repository::Source source{ details.Name };
+                ProgressCallback progress;
+                source.Open(progress);
+                s_warmSources.emplace_back(std::move(source));
+                AICLI_LOG(CLI, Info, << "Warmed source: " << details.Name);
+            }
+            CATCH_LOG_MSG("Failed to warm source: %hs", details.Name.c_str());
+        }
+    }
+
     void InProcInitialize()
     {
 #ifndef AICLI_DISABLE_TEST_HOOKS
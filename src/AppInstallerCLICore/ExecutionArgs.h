@@ -179,6 +179,7 @@ namespace AppInstaller::CLI::Execution
             Force, // Forces the execution of the workflow with non security related issues
             OutputFile,
             Correlation,
+            Profile, // Collects per-task timing data and prints a summary report
 
             DependencySource, // Index source to be queried against for finding dependencies
             CustomHeader, // Optional Rest source header
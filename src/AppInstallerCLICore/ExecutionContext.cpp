@@ -97,6 +97,7 @@ namespace AppInstaller::CLI::Execution
         }
 
         COPY_DATA_IF_EXISTS(Data::InstallerDownloadAuthenticators);
+        COPY_DATA_IF_EXISTS(Data::DependencyNodeResults);
     }
 
     void Context::EnableSignalTerminationHandler(bool enabled)
@@ -113,6 +114,12 @@ namespace AppInstaller::CLI::Execution
             Logging::Log().SetLevel(Logging::Level::Verbose);
         }
 
+        // Collect per-task timing data if requested
+        if (Args.Contains(Args::Type::Profile))
+        {
+            EnableProfiling();
+        }
+
         // Disable warnings if requested
         if (Args.Contains(Args::Type::IgnoreWarnings))
         {
@@ -271,9 +278,6 @@ namespace AppInstaller::CLI::Execution
 
     void Context::Checkpoint(std::string_view checkpointName, std::vector<Execution::Data> contextData)
     {
-        UNREFERENCED_PARAMETER(checkpointName);
-        UNREFERENCED_PARAMETER(contextData);
-
         if (!m_checkpointManager)
         {
             m_checkpointManager = std::make_unique<AppInstaller::Checkpoints::CheckpointManager>();
@@ -283,6 +287,10 @@ namespace AppInstaller::CLI::Execution
             AppInstaller::Reboot::RegisterRestartForWER("resume -g " + GetResumeId());
         }
 
-        // TODO: Capture context data for checkpoint.
+        if (!contextData.empty())
+        {
+            auto checkpoint = m_checkpointManager->CreateCheckpoint(checkpointName);
+            Checkpoints::SaveContextDataToCheckpoint(*this, checkpoint, contextData);
+        }
     }
 }
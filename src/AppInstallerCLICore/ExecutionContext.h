@@ -10,6 +10,7 @@
 #include <AppInstallerProgress.h>
 #include <winget/Checkpoint.h>
 
+#include <chrono>
 #include <string_view>
 
 #define WINGET_CATCH_RESULT_EXCEPTION_STORE(exceptionHR)   catch (const wil::ResultException& re) { exceptionHR = re.GetErrorCode(); }
@@ -76,6 +77,9 @@ namespace AppInstaller::CLI::Execution
         RebootRequired = 0x400,
         RegisterResume = 0x800,
         InstallerExecutionUseRepair = 0x1000,
+        // Renders an uncached manifest icon on a background task rather than inline,
+        // for flows that emit it at the end via ShowDeferredIcon.
+        DeferIconDisplay = 0x2000,
     };
 
     DEFINE_ENUM_FLAG_OPERATORS(ContextFlag);
@@ -83,6 +87,19 @@ namespace AppInstaller::CLI::Execution
     // Callback to log data actions.
     void ContextEnumBasedVariantMapActionCallback(const void* map, Data data, EnumBasedVariantMapAction action);
 
+    // A per-task measurement collected when profiling is enabled.
+    struct WorkflowTaskProfile
+    {
+        std::string Name;
+        std::chrono::microseconds WallTime{};
+        std::chrono::microseconds CpuTime{};
+        uint64_t PeakWorkingSetInBytes = 0;
+        // Change in the process's private (committed) memory across the task; an
+        // approximation of what the task allocated and kept, as other threads may
+        // also allocate while it runs.
+        int64_t PrivateUsageDeltaInBytes = 0;
+    };
+
     // The context within which all commands execute.
     // Contains input/output via Execution::Reporter and
     // arguments via Execution::Args.
@@ -162,6 +179,18 @@ namespace AppInstaller::CLI::Execution
 
         std::unique_ptr<AppInstaller::ThreadLocalStorage::PreviousThreadGlobals> SetForCurrentThread();
 
+        // Returns a value indicating whether per-task profiling data should be collected.
+        bool IsProfilingEnabled() const { return m_profilingEnabled; }
+
+        // Enables collection of per-task profiling data.
+        void EnableProfiling() { m_profilingEnabled = true; }
+
+        // Records a profiling measurement for an executed workflow task.
+        void RecordTaskProfile(WorkflowTaskProfile&& profile) { m_taskProfiles.emplace_back(std::move(profile)); }
+
+        // Gets the profiling measurements recorded so far.
+        const std::vector<WorkflowTaskProfile>& GetTaskProfiles() const { return m_taskProfiles; }
+
         // Gets the executing command
         AppInstaller::CLI::Command* GetExecutingCommand() { return m_executingCommand; }
 
@@ -207,5 +236,7 @@ namespace AppInstaller::CLI::Execution
         std::shared_ptr<ThreadLocalStorage::WingetThreadGlobals> m_threadGlobals = std::make_shared<ThreadLocalStorage::WingetThreadGlobals>();
         AppInstaller::CLI::Command* m_executingCommand = nullptr;
         std::unique_ptr<AppInstaller::Checkpoints::CheckpointManager> m_checkpointManager;
+        bool m_profilingEnabled = false;
+        std::vector<WorkflowTaskProfile> m_taskProfiles;
     };
 }
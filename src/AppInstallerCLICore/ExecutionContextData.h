@@ -15,12 +15,18 @@
 #include "ConfigurationContext.h"
 
 #include <filesystem>
+#include <future>
 #include <map>
 #include <string>
 #include <utility>
 #include <variant>
 #include <vector>
 
+namespace AppInstaller::CLI::Workflow
+{
+    struct DependencyNodeMemo;
+}
+
 namespace AppInstaller::CLI::Execution
 {
     // Names a piece of data stored in the context by a workflow step.
@@ -69,11 +75,25 @@ namespace AppInstaller::CLI::Execution
         RepairString,
         MsixDigests,
         InstallerDownloadAuthenticators,
+        // Memoized dependency node evaluations, shared with sub contexts so that a
+        // dependency appearing in multiple package graphs is only resolved once.
+        DependencyNodeResults,
+        // A predefined source open that was started in the background; adopted by OpenPredefinedSource.
+        BackgroundPredefinedSource,
+        // A background render of the manifest icon; emitted by ShowDeferredIcon.
+        DeferredIconSequence,
         Max
     };
 
     struct Context;
 
+    // The in-flight result of a predefined source open started in the background.
+    struct BackgroundPredefinedSourceData
+    {
+        Repository::PredefinedSource PredefinedSource = Repository::PredefinedSource::Installed;
+        std::shared_future<Repository::Source> Source;
+    };
+
     namespace details
     {
         template <Data D>
@@ -299,5 +319,25 @@ namespace AppInstaller::CLI::Execution
             // The authenticator map shared with sub contexts
             using value_t = std::shared_ptr<std::map<Authentication::AuthenticationInfo, Authentication::Authenticator>>;
         };
+
+        template<>
+        struct DataMapping<Data::DependencyNodeResults>
+        {
+            // The dependency evaluation memo shared with sub contexts
+            using value_t = std::shared_ptr<Workflow::DependencyNodeMemo>;
+        };
+
+        template <>
+        struct DataMapping<Data::BackgroundPredefinedSource>
+        {
+            using value_t = BackgroundPredefinedSourceData;
+        };
+
+        template <>
+        struct DataMapping<Data::DeferredIconSequence>
+        {
+            // The rendered sixel sequence; empty if no icon could be produced
+            using value_t = std::future<std::string>;
+        };
     }
 }
@@ -8,6 +8,7 @@
 
 using namespace AppInstaller::Settings;
 using namespace AppInstaller::CLI::VirtualTerminal;
+using namespace std::chrono_literals;
 using namespace std::string_view_literals;
 
 namespace AppInstaller::CLI::Execution
@@ -16,6 +17,10 @@ namespace AppInstaller::CLI::Execution
     {
         static constexpr size_t s_ProgressBarCellWidth = 30;
 
+        // The repaint cadence used when output is redirected (logs, CI); kept very low so
+        // that captured output is not filled with repaint frames.
+        static constexpr std::chrono::milliseconds s_RedirectedFrameInterval{ 3000 };
+
         struct BytesFormatData
         {
             uint64_t PowerOfTwo;
@@ -136,7 +141,7 @@ namespace AppInstaller::CLI::Execution
     struct ProgressVisualizerBase
     {
         ProgressVisualizerBase(BaseStream& stream, bool enableVT) :
-            m_out(stream), m_enableVT(enableVT) {}
+            m_out(stream), m_enableVT(enableVT), m_interactive(GetConsoleWidth().has_value()) {}
 
         void SetMessage(std::string_view message)
         {
@@ -153,6 +158,26 @@ namespace AppInstaller::CLI::Execution
 
         bool VT_Enabled() const { return m_enableVT; }
 
+        // True if the output is going to an interactive console rather than being redirected.
+        bool IsInteractive() const { return m_interactive; }
+
+        // Determines whether a new frame should reach the stream, coalescing updates that
+        // arrive faster than the target cadence. Interactive consoles render at the given
+        // cadence; redirected output renders a small fraction of that.
+        bool ShouldRenderFrame(std::chrono::milliseconds interactiveInterval)
+        {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            std::chrono::milliseconds interval = m_interactive ? interactiveInterval : s_RedirectedFrameInterval;
+
+            if (m_lastFrame != std::chrono::steady_clock::time_point{} && now - m_lastFrame < interval)
+            {
+                return false;
+            }
+
+            m_lastFrame = now;
+            return true;
+        }
+
         void ClearLine()
         {
             if (VT_Enabled())
@@ -175,6 +200,8 @@ namespace AppInstaller::CLI::Execution
 
     private:
         bool m_enableVT = false;
+        bool m_interactive = true;
+        std::chrono::steady_clock::time_point m_lastFrame;
         std::shared_ptr<Utility::NormalizedString> m_message;
     };
 
@@ -259,7 +286,26 @@ namespace AppInstaller::CLI::Execution
             // showing anything, or a progress task to skip straight to progress.
             Sleep(100);
 
-            if (!m_canceled)
+            if (!m_canceled && !IsInteractive())
+            {
+                // Redirected output (logs, CI) gets no spinner frames; the carriage returns
+                // do not overwrite anything there, so each frame would become a line of noise.
+                // Just emit the message as it changes.
+                std::shared_ptr<Utility::NormalizedString> message;
+
+                while (!m_canceled)
+                {
+                    std::shared_ptr<Utility::NormalizedString> newMessage = ProgressVisualizerBase::Message();
+                    if (newMessage && (!message || *message != *newMessage))
+                    {
+                        message = newMessage;
+                        m_out << "  " << *message << std::endl;
+                    }
+
+                    Sleep(250);
+                }
+            }
+            else if (!m_canceled)
             {
                 if (VT_Enabled())
                 {
@@ -324,6 +370,13 @@ namespace AppInstaller::CLI::Execution
             {
                 ClearLine();
             }
+            else if (m_isVisible && (!maximum || current != maximum) && !ShouldRenderFrame(100ms))
+            {
+                // Coalesce updates that arrive faster than the frame cadence;
+                // the final frame always renders so that completed progress is accurate.
+                m_lastCurrent = current;
+                return;
+            }
 
             // TODO: Progress bar does not currently use message
             if (VT_Enabled())
@@ -675,6 +728,13 @@ namespace AppInstaller::CLI::Execution
             {
                 ClearLine();
             }
+            else if (m_isVisible && (!maximum || current != maximum) && !ShouldRenderFrame(100ms))
+            {
+                // Coalesce updates that arrive faster than the frame cadence;
+                // the final frame always renders so that completed progress is accurate.
+                m_lastCurrent = current;
+                return;
+            }
 
             m_out << TextFormat::Default;
 
@@ -187,8 +187,8 @@ namespace AppInstaller::CLI
             return root;
         }
 
-        // Adds a new Package node to a Source node in the Json file, and returns it.
-        Json::Value& AddPackageToSource(Json::Value& sourceNode, const PackageCollection::Package& package)
+        // Creates the JSON node describing a single package.
+        Json::Value CreatePackageNode(const PackageCollection::Package& package)
         {
             const auto& ss = StaticStrings::Instance();
 
@@ -224,22 +224,37 @@ namespace AppInstaller::CLI
                 packageNode[ss.PackagesJson_Package_InitialCustomSwitches] = package.InitialCustomSwitches;
             }
 
-            return sourceNode[ss.PackagesJson_Packages].append(std::move(packageNode));
+            return packageNode;
         }
 
-        // Adds a new Source node to the JSON, and returns it.
-        Json::Value& AddSourceNode(Json::Value& root, const PackageCollection::Source& source)
+        // Adds a new Package node to a Source node in the Json file, and returns it.
+        Json::Value& AddPackageToSource(Json::Value& sourceNode, const PackageCollection::Package& package)
         {
             const auto& ss = StaticStrings::Instance();
+            return sourceNode[ss.PackagesJson_Packages].append(CreatePackageNode(package));
+        }
 
-            Json::Value sourceNode{ Json::ValueType::objectValue };
+        // Creates the JSON node describing a source.
+        Json::Value CreateSourceDetailsNode(const PackageCollection::Source& source)
+        {
+            const auto& ss = StaticStrings::Instance();
 
             Json::Value sourceDetailsNode{ Json::ValueType::objectValue };
             sourceDetailsNode[ss.PackagesJson_Source_Name] = source.Details.Name;
             sourceDetailsNode[ss.PackagesJson_Source_Argument] = source.Details.Arg;
             sourceDetailsNode[ss.PackagesJson_Source_Identifier] = source.Details.Identifier;
             sourceDetailsNode[ss.PackagesJson_Source_Type] = source.Details.Type;
-            sourceNode[ss.PackagesJson_Source_Details] = std::move(sourceDetailsNode);
+
+            return sourceDetailsNode;
+        }
+
+        // Adds a new Source node to the JSON, and returns it.
+        Json::Value& AddSourceNode(Json::Value& root, const PackageCollection::Source& source)
+        {
+            const auto& ss = StaticStrings::Instance();
+
+            Json::Value sourceNode{ Json::ValueType::objectValue };
+            sourceNode[ss.PackagesJson_Source_Details] = CreateSourceDetailsNode(source);
 
             sourceNode[ss.PackagesJson_Packages] = Json::Value{ Json::ValueType::arrayValue };
 
@@ -266,6 +281,72 @@ namespace AppInstaller::CLI
             return root;
         }
 
+        void WriteJson(const PackageCollection& packages, std::ostream& stream)
+        {
+            const auto& ss = StaticStrings::Instance();
+            Json::StreamWriterBuilder writerBuilder;
+
+            auto writeValue = [&](const Json::Value& value)
+            {
+                stream << Json::writeString(writerBuilder, value);
+            };
+
+            auto writeKey = [&](const std::string& key)
+            {
+                writeValue(Json::Value{ key });
+                stream << ':';
+            };
+
+            // The envelope values and each package node are serialized individually so that
+            // the complete document tree never exists in memory at once.
+            Json::Value envelope = CreateRoot(packages.ClientVersion);
+
+            stream << '{';
+
+            for (const auto& memberName : envelope.getMemberNames())
+            {
+                writeKey(memberName);
+                writeValue(envelope[memberName]);
+                stream << ',';
+            }
+
+            writeKey(ss.PackagesJson_Sources);
+            stream << '[';
+
+            bool firstSource = true;
+            for (const auto& source : packages.Sources)
+            {
+                if (!firstSource)
+                {
+                    stream << ',';
+                }
+                firstSource = false;
+
+                stream << '{';
+                writeKey(ss.PackagesJson_Source_Details);
+                writeValue(CreateSourceDetailsNode(source));
+                stream << ',';
+                writeKey(ss.PackagesJson_Packages);
+                stream << '[';
+
+                bool firstPackage = true;
+                for (const auto& package : source.Packages)
+                {
+                    if (!firstPackage)
+                    {
+                        stream << ',';
+                    }
+                    firstPackage = false;
+
+                    writeValue(CreatePackageNode(package));
+                }
+
+                stream << "]}";
+            }
+
+            stream << "]}";
+        }
+
         ParseResult TryParseJson(const Json::Value& root)
         {
             const auto& ss = StaticStrings::Instance();
@@ -7,6 +7,7 @@
 
 #include <json/json.h>
 
+#include <iosfwd>
 #include <vector>
 
 namespace AppInstaller::CLI
@@ -76,6 +77,11 @@ namespace AppInstaller::CLI
         // Converts a collection of packages to its JSON representation for exporting.
         Json::Value CreateJson(const PackageCollection& packages);
 
+        // Writes the JSON representation of a collection of packages to the stream.
+        // Each package node is serialized individually so that the complete document
+        // tree is never materialized in memory.
+        void WriteJson(const PackageCollection& packages, std::ostream& stream);
+
         // Tries to parse a JSON into a collection of packages.
         ParseResult TryParseJson(const Json::Value& root);
     }
@@ -6,6 +6,7 @@
 #include <winget/Manifest.h>
 #include <winget/ManifestCommon.h>
 #include <winget/Filesystem.h>
+#include <winget/ParallelWork.h>
 #include <winget/PathVariable.h>
 #include <winget/PortableIndex.h>
 #include <AppInstallerErrors.h>
@@ -217,12 +218,13 @@ namespace AppInstaller::CLI::Portable
                 PortableIndex existingIndex = PortableIndex::Open(existingIndexPath.u8string(), SQLiteStorageBase::OpenDisposition::ReadWrite);
 
                 std::exception_ptr firstRemoveException;
+                std::vector<AppInstaller::Portable::PortableFileEntry> removedEntries;
                 for (auto expectedEntry : m_expectedEntries)
                 {
                     try
                     {
                         RemoveFile(expectedEntry);
-                        existingIndex.RemovePortableFile(expectedEntry);
+                        removedEntries.emplace_back(std::move(expectedEntry));
                     }
                     catch (...)
                     {
@@ -234,6 +236,11 @@ namespace AppInstaller::CLI::Portable
                         }
                     }
                 }
+
+                // Drop everything that was actually removed from the index in one
+                // transaction; entries whose removal failed stay recorded.
+                existingIndex.RemovePortableFiles(removedEntries);
+
                 if (firstRemoveException)
                 {
                     std::rethrow_exception(firstRemoveException);
@@ -284,9 +291,13 @@ namespace AppInstaller::CLI::Portable
                 PortableIndex::Open(targetIndexPath.u8string(), SQLiteStorageBase::OpenDisposition::ReadWrite) :
                 PortableIndex::CreateNew(targetIndexPath.u8string());
 
+            // Record all of the desired entries up front in a single transaction; committing the
+            // index once per file dominates deployment time for packages with many files, and an
+            // entry recorded before its file is deployed only means uninstall has more to check.
+            targetIndex.AddOrUpdatePortableFiles(m_desiredEntries);
+
             for (auto desiredEntry : m_desiredEntries)
             {
-                targetIndex.AddOrUpdatePortableFile(desiredEntry);
                 InstallFile(desiredEntry);
             }
         }
@@ -301,16 +312,25 @@ namespace AppInstaller::CLI::Portable
 
     bool PortableInstaller::VerifyExpectedState()
     {
-        for (auto entry : m_expectedEntries)
+        // Hashing the files dominates this check; verify the entries in parallel.
+        std::atomic_bool result{ true };
+
+        Parallel::ForEachIndex(m_expectedEntries.size(), [&](size_t index)
         {
+            if (!result)
+            {
+                return;
+            }
+
+            auto& entry = m_expectedEntries[index];
             if (!VerifyPortableFile(entry))
             {
                 AICLI_LOG(CLI, Info, << "Portable file has been modified: " << entry.GetFilePath());
-                return false;
+                result = false;
             }
-        }
+        });
 
-        return true;
+        return result;
     }
 
     void PortableInstaller::Install(Workflow::OperationType operation)
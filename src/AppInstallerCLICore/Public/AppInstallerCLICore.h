@@ -10,6 +10,12 @@ namespace AppInstaller::CLI
     // Initializes the Windows Package Manager COM server.
     void ServerInitialize();
 
+    // Warms the Windows Package Manager COM server by loading settings and policies and
+    // opening the configured sources, which are held for the server lifetime. Intended to
+    // be run on a background thread after the server is registered so that client calls
+    // arriving later do not pay for this initialization.
+    void ServerWarmUp();
+
     // Initializations for InProc invocation.
     void InProcInitialize();
 }
@@ -487,10 +487,12 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(MSStoreStoreClientBlocked);
         WINGET_DEFINE_RESOURCE_STRINGID(MultipleExclusiveArgumentsProvided);
         WINGET_DEFINE_RESOURCE_STRINGID(MultipleInstalledPackagesFound);
+        WINGET_DEFINE_RESOURCE_STRINGID(MultipleInstallersRequireElevation);
         WINGET_DEFINE_RESOURCE_STRINGID(MultiplePackagesFound);
         WINGET_DEFINE_RESOURCE_STRINGID(MultiplePackagesFoundFilteredBySourcePriority);
         WINGET_DEFINE_RESOURCE_STRINGID(MultipleUnsupportedNestedInstallersSpecified);
         WINGET_DEFINE_RESOURCE_STRINGID(MultiQueryArgumentDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(MultiQueryDuplicatePackage);
         WINGET_DEFINE_RESOURCE_STRINGID(MultiQueryPackageAlreadyInstalled);
         WINGET_DEFINE_RESOURCE_STRINGID(MultiQueryPackageNotFound);
         WINGET_DEFINE_RESOURCE_STRINGID(MultiQuerySearchFailed);
@@ -576,6 +578,12 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(PressEnterToContinue);
         WINGET_DEFINE_RESOURCE_STRINGID(PrivacyStatement);
         WINGET_DEFINE_RESOURCE_STRINGID(ProductCodeArgumentDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(ProfileArgumentDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(ProfileCpuTime);
+        WINGET_DEFINE_RESOURCE_STRINGID(ProfileMemoryDelta);
+        WINGET_DEFINE_RESOURCE_STRINGID(ProfilePeakMemory);
+        WINGET_DEFINE_RESOURCE_STRINGID(ProfileTask);
+        WINGET_DEFINE_RESOURCE_STRINGID(ProfileWallTime);
         WINGET_DEFINE_RESOURCE_STRINGID(PromptForInstallRoot);
         WINGET_DEFINE_RESOURCE_STRINGID(PromptOptionNo);
         WINGET_DEFINE_RESOURCE_STRINGID(PromptOptionYes);
@@ -812,6 +820,7 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(UpgradeInstallTechnologyMismatchCount);
         WINGET_DEFINE_RESOURCE_STRINGID(UpgradeIsPinned);
         WINGET_DEFINE_RESOURCE_STRINGID(UpgradePinnedByUserCount);
+        WINGET_DEFINE_RESOURCE_STRINGID(UpgradePrefetchingInstallers);
         WINGET_DEFINE_RESOURCE_STRINGID(UpgradeRequireExplicitCount);
         WINGET_DEFINE_RESOURCE_STRINGID(UpgradeUnknownVersionCount);
         WINGET_DEFINE_RESOURCE_STRINGID(UpgradeUnknownVersionExplanation);
@@ -118,6 +118,23 @@ namespace AppInstaller::CLI::VirtualTerminal::Sixel
                         char sixelBit = 1 << rowOffset;
                         UINT currentRow = m_currentPixelRow + rowOffset;
 
+                        // A single untranslated view can be walked as a contiguous row,
+                        // avoiding the per-pixel view lookup of the general path below.
+                        const BYTE* directRow = (m_views.size() == 1 ? m_views.front().GetRow(currentRow) : nullptr);
+                        if (directRow)
+                        {
+                            UINT rowWidth = std::min(m_renderControls.PixelWidth, m_views.front().Width());
+
+                            for (UINT i = 0; i < rowWidth; ++i)
+                            {
+                                size_t colorIndex = directRow[i];
+                                m_enabledColors[colorIndex] = 1;
+                                m_sixelBuffer[(colorIndex * m_renderControls.PixelWidth) + i] += sixelBit;
+                            }
+
+                            continue;
+                        }
+
                         for (UINT i = 0; i < m_renderControls.PixelWidth; ++i)
                         {
                             const BYTE* pixelPtr = nullptr;
@@ -400,6 +417,16 @@ namespace AppInstaller::CLI::VirtualTerminal::Sixel
         return m_viewBytes + (static_cast<size_t>(viewY) * m_viewStride) + viewX;
     }
 
+    const BYTE* ImageView::GetRow(UINT y) const
+    {
+        if (m_tile || m_translateX || m_translateY || y >= m_viewHeight)
+        {
+            return nullptr;
+        }
+
+        return m_viewBytes + (static_cast<size_t>(y) * m_viewStride);
+    }
+
     UINT ImageView::Width() const
     {
         return m_viewWidth;
@@ -88,6 +88,10 @@ namespace AppInstaller::CLI::VirtualTerminal::Sixel
         // Returns null if the coordinate is outside of the view.
         const BYTE* GetPixel(UINT x, UINT y) const;
 
+        // Gets a pointer to the contiguous pixel row at the given y coordinate.
+        // Returns null when the view is translated or tiled, as its rows cannot be walked directly.
+        const BYTE* GetRow(UINT y) const;
+
         // Get the dimensions of the view.
         UINT Width() const;
         UINT Height() const;
@@ -6,6 +6,7 @@
 
 #include <array>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,7 @@ namespace AppInstaller::CLI::Execution
     {
         using header_t = std::array<Resource::LocString, FieldCount>;
         using line_t = std::array<std::string, FieldCount>;
+        using widths_t = std::array<size_t, FieldCount>;
 
         TableOutput(Reporter& reporter, header_t&& header) :
             m_reporter(reporter),
@@ -36,11 +38,20 @@ namespace AppInstaller::CLI::Execution
         {
             m_empty = false;
 
+            // Measure each cell once on the way in; the display width computation normalizes
+            // and walks the string with ICU, so it is too expensive to repeat at output time.
+            widths_t widths;
+            for (size_t i = 0; i < FieldCount; ++i)
+            {
+                widths[i] = Utility::UTF8ColumnWidth(line[i]);
+            }
+
             // Always buffer every row so that column widths are computed from the full dataset
             // before any output is written. This guarantees that the widest value in any column
             // is always fully visible and columns are perfectly aligned, whether output goes to
             // a console or is redirected. Complete() triggers the actual output.
             m_buffer.emplace_back(std::move(line));
+            m_widths.emplace_back(widths);
         }
 
         void Complete()
@@ -69,6 +80,7 @@ namespace AppInstaller::CLI::Execution
         Reporter& m_reporter;
         std::array<Column, FieldCount> m_columns;
         std::vector<line_t> m_buffer;
+        std::vector<widths_t> m_widths;
         bool m_bufferEvaluated = false;
         bool m_empty = true;
         bool m_hasConsole = false;
@@ -80,12 +92,12 @@ namespace AppInstaller::CLI::Execution
                 return;
             }
 
-            // Determine the maximum length for all columns
-            for (const auto& line : m_buffer)
+            // Determine the maximum length for all columns from the cached cell widths
+            for (const auto& widths : m_widths)
             {
                 for (size_t i = 0; i < FieldCount; ++i)
                 {
-                    m_columns[i].MaxLength = std::max(m_columns[i].MaxLength, Utility::UTF8ColumnWidth(line[i]));
+                    m_columns[i].MaxLength = std::max(m_columns[i].MaxLength, widths[i]);
                 }
             }
 
@@ -152,67 +164,79 @@ namespace AppInstaller::CLI::Execution
                 totalRequired = *consoleWidthOpt - 1;
             }
 
-            // Header line
+            // Compose the entire frame into a single preallocated buffer so that it reaches
+            // the console host in one write; emitting cell-by-cell with a flush per line is
+            // noticeably slow over ConPTY and SSH for large tables.
+            std::string frame;
+            // Each row is at most the total width plus a newline; the header and separator
+            // account for the two extra rows.
+            frame.reserve((totalRequired + 1) * (m_buffer.size() + 2));
+
+            // Header line; the column widths were measured at construction
             line_t headerLine;
+            widths_t headerWidths;
 
             for (size_t i = 0; i < FieldCount; ++i)
             {
                 headerLine[i] = m_columns[i].Name.get();
+                headerWidths[i] = m_columns[i].MinLength;
             }
 
-            OutputLineToStream(headerLine);
+            AppendLine(frame, headerLine, headerWidths);
 
-            m_reporter.Info() << std::string(totalRequired, '-') << std::endl;
+            frame.append(totalRequired, '-');
+            frame.push_back('\n');
 
-            for (const auto& line : m_buffer)
+            for (size_t lineIndex = 0; lineIndex < m_buffer.size(); ++lineIndex)
             {
-                OutputLineToStream(line);
+                AppendLine(frame, m_buffer[lineIndex], m_widths[lineIndex]);
             }
 
+            m_reporter.Info() << std::move(frame) << std::flush;
+
             m_bufferEvaluated = true;
         }
 
-        void OutputLineToStream(const line_t& line)
+        void AppendLine(std::string& out, const line_t& line, const widths_t& widths)
         {
-            auto out = m_reporter.Info();
-
             for (size_t i = 0; i < FieldCount; ++i)
             {
                 const auto& col = m_columns[i];
 
                 if (col.MaxLength)
                 {
-                    size_t valueLength = Utility::UTF8ColumnWidth(line[i]);
+                    size_t valueLength = widths[i];
 
                     if (valueLength > col.MaxLength)
                     {
                         size_t actualWidth;
-                        out << Utility::UTF8TrimRightToColumnWidth(line[i], col.MaxLength - 1, actualWidth) << "\xE2\x80\xA6"; // UTF8 encoding of ellipsis (…) character
+                        out += Utility::UTF8TrimRightToColumnWidth(line[i], col.MaxLength - 1, actualWidth);
+                        out += "\xE2\x80\xA6"; // UTF8 encoding of ellipsis (…) character
 
                         // Some characters take 2 unit space, the trimmed string length might be 1 less than the expected length.
                         if (actualWidth != col.MaxLength - 1)
                         {
-                            out << ' ';
+                            out.push_back(' ');
                         }
 
                         if (col.SpaceAfter)
                         {
-                            out << ' ';
+                            out.push_back(' ');
                         }
                     }
                     else
                     {
-                        out << line[i];
+                        out += line[i];
 
                         if (col.SpaceAfter)
                         {
-                            out << std::string(col.MaxLength - valueLength + 1, ' ');
+                            out.append(col.MaxLength - valueLength + 1, ' ');
                         }
                     }
                 }
             }
 
-            out << std::endl;
+            out.push_back('\n');
         }
     };
 }
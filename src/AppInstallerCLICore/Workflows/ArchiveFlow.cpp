@@ -60,7 +60,35 @@ namespace AppInstaller::CLI::Workflow
         }
         else
         {
-            HRESULT result = AppInstaller::Archive::TryExtractArchive(installerPath, destinationFolder);
+            HRESULT result = E_FAIL;
+            bool extractedNestedInstallerFiles = false;
+
+            // Large archives routinely carry a small relevant payload; try pulling just the
+            // manifest listed entries out via the central directory before extracting everything.
+            const auto& installer = context.Get<Execution::Data::Installer>().value();
+            if (!installer.NestedInstallerFiles.empty())
+            {
+                std::vector<std::string> relativeFilePaths;
+                for (const auto& nestedInstallerFile : installer.NestedInstallerFiles)
+                {
+                    relativeFilePaths.emplace_back(nestedInstallerFile.RelativeFilePath);
+                }
+
+                result = AppInstaller::Archive::TryExtractFilesFromZipArchive(installerPath, destinationFolder, relativeFilePaths);
+                if (SUCCEEDED(result))
+                {
+                    extractedNestedInstallerFiles = true;
+                }
+                else
+                {
+                    AICLI_LOG(CLI, Info, << "Direct zip extraction not applicable with code " << result << "; extracting full archive");
+                }
+            }
+
+            if (!extractedNestedInstallerFiles)
+            {
+                result = AppInstaller::Archive::TryExtractArchive(installerPath, destinationFolder);
+            }
 
             if (SUCCEEDED(result))
             {
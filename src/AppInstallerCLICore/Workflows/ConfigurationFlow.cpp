@@ -2204,6 +2204,28 @@ namespace AppInstaller::CLI::Workflow
                 return "None";
             }
         }
+
+        // Determines whether the apply pass can be skipped entirely when a batched test
+        // pass reports the whole set compliant. Sets containing units that must always be
+        // invoked during apply (Inform intents, inactive units, groups, or set level
+        // commands) are excluded, as dropping the apply pass would change their behavior.
+        bool CanSkipApplyWhenCompliant(const ConfigurationSet& configurationSet)
+        {
+            constexpr std::wstring_view s_UnitType_RunCommandOnSet = L"Microsoft.DSC.Transitional/RunCommandOnSet";
+
+            for (const auto& unit : configurationSet.Units())
+            {
+                if (!unit.IsActive() ||
+                    unit.IsGroup() ||
+                    unit.Intent() == ConfigurationUnitIntent::Inform ||
+                    Utility::CaseInsensitiveEquals(s_UnitType_RunCommandOnSet, unit.Type()))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
     }
 
     void CreateConfigurationProcessor(Context& context)
@@ -2389,6 +2411,29 @@ namespace AppInstaller::CLI::Workflow
         ApplyConfigurationSetResult result = nullptr;
         ConfigurationContext& configContext = context.Get<Data::ConfigurationContext>();
 
+        // On mostly compliant machines a batched test pass is cheaper than interleaving
+        // Test and Apply calls for every unit; when it reports the whole set already in
+        // the desired state, the apply pass is skipped entirely.
+        if (anon::CanSkipApplyWhenCompliant(configContext.Set()))
+        {
+            TestConfigurationSetResult testResult = nullptr;
+
+            {
+                auto testOperation = configContext.Processor().TestSetAsync(configContext.Set());
+                anon::TestConfigurationSetProgressOutput progress{ context, testOperation };
+
+                testResult = testOperation.get();
+                progress.HandleUnreportedProgress(testResult);
+            }
+
+            if (testResult.TestResult() == ConfigurationTestResult::Positive)
+            {
+                context.Reporter.Info() << Resource::String::ConfigurationInDesiredState << std::endl;
+                context.Reporter.Info() << Resource::String::ConfigurationSuccessfullyApplied << std::endl;
+                return;
+            }
+        }
+
         {
             auto applyOperation = configContext.Processor().ApplySetAsync(configContext.Set(), ApplyConfigurationSetFlags::None);
             anon::ApplyConfigurationSetProgressOutput progress{ context, applyOperation };
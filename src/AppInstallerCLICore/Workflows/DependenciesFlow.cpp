@@ -241,6 +241,11 @@ namespace AppInstaller::CLI::Workflow
         }
     }
 
+    void InitializeDependencyNodeResultsMap(Execution::Context& context)
+    {
+        context.Add<Execution::Data::DependencyNodeResults>(std::make_shared<DependencyNodeMemo>());
+    }
+
     void CreateDependencySubContexts::operator()(Execution::Context& context) const
     {
         if (Settings::User().Get<Settings::Setting::InstallSkipDependencies>() || context.Args.Contains(Execution::Args::Type::SkipDependencies))
@@ -270,15 +275,25 @@ namespace AppInstaller::CLI::Workflow
             AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_INTERNAL_ERROR); 
         }
 
+        // Create the evaluation memo if an outer flow has not already shared one.
+        if (!context.Contains(Execution::Data::DependencyNodeResults))
+        {
+            InitializeDependencyNodeResultsMap(context);
+        }
+
         std::map<string_t, DependencyPackageCandidate> idToPackageMap;
         bool foundError = false;
-        DependencyGraph dependencyGraph(rootAsDependency, rootDependencies, 
+        // Nodes may be evaluated on concurrent threads; guards the shared results above.
+        std::mutex resultsLock;
+        DependencyGraph dependencyGraph(rootAsDependency, rootDependencies,
             [&](Dependency node)
             {
                 DependencyNodeProcessor nodeProcessor(context);
 
                 auto result = nodeProcessor.EvaluateDependencies(node);
                 DependencyList list = nodeProcessor.GetDependencyList();
+
+                std::lock_guard<std::mutex> lock{ resultsLock };
                 foundError = foundError || (result == DependencyNodeProcessorResult::Error);
 
                 if (result == DependencyNodeProcessorResult::Success)
@@ -295,7 +310,7 @@ namespace AppInstaller::CLI::Workflow
                 return list;
             });
 
-        dependencyGraph.BuildGraph();
+        dependencyGraph.BuildGraph(true);
 
         if (foundError)
         {
@@ -335,11 +350,12 @@ namespace AppInstaller::CLI::Workflow
                     itr->second.Manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>(),
                     itr->second.Manifest.Version);
 
-                // Extract the data needed for installing
-                dependencyContext.Add<Execution::Data::PackageVersion>(itr->second.PackageVersion);
-                dependencyContext.Add<Execution::Data::Manifest>(itr->second.Manifest);
-                dependencyContext.Add<Execution::Data::InstalledPackageVersion>(itr->second.InstalledPackageVersion);
-                dependencyContext.Add<Execution::Data::Installer>(itr->second.Installer);
+                // Extract the data needed for installing; each node appears once in the
+                // installation order, so the candidate data can be moved into the sub-context.
+                dependencyContext.Add<Execution::Data::PackageVersion>(std::move(itr->second.PackageVersion));
+                dependencyContext.Add<Execution::Data::Manifest>(std::move(itr->second.Manifest));
+                dependencyContext.Add<Execution::Data::InstalledPackageVersion>(std::move(itr->second.InstalledPackageVersion));
+                dependencyContext.Add<Execution::Data::Installer>(std::move(itr->second.Installer));
 
                 if (WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::InstallerDownloadOnly))
                 {
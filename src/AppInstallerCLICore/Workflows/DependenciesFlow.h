@@ -39,6 +39,13 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: Dependencies
     void GetDependenciesInfoForUninstall(Execution::Context& context);
 
+    // Creates the memo shared by dependency node evaluations in this context and its
+    // sub contexts, so that a dependency shared by several packages is only resolved once.
+    // Required Args: None
+    // Inputs: None
+    // Outputs: DependencyNodeResults
+    void InitializeDependencyNodeResultsMap(Execution::Context& context);
+
     // Builds the dependency graph and creates the sub contexts for each package dependency.
     // Required Args: None
     // Inputs: Manifest, Installer and DependencySource
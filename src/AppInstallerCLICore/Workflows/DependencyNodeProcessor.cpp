@@ -11,10 +11,67 @@ using namespace AppInstaller::Repository;
 
 namespace AppInstaller::CLI::Workflow
 {
+    namespace
+    {
+        // Builds the memo key for a dependency node; evaluations are only equivalent
+        // for the same source, package id and minimum version requirement.
+        std::string GetDependencyMemoKey(const Source& source, const Dependency& dependencyNode)
+        {
+            std::string result = source.GetIdentifier();
+            result.push_back('\0');
+            result += Utility::FoldCase(std::string_view{ dependencyNode.Id() });
+            result.push_back('\0');
+
+            if (dependencyNode.MinVersion)
+            {
+                result += dependencyNode.MinVersion->ToString();
+            }
+
+            return result;
+        }
+    }
+
     DependencyNodeProcessor::DependencyNodeProcessor(Execution::Context& context)
         : m_context(context) {}
 
     DependencyNodeProcessorResult DependencyNodeProcessor::EvaluateDependencies(Dependency& dependencyNode)
+    {
+        std::shared_ptr<DependencyNodeMemo> memo;
+        std::string memoKey;
+
+        if (m_context.Contains(Execution::Data::DependencyNodeResults))
+        {
+            memo = m_context.Get<Execution::Data::DependencyNodeResults>();
+            memoKey = GetDependencyMemoKey(m_context.Get<Execution::Data::DependencySource>(), dependencyNode);
+
+            std::lock_guard<std::mutex> lock{ memo->Lock };
+            auto itr = memo->Entries.find(memoKey);
+            if (itr != memo->Entries.end())
+            {
+                AICLI_LOG(CLI, Verbose, << "Using memoized dependency evaluation for package " << dependencyNode.Id());
+                m_dependenciesList = itr->second.Dependencies;
+                m_nodePackageLatestVersion = itr->second.PackageLatestVersion;
+                m_nodePackageInstalledVersion = itr->second.PackageInstalledVersion;
+                m_nodeManifest = itr->second.Manifest;
+                m_installer = itr->second.Installer;
+                return itr->second.Result;
+            }
+        }
+
+        DependencyNodeProcessorResult result = EvaluateDependenciesInternal(dependencyNode);
+
+        if (memo)
+        {
+            DependencyNodeMemo::Entry entry{ result, m_dependenciesList, m_nodePackageLatestVersion, m_nodePackageInstalledVersion, m_nodeManifest, m_installer };
+
+            std::lock_guard<std::mutex> lock{ memo->Lock };
+            memo->Entries.emplace(std::move(memoKey), std::move(entry));
+        }
+
+        return result;
+    }
+
+    DependencyNodeProcessorResult DependencyNodeProcessor::EvaluateDependenciesInternal(Dependency& dependencyNode)
     {
         SearchRequest searchRequest;
         const auto& source = m_context.Get<Execution::Data::DependencySource>();
@@ -17,6 +17,27 @@ namespace AppInstaller::CLI::Workflow
         Skipped,
     };
 
+    // Memoized dependency node evaluations, keyed by source, id and minimum version.
+    // Shared across the dependency graph builds of a context and its sub contexts so
+    // that a dependency appearing in multiple package graphs is only resolved against
+    // the source once.
+    struct DependencyNodeMemo
+    {
+        struct Entry
+        {
+            DependencyNodeProcessorResult Result = DependencyNodeProcessorResult::Error;
+            DependencyList Dependencies;
+            std::shared_ptr<IPackageVersion> PackageLatestVersion;
+            std::shared_ptr<IPackageVersion> PackageInstalledVersion;
+            Manifest::Manifest Manifest;
+            Manifest::ManifestInstaller Installer;
+        };
+
+        // Guards Entries; nodes may be evaluated on concurrent threads.
+        std::mutex Lock;
+        std::map<std::string, Entry> Entries;
+    };
+
     struct DependencyNodeProcessor
     {
         DependencyNodeProcessor(Execution::Context& context);
@@ -29,11 +50,15 @@ namespace AppInstaller::CLI::Workflow
 
         std::shared_ptr<IPackageVersion> GetPackageInstalledVersion() { return m_nodePackageInstalledVersion; }
 
-        Manifest::Manifest GetManifest() { return m_nodeManifest;  }
+        // The processor is consumed after evaluation, so the manifest and installer are moved out rather than copied.
+        Manifest::Manifest GetManifest() { return std::move(m_nodeManifest); }
 
-        Manifest::ManifestInstaller GetPreferredInstaller() { return m_installer; }
+        Manifest::ManifestInstaller GetPreferredInstaller() { return std::move(m_installer); }
 
     private:
+        // Performs the actual source search and installer selection for the node.
+        DependencyNodeProcessorResult EvaluateDependenciesInternal(Dependency& dependencyNode);
+
         Execution::Context& m_context;
         DependencyList m_dependenciesList;
         std::shared_ptr<IPackageVersion> m_nodePackageLatestVersion;
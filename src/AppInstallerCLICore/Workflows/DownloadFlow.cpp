@@ -12,6 +12,7 @@
 #include <winget/GroupPolicy.h>
 #include <winget/ManifestYamlWriter.h>
 #include <winget/NetworkSettings.h>
+#include <winget/SharedThreadGlobals.h>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -29,6 +30,14 @@ namespace AppInstaller::CLI::Workflow
         constexpr std::string_view s_AzureBlobStorageApiVersionHeader = "x-ms-version"sv;
         constexpr std::string_view s_AzureBlobStorageApiVersionValue = "2020-04-08"sv;
 
+        // One foreground download plus this many background prefetches mirrors the
+        // COM orchestrator's download queue width.
+        constexpr size_t s_PrefetchWorkerCount = 2;
+
+        // Prefetched installers are downloaded under this extension and only renamed
+        // to their final name once complete and hash verified.
+        constexpr std::wstring_view s_PrefetchFileExtension = L".prefetch"sv;
+
         // Get the base download directory path for the installer.
         // Also creates the directory as necessary.
         std::filesystem::path GetInstallerBaseDownloadPath(Execution::Context& context)
@@ -696,7 +705,17 @@ namespace AppInstaller::CLI::Workflow
             }
 
             renamedDownloadedInstaller = downloadDirectory / GetInstallerDownloadOnlyFileName(context);
-            Filesystem::RenameFile(installerPath, renamedDownloadedInstaller);
+
+            // Moving to the download directory may cross volumes and degrade to copying a
+            // multi-gigabyte installer; report progress and allow cancellation while it runs.
+            context.Reporter.ExecuteWithProgress([&](IProgressCallback& progress)
+                {
+                    Filesystem::RenameFile(installerPath, renamedDownloadedInstaller, [&progress](uint64_t bytesCopied, uint64_t totalBytes)
+                        {
+                            progress.OnProgress(bytesCopied, totalBytes, ProgressType::Bytes);
+                            return !progress.IsCancelledBy(CancelReason::Any);
+                        });
+                });
             context.Reporter.Info() << Resource::String::InstallerDownloaded(Utility::LocIndView{ renamedDownloadedInstaller.u8string() }) << std::endl;
         }
         else
@@ -791,4 +810,229 @@ namespace AppInstaller::CLI::Workflow
     {
         context.Add<Execution::Data::InstallerDownloadAuthenticators>(std::make_shared<std::map<Authentication::AuthenticationInfo, Authentication::Authenticator>>());
     }
+
+    bool IsInstallerDownloadPresent(Execution::Context& context)
+    {
+        if (!context.Contains(Execution::Data::Installer) || !context.Contains(Execution::Data::Manifest))
+        {
+            return false;
+        }
+
+        const auto& installer = context.Get<Execution::Data::Installer>();
+        if (!installer || installer->Url.empty() || installer->Sha256.empty())
+        {
+            return false;
+        }
+
+        try
+        {
+            return std::filesystem::exists(GetInstallerBaseDownloadPath(context) / GetInstallerPreHashValidationFileName(context));
+        }
+        CATCH_LOG();
+
+        return false;
+    }
+
+    InstallerPrefetcher::InstallerPrefetcher(std::vector<std::unique_ptr<Execution::Context>>& packageSubContexts, PrefetchOptions options) :
+        m_options(options)
+    {
+        // When the foreground flow downloads the first sub context right away, start at the second.
+        for (size_t contextIndex = m_options.SkipFirstContext ? 1 : 0; contextIndex < packageSubContexts.size(); ++contextIndex)
+        {
+            AddItem(*packageSubContexts[contextIndex]);
+        }
+
+        Start();
+    }
+
+    InstallerPrefetcher::InstallerPrefetcher(Execution::Context& singlePackageContext)
+    {
+        AddItem(singlePackageContext);
+        Start();
+    }
+
+    void InstallerPrefetcher::AddItem(Execution::Context& context)
+    {
+        if (!context.Contains(Execution::Data::Installer) || !context.Contains(Execution::Data::Manifest))
+        {
+            return;
+        }
+
+        const auto& installer = context.Get<Execution::Data::Installer>();
+        if (!installer || installer->Url.empty() || installer->Sha256.empty())
+        {
+            return;
+        }
+
+        // Authentication may require user interaction, and MSStore / streamed MSIX
+        // installs do not download a plain installer file; leave those to the
+        // foreground flow.
+        if (installer->AuthInfo.Type != Authentication::AuthenticationType::None)
+        {
+            return;
+        }
+
+        switch (installer->BaseInstallerType)
+        {
+        case InstallerTypeEnum::Exe:
+        case InstallerTypeEnum::Burn:
+        case InstallerTypeEnum::Inno:
+        case InstallerTypeEnum::Msi:
+        case InstallerTypeEnum::Nullsoft:
+        case InstallerTypeEnum::Portable:
+        case InstallerTypeEnum::Wix:
+        case InstallerTypeEnum::Zip:
+            break;
+        default:
+            return;
+        }
+
+        PrefetchItem item;
+        item.Url = installer->Url;
+        item.Sha256 = installer->Sha256;
+        item.TargetPath = GetInstallerBaseDownloadPath(context) / GetInstallerPreHashValidationFileName(context);
+        item.Info.DisplayName = Resource::GetFixedString(Resource::FixedString::ProductName);
+        // Use the SHA256 hash of the installer as the identifier for the download
+        item.Info.ContentId = SHA256::ConvertToString(installer->Sha256);
+        item.Info.BackgroundPriority = m_options.BackgroundPriority;
+        m_items.push_back(std::move(item));
+    }
+
+    void InstallerPrefetcher::Start()
+    {
+        if (m_items.empty())
+        {
+            return;
+        }
+
+        size_t workerCount = std::min(s_PrefetchWorkerCount, m_items.size());
+
+        // Fully populate the progress vector before any worker can index into it.
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            m_progress.emplace_back(std::make_unique<ProgressCallback>());
+        }
+
+        ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(std::async(std::launch::async, [this, i, callerGlobals]()
+                {
+                    std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                    if (callerGlobals)
+                    {
+                        previousGlobals = callerGlobals->SetForCurrentThread();
+                    }
+
+                    RunWorker(i);
+                }));
+        }
+    }
+
+    InstallerPrefetcher::~InstallerPrefetcher()
+    {
+        CancelAndWait();
+    }
+
+    void InstallerPrefetcher::CancelAndWait()
+    {
+        m_cancelled = true;
+
+        for (const auto& progress : m_progress)
+        {
+            progress->Cancel(CancelReason::Abort);
+        }
+
+        for (auto& worker : m_workers)
+        {
+            try
+            {
+                worker.get();
+            }
+            CATCH_LOG();
+        }
+
+        m_workers.clear();
+    }
+
+    void InstallerPrefetcher::Wait(IProgressCallback& progress)
+    {
+        for (const auto& worker : m_workers)
+        {
+            while (worker.wait_for(std::chrono::milliseconds{ 250 }) != std::future_status::ready)
+            {
+                if (progress.IsCancelledBy(CancelReason::Any))
+                {
+                    CancelAndWait();
+                    return;
+                }
+            }
+        }
+
+        // All workers are done; this just collects their results.
+        CancelAndWait();
+    }
+
+    void InstallerPrefetcher::Discard()
+    {
+        CancelAndWait();
+
+        // Only remove files this prefetcher placed; a file that already existed may be
+        // a download the user made deliberately.
+        for (const PrefetchItem& item : m_items)
+        {
+            if (item.Published)
+            {
+                try
+                {
+                    std::filesystem::remove(item.TargetPath);
+                    AICLI_LOG(CLI, Info, << "Discarded prefetched installer " << item.TargetPath);
+                }
+                CATCH_LOG();
+            }
+        }
+    }
+
+    void InstallerPrefetcher::RunWorker(size_t workerIndex)
+    {
+        while (!m_cancelled)
+        {
+            size_t index = m_nextItem++;
+            if (index >= m_items.size())
+            {
+                break;
+            }
+
+            PrefetchItem& item = m_items[index];
+
+            try
+            {
+                if (std::filesystem::exists(item.TargetPath))
+                {
+                    continue;
+                }
+
+                // Download to a temporary name so that the foreground flow only ever
+                // sees complete, verified files.
+                std::filesystem::path temporaryPath = item.TargetPath;
+                temporaryPath += s_PrefetchFileExtension;
+
+                auto downloadResult = Utility::Download(item.Url, temporaryPath, Utility::DownloadType::Installer, *m_progress[workerIndex], item.Info);
+
+                if (!downloadResult.Sha256Hash.empty() && SHA256::AreEqual(downloadResult.Sha256Hash, item.Sha256))
+                {
+                    std::filesystem::rename(temporaryPath, item.TargetPath);
+                    item.Published = true;
+                    AICLI_LOG(CLI, Info, << "Prefetched installer to " << item.TargetPath);
+                }
+                else
+                {
+                    // Cancelled or hash mismatch; the foreground download will handle reporting.
+                    std::filesystem::remove(temporaryPath);
+                }
+            }
+            CATCH_LOG();
+        }
+    }
 }
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #pragma once
 #include "ExecutionContext.h"
+#include <AppInstallerDownloader.h>
+#include <AppInstallerSHA256.h>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -92,4 +94,77 @@ namespace AppInstaller::CLI::Workflow
     // Inputs: None
     // Outputs: New empty InstallerDownloadAuthenticators
     void InitializeInstallerDownloadAuthenticatorsMap(Execution::Context& context);
+
+    // Determines whether a complete installer file is already on disk for the context's
+    // selected installer, such as one published by the InstallerPrefetcher. The file's
+    // hash is still verified by the normal download flow before it is used.
+    bool IsInstallerDownloadPresent(Execution::Context& context);
+
+    // Downloads the installers for the given package sub contexts in the background so that
+    // the serial per-package flow picks them up from disk via CheckForExistingInstaller.
+    // Prefetch failures are only logged; the per-package download remains the one that
+    // reports progress and errors to the user.
+    struct InstallerPrefetcher
+    {
+        // Controls how the prefetcher schedules its downloads.
+        struct PrefetchOptions
+        {
+            // Skips the first sub context, for flows where the foreground download starts on it right away.
+            bool SkipFirstContext = true;
+            // Requests background priority from the downloader (only honored by Delivery
+            // Optimization), keeping prefetch traffic from competing with interactive use.
+            bool BackgroundPriority = false;
+        };
+
+        // Begins prefetching installers for the given package sub contexts.
+        InstallerPrefetcher(std::vector<std::unique_ptr<Execution::Context>>& packageSubContexts, PrefetchOptions options = {});
+
+        // Begins prefetching the given context's selected installer; used while a prompt
+        // awaits user input so that an accepted install does not start the download cold.
+        explicit InstallerPrefetcher(Execution::Context& singlePackageContext);
+
+        // Cancels any remaining work and waits for the workers to complete.
+        ~InstallerPrefetcher();
+
+        InstallerPrefetcher(const InstallerPrefetcher&) = delete;
+        InstallerPrefetcher& operator=(const InstallerPrefetcher&) = delete;
+
+        // Cancels any remaining work and removes installer files this prefetcher published;
+        // used when the user declines the install that the prefetch was speculating on.
+        void Discard();
+
+        // Waits for all prefetch work to complete, cancelling it if the progress is cancelled.
+        void Wait(IProgressCallback& progress);
+
+    private:
+        // A single installer download to perform.
+        struct PrefetchItem
+        {
+            std::string Url;
+            Utility::SHA256::HashBuffer Sha256;
+            std::filesystem::path TargetPath;
+            Utility::DownloadInfo Info;
+            // Set by the worker when the downloaded file is moved to the target path.
+            bool Published = false;
+        };
+
+        // Adds a prefetch item for the context's selected installer if it is eligible.
+        void AddItem(Execution::Context& context);
+
+        // Starts the workers for the collected items.
+        void Start();
+
+        // Cancels any remaining work and waits for the workers to complete.
+        void CancelAndWait();
+
+        // Runs prefetch items until none remain or the prefetcher is cancelled.
+        void RunWorker(size_t workerIndex);
+
+        PrefetchOptions m_options;
+        std::vector<PrefetchItem> m_items;
+        std::atomic_size_t m_nextItem{ 0 };
+        std::atomic_bool m_cancelled{ false };
+        std::vector<std::unique_ptr<ProgressCallback>> m_progress;
+        std::vector<std::future<void>> m_workers;
+    };
 }
@@ -58,40 +58,44 @@ namespace AppInstaller::CLI::Workflow
             return std::find_if(sources.begin(), sources.end(), GetSourceDetailsEquivalencePredicate<T>(details));
         }
 
-        // Gets the available version of an installed package.
-        // If requested, checks that the installed version is available and reports a warning if it is not.
-        std::shared_ptr<IPackageVersion> GetAvailableVersionForInstalledPackage(
-            Execution::Context& context,
-            std::shared_ptr<ICompositePackage> package,
-            Utility::LocIndView version,
-            Utility::LocIndView channel,
-            bool checkVersion)
+        // The resolved correlation data for a single installed package.
+        struct ExportCandidate
         {
+            std::shared_ptr<IPackageVersion> InstalledVersion;
+            Utility::LocIndString Version;
+            Utility::LocIndString Channel;
+            std::shared_ptr<IPackageVersion> AvailableVersion;
+            // The installed version was requested but not available; AvailableVersion holds the latest instead.
+            bool InstalledVersionNotAvailable = false;
+        };
+
+        // Correlates an installed package against the available sources.
+        // Performs only source queries so that it can run on a worker thread;
+        // any reporting on the result happens on the calling thread.
+        ExportCandidate CreateExportCandidate(const std::shared_ptr<ICompositePackage>& package, bool checkVersion)
+        {
+            ExportCandidate candidate;
+            candidate.InstalledVersion = GetInstalledVersion(package);
+            candidate.Version = candidate.InstalledVersion->GetProperty(PackageVersionProperty::Version);
+            candidate.Channel = candidate.InstalledVersion->GetProperty(PackageVersionProperty::Channel);
+
             std::shared_ptr<IPackageVersionCollection> availableVersions = GetAvailableVersionsForInstalledVersion(package);
 
-            if (!checkVersion)
+            if (checkVersion)
             {
-                return availableVersions->GetLatestVersion();
-            }
-
-            auto availablePackageVersion = availableVersions->GetVersion({ "", version, channel });
-            if (!availablePackageVersion)
-            {
-                availablePackageVersion = availableVersions->GetLatestVersion();
-                if (availablePackageVersion)
+                candidate.AvailableVersion = availableVersions->GetVersion({ "", candidate.Version.get(), candidate.Channel.get() });
+                if (!candidate.AvailableVersion)
                 {
-                    // Warn installed version is not available.
-                    AICLI_LOG(
-                        CLI,
-                        Info,
-                        << "Installed package version is not available."
-                        << " Package Id [" << availablePackageVersion->GetProperty(PackageVersionProperty::Id) << "], Version [" << version << "], Channel [" << channel << "]"
-                        << ". Found Version [" << availablePackageVersion->GetProperty(PackageVersionProperty::Version) << "], Channel [" << availablePackageVersion->GetProperty(PackageVersionProperty::Version) << "]");
-                    context.Reporter.Warn() << Resource::String::InstalledPackageVersionNotAvailable(availablePackageVersion->GetProperty(PackageVersionProperty::Id), version, channel) << std::endl;
+                    candidate.AvailableVersion = availableVersions->GetLatestVersion();
+                    candidate.InstalledVersionNotAvailable = candidate.AvailableVersion != nullptr;
                 }
             }
+            else
+            {
+                candidate.AvailableVersion = availableVersions->GetLatestVersion();
+            }
 
-            return availablePackageVersion;
+            return candidate;
         }
     }
 
@@ -99,17 +103,59 @@ namespace AppInstaller::CLI::Workflow
     {
         const auto& searchResult = context.Get<Execution::Data::SearchResult>();
         const bool includeVersions = context.Args.Contains(Execution::Args::Type::IncludeVersions);
+
+        // Correlating each installed package against the available sources is almost entirely
+        // waiting on source queries. Resolve the candidates on a bounded set of workers, each
+        // writing only to its own slot, then build the collection serially and in the original
+        // order so that the reported warnings and the exported file remain deterministic.
+        const size_t matchCount = searchResult.Matches.size();
+        std::vector<ExportCandidate> candidates(matchCount);
+
+        size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency(), matchCount);
+        if (threadCount > 1)
+        {
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+            std::atomic_size_t nextMatch{ 0 };
+
+            std::vector<std::future<void>> futures;
+            for (size_t thread = 0; thread < threadCount; ++thread)
+            {
+                futures.emplace_back(std::async(std::launch::async, [&, callerGlobals]()
+                    {
+                        std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                        if (callerGlobals)
+                        {
+                            previousGlobals = callerGlobals->SetForCurrentThread();
+                        }
+
+                        for (size_t i = nextMatch++; i < matchCount; i = nextMatch++)
+                        {
+                            candidates[i] = CreateExportCandidate(searchResult.Matches[i].Package, includeVersions);
+                        }
+                    }));
+            }
+
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < matchCount; ++i)
+            {
+                candidates[i] = CreateExportCandidate(searchResult.Matches[i].Package, includeVersions);
+            }
+        }
+
         PackageCollection exportedPackages;
         exportedPackages.ClientVersion = Runtime::GetClientVersion().get();
         auto& exportedSources = exportedPackages.Sources;
-        for (const auto& packageMatch : searchResult.Matches)
+        for (const auto& candidate : candidates)
         {
-            auto installedPackageVersion = GetInstalledVersion(packageMatch.Package);
-            auto version = installedPackageVersion->GetProperty(PackageVersionProperty::Version);
-            auto channel = installedPackageVersion->GetProperty(PackageVersionProperty::Channel);
+            const auto& installedPackageVersion = candidate.InstalledVersion;
+            const auto& availablePackageVersion = candidate.AvailableVersion;
 
-            // Find an available version of this package to determine its source.
-            auto availablePackageVersion = GetAvailableVersionForInstalledPackage(context, packageMatch.Package, version, channel, includeVersions);
             if (!availablePackageVersion)
             {
                 // Report package not found and move to next package.
@@ -118,6 +164,18 @@ namespace AppInstaller::CLI::Workflow
                 continue;
             }
 
+            if (candidate.InstalledVersionNotAvailable)
+            {
+                // Warn installed version is not available.
+                AICLI_LOG(
+                    CLI,
+                    Info,
+                    << "Installed package version is not available."
+                    << " Package Id [" << availablePackageVersion->GetProperty(PackageVersionProperty::Id) << "], Version [" << candidate.Version << "], Channel [" << candidate.Channel << "]"
+                    << ". Found Version [" << availablePackageVersion->GetProperty(PackageVersionProperty::Version) << "], Channel [" << availablePackageVersion->GetProperty(PackageVersionProperty::Version) << "]");
+                context.Reporter.Warn() << Resource::String::InstalledPackageVersionNotAvailable(availablePackageVersion->GetProperty(PackageVersionProperty::Id), candidate.Version, candidate.Channel) << std::endl;
+            }
+
             const auto& sourceDetails = availablePackageVersion->GetSource().GetDetails();
             AICLI_LOG(CLI, Info,
                 << "Installed package is available. Package Id [" << availablePackageVersion->GetProperty(PackageVersionProperty::Id) << "], Source [" << sourceDetails.Identifier << "]");
@@ -164,7 +222,7 @@ namespace AppInstaller::CLI::Workflow
 
             if (includeVersions)
             {
-                exportPackage.VersionAndChannel = { version.get(), channel.get() };
+                exportPackage.VersionAndChannel = { candidate.Version.get(), candidate.Channel.get() };
             }
 
             sourceItr->Packages.emplace_back(std::move(exportPackage));
@@ -175,24 +233,33 @@ namespace AppInstaller::CLI::Workflow
 
     void WriteImportFile(Execution::Context& context)
     {
-        auto packages = PackagesJson::CreateJson(context.Get<Execution::Data::PackageCollection>());
-
         std::filesystem::path outputFilePath{ context.Args.GetArg(Execution::Args::Type::OutputFile) };
 
         // GetFileAttributesW returns INVALID_FILE_ATTRIBUTES for nonexistent files, so no separate exists() check is needed.
         DWORD attrs = GetFileAttributesW(outputFilePath.c_str());
         bool isHidden = (attrs != INVALID_FILE_ATTRIBUTES && (attrs & FILE_ATTRIBUTE_HIDDEN));
 
-        // Open the file directly without changing its attributes:
-        // - For an existing hidden file, use TRUNCATE_EXISTING to clear its content while preserving its attributes.
-        // - Otherwise, use CREATE_ALWAYS to create a new file or overwrite an existing one.
-        DWORD creationDisposition = isHidden ? TRUNCATE_EXISTING : CREATE_ALWAYS;
-        wil::unique_hfile fileHandle{ CreateFileW(outputFilePath.c_str(), GENERIC_WRITE, 0, nullptr, creationDisposition, FILE_ATTRIBUTE_NORMAL, nullptr) };
-        THROW_LAST_ERROR_IF(!fileHandle);
+        // Open the file without changing its attributes:
+        // - For an existing hidden file, truncate it first while preserving its attributes, then
+        //   open without truncation; opening a hidden file for plain overwrite fails.
+        // - Otherwise, create a new file or overwrite an existing one.
+        std::fstream outputFile;
+        if (isHidden)
+        {
+            wil::unique_hfile fileHandle{ CreateFileW(outputFilePath.c_str(), GENERIC_WRITE, 0, nullptr, TRUNCATE_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+            THROW_LAST_ERROR_IF(!fileHandle);
+            fileHandle.reset();
+
+            outputFile.open(outputFilePath, std::ios::in | std::ios::out | std::ios::binary);
+        }
+        else
+        {
+            outputFile.open(outputFilePath, std::ios::out | std::ios::trunc | std::ios::binary);
+        }
+        THROW_LAST_ERROR_IF(outputFile.fail());
 
-        Json::StreamWriterBuilder writerBuilder;
-        std::string jsonContent = Json::writeString(writerBuilder, packages);
-        Filesystem::WriteStringToFile(fileHandle.get(), jsonContent);
+        // Stream the collection directly to the file rather than materializing the document.
+        PackagesJson::WriteJson(context.Get<Execution::Data::PackageCollection>(), outputFile);
     }
 
     void ReadImportFile(Execution::Context& context)
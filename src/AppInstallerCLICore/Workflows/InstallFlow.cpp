@@ -59,6 +59,73 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        // Adds the ARP identity that a previous install of the same package recorded in the
+        // source's tracking catalog to the manifest being correlated. Product and upgrade
+        // codes confirmed by an earlier correlation give the exact match paths a chance to
+        // succeed before the scoring heuristics run.
+        void AddTrackedCorrelationToManifest(Execution::Context& context, Manifest::Manifest& manifest) try
+        {
+            if (!context.Contains(Execution::Data::PackageVersion))
+            {
+                return;
+            }
+
+            auto trackingCatalog = context.Get<Execution::Data::PackageVersion>()->GetSource().GetTrackingCatalog();
+            if (!trackingCatalog)
+            {
+                return;
+            }
+
+            SearchRequest trackingRequest;
+            trackingRequest.Filters.emplace_back(PackageMatchField::Id, MatchType::CaseInsensitive, manifest.Id);
+
+            SearchResult trackingResult = trackingCatalog.Search(trackingRequest);
+            if (trackingResult.Matches.size() != 1)
+            {
+                return;
+            }
+
+            auto trackedPackages = trackingResult.Matches[0].Package->GetAvailable();
+            if (trackedPackages.empty())
+            {
+                return;
+            }
+
+            auto trackedVersion = trackedPackages[0]->GetLatestVersion();
+            if (!trackedVersion)
+            {
+                return;
+            }
+
+            // Only the system reference codes are taken; names recorded in the tracking catalog
+            // come from the manifest and are already part of the correlation search.
+            std::vector<AppsAndFeaturesEntry> entries;
+
+            for (auto&& productCode : trackedVersion->GetMultiProperty(PackageVersionMultiProperty::ProductCode))
+            {
+                AppsAndFeaturesEntry entry;
+                entry.ProductCode = std::move(productCode).get();
+                entries.push_back(std::move(entry));
+            }
+
+            for (auto&& upgradeCode : trackedVersion->GetMultiProperty(PackageVersionMultiProperty::UpgradeCode))
+            {
+                AppsAndFeaturesEntry entry;
+                entry.UpgradeCode = std::move(upgradeCode).get();
+                entries.push_back(std::move(entry));
+            }
+
+            if (entries.empty())
+            {
+                return;
+            }
+
+            AICLI_LOG(CLI, Verbose, << "Adding ARP identity recorded in tracking catalog to correlation data for [" << manifest.Id << "]");
+            manifest.Installers.emplace_back();
+            manifest.Installers.back().AppsAndFeaturesEntries = std::move(entries);
+        }
+        CATCH_LOG()
+
         bool ShouldUseDirectMSIInstall(InstallerTypeEnum type, bool isSilentInstall)
         {
             return DoesInstallerTypeUseMsiProperties(type) &&
@@ -787,8 +854,64 @@ namespace AppInstaller::CLI::Workflow
             context.Reporter.Info() << Resource::String::DependenciesOnlyMessage << std::endl;
         }
 
-        for (auto& packageContext : packageSubContexts)
+        // Inform of the elevation requests coming from the batch up front. Each installer that
+        // requires elevation is launched through the runas verb individually; there is no broker
+        // holding a single elevated context across the batch, so make the repeated prompts
+        // expected rather than surprising.
+        if (!m_dependenciesOnly && !downloadInstallerOnly && !Runtime::IsRunningAsAdmin())
+        {
+            size_t elevationRequests = 0;
+
+            for (auto& packageContext : packageSubContexts)
+            {
+                const auto& installer = packageContext->Get<Execution::Data::Installer>();
+                if (installer && installer->ElevationRequirement == ElevationRequirementEnum::ElevationRequired)
+                {
+                    ++elevationRequests;
+                }
+            }
+
+            if (elevationRequests > 1)
+            {
+                context.Reporter.Warn() << Resource::String::MultipleInstallersRequireElevation(elevationRequests) << std::endl;
+            }
+        }
+
+        // Download upcoming installers in the background while each package is
+        // processed; only the install/commit stage below remains serialized.
+        std::unique_ptr<InstallerPrefetcher> installerPrefetcher;
+        if (!m_dependenciesOnly && packagesCount > 1)
         {
+            installerPrefetcher = std::make_unique<InstallerPrefetcher>(packageSubContexts);
+        }
+
+        // Walk the batch in download-aware order: prefer a package whose installer is
+        // already on disk over one that would block on its download, falling back to
+        // list order when nothing has finished prefetching. Installs stay serialized,
+        // so the batch completes as soon as the larger of total download time and
+        // total install time allows, instead of their sum.
+        std::vector<size_t> remainingPackages(packagesCount);
+        std::iota(remainingPackages.begin(), remainingPackages.end(), static_cast<size_t>(0));
+
+        while (!remainingPackages.empty())
+        {
+            size_t selected = 0;
+
+            if (installerPrefetcher)
+            {
+                for (size_t i = 0; i < remainingPackages.size(); ++i)
+                {
+                    if (IsInstallerDownloadPresent(*packageSubContexts[remainingPackages[i]]))
+                    {
+                        selected = i;
+                        break;
+                    }
+                }
+            }
+
+            auto& packageContext = packageSubContexts[remainingPackages[selected]];
+            remainingPackages.erase(remainingPackages.begin() + selected);
+
             packagesProgress++;
             context.Reporter.Info() << '(' << packagesProgress << '/' << packagesCount << ") "_liv;
 
@@ -896,7 +1019,11 @@ namespace AppInstaller::CLI::Workflow
             return;
         }
 
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        // Consult the tracking catalog before correlating; a previously confirmed ARP
+        // identity lets the exact match paths short circuit the scoring heuristics.
+        Manifest::Manifest manifest = context.Get<Execution::Data::Manifest>();
+        AddTrackedCorrelationToManifest(context, manifest);
+
         auto& arpCorrelationData = context.Get<Execution::Data::ARPCorrelationData>();
 
         arpCorrelationData.CapturePostInstallSnapshot();
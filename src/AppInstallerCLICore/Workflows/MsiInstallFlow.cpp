@@ -5,11 +5,106 @@
 #include <winget/MsiExecArguments.h>
 #include <winget/Runtime.h>
 
+#include <msiquery.h>
+
 namespace AppInstaller::CLI::Workflow
 {
     namespace
     {
-        std::optional<UINT> InvokeMsiInstallProduct(const std::filesystem::path& installerPath, const Msi::MsiParsedArguments& msiArgs, IProgressCallback&)
+        // Tracks the tick based progress reported by the MSI engine.
+        // A reset record declares the total and direction for the current phase,
+        // progress report records move within it, and action data records step by
+        // a previously declared amount when the engine enables them.
+        struct MsiProgressState
+        {
+            MsiProgressState(IProgressCallback& progress) : Progress(progress) {}
+
+            void Reset(UINT64 total, bool forward)
+            {
+                Total = total;
+                Forward = forward;
+                Completed = forward ? 0 : total;
+                Report();
+            }
+
+            void Move(UINT64 ticks)
+            {
+                if (Forward)
+                {
+                    Completed = std::min(Completed + ticks, Total);
+                }
+                else
+                {
+                    Completed = (ticks < Completed) ? Completed - ticks : 0;
+                }
+                Report();
+            }
+
+            void Report()
+            {
+                if (Total != 0)
+                {
+                    Progress.OnProgress(Completed, Total, ProgressType::Percent);
+                }
+            }
+
+            IProgressCallback& Progress;
+            UINT64 Total = 0;
+            UINT64 Completed = 0;
+            UINT ActionDataStep = 0;
+            bool Forward = true;
+            bool SendActionData = false;
+        };
+
+        INT CALLBACK MsiProgressRecordHandler(LPVOID context, UINT messageType, MSIHANDLE record) noexcept
+        {
+            MsiProgressState& state = *reinterpret_cast<MsiProgressState*>(context);
+
+            // Cancellation is delivered to the engine by answering any message with IDCANCEL;
+            // it unwinds the install and MsiInstallProduct returns ERROR_INSTALL_USEREXIT.
+            if (state.Progress.IsCancelledBy(CancelReason::Any))
+            {
+                return IDCANCEL;
+            }
+
+            switch (static_cast<INSTALLMESSAGE>(messageType & 0xFF000000))
+            {
+            case INSTALLMESSAGE_PROGRESS:
+                switch (MsiRecordGetInteger(record, 1))
+                {
+                case 0:
+                    // Progress reset; field 2 is the total and field 3 the direction.
+                    state.Reset(MsiRecordGetInteger(record, 2), MsiRecordGetInteger(record, 3) == 0);
+                    state.SendActionData = false;
+                    break;
+                case 1:
+                    // Action info; field 2 is the step to take for each action data
+                    // message and field 3 indicates whether to take it.
+                    state.ActionDataStep = MsiRecordGetInteger(record, 2);
+                    state.SendActionData = (MsiRecordGetInteger(record, 3) != 0);
+                    break;
+                case 2:
+                    // Progress report; field 2 is the number of ticks moved.
+                    state.Move(MsiRecordGetInteger(record, 2));
+                    break;
+                case 3:
+                    // Progress addition; field 2 extends the total.
+                    state.Total += MsiRecordGetInteger(record, 2);
+                    break;
+                }
+                return IDOK;
+            case INSTALLMESSAGE_ACTIONDATA:
+                if (state.SendActionData)
+                {
+                    state.Move(state.ActionDataStep);
+                }
+                return IDOK;
+            default:
+                return IDOK;
+            }
+        }
+
+        std::optional<UINT> InvokeMsiInstallProduct(const std::filesystem::path& installerPath, const Msi::MsiParsedArguments& msiArgs, IProgressCallback& progress)
         {
             if (msiArgs.LogFile)
             {
@@ -24,8 +119,25 @@ namespace AppInstaller::CLI::Workflow
             // Returns old UI level. We don't need to reset it so we ignore it.
             MsiSetInternalUI(msiArgs.UILevel, nullptr);
 
-            // TODO: Use progress callback
-            return MsiInstallProductW(installerPath.c_str(), msiArgs.Properties.c_str());
+            // Receive progress and cancellation through an external UI record handler;
+            // the engine invokes it from its own threads while the install runs.
+            MsiProgressState progressState{ progress };
+            PINSTALLUI_HANDLER_RECORD previousHandler = nullptr;
+            THROW_IF_WIN32_ERROR(MsiSetExternalUIRecord(MsiProgressRecordHandler, INSTALLLOGMODE_PROGRESS | INSTALLLOGMODE_ACTIONDATA, &progressState, &previousHandler));
+            auto removeHandler = wil::scope_exit([&]()
+                {
+                    MsiSetExternalUIRecord(previousHandler, 0, nullptr, nullptr);
+                });
+
+            UINT result = MsiInstallProductW(installerPath.c_str(), msiArgs.Properties.c_str());
+
+            if (result == ERROR_INSTALL_USEREXIT && progress.IsCancelledBy(CancelReason::Any))
+            {
+                // The user exit was the cancellation injected by the handler.
+                return std::nullopt;
+            }
+
+            return result;
         }
     }
 
@@ -58,14 +58,48 @@ namespace AppInstaller::CLI::Workflow
 
     void SearchSubContextsForSingle::operator()(Execution::Context& context) const
     {
+        auto& searchContexts = context.Get<Execution::Data::PackageSubContexts>();
         std::vector<std::unique_ptr<Execution::Context>> packageSubContexts;
         bool foundAll = true;
 
-        for (auto& searchContextPtr : context.Get<Execution::Data::PackageSubContexts>())
+        // The searches are independent and dominated by source I/O; run them against the
+        // already opened source on a bounded set of workers. Selection and reporting below
+        // stay serial and in query order.
+        {
+            std::atomic_size_t nextSearch{ 0 };
+            auto runSearches = [&]()
+                {
+                    for (size_t i = nextSearch++; i < searchContexts.size(); i = nextSearch++)
+                    {
+                        Execution::Context& searchContext = *searchContexts[i];
+                        auto previousThreadGlobals = searchContext.SetForCurrentThread();
+                        searchContext.Add<Execution::Data::SearchResult>(searchContext.Get<Execution::Data::Source>().Search(searchContext.Get<Execution::Data::SearchRequest>()));
+                    }
+                };
+
+            // The calling thread always participates in the searches.
+            size_t additionalThreads = searchContexts.size() > 1 ? std::min(searchContexts.size(), static_cast<size_t>(3)) - 1 : 0;
+            std::vector<std::future<void>> searchWorkers;
+
+            for (size_t i = 0; i < additionalThreads; ++i)
+            {
+                searchWorkers.emplace_back(std::async(std::launch::async, runSearches));
+            }
+
+            runSearches();
+
+            for (auto& worker : searchWorkers)
+            {
+                worker.get();
+            }
+        }
+
+        std::set<std::string> selectedPackageIdentifiers;
+
+        for (auto& searchContextPtr : searchContexts)
         {
             auto& searchContext = *searchContextPtr;
             SearchRequest searchRequest = searchContext.Get<Execution::Data::SearchRequest>();
-            searchContext.Add<Execution::Data::SearchResult>(searchContext.Get<Execution::Data::Source>().Search(searchRequest));
 
             switch (m_operationType)
             {
@@ -128,6 +162,20 @@ namespace AppInstaller::CLI::Workflow
                 }
             }
 
+            // Distinct queries can resolve to the same package; only the first occurrence
+            // proceeds so that the operation is not attempted repeatedly.
+            if (searchContext.Contains(Execution::Data::Package))
+            {
+                std::string packageIdentifier = Utility::FoldCase(std::string_view{ searchContext.Get<Execution::Data::Package>()->GetProperty(PackageProperty::Id).get() });
+                if (!selectedPackageIdentifiers.insert(std::move(packageIdentifier)).second)
+                {
+                    auto packageString = GetPackageStringFromSearchRequest(searchRequest);
+                    AICLI_LOG(CLI, Info, << "Duplicate package selected for query: [" << packageString << "]");
+                    context.Reporter.Info() << Resource::String::MultiQueryDuplicatePackage(packageString) << std::endl;
+                    continue;
+                }
+            }
+
             packageSubContexts.emplace_back(std::move(searchContextPtr));
         }
 
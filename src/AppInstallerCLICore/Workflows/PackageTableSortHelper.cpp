@@ -20,15 +20,15 @@ namespace AppInstaller::CLI::Workflow
     {
         if (WI_IsFlagSet(fieldMask, SortField::Name))
         {
-            FoldedName = Utility::FoldCase(name);
+            NameSortKey = Utility::GenerateSortKey(name);
         }
         if (WI_IsFlagSet(fieldMask, SortField::Id))
         {
-            FoldedId = Utility::FoldCase(id);
+            IdSortKey = Utility::GenerateSortKey(id);
         }
         if (WI_IsFlagSet(fieldMask, SortField::Source))
         {
-            FoldedSource = Utility::FoldCase(source);
+            SourceSortKey = Utility::GenerateSortKey(source);
         }
         if (WI_IsFlagSet(fieldMask, SortField::Version))
         {
@@ -107,9 +107,9 @@ namespace AppInstaller::CLI::Workflow
         switch (field)
         {
         case SortField::Name:
-            return a.FoldedName.compare(b.FoldedName);
+            return a.NameSortKey.compare(b.NameSortKey);
         case SortField::Id:
-            return a.FoldedId.compare(b.FoldedId);
+            return a.IdSortKey.compare(b.IdSortKey);
         case SortField::Version:
         {
             if (a.ParsedInstalledVersion < b.ParsedInstalledVersion) return -1;
@@ -117,7 +117,7 @@ namespace AppInstaller::CLI::Workflow
             return 0;
         }
         case SortField::Source:
-            return a.FoldedSource.compare(b.FoldedSource);
+            return a.SourceSortKey.compare(b.SourceSortKey);
         case SortField::Available:
         {
             bool aHas = a.ParsedAvailableVersion.has_value();
@@ -19,10 +19,10 @@ namespace AppInstaller::CLI::Workflow
     {
         size_t OriginalIndex = 0;
 
-        // Precomputed case-folded sort keys
-        std::string FoldedName;
-        std::string FoldedId;
-        std::string FoldedSource;
+        // Precomputed collation sort keys; ordered by plain byte comparison.
+        std::string NameSortKey;
+        std::string IdSortKey;
+        std::string SourceSortKey;
 
         // Precomputed parsed versions
         Utility::Version ParsedInstalledVersion;
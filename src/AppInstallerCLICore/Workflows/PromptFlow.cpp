@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "PromptFlow.h"
+#include "DownloadFlow.h"
 #include "ShowFlow.h"
 #include <winget/UserSettings.h>
 
@@ -425,16 +426,33 @@ namespace AppInstaller::CLI::Workflow
     {
         bool installerDownloadOnly = WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::InstallerDownloadOnly);
 
+        // While a prompt waits on user input the pipeline is otherwise idle, so begin
+        // retrieving the installer in the background; an accepted install then picks the
+        // complete, hash verified file up from disk via CheckForExistingInstaller.
+        std::unique_ptr<InstallerPrefetcher> installerPrefetcher;
+
         for (auto& prompt : GetPackagePrompts(true, installerDownloadOnly))
         {
             // Show the prompt if needed
             if (prompt->PackageNeedsPrompt(context))
             {
+                if (!installerPrefetcher && IsInteractivityAllowed(context))
+                {
+                    installerPrefetcher = std::make_unique<InstallerPrefetcher>(context);
+                }
+
                 prompt->PromptForSinglePackage(context);
             }
 
             if (context.IsTerminated())
             {
+                // The user declined (or the operation was cancelled); remove any
+                // speculatively downloaded installer.
+                if (installerPrefetcher)
+                {
+                    installerPrefetcher->Discard();
+                }
+
                 return;
             }
         }
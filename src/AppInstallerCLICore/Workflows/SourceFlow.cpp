@@ -237,12 +237,59 @@ namespace AppInstaller::CLI::Workflow
 
         const std::vector<Repository::SourceDetails>& sources = context.Get<Data::SourceList>();
 
+        // Run all of the updates concurrently; each is dominated by its download, and the
+        // source list commits metadata through an optimistic retry loop so the writes from
+        // different sources do not conflict. Results are reported in list order.
+        struct UpdateOperation
+        {
+            std::string Name;
+            std::unique_ptr<ProgressCallback> Progress = std::make_unique<ProgressCallback>();
+            std::future<std::vector<Repository::SourceDetails>> Result;
+        };
+
+        std::vector<UpdateOperation> operations;
+        ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
         for (const auto& sd : sources)
         {
-            Repository::Source source{ sd.Name };
-            context.Reporter.Info() << Resource::String::SourceUpdateOne(Utility::LocIndView{ sd.Name }) << std::endl;
-            auto updateFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails> { return source.Update(progress); };
-            auto sourceDetails = context.Reporter.ExecuteWithProgress(updateFunction);
+            UpdateOperation operation;
+            operation.Name = sd.Name;
+            operation.Result = std::async(std::launch::async, [name = sd.Name, progress = operation.Progress.get(), callerGlobals]()
+                {
+                    std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                    if (callerGlobals)
+                    {
+                        previousGlobals = callerGlobals->SetForCurrentThread();
+                    }
+
+                    Repository::Source source{ name };
+                    return source.Update(*progress);
+                });
+            operations.emplace_back(std::move(operation));
+        }
+
+        for (auto& operation : operations)
+        {
+            context.Reporter.Info() << Resource::String::SourceUpdateOne(Utility::LocIndView{ operation.Name }) << std::endl;
+
+            auto waitFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails>
+                {
+                    while (operation.Result.wait_for(std::chrono::milliseconds{ 250 }) != std::future_status::ready)
+                    {
+                        if (progress.IsCancelledBy(CancelReason::Any))
+                        {
+                            // Stop all of the remaining updates as well.
+                            for (auto& toCancel : operations)
+                            {
+                                toCancel.Progress->Cancel(CancelReason::Abort);
+                            }
+                        }
+                    }
+
+                    return operation.Result.get();
+                };
+
+            auto sourceDetails = context.Reporter.ExecuteWithProgress(waitFunction);
             if (!sourceDetails.empty())
             {
                 if (std::chrono::system_clock::now() < sourceDetails[0].DoNotUpdateBefore)
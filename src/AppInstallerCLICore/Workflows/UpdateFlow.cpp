@@ -3,7 +3,9 @@
 #include "pch.h"
 #include "WorkflowBase.h"
 #include "DependenciesFlow.h"
+#include "DownloadFlow.h"
 #include "InstallFlow.h"
+#include "ResumeFlow.h"
 #include "UpdateFlow.h"
 #include <winget/ManifestComparator.h>
 #include <winget/PinningData.h>
@@ -218,34 +220,89 @@ namespace AppInstaller::CLI::Workflow
         int packagesThatRequireExplicitSkipped = 0;
         int packagesSkippedInstallTechnologyMismatch = 0;
 
+        // Evaluating a candidate pulls manifests from the source and runs installer
+        // selection, which is almost entirely waiting on I/O. Create the sub contexts
+        // serially, evaluate all candidates on a bounded set of workers, then apply
+        // the results serially and in the original order.
+        struct UpdateCandidate
+        {
+            const ResultMatch* Match = nullptr;
+            std::unique_ptr<Execution::Context> Context;
+            bool UnknownVersionSkipped = false;
+        };
+
+        std::vector<UpdateCandidate> candidates;
+        candidates.reserve(matches.size());
         for (const auto& match : matches)
+        {
+            UpdateCandidate candidate;
+            candidate.Match = &match;
+            candidate.Context = context.CreateSubContext();
+            candidates.emplace_back(std::move(candidate));
+        }
+
+        {
+            std::atomic_size_t nextCandidate{ 0 };
+            auto evaluateCandidates = [&]()
+                {
+                    for (size_t i = nextCandidate++; i < candidates.size(); i = nextCandidate++)
+                    {
+                        UpdateCandidate& candidate = candidates[i];
+                        Execution::Context& updateContext = *candidate.Context;
+                        auto previousThreadGlobals = updateContext.SetForCurrentThread();
+                        auto installedVersion = GetInstalledVersion(candidate.Match->Package);
+
+                        updateContext.Add<Execution::Data::Package>(candidate.Match->Package);
+
+                        // Filter out packages with unknown installed versions
+                        if (Utility::Version(installedVersion->GetProperty(PackageVersionProperty::Version)).IsUnknown() &&
+                            !context.Args.Contains(Execution::Args::Type::IncludeUnknown))
+                        {
+                            // we don't know what the package's version is and the user didn't ask to upgrade it anyway.
+                            AICLI_LOG(CLI, Info, << "Skipping " << candidate.Match->Package->GetProperty(PackageProperty::Id) << " as it has unknown installed version");
+                            candidate.UnknownVersionSkipped = true;
+                            continue;
+                        }
+
+                        updateContext <<
+                            Workflow::GetInstalledPackageVersion <<
+                            Workflow::ReportExecutionStage(ExecutionStage::Discovery) <<
+                            SelectLatestApplicableVersion(false);
+                    }
+                };
+
+            // The calling thread always participates in the evaluation.
+            size_t additionalThreads = candidates.size() > 1 ? std::min(candidates.size(), static_cast<size_t>(3)) - 1 : 0;
+            std::vector<std::future<void>> evaluationWorkers;
+
+            for (size_t i = 0; i < additionalThreads; ++i)
+            {
+                evaluationWorkers.emplace_back(std::async(std::launch::async, evaluateCandidates));
+            }
+
+            evaluateCandidates();
+
+            for (auto& worker : evaluationWorkers)
+            {
+                worker.get();
+            }
+        }
+
+        for (auto& candidate : candidates)
         {
             // We want to do best effort to update all applicable updates regardless on previous update failure
-            auto updateContextPtr = context.CreateSubContext();
-            Execution::Context& updateContext = *updateContextPtr;
+            Execution::Context& updateContext = *candidate.Context;
             auto previousThreadGlobals = updateContext.SetForCurrentThread();
-            auto installedVersion = GetInstalledVersion(match.Package);
 
-            updateContext.Add<Execution::Data::Package>(match.Package);
-
-            // Filter out packages with unknown installed versions
-            if (Utility::Version(installedVersion->GetProperty(PackageVersionProperty::Version)).IsUnknown() &&
-                !context.Args.Contains(Execution::Args::Type::IncludeUnknown))
+            if (candidate.UnknownVersionSkipped)
             {
-                // we don't know what the package's version is and the user didn't ask to upgrade it anyway.
-                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id) << " as it has unknown installed version");
                 ++packagesWithUnknownVersionSkipped;
                 continue;
             }
 
-            updateContext <<
-                Workflow::GetInstalledPackageVersion <<
-                Workflow::ReportExecutionStage(ExecutionStage::Discovery) <<
-                SelectLatestApplicableVersion(false);
-
             if (updateContext.GetTerminationHR() == APPINSTALLER_CLI_ERROR_UPDATE_INSTALL_TECHNOLOGY_MISMATCH)
             {
-                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id)
+                AICLI_LOG(CLI, Info, << "Skipping " << candidate.Match->Package->GetProperty(PackageProperty::Id)
                     << " as available upgrades use a different install technology");
                 ++packagesSkippedInstallTechnologyMismatch;
                 continue;
@@ -268,14 +325,14 @@ namespace AppInstaller::CLI::Workflow
                 // packages installed from another source, it ensures consistency with the
                 // list of available updates (there we don't have the selected installer)
                 // and at most we will update each package like this once.
-                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id) << " as it requires explicit upgrade");
+                AICLI_LOG(CLI, Info, << "Skipping " << candidate.Match->Package->GetProperty(PackageProperty::Id) << " as it requires explicit upgrade");
                 ++packagesThatRequireExplicitSkipped;
                 continue;
             }
 
             updateAllFoundUpdate = true;
 
-            AddToPackageSubContextsIfNotPresent(packageSubContexts, std::move(updateContextPtr));
+            AddToPackageSubContextsIfNotPresent(packageSubContexts, std::move(candidate.Context));
         }
 
         if (updateAllFoundUpdate)
@@ -316,6 +373,66 @@ namespace AppInstaller::CLI::Workflow
         }
     }
 
+    void PrefetchUpgradeInstallers(Execution::Context& context)
+    {
+        uint32_t prefetchCount = Settings::User().Get<Settings::Setting::NetworkUpgradePrefetchCount>();
+        if (prefetchCount == 0)
+        {
+            return;
+        }
+
+        const auto& matches = context.Get<Execution::Data::SearchResult>().Matches;
+
+        // Resolve installers for the first candidates in the listed order; the installs
+        // that follow a listing usually start at the top of it.
+        std::vector<std::unique_ptr<Execution::Context>> prefetchContexts;
+
+        for (const auto& match : matches)
+        {
+            if (prefetchContexts.size() >= prefetchCount)
+            {
+                break;
+            }
+
+            auto candidateContext = context.CreateSubContext();
+            Execution::Context& candidate = *candidateContext;
+            auto previousThreadGlobals = candidate.SetForCurrentThread();
+            auto installedVersion = GetInstalledVersion(match.Package);
+
+            if (Utility::Version(installedVersion->GetProperty(PackageVersionProperty::Version)).IsUnknown() &&
+                !context.Args.Contains(Execution::Args::Type::IncludeUnknown))
+            {
+                continue;
+            }
+
+            candidate.Add<Execution::Data::Package>(match.Package);
+
+            candidate <<
+                Workflow::GetInstalledPackageVersion <<
+                SelectLatestApplicableVersion(false);
+
+            if (!candidate.IsTerminated())
+            {
+                prefetchContexts.emplace_back(std::move(candidateContext));
+            }
+        }
+
+        if (prefetchContexts.empty())
+        {
+            return;
+        }
+
+        AICLI_LOG(CLI, Info, << "Prefetching installers for " << prefetchContexts.size() << " listed upgrades");
+        context.Reporter.Info() << Resource::String::UpgradePrefetchingInstallers << std::endl;
+
+        InstallerPrefetcher::PrefetchOptions options;
+        options.SkipFirstContext = false;
+        options.BackgroundPriority = true;
+
+        InstallerPrefetcher prefetcher{ prefetchContexts, options };
+        context.Reporter.ExecuteWithProgress([&](IProgressCallback& progress) { prefetcher.Wait(progress); }, true);
+    }
+
     void SelectSinglePackageVersionForInstallOrUpgrade::operator()(Execution::Context& context) const
     {
         THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), m_operationType != OperationType::Install && m_operationType != OperationType::Upgrade);
@@ -373,6 +490,7 @@ namespace AppInstaller::CLI::Workflow
         context <<
             SearchSourceForSingle <<
             SelectSinglePackageVersionForInstallOrUpgrade(m_operationType) <<
+            Checkpoint("PreInstallCheckpoint", { Execution::Data::Manifest }) <<
             InstallSinglePackage;
     }
 }
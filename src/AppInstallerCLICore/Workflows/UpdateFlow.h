@@ -33,6 +33,14 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: None
     void UpdateAllApplicable(Execution::Context& context);
 
+    // Downloads the installers for the first listed upgrade candidates at background
+    // priority so that a later install starts from a warm cache. Opt-in through the
+    // network.upgradePrefetchCount setting; does nothing when it is 0.
+    // Required Args: None
+    // Inputs: SearchResult
+    // Outputs: None
+    void PrefetchUpgradeInstallers(Execution::Context& context);
+
     // Select single package version for install or upgrade
     // Required Args: bool indicating whether the flow is for upgrade
     // Inputs: Source, SearchResult
@@ -18,6 +18,7 @@
 #include <AppInstallerSHA256.h>
 #include <winget/Runtime.h>
 #include <winget/PackageVersionSelection.h>
+#include <winget/PerformanceTrace.h>
 #include <winget/IconExtraction.h>
 
 EXTERN_C IMAGE_DOS_HEADER __ImageBase;
@@ -33,6 +34,10 @@ namespace AppInstaller::CLI::Workflow
 {
     namespace
     {
+        // Shells only present a handful of candidates for a tab press; there is no value
+        // in materializing an unbounded result set to answer a completion query.
+        constexpr size_t s_CompletionSearchMaximumResults = 50;
+
         std::string GetMatchCriteriaDescriptor(const ResultMatch& match)
         {
             if (match.MatchCriteria.Field != PackageMatchField::Id && match.MatchCriteria.Field != PackageMatchField::Name)
@@ -111,14 +116,94 @@ namespace AppInstaller::CLI::Workflow
             return IsSecondIconResolutionBetter(current.IconResolution, alternative.IconResolution);
         }
 
-        void ShowIcon(Execution::OutputStream& outputStream, VirtualTerminal::Sixel::Image& icon)
+        // Describes a single icon render, including the cache location of its output.
+        struct IconRenderInfo
         {
+            UINT WidthCells = 0;
+            UINT HeightCells = 0;
+            std::filesystem::path CachePath;
+        };
+
+        // Computes the render size and the cache path for the rendered sixel output.
+        // The rendered output depends on both the icon content and the render size, so
+        // the cache key includes the dimensions alongside the content hash.
+        IconRenderInfo GetIconRenderInfo(std::string_view iconHash)
+        {
+            IconRenderInfo result;
+
             // Using a height of 4 arbitrarily; allow width up to the entire console.
-            UINT imageHeightCells = 4;
-            UINT imageWidthCells = static_cast<UINT>(Execution::GetConsoleWidth().value_or(120));
+            result.HeightCells = 4;
+            result.WidthCells = static_cast<UINT>(Execution::GetConsoleWidth().value_or(120));
+
+            if (!iconHash.empty())
+            {
+                // Store rendered output alongside the icon file cache.
+                std::filesystem::path cachePath = Runtime::GetPathTo(Runtime::PathName::Temp);
+                cachePath /= "cache";
+                cachePath /= "RenderedIcon";
+
+                std::ostringstream fileName;
+                fileName << iconHash << '_' << result.WidthCells << 'x' << result.HeightCells << ".sixel";
+                cachePath /= Utility::ConvertToUTF16(fileName.str());
+
+                result.CachePath = std::move(cachePath);
+            }
 
-            icon.RenderSizeInCells(imageWidthCells, imageHeightCells);
-            icon.RenderTo(outputStream);
+            return result;
+        }
+
+        // Outputs the cached rendered sixel if one exists, avoiding image decode entirely.
+        bool TryShowCachedIcon(Execution::OutputStream& outputStream, const IconRenderInfo& renderInfo) try
+        {
+            if (renderInfo.CachePath.empty())
+            {
+                return false;
+            }
+
+            std::ifstream cacheStream{ renderInfo.CachePath, std::ios_base::in | std::ios_base::binary };
+            if (!cacheStream)
+            {
+                return false;
+            }
+
+            std::string cachedSequence = Utility::ReadEntireStream(cacheStream);
+            if (cachedSequence.empty())
+            {
+                return false;
+            }
+
+            outputStream << VirtualTerminal::ConstructedSequence{ std::move(cachedSequence) };
+
+            // Force the final sixel line to not be overwritten
+            outputStream << std::endl;
+            return true;
+        }
+        catch (...) { return false; }
+
+        // Renders the icon at the requested size and writes the result to the render cache,
+        // returning the sequence without outputting it.
+        std::string RenderIconSequence(VirtualTerminal::Sixel::Image& icon, const IconRenderInfo& renderInfo)
+        {
+            icon.RenderSizeInCells(renderInfo.WidthCells, renderInfo.HeightCells);
+            VirtualTerminal::ConstructedSequence sequence = icon.Render();
+
+            if (!renderInfo.CachePath.empty())
+            {
+                try
+                {
+                    std::filesystem::create_directories(renderInfo.CachePath.parent_path());
+                    std::ofstream cacheStream{ renderInfo.CachePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
+                    cacheStream << sequence.Get();
+                }
+                CATCH_LOG();
+            }
+
+            return std::string{ sequence.Get() };
+        }
+
+        void ShowIcon(Execution::OutputStream& outputStream, VirtualTerminal::Sixel::Image& icon, const IconRenderInfo& renderInfo)
+        {
+            outputStream << VirtualTerminal::ConstructedSequence{ RenderIconSequence(icon, renderInfo) };
 
             // Force the final sixel line to not be overwritten
             outputStream << std::endl;
@@ -147,15 +232,49 @@ namespace AppInstaller::CLI::Workflow
                 return;
             }
 
+            auto iconHash = Utility::SHA256::ConvertToString(bestFitIcon->Sha256);
+            IconRenderInfo renderInfo = GetIconRenderInfo(iconHash);
+            auto infoOut = context.Reporter.Info();
+
+            if (TryShowCachedIcon(infoOut, renderInfo))
+            {
+                return;
+            }
+
+            if (WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::DeferIconDisplay))
+            {
+                // Download and decode on a background task so that the textual output is not
+                // delayed behind the icon; ShowDeferredIcon emits the result at the end of the flow.
+                ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+                context.Add<Execution::Data::DeferredIconSequence>(std::async(std::launch::async,
+                    [icon = *bestFitIcon, iconHash, renderInfo, callerGlobals]() -> std::string
+                    {
+                        std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                        if (callerGlobals)
+                        {
+                            previousGlobals = callerGlobals->SetForCurrentThread();
+                        }
+
+                        auto splitUri = Utility::SplitFileNameFromURI(icon.Url);
+                        Caching::FileCache fileCache{ Caching::FileCache::Type::Icon, iconHash, { splitUri.first } };
+                        auto iconStream = fileCache.GetFile(splitUri.second, icon.Sha256);
+
+                        VirtualTerminal::Sixel::Image sixelIcon{ *iconStream, icon.FileType };
+                        return RenderIconSequence(sixelIcon, renderInfo);
+                    }));
+
+                return;
+            }
+
             // Use a cache to hold the icons
             auto splitUri = Utility::SplitFileNameFromURI(bestFitIcon->Url);
-            Caching::FileCache fileCache{ Caching::FileCache::Type::Icon, Utility::SHA256::ConvertToString(bestFitIcon->Sha256), { splitUri.first } };
+            Caching::FileCache fileCache{ Caching::FileCache::Type::Icon, iconHash, { splitUri.first } };
             auto iconStream = fileCache.GetFile(splitUri.second, bestFitIcon->Sha256);
 
             VirtualTerminal::Sixel::Image sixelIcon{ *iconStream, bestFitIcon->FileType };
-            auto infoOut = context.Reporter.Info();
 
-            ShowIcon(infoOut, sixelIcon);
+            ShowIcon(infoOut, sixelIcon, renderInfo);
         }
         CATCH_LOG();
 
@@ -176,8 +295,16 @@ namespace AppInstaller::CLI::Workflow
                 return;
             }
 
+            auto iconHash = Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(bestFitIcon->IconContent));
+            IconRenderInfo renderInfo = GetIconRenderInfo(iconHash);
+
+            if (TryShowCachedIcon(outputStream, renderInfo))
+            {
+                return;
+            }
+
             VirtualTerminal::Sixel::Image sixelIcon{ bestFitIcon->IconContent, bestFitIcon->IconFileType };
-            ShowIcon(outputStream, sixelIcon);
+            ShowIcon(outputStream, sixelIcon, renderInfo);
         }
         CATCH_LOG();
 
@@ -222,6 +349,14 @@ namespace AppInstaller::CLI::Workflow
                     }
                 }
 
+                if (context.Contains(Execution::Data::CompletionData))
+                {
+                    // Tab completion is latency sensitive and cannot afford a source update;
+                    // answer from the data on hand and let the next regular command refresh it.
+                    // An interval of zero is the established "no auto update" value.
+                    source.SetBackgroundUpdateInterval(Repository::TimeSpan::zero());
+                }
+
                 auto openFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails>
                 {
                     source.SetCaller("winget-cli");
@@ -276,6 +411,21 @@ namespace AppInstaller::CLI::Workflow
             return source;
         }
 
+        // Runs a search with the context's cancellation wired up to interrupt the source,
+        // so that Ctrl+C and COM Cancel abort in-flight statements rather than waiting
+        // for them to run to completion. The search operation is identified by the thread
+        // that starts it, and that identity follows the search onto any worker threads it
+        // fans out to; the interrupt only reaches searches carrying it, as the underlying
+        // source may be shared with other operations whose searches must not be aborted
+        // by this context's cancellation.
+        SearchResult SearchWithCancellation(Execution::Context& context, const Repository::Source& source, const SearchRequest& searchRequest)
+        {
+            std::thread::id searchOperationId = std::this_thread::get_id();
+            auto progressScope = context.Reporter.BeginAsyncProgress(true);
+            auto cancellationRemoval = progressScope->Callback().SetCancellationFunction([&source, searchOperationId]() { source.InterruptSearches(searchOperationId); });
+            return source.Search(searchRequest);
+        }
+
         void SearchSourceApplyFilters(Execution::Context& context, SearchRequest& searchRequest, MatchType matchType)
         {
             const auto& args = context.Args;
@@ -542,6 +692,22 @@ namespace AppInstaller::CLI::Workflow
         {
             AICLI_LOG(Workflow, Verbose, << "Running task: " << m_name);
         }
+
+        Logging::EventRing::Record(TraceName());
+    }
+
+    std::string WorkflowTask::TraceName() const
+    {
+        if (m_isFunc)
+        {
+            std::ostringstream strstr;
+            strstr << "0x" << std::hex << (reinterpret_cast<char*>(m_func) - reinterpret_cast<char*>(&__ImageBase));
+            return std::move(strstr).str();
+        }
+        else
+        {
+            return m_name;
+        }
     }
 
     Repository::PredefinedSource DetermineInstalledSource(const Execution::Context& context)
@@ -771,26 +937,78 @@ namespace AppInstaller::CLI::Workflow
         }
     }
 
+    void OpenPredefinedSourceInBackground::operator()(Execution::Context& context) const
+    {
+        ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+        Repository::PredefinedSource predefinedSource = m_predefinedSource;
+
+        Execution::BackgroundPredefinedSourceData data;
+        data.PredefinedSource = predefinedSource;
+        data.Source = std::async(std::launch::async, [predefinedSource, callerGlobals]() -> Repository::Source
+            {
+                std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                if (callerGlobals)
+                {
+                    previousGlobals = callerGlobals->SetForCurrentThread();
+                }
+
+                Repository::Source source{ predefinedSource };
+
+                // A well known predefined source should return a value.
+                THROW_HR_IF(E_UNEXPECTED, !source);
+
+                ProgressCallback progress;
+                source.Open(progress);
+                return source;
+            }).share();
+
+        context.Add<Execution::Data::BackgroundPredefinedSource>(std::move(data));
+    }
+
     void OpenPredefinedSource::operator()(Execution::Context& context) const
     {
         Repository::Source source;
-        try
-        {
-            source = Source{ m_predefinedSource };
-
-            // A well known predefined source should return a value.
-            THROW_HR_IF(E_UNEXPECTED, !source);
+        bool adoptedBackgroundOpen = false;
 
-            auto openFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails>
+        // Adopt a matching background open if one was started.
+        if (context.Contains(Execution::Data::BackgroundPredefinedSource))
+        {
+            const auto& backgroundSource = context.Get<Execution::Data::BackgroundPredefinedSource>();
+            if (backgroundSource.PredefinedSource == m_predefinedSource)
             {
-                return source.Open(progress);
-            };
-            context.Reporter.ExecuteWithProgress(openFunction, true);
+                try
+                {
+                    source = backgroundSource.Source.get();
+                    adoptedBackgroundOpen = true;
+                }
+                catch (...)
+                {
+                    context.Reporter.Error() << Resource::String::SourceOpenPredefinedFailedSuggestion << std::endl;
+                    throw;
+                }
+            }
         }
-        catch (...)
+
+        if (!adoptedBackgroundOpen)
         {
-            context.Reporter.Error() << Resource::String::SourceOpenPredefinedFailedSuggestion << std::endl;
-            throw;
+            try
+            {
+                source = Source{ m_predefinedSource };
+
+                // A well known predefined source should return a value.
+                THROW_HR_IF(E_UNEXPECTED, !source);
+
+                auto openFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails>
+                {
+                    return source.Open(progress);
+                };
+                context.Reporter.ExecuteWithProgress(openFunction, true);
+            }
+            catch (...)
+            {
+                context.Reporter.Error() << Resource::String::SourceOpenPredefinedFailedSuggestion << std::endl;
+                throw;
+            }
         }
 
         if (m_forDependencies)
@@ -873,7 +1091,7 @@ namespace AppInstaller::CLI::Workflow
             searchRequest.MaximumResults,
             searchRequest.ToString());
 
-        context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
+        context.Add<Execution::Data::SearchResult>(SearchWithCancellation(context, context.Get<Execution::Data::Source>(), searchRequest));
     }
 
     void GetSearchRequestForSingle(Execution::Context& context)
@@ -924,7 +1142,7 @@ namespace AppInstaller::CLI::Workflow
                 searchRequest.MaximumResults,
                 searchRequest.ToString());
 
-            context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
+            context.Add<Execution::Data::SearchResult>(SearchWithCancellation(context, context.Get<Execution::Data::Source>(), searchRequest));
         }
     }
 
@@ -935,10 +1153,11 @@ namespace AppInstaller::CLI::Workflow
         SearchRequest searchRequest;
         std::string_view query = context.Get<Execution::Data::CompletionData>().Word();
         searchRequest.Query.emplace(RequestMatch(matchType, query));
+        searchRequest.MaximumResults = s_CompletionSearchMaximumResults;
 
         SearchSourceApplyFilters(context, searchRequest, matchType);
 
-        context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
+        context.Add<Execution::Data::SearchResult>(SearchWithCancellation(context, context.Get<Execution::Data::Source>(), searchRequest));
     }
 
     void SearchSourceForSingleCompletion(Execution::Context& context)
@@ -950,10 +1169,11 @@ namespace AppInstaller::CLI::Workflow
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Id, matchType, query));
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Name, matchType, query));
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Moniker, matchType, query));
+        searchRequest.MaximumResults = s_CompletionSearchMaximumResults;
 
         SearchSourceApplyFilters(context, searchRequest, matchType);
 
-        context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
+        context.Add<Execution::Data::SearchResult>(SearchWithCancellation(context, context.Get<Execution::Data::Source>(), searchRequest));
     }
 
     void SearchSourceForCompletionField::operator()(Execution::Context& context) const
@@ -962,11 +1182,12 @@ namespace AppInstaller::CLI::Workflow
 
         SearchRequest searchRequest;
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(m_field, MatchType::StartsWith, word));
+        searchRequest.MaximumResults = s_CompletionSearchMaximumResults;
 
         // If filters are provided, be generous with the search no matter the intended result.
         SearchSourceApplyFilters(context, searchRequest, MatchType::Substring);
 
-        context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
+        context.Add<Execution::Data::SearchResult>(SearchWithCancellation(context, context.Get<Execution::Data::Source>(), searchRequest));
     }
 
     void ReportSearchResult(Execution::Context& context)
@@ -1658,6 +1879,25 @@ namespace AppInstaller::CLI::Workflow
         ShowManifestIcon(context, manifest);
     }
 
+    void ShowDeferredIcon(Execution::Context& context) try
+    {
+        if (!context.Contains(Execution::Data::DeferredIconSequence))
+        {
+            return;
+        }
+
+        std::string sequence = context.Get<Execution::Data::DeferredIconSequence>().get();
+        if (!sequence.empty())
+        {
+            auto infoOut = context.Reporter.Info();
+            infoOut << VirtualTerminal::ConstructedSequence{ std::move(sequence) };
+
+            // Force the final sixel line to not be overwritten
+            infoOut << std::endl;
+        }
+    }
+    CATCH_LOG();
+
     void SelectInstaller(Execution::Context& context)
     {
         bool isUpdate = WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::InstallerExecutionUseUpdate);
@@ -1701,7 +1941,7 @@ namespace AppInstaller::CLI::Workflow
                 installer->Locale);
         }
 
-        context.Add<Execution::Data::Installer>(installer);
+        context.Add<Execution::Data::Installer>(std::move(installer));
     }
 
     void EnsureRunningAsAdmin(Execution::Context& context)
@@ -1755,7 +1995,7 @@ namespace AppInstaller::CLI::Workflow
 
             if (!searchRequest.Inclusions.empty())
             {
-                auto searchResult = source.Search(searchRequest);
+                auto searchResult = SearchWithCancellation(context, source, searchRequest);
 
                 if (!searchResult.Matches.empty())
                 {
@@ -1781,7 +2021,7 @@ namespace AppInstaller::CLI::Workflow
 
         searchRequest.Filters.emplace_back(PackageMatchFilter(PackageMatchField::Name, MatchType::CaseInsensitive, manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>()));
 
-        context.Add<Execution::Data::SearchResult>(source.Search(searchRequest));
+        context.Add<Execution::Data::SearchResult>(SearchWithCancellation(context, source, searchRequest));
     }
 
     void GetInstalledPackageVersion(Execution::Context& context)
@@ -1835,6 +2075,52 @@ namespace AppInstaller::CLI::Workflow
     }
 }
 
+namespace
+{
+    // Gets the CPU time consumed so far by the calling thread.
+    std::chrono::microseconds GetCurrentThreadCpuTime()
+    {
+        FILETIME creationTime{};
+        FILETIME exitTime{};
+        FILETIME kernelTime{};
+        FILETIME userTime{};
+
+        if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        {
+            ULARGE_INTEGER kernel{ kernelTime.dwLowDateTime, kernelTime.dwHighDateTime };
+            ULARGE_INTEGER user{ userTime.dwLowDateTime, userTime.dwHighDateTime };
+            // FILETIME is in 100ns units
+            return std::chrono::microseconds{ (kernel.QuadPart + user.QuadPart) / 10 };
+        }
+
+        return {};
+    }
+
+    // Gets the peak working set of the process.
+    uint64_t GetPeakWorkingSet()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return counters.PeakWorkingSetSize;
+        }
+
+        return 0;
+    }
+
+    // Gets the private (committed) memory usage of the process.
+    int64_t GetPrivateUsage()
+    {
+        PROCESS_MEMORY_COUNTERS_EX counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)))
+        {
+            return static_cast<int64_t>(counters.PrivateUsage);
+        }
+
+        return 0;
+    }
+}
+
 AppInstaller::CLI::Execution::Context& operator<<(AppInstaller::CLI::Execution::Context& context, AppInstaller::CLI::Workflow::WorkflowTask::Func f)
 {
     return (context << AppInstaller::CLI::Workflow::WorkflowTask(f));
@@ -1849,7 +2135,29 @@ AppInstaller::CLI::Execution::Context& operator<<(AppInstaller::CLI::Execution::
 #endif
         {
             task.Log();
-            task(context);
+            std::string traceName = task.TraceName();
+            AppInstaller::Logging::PerformanceTraceSpan taskSpan{ traceName };
+
+            if (context.IsProfilingEnabled())
+            {
+                auto wallStart = std::chrono::steady_clock::now();
+                auto cpuStart = GetCurrentThreadCpuTime();
+                auto privateUsageStart = GetPrivateUsage();
+
+                task(context);
+
+                AppInstaller::CLI::Execution::WorkflowTaskProfile profile;
+                profile.Name = std::move(traceName);
+                profile.WallTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wallStart);
+                profile.CpuTime = GetCurrentThreadCpuTime() - cpuStart;
+                profile.PeakWorkingSetInBytes = GetPeakWorkingSet();
+                profile.PrivateUsageDeltaInBytes = GetPrivateUsage() - privateUsageStart;
+                context.RecordTaskProfile(std::move(profile));
+            }
+            else
+            {
+                task(context);
+            }
         }
     }
     return context;
@@ -72,6 +72,10 @@ namespace AppInstaller::CLI::Workflow
         bool ExecuteAlways() const { return m_executeAlways; }
         void Log() const;
 
+        // Gets a name for the task suitable for trace events; function tasks use their
+        // module offset, matching the form written by Log.
+        std::string TraceName() const;
+
     private:
         bool m_isFunc = false;
         Func m_func = nullptr;
@@ -138,6 +142,23 @@ namespace AppInstaller::CLI::Workflow
         bool m_forDependencies;
     };
 
+    // Starts opening a predefined source on a background thread so that the open overlaps
+    // the tasks that follow; OpenPredefinedSource adopts the result when it runs for the
+    // same predefined source. The background open does not report progress, so it should
+    // only be used for sources that open quickly relative to the overlapped tasks.
+    // Required Args: None
+    // Inputs: None
+    // Outputs: BackgroundPredefinedSource
+    struct OpenPredefinedSourceInBackground : public WorkflowTask
+    {
+        OpenPredefinedSourceInBackground(Repository::PredefinedSource source) : WorkflowTask("OpenPredefinedSourceInBackground"), m_predefinedSource(source) {}
+
+        void operator()(Execution::Context& context) const override;
+
+    private:
+        Repository::PredefinedSource m_predefinedSource;
+    };
+
     // Creates a composite source from the given predefined source and the existing source.
     // Required Args: None
     // Inputs: Source
@@ -374,6 +395,13 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: None
     void ReportManifestIdentity(Execution::Context& context);
 
+    // Emits an icon render that was started in the background, waiting for it if needed.
+    // Does nothing if no deferred render was started.
+    // Required Args: None
+    // Inputs: DeferredIconSequence?
+    // Outputs: None
+    void ShowDeferredIcon(Execution::Context& context);
+
     // Reports the manifest's identity with version.
     // Required Args: None
     // Inputs: Manifest
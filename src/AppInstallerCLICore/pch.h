@@ -7,6 +7,7 @@
 #include <shellapi.h>
 #include <WinInet.h>
 #include <msi.h>
+#include <Psapi.h>
 #include <wincodec.h>
 
 #pragma warning( push )
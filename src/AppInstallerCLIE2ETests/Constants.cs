@@ -34,6 +34,7 @@ namespace AppInstallerCLIE2ETests
         public const string ForcedExperimentalFeaturesParameter = "ForcedExperimentalFeatures";
         public const string InprocTestbedPathParameter = "InprocTestbedPath";
         public const string InprocTestbedUseTestPackageParameter = "InprocTestbedUseTestPackage";
+        public const string PerfBaselinePathParameter = "PerfBaselinePath";
 
         // Test Sources
         public const string DefaultWingetSourceName = @"winget";
@@ -1256,6 +1256,7 @@ namespace AppInstallerCLIE2ETests.Helpers
                 }
             }
 
+            Stopwatch stopwatch = Stopwatch.StartNew();
             p.Start();
             p.BeginOutputReadLine();
             p.BeginErrorReadLine();
@@ -1271,8 +1272,11 @@ namespace AppInstallerCLIE2ETests.Helpers
                 // According to documentation, this extra call will ensure that the redirected streams
                 // have finished reading all of the data.
                 p.WaitForExit();
+                stopwatch.Stop();
 
                 result.ExitCode = p.ExitCode;
+                result.WallTime = stopwatch.Elapsed;
+                result.CpuTime = p.TotalProcessorTime;
                 result.StdOut = outputData.ToString();
                 result.StdErr = errorData.ToString();
 
@@ -1336,6 +1340,16 @@ namespace AppInstallerCLIE2ETests.Helpers
             /// StdErr.
             /// </summary>
             public string StdErr;
+
+            /// <summary>
+            /// Wall clock time from process start to exit.
+            /// </summary>
+            public TimeSpan WallTime;
+
+            /// <summary>
+            /// CPU time consumed by the process across all of its threads.
+            /// </summary>
+            public TimeSpan CpuTime;
         }
     }
 }
@@ -49,6 +49,8 @@ namespace AppInstallerCLIE2ETests.Helpers
             this.InprocTestbedPath = this.InitializeFileParam(Constants.InprocTestbedPathParameter);
 
             this.ForcedExperimentalFeatures = this.InitializeStringArrayParam(Constants.ForcedExperimentalFeaturesParameter);
+
+            this.PerfBaselinePath = this.InitializeStringParam(Constants.PerfBaselinePathParameter);
         }
 
         /// <summary>
@@ -168,6 +170,11 @@ namespace AppInstallerCLIE2ETests.Helpers
         /// </summary>
         public string[] ForcedExperimentalFeatures { get; }
 
+        /// <summary>
+        /// Gets the path of the performance scenario baseline file; null when timing is not gated.
+        /// </summary>
+        public string PerfBaselinePath { get; }
+
         /// <summary>
         /// Gets a value indicating whether is the default parameters.
         /// </summary>
@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------
+// <copyright file="PerformanceScenarios.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace AppInstallerCLIE2ETests
+{
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using AppInstallerCLIE2ETests.Helpers;
+    using Newtonsoft.Json;
+    using NUnit.Framework;
+
+    /// <summary>
+    /// Timing focused scenarios run against the test source. Every scenario records its wall and
+    /// CPU time to the test output; when a baseline file is supplied through the PerfBaselinePath
+    /// test parameter the measurements are additionally gated against it, so a run without the
+    /// parameter (the default for functional passes) can never fail on timing. Scenarios missing
+    /// from the baseline file are appended to it, which is also how a baseline is first recorded.
+    /// </summary>
+    [NonParallelizable]
+    public class PerformanceScenarios : BaseCommand
+    {
+        // Runs per warm scenario; the median is gated to absorb scheduling outliers.
+        private const int Iterations = 5;
+
+        // A scenario fails the gate when its median exceeds the baseline by this factor plus the slack.
+        // The slack keeps very short scenarios from failing on noise that the factor alone would admit.
+        private const double RegressionFactor = 1.5;
+        private const double SlackMilliseconds = 250;
+
+        /// <summary>
+        /// Measures the first search against a freshly added source (cold: nothing has opened the
+        /// index yet) and the searches that follow it (warm).
+        /// </summary>
+        [Test]
+        public void SearchColdAndWarm()
+        {
+            this.ResetTestSource();
+
+            var coldResult = TestCommon.RunAICLICommand("search", "TestExampleInstaller");
+            Assert.That(coldResult.ExitCode, Is.EqualTo(Constants.ErrorCode.S_OK));
+            Assert.That(coldResult.StdOut, Does.Contain("TestExampleInstaller"));
+            this.GateScenario("search-cold", ScenarioMeasurement.FromResult(coldResult));
+
+            this.MeasureScenario("search-warm", "search", "TestExampleInstaller", Constants.ErrorCode.S_OK);
+        }
+
+        /// <summary>
+        /// Measures enumerating the installed packages and correlating them against the sources.
+        /// </summary>
+        [Test]
+        public void ListInstalled()
+        {
+            this.MeasureScenario("list", "list", string.Empty, Constants.ErrorCode.S_OK);
+        }
+
+        /// <summary>
+        /// Measures the upgrade applicability scan across the installed packages.
+        /// </summary>
+        [Test]
+        public void UpgradeScan()
+        {
+            // The exit code depends on whether anything on the host has an upgrade available;
+            // the scenario measures the scan itself, so no particular code is required.
+            this.MeasureScenario("upgrade-scan", "upgrade", string.Empty, null);
+        }
+
+        /// <summary>
+        /// Measures resolving a package through manifest and installer selection, which is the
+        /// work an install performs before it starts downloading.
+        /// </summary>
+        [Test]
+        public void InstallResolution()
+        {
+            this.MeasureScenario("install-resolution", "show", Constants.ExeInstallerPackageId, Constants.ErrorCode.S_OK);
+        }
+
+        /// <summary>
+        /// Returns the median of the given values.
+        /// </summary>
+        /// <param name="values">Values to aggregate.</param>
+        /// <returns>The median value.</returns>
+        private static double Median(IEnumerable<double> values)
+        {
+            var sorted = values.OrderBy(v => v).ToList();
+            return sorted[sorted.Count / 2];
+        }
+
+        /// <summary>
+        /// Runs the given command several times and gates the median measurement.
+        /// </summary>
+        /// <param name="scenario">Scenario name used in the baseline file.</param>
+        /// <param name="command">Command to run.</param>
+        /// <param name="parameters">Parameters.</param>
+        /// <param name="expectedExitCode">Exit code each run must produce; null to accept any.</param>
+        private void MeasureScenario(string scenario, string command, string parameters, int? expectedExitCode)
+        {
+            var runs = new List<ScenarioMeasurement>();
+
+            for (int i = 0; i < Iterations; ++i)
+            {
+                var result = TestCommon.RunAICLICommand(command, parameters);
+
+                if (expectedExitCode.HasValue)
+                {
+                    Assert.That(result.ExitCode, Is.EqualTo(expectedExitCode.Value));
+                }
+
+                runs.Add(ScenarioMeasurement.FromResult(result));
+            }
+
+            this.GateScenario(
+                scenario,
+                new ScenarioMeasurement
+                {
+                    WallMilliseconds = Median(runs.Select(r => r.WallMilliseconds)),
+                    CpuMilliseconds = Median(runs.Select(r => r.CpuMilliseconds)),
+                });
+        }
+
+        /// <summary>
+        /// Reports the measurement, and compares it against the baseline when one is configured.
+        /// A scenario not yet present in the baseline file is recorded rather than gated.
+        /// </summary>
+        /// <param name="scenario">Scenario name used in the baseline file.</param>
+        /// <param name="measured">The measurement for this run.</param>
+        private void GateScenario(string scenario, ScenarioMeasurement measured)
+        {
+            TestContext.Out.WriteLine($"{scenario}: wall {measured.WallMilliseconds:F0} ms, cpu {measured.CpuMilliseconds:F0} ms");
+
+            string baselinePath = TestSetup.Parameters.PerfBaselinePath;
+            if (string.IsNullOrEmpty(baselinePath))
+            {
+                return;
+            }
+
+            Dictionary<string, ScenarioMeasurement> baseline = File.Exists(baselinePath)
+                ? JsonConvert.DeserializeObject<Dictionary<string, ScenarioMeasurement>>(File.ReadAllText(baselinePath))
+                : new Dictionary<string, ScenarioMeasurement>();
+
+            if (baseline.TryGetValue(scenario, out ScenarioMeasurement recorded))
+            {
+                Assert.That(
+                    measured.WallMilliseconds,
+                    Is.LessThanOrEqualTo((recorded.WallMilliseconds * RegressionFactor) + SlackMilliseconds),
+                    $"{scenario} wall time regressed from the baseline of {recorded.WallMilliseconds:F0} ms");
+                Assert.That(
+                    measured.CpuMilliseconds,
+                    Is.LessThanOrEqualTo((recorded.CpuMilliseconds * RegressionFactor) + SlackMilliseconds),
+                    $"{scenario} CPU time regressed from the baseline of {recorded.CpuMilliseconds:F0} ms");
+            }
+            else
+            {
+                baseline[scenario] = measured;
+                File.WriteAllText(baselinePath, JsonConvert.SerializeObject(baseline, Formatting.Indented));
+                TestContext.Out.WriteLine($"{scenario}: recorded as new baseline entry");
+            }
+        }
+
+        /// <summary>
+        /// The timings recorded for a scenario.
+        /// </summary>
+        public class ScenarioMeasurement
+        {
+            /// <summary>
+            /// Gets or sets the wall clock time in milliseconds.
+            /// </summary>
+            public double WallMilliseconds { get; set; }
+
+            /// <summary>
+            /// Gets or sets the CPU time in milliseconds.
+            /// </summary>
+            public double CpuMilliseconds { get; set; }
+
+            /// <summary>
+            /// Creates a measurement from a command run result.
+            /// </summary>
+            /// <param name="result">The result of the command.</param>
+            /// <returns>The measurement.</returns>
+            public static ScenarioMeasurement FromResult(TestCommon.RunCommandResult result)
+            {
+                return new ScenarioMeasurement
+                {
+                    WallMilliseconds = result.WallTime.TotalMilliseconds,
+                    CpuMilliseconds = result.CpuTime.TotalMilliseconds,
+                };
+            }
+        }
+    }
+}
@@ -24,6 +24,25 @@ TEST_CASE("Extract_ZipArchive", "[archive]")
     REQUIRE(std::filesystem::exists(expectedPath));
 }
 
+TEST_CASE("ExtractFilesFrom_ZipArchive", "[archive]")
+{
+    TestCommon::TempDirectory tempDirectory("TempDirectory");
+    TestDataFile testZip(s_ZipFile);
+
+    const auto& testZipPath = testZip.GetPath();
+    const auto& tempDirectoryPath = tempDirectory.GetPath();
+
+    HRESULT hr = TryExtractFilesFromZipArchive(testZipPath, tempDirectoryPath, { "test.txt" });
+
+    std::filesystem::path expectedPath = tempDirectoryPath / "test.txt";
+    REQUIRE(SUCCEEDED(hr));
+    REQUIRE(std::filesystem::exists(expectedPath));
+
+    // A missing entry must fail so that callers fall back to a full extraction.
+    HRESULT missingHr = TryExtractFilesFromZipArchive(testZipPath, tempDirectoryPath, { "does-not-exist.txt" });
+    REQUIRE(FAILED(missingHr));
+}
+
 TEST_CASE("Scan_ZipArchive", "[archive]")
 {
     TestDataFile testZip(s_ZipFile);
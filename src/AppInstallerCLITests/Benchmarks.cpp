@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <AppInstallerStrings.h>
+#include <AppInstallerVersions.h>
+#include <winget/ManifestYamlParser.h>
+#include <winget/NameNormalization.h>
+#include <Microsoft/SQLiteIndex.h>
+
+using namespace AppInstaller::Manifest;
+using namespace AppInstaller::Repository;
+using namespace AppInstaller::Repository::Microsoft;
+using namespace AppInstaller::Utility;
+using namespace TestCommon;
+
+// Microbenchmarks over known hot paths. These are hidden from the default test run so that
+// CI functional passes stay fast; execute them explicitly with:
+//   AppInstallerCLITests.exe [benchmark]
+// Compare the reported means against a previous build when chasing a regression.
+
+namespace
+{
+    // Builds an in-memory index populated with the requested number of synthetic packages.
+    SQLiteIndex CreateBenchmarkIndex(size_t packageCount)
+    {
+        SQLiteIndex index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET, AppInstaller::SQLite::Version::Latest());
+
+        for (size_t i = 0; i < packageCount; ++i)
+        {
+            std::string publisher = "BenchPublisher" + std::to_string(i);
+
+            Manifest manifest;
+            manifest.Installers.push_back({});
+            manifest.Id = publisher + ".Id";
+            manifest.DefaultLocalization.Add<Localization::PackageName>(publisher + " Name");
+            manifest.Moniker = "bench" + std::to_string(i);
+            manifest.Version = "1.0.0";
+            manifest.DefaultLocalization.Add<Localization::Tags>({ "benchmark" });
+            manifest.Installers[0].Commands = { "bench" };
+
+            index.AddManifest(manifest, ToLower(publisher) + "/id/1.0.0");
+        }
+
+        return index;
+    }
+}
+
+TEST_CASE("Benchmark_VersionComparison", "[.][benchmark]")
+{
+    Version simpleA{ "103.88.7621.122" };
+    Version simpleB{ "103.88.7621.123" };
+    Version complexA{ "1.2.3-alpha.4" };
+    Version complexB{ "1.2.3-alpha.10" };
+
+    BENCHMARK("parse dotted quad")
+    {
+        return Version{ "103.88.7621.122" };
+    };
+
+    BENCHMARK("compare dotted quad")
+    {
+        return simpleA < simpleB;
+    };
+
+    BENCHMARK("compare with preamble")
+    {
+        return complexA < complexB;
+    };
+}
+
+TEST_CASE("Benchmark_NameNormalization", "[.][benchmark]")
+{
+    NameNormalizer normalizer(NormalizationVersion::Initial);
+
+    BENCHMARK("normalize name and publisher")
+    {
+        return normalizer.Normalize("Microsoft Visual C++ 2015 Redistributable (x64) - 14.0.23506", "Microsoft Corporation");
+    };
+}
+
+TEST_CASE("Benchmark_ManifestYamlParsing", "[.][benchmark]")
+{
+    TestDataFile manifestFile("ManifestV1-Singleton.yaml");
+
+    BENCHMARK("parse singleton manifest")
+    {
+        return YamlParser::CreateFromPath(manifestFile);
+    };
+}
+
+TEST_CASE("Benchmark_SQLiteIndexSearch", "[.][benchmark]")
+{
+    size_t packageCount = GENERATE(static_cast<size_t>(1'000), static_cast<size_t>(10'000));
+    SQLiteIndex index = CreateBenchmarkIndex(packageCount);
+
+    SearchRequest exactRequest;
+    exactRequest.Filters.emplace_back(PackageMatchField::Id, MatchType::CaseInsensitive, "benchpublisher42.id");
+
+    SearchRequest substringRequest;
+    substringRequest.Query = RequestMatch(MatchType::Substring, "BenchPublisher99");
+
+    DYNAMIC_SECTION("packages: " << packageCount)
+    {
+        BENCHMARK("exact id match")
+        {
+            return index.Search(exactRequest).Matches.size();
+        };
+
+        BENCHMARK("substring query")
+        {
+            return index.Search(substringRequest).Matches.size();
+        };
+    }
+}
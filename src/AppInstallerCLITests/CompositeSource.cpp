@@ -12,6 +12,8 @@
 #include <winget/PinningData.h>
 #include <winget/PackageVersionSelection.h>
 
+#include <condition_variable>
+
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 using namespace TestCommon;
@@ -862,6 +864,42 @@ TEST_CASE("CompositeSource_MultipleAvailableSources_ReverseMatchBoth", "[Composi
     REQUIRE(result.Matches[0].Package->GetAvailable()[1]->GetVersionKeys().size() == 1);
 }
 
+TEST_CASE("CompositeSource_BatchedCorrelation_MultipleInstalled", "[CompositeSource]")
+{
+    std::string pfn1 = "first_apfn";
+    std::string pfn2 = "second_apfn";
+
+    CompositeTestSetup setup;
+    setup.Installed->Everything.Matches.emplace_back(setup.MakeInstalled().WithId("Id1").WithDefaultName("Name1").WithPFN(pfn1), Criteria());
+    setup.Installed->Everything.Matches.emplace_back(setup.MakeInstalled().WithId("Id2").WithDefaultName("Name2").WithPFN(pfn2), Criteria());
+
+    size_t searchCalls = 0;
+    setup.Available->SearchFunction = [&](const SearchRequest& request)
+    {
+        ++searchCalls;
+
+        // The correlation search should be a single batched request covering both installed packages.
+        RequireSearchRequestIncludes(request.Inclusions, PackageMatchField::PackageFamilyName, MatchType::Exact, pfn1);
+        RequireSearchRequestIncludes(request.Inclusions, PackageMatchField::PackageFamilyName, MatchType::Exact, pfn2);
+
+        SearchResult result;
+        result.Matches.emplace_back(setup.MakeAvailable().WithId("Available1").WithDefaultName("Name1").WithPFN(pfn1), Criteria());
+        result.Matches.emplace_back(setup.MakeAvailable().WithId("Available2").WithDefaultName("Name2").WithPFN(pfn2), Criteria());
+        return result;
+    };
+
+    SearchResult result = setup.Search();
+
+    REQUIRE(searchCalls == 1);
+    REQUIRE(result.Matches.size() == 2);
+    REQUIRE(GetInstalledVersion(result.Matches[0].Package));
+    REQUIRE(result.Matches[0].Package->GetAvailable().size() == 1);
+    REQUIRE(result.Matches[0].Package->GetAvailable()[0]->GetProperty(PackageProperty::Id).get() == "Available1");
+    REQUIRE(GetInstalledVersion(result.Matches[1].Package));
+    REQUIRE(result.Matches[1].Package->GetAvailable().size() == 1);
+    REQUIRE(result.Matches[1].Package->GetAvailable()[0]->GetProperty(PackageProperty::Id).get() == "Available2");
+}
+
 TEST_CASE("CompositeSource_IsSame", "[CompositeSource]")
 {
     CompositeTestSetup setup;
@@ -2037,3 +2075,68 @@ TEST_CASE("CompositeSource_MappedVersions_ProperSorting", "[CompositeSource]")
     REQUIRE(installedVersions[0].Version == versionMapped2);
     REQUIRE(installedVersions[1].Version == versionMapped1);
 }
+
+TEST_CASE("CompositeSource_InterruptSearches_ReachesSpawnedSearchThreads", "[CompositeSource]")
+{
+    // A sub-source whose search blocks until it is interrupted for the operation it observed,
+    // recording the identities involved so that their propagation can be verified.
+    struct InterruptibleTestSource : public ComponentTestSource
+    {
+        SearchResult Search(const SearchRequest&) const override
+        {
+            std::unique_lock<std::mutex> lock{ Lock };
+            ObservedOperationId = GetCurrentSearchOperationId();
+            SearchThreadId = std::this_thread::get_id();
+            SearchStarted.notify_all();
+            Interrupted = InterruptReceived.wait_for(lock, std::chrono::seconds{ 5 }, [this]() { return InterruptedOperationId == ObservedOperationId; });
+            return {};
+        }
+
+        void InterruptSearches(std::thread::id operationId) const override
+        {
+            std::lock_guard<std::mutex> lock{ Lock };
+            InterruptedOperationId = operationId;
+            InterruptReceived.notify_all();
+        }
+
+        void WaitForSearchStart() const
+        {
+            std::unique_lock<std::mutex> lock{ Lock };
+            SearchStarted.wait_for(lock, std::chrono::seconds{ 5 }, [this]() { return SearchThreadId != std::thread::id{}; });
+        }
+
+        mutable std::mutex Lock;
+        mutable std::condition_variable SearchStarted;
+        mutable std::condition_variable InterruptReceived;
+        mutable std::thread::id ObservedOperationId;
+        mutable std::thread::id SearchThreadId;
+        mutable std::thread::id InterruptedOperationId;
+        mutable bool Interrupted = false;
+    };
+
+    auto firstAvailable = std::make_shared<InterruptibleTestSource>();
+    auto secondAvailable = std::make_shared<InterruptibleTestSource>();
+
+    CompositeSource composite("*CompositeSource_Interrupt");
+    composite.AddAvailableSource(Source{ firstAvailable });
+    composite.AddAvailableSource(Source{ secondAvailable });
+
+    // With more than one available source the composite runs each sub-source search on its
+    // own spawned thread; an interrupt for the operation must still reach those searches.
+    std::thread operationThread([&]() { composite.Search({}); });
+    std::thread::id operationId = operationThread.get_id();
+
+    firstAvailable->WaitForSearchStart();
+    secondAvailable->WaitForSearchStart();
+
+    composite.InterruptSearches(operationId);
+
+    operationThread.join();
+
+    REQUIRE(firstAvailable->Interrupted);
+    REQUIRE(secondAvailable->Interrupted);
+    REQUIRE(firstAvailable->ObservedOperationId == operationId);
+    REQUIRE(secondAvailable->ObservedOperationId == operationId);
+    REQUIRE(firstAvailable->SearchThreadId != operationId);
+    REQUIRE(secondAvailable->SearchThreadId != operationId);
+}
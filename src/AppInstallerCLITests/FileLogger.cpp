@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include <AppInstallerFileLogger.h>
+#include <AppInstallerLogging.h>
 #include <AppInstallerStrings.h>
 
 using namespace AppInstaller::Logging;
@@ -168,6 +169,8 @@ namespace
         std::string_view largeStringView = largeString;
         expectedFileContents.push_back(largeStringView.substr(0, std::min(largeString.size(), maximumAvailableSpace)));
 
+        // Writes are asynchronous; get them on disk before inspecting the file
+        logger.Drain();
         ValidateFileContents(tempFile, expectedFileContents, maximumSize);
 
         // Log again
@@ -195,6 +198,7 @@ namespace
 
         expectedFileContents.push_back(largeStringView.substr(0, std::min(largeString.size(), maximumAvailableSpace)));
 
+        logger.Drain();
         ValidateFileContents(tempFile, expectedFileContents, maximumSize);
     }
 }
@@ -241,5 +245,50 @@ TEST_CASE("FileLogger_MaximumSize_ManyWraps", "[logging]")
     expectedFileContents.push_back(WrapIndicator);
     expectedFileContents.push_back(largeStringView.substr(0, initSize));
 
+    // Writes are asynchronous; get them on disk before inspecting the file
+    logger.Drain();
     ValidateFileContents(tempFile, expectedFileContents, maximumSize);
 }
+
+namespace
+{
+    std::string GetEventRingContents()
+    {
+        EventRing::RawView view = EventRing::GetRawView();
+
+        std::string result;
+        result.append(view.First, view.FirstSize);
+
+        if (view.SecondSize)
+        {
+            result.append(view.Second, view.SecondSize);
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("EventRing_RecordAndView", "[logging]")
+{
+    std::string marker = "EventRing_RecordAndView marker event";
+    EventRing::Record(marker);
+
+    std::string contents = GetEventRingContents();
+    REQUIRE(contents.find(marker + '\n') != std::string::npos);
+}
+
+TEST_CASE("EventRing_Wraps", "[logging]")
+{
+    // Push well over the ring capacity through it, then ensure the most recent event survived.
+    std::string filler(100, 'x');
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        EventRing::Record(filler);
+    }
+
+    std::string marker = "EventRing_Wraps marker event";
+    EventRing::Record(marker);
+
+    std::string contents = GetEventRingContents();
+    REQUIRE(contents.find(marker + '\n') != std::string::npos);
+}
@@ -239,6 +239,44 @@ TEST_CASE("PathTree_VisitIf_Correct", "[filesystem][pathtree]")
     pathTree.VisitIf(L"C:", check_input, if_input);
 }
 
+TEST_CASE("CopyFileWithProgress", "[filesystem]")
+{
+    TestCommon::TempDirectory tempDirectory{ "CopyFileWithProgress" };
+    auto sourceFile = tempDirectory.CreateTempFile("source", ".bin");
+    std::filesystem::path targetPath = tempDirectory.GetPath() / "target.bin";
+
+    std::string content(1 << 20, 'w');
+    {
+        std::ofstream sourceStream{ sourceFile.GetPath(), std::ios::binary };
+        sourceStream << content;
+    }
+
+    SECTION("Reports progress")
+    {
+        uint64_t lastBytesCopied = 0;
+        uint64_t lastTotalBytes = 0;
+        CopyFileWithProgress(sourceFile.GetPath(), targetPath, [&](uint64_t bytesCopied, uint64_t totalBytes)
+            {
+                lastBytesCopied = bytesCopied;
+                lastTotalBytes = totalBytes;
+                return true;
+            });
+
+        REQUIRE(std::filesystem::exists(targetPath));
+        REQUIRE(std::filesystem::file_size(targetPath) == content.size());
+        REQUIRE(lastBytesCopied == content.size());
+        REQUIRE(lastTotalBytes == content.size());
+    }
+
+    SECTION("Cancellation")
+    {
+        REQUIRE_THROWS(CopyFileWithProgress(sourceFile.GetPath(), targetPath, [](uint64_t, uint64_t)
+            {
+                return false;
+            }));
+    }
+}
+
 TEST_CASE("WriteStringToFile", "[filesystem]")
 {
     SECTION("Basic content")
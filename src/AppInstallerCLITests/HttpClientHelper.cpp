@@ -25,9 +25,41 @@ TEST_CASE("ExtractJsonResponse_UnsupportedMimeType", "[RestSource][RestSearch]")
 TEST_CASE("ValidateAndExtractResponse_ServiceUnavailable", "[RestSource]")
 {
     HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::ServiceUnavailable) };
+    // Exhausted retry budget means the throttled response surfaces immediately.
+    helper.SetRetryBudget(0);
     REQUIRE_THROWS_HR(helper.HandleGet(L"https://testUri"), APPINSTALLER_CLI_ERROR_SERVICE_UNAVAILABLE);
 }
 
+TEST_CASE("HttpClientHelper_RetryAfterThrottling", "[RestSource]")
+{
+    auto requestCount = std::make_shared<std::atomic<uint32_t>>(0);
+    auto handler = std::make_shared<TestRestRequestHandler>([requestCount](web::http::http_request) ->
+        pplx::task<web::http::http_response>
+        {
+            web::http::http_response response;
+
+            if (++(*requestCount) == 1)
+            {
+                response.set_status_code(web::http::status_codes::ServiceUnavailable);
+                response.headers().add(web::http::header_names::retry_after, 1);
+            }
+            else
+            {
+                response.set_body(web::json::value::parse(L"{}"));
+                response.headers().set_content_type(web::http::details::mime_types::application_json);
+                response.set_status_code(web::http::status_codes::OK);
+            }
+
+            return pplx::task_from_result(response);
+        });
+
+    HttpClientHelper helper{ handler };
+    auto result = helper.HandleGet(L"https://testUri");
+
+    REQUIRE(result.has_value());
+    REQUIRE(requestCount->load() == 2);
+}
+
 TEST_CASE("ValidateAndExtractResponse_NotFound", "[RestSource]")
 {
     HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::NotFound) };
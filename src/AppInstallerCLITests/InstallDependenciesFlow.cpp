@@ -369,3 +369,41 @@ TEST_CASE("InstallFlow_Dependencies_WindowsFeaturesArgument_Quoted", "[InstallFl
 // add dependencies for installer tests to DependenciesTestSource (or a new one)
 // add tests for min version dependency solving
 // add tests that check for correct installation of dependencies (not only the order)
+
+struct SearchCountingDependenciesTestSource : public DependenciesTestSource
+{
+    SearchResult Search(const SearchRequest& request) const override
+    {
+        ++SearchCount;
+        return DependenciesTestSource::Search(request);
+    }
+
+    mutable size_t SearchCount = 0;
+};
+
+TEST_CASE("DependencyGraph_MemoizedNodeEvaluation", "[InstallFlow][workflow][dependencyGraph][dependencies]")
+{
+    std::ostringstream installOutput;
+    TestContext context{ installOutput, std::cin };
+    auto previousThreadGlobals = context.SetForCurrentThread();
+
+    auto countingSource = std::make_shared<SearchCountingDependenciesTestSource>();
+    context.Override({ Workflow::OpenDependencySource, [countingSource](TestContext& testContext)
+    {
+        testContext.Add<Execution::Data::DependencySource>(Source{ countingSource });
+    } });
+
+    Manifest manifest = CreateFakeManifestWithDependencies("H");
+    context << InitializeDependencyNodeResultsMap;
+    context.Add<Execution::Data::Manifest>(manifest);
+    context.Add<Execution::Data::Installer>(manifest.Installers[0]);
+
+    context << CreateDependencySubContexts(Resource::String::PackageRequiresDependencies);
+
+    size_t firstBuildSearchCount = countingSource->SearchCount;
+    REQUIRE(firstBuildSearchCount > 0);
+
+    // A second graph build in the same context resolves every node from the shared memo.
+    context << CreateDependencySubContexts(Resource::String::PackageRequiresDependencies);
+    REQUIRE(countingSource->SearchCount == firstBuildSearchCount);
+}
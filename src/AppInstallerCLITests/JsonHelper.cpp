@@ -44,6 +44,28 @@ TEST_CASE("GetJsonValueFromNode", "[RestSource]")
     REQUIRE(!empty);
 }
 
+TEST_CASE("GetJsonValueFromNode_Key", "[RestSource]")
+{
+    web::json::value jsonObject = GetTestJsonObject();
+    constexpr JSON::Key key1{ L"Key1" };
+    std::optional<std::reference_wrapper<const web::json::value>> actual = JSON::GetJsonValueFromNode(jsonObject, key1);
+    REQUIRE(actual);
+    REQUIRE(actual.value().get().as_string() == L"Value1");
+
+    constexpr JSON::Key key3{ L"Key3" };
+    std::optional<std::reference_wrapper<const web::json::value>> absentKey = JSON::GetJsonValueFromNode(jsonObject, key3);
+    REQUIRE(!absentKey);
+
+    web::json::value emptyObject;
+    std::optional<std::reference_wrapper<const web::json::value>> empty = JSON::GetJsonValueFromNode(emptyObject, key1);
+    REQUIRE(!empty);
+
+    constexpr JSON::Key arrayKey{ L"Array" };
+    std::vector<std::string> arrayValues = JSON::GetRawStringArrayFromJsonNode(jsonObject, arrayKey);
+    REQUIRE(arrayValues.size() == 3);
+    REQUIRE(arrayValues[0] == "ArrayValue1");
+}
+
 TEST_CASE("GetRawStringValueFromJsonValue", "[RestSource]")
 {
     std::optional<std::string> stringTest = JSON::GetRawStringValueFromJsonValue(web::json::value::string(L"cpprest "));
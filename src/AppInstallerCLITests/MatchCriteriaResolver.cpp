@@ -152,3 +152,26 @@ TEST_CASE("MatchCriteriaResolver_Complex", "[MatchCriteriaResolver]")
     PackageMatchFilter actual = FindBestMatchCriteria(request, &packageVersion);
     RequireMatchCriteria(expected, actual);
 }
+
+TEST_CASE("MatchCriteriaResolver_CompiledReuse", "[MatchCriteriaResolver]")
+{
+    SearchRequest request;
+    request.Query = RequestMatch{ MatchType::Substring, "Search" };
+
+    MatchCriteriaResolver resolver{ request };
+
+    Manifest::Manifest exactManifest;
+    exactManifest.Id = "Search";
+    TestPackageVersion exactVersion(exactManifest);
+    RequireMatchCriteria({ PackageMatchField::Id, MatchType::Exact, exactManifest.Id }, resolver.FindBestMatchCriteria(&exactVersion));
+
+    Manifest::Manifest substringManifest;
+    substringManifest.Id = "Contains searches within";
+    TestPackageVersion substringVersion(substringManifest);
+    RequireMatchCriteria({ PackageMatchField::Id, MatchType::Substring, substringManifest.Id }, resolver.FindBestMatchCriteria(&substringVersion));
+
+    Manifest::Manifest noMatchManifest;
+    noMatchManifest.Id = "Unrelated";
+    TestPackageVersion noMatchVersion(noMatchManifest);
+    RequireMatchCriteria({ PackageMatchField::Unknown, MatchType::Wildcard, "" }, resolver.FindBestMatchCriteria(&noMatchVersion));
+}
@@ -776,3 +776,44 @@ TEST_CASE("PackageCollection_Read_BadTimeStamp", "[PackageCollection]")
     REQUIRE(parseResult.Result == PackagesJson::ParseResult::Type::SchemaValidationFailed);
     REQUIRE_FALSE(parseResult.Errors.empty());
 }
+
+TEST_CASE("PackageCollection_WriteJson_MatchesCreateJson", "[PackageCollection]")
+{
+    PackageCollection::Source source;
+    source.Details.Name = "TestSource";
+    source.Details.Arg = "https://aka.ms/winget";
+    source.Details.Type = "Microsoft.PreIndexed.Package";
+    source.Details.Identifier = "TestSourceId";
+
+    source.Packages.emplace_back(LocIndString{ "test.package1"sv }, Version{ "1.0.1" }, Channel{ "" });
+    source.Packages.emplace_back(LocIndString{ "test.package2"sv }, Version{ "2" }, Channel{ "Public" });
+    source.Packages.back().InitialOverrideArgs = "/silent";
+    source.Packages.back().InitialCustomSwitches = "--custom-flag";
+
+    PackageCollection::Source secondSource;
+    secondSource.Details.Name = "SecondSource";
+    secondSource.Details.Arg = "https://contoso.com/source";
+    secondSource.Details.Type = "Microsoft.Rest";
+    secondSource.Details.Identifier = "SecondSourceId";
+    secondSource.Packages.emplace_back(LocIndString{ "test.package3"sv }, Version{ "3.0" }, Channel{ "" });
+
+    PackageCollection pc
+    {
+        "0.1.2.3",
+        std::vector<PackageCollection::Source>{ source, secondSource }
+    };
+
+    // The streamed output must parse back to the same document the DOM path produces.
+    std::ostringstream stream;
+    PackagesJson::WriteJson(pc, stream);
+
+    std::istringstream input{ stream.str() };
+    Json::Value streamedJson;
+    input >> streamedJson;
+
+    ValidateJsonWithCollection(streamedJson, pc);
+
+    auto parseResult = PackagesJson::TryParseJson(streamedJson);
+    REQUIRE(parseResult.Result == PackagesJson::ParseResult::Type::Success);
+    ValidateEqualCollections(pc, parseResult.Packages);
+}
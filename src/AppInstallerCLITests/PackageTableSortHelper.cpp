@@ -29,9 +29,9 @@ namespace
         for (size_t i = 0; i < actual.size(); ++i)
         {
             INFO("Entry index: " << i);
-            REQUIRE(actual[i].FoldedName == expected[i].FoldedName);
-            REQUIRE(actual[i].FoldedId == expected[i].FoldedId);
-            REQUIRE(actual[i].FoldedSource == expected[i].FoldedSource);
+            REQUIRE(actual[i].NameSortKey == expected[i].NameSortKey);
+            REQUIRE(actual[i].IdSortKey == expected[i].IdSortKey);
+            REQUIRE(actual[i].SourceSortKey == expected[i].SourceSortKey);
             REQUIRE(actual[i].ParsedInstalledVersion == expected[i].ParsedInstalledVersion);
             REQUIRE(actual[i].ParsedAvailableVersion == expected[i].ParsedAvailableVersion);
         }
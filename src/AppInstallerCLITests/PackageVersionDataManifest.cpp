@@ -77,6 +77,39 @@ TEST_CASE("PackageVersionDataManifest_Multiple", "[PackageVersionDataManifest]")
     }
 }
 
+TEST_CASE("PackageVersionDataManifest_Compact_RoundTrip", "[PackageVersionDataManifest]")
+{
+    PackageVersionDataManifest original;
+    original.AddVersion({ VersionAndChannel{ Version{ "1.0" }, Channel{} }, ".99", "1.01", "path", "hash" });
+    original.AddVersion({ VersionAndChannel{ Version{ "1.1" }, Channel{} }, "1.99", "2.01", "path2", "hash2" });
+    original.AddVersion({ VersionAndChannel{ Version{ "1.2" }, Channel{} }, {}, {}, "path2", "hash2" });
+    original.AddVersion({ VersionAndChannel{ Version{ "2.0" }, Channel{} }, "3.99", "15.01", "path4", "hash4" });
+
+    std::string serialized = original.Serialize(PackageVersionDataManifest::SerializationFormat::Compact_2_0);
+    REQUIRE(serialized.size() < original.Serialize().size());
+
+    PackageVersionDataManifest copy;
+    copy.Deserialize(serialized);
+
+    REQUIRE(original.Versions().size() == copy.Versions().size());
+
+    for (size_t i = 0; i < original.Versions().size(); ++i)
+    {
+        INFO(i);
+        RequireVersionDataEqual(copy.Versions()[i], original.Versions()[i]);
+    }
+}
+
+TEST_CASE("PackageVersionDataManifest_Compact_Empty", "[PackageVersionDataManifest]")
+{
+    PackageVersionDataManifest original;
+
+    PackageVersionDataManifest copy;
+    copy.Deserialize(original.Serialize(PackageVersionDataManifest::SerializationFormat::Compact_2_0));
+
+    REQUIRE(copy.Versions().empty());
+}
+
 TEST_CASE("PackageVersionDataManifest_CompressionRoundTrip", "[PackageVersionDataManifest]")
 {
     PackageVersionDataManifest original;
@@ -88,7 +121,19 @@ TEST_CASE("PackageVersionDataManifest_CompressionRoundTrip", "[PackageVersionDat
     std::string serialized = original.Serialize();
     auto compressed = PackageVersionDataManifest::CreateCompressor().Compress(serialized);
 
-    auto decompressed = PackageVersionDataManifest::CreateDecompressor().Decompress(compressed);
+    std::vector<uint8_t> decompressed;
+
+    SECTION("Created decompressor")
+    {
+        decompressed = PackageVersionDataManifest::CreateDecompressor().Decompress(compressed);
+    }
+    SECTION("Thread local decompressor")
+    {
+        decompressed = PackageVersionDataManifest::GetThreadLocalDecompressor().Decompress(compressed);
+
+        // The cached decompressor must produce the same result when reused.
+        REQUIRE(PackageVersionDataManifest::GetThreadLocalDecompressor().Decompress(compressed) == decompressed);
+    }
 
     PackageVersionDataManifest copy;
     copy.Deserialize(decompressed);
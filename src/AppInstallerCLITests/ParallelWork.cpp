@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <winget/ParallelWork.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace AppInstaller;
+
+TEST_CASE("ParallelWork_AllIndicesProcessedOnce", "[parallelwork]")
+{
+    constexpr size_t itemCount = 1000;
+    std::vector<std::atomic_size_t> counts(itemCount);
+
+    Parallel::ForEachIndex(itemCount, [&](size_t i)
+        {
+            counts[i]++;
+        });
+
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        REQUIRE(counts[i] == 1);
+    }
+}
+
+TEST_CASE("ParallelWork_EmptyAndSingle", "[parallelwork]")
+{
+    size_t invocations = 0;
+
+    Parallel::ForEachIndex(0, [&](size_t)
+        {
+            ++invocations;
+        });
+    REQUIRE(invocations == 0);
+
+    Parallel::ForEachIndex(1, [&](size_t i)
+        {
+            REQUIRE(i == 0);
+            ++invocations;
+        });
+    REQUIRE(invocations == 1);
+}
+
+TEST_CASE("ParallelWork_ExceptionPropagates", "[parallelwork]")
+{
+    constexpr size_t itemCount = 100;
+    std::atomic_size_t invocations{ 0 };
+
+    REQUIRE_THROWS_AS(
+        Parallel::ForEachIndex(itemCount, [&](size_t i)
+            {
+                invocations++;
+                if (i == 42)
+                {
+                    throw std::runtime_error("work item failure");
+                }
+            }),
+        std::runtime_error);
+
+    // Every item still runs; the failure is reported after the batch completes.
+    REQUIRE(invocations == itemCount);
+}
+
+TEST_CASE("ParallelWork_NestedInvocation", "[parallelwork]")
+{
+    constexpr size_t outerCount = 4;
+    constexpr size_t innerCount = 8;
+    std::atomic_size_t innerInvocations{ 0 };
+
+    Parallel::ForEachIndex(outerCount, [&](size_t)
+        {
+            Parallel::ForEachIndex(innerCount, [&](size_t)
+                {
+                    innerInvocations++;
+                });
+        });
+
+    REQUIRE(innerInvocations == outerCount * innerCount);
+}
+
+TEST_CASE("ParallelWork_MaxWorkersRespected", "[parallelwork]")
+{
+    constexpr size_t itemCount = 64;
+    std::atomic_size_t concurrent{ 0 };
+    std::atomic_size_t maxObserved{ 0 };
+
+    Parallel::ForEachIndex(itemCount, [&](size_t)
+        {
+            size_t current = ++concurrent;
+            size_t observed = maxObserved.load();
+            while (current > observed && !maxObserved.compare_exchange_weak(observed, current)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            --concurrent;
+        }, 2);
+
+    REQUIRE(maxObserved <= 2);
+}
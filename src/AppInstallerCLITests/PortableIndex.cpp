@@ -199,4 +199,34 @@ TEST_CASE("PortableIndex_RemoveWithId", "[portableIndex]")
         Portable_V1_0::PortableTable::DeleteById(connection, 1);
         REQUIRE_FALSE(Portable_V1_0::PortableTable::ExistsById(connection, 1));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("PortableIndex_BatchAddAndRemove", "[portableIndex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    std::vector<PortableFileEntry> portableFiles;
+    for (int i = 0; i < 3; ++i)
+    {
+        PortableFileEntry portableFile;
+        CreateFakePortableFile(portableFile);
+        portableFile.SetFilePath("testPortableFile" + std::to_string(i) + ".exe");
+        portableFiles.emplace_back(std::move(portableFile));
+    }
+
+    PortableIndex index = PortableIndex::CreateNew(tempFile, { 1, 0 });
+    index.AddOrUpdatePortableFiles(portableFiles);
+
+    for (const auto& portableFile : portableFiles)
+    {
+        REQUIRE(index.Exists(portableFile));
+    }
+
+    index.RemovePortableFiles(portableFiles);
+
+    {
+        // Open it directly to directly test table state
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadWrite);
+        REQUIRE(Schema::Portable_V1_0::PortableTable::IsEmpty(connection));
+    }
+}
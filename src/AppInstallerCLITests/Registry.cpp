@@ -108,6 +108,26 @@ TEST_CASE("EnumerateKeys", "[registry]")
     REQUIRE(subKeyNames.empty());
 }
 
+TEST_CASE("GetInfo", "[registry]")
+{
+    wil::unique_hkey root = RegCreateVolatileTestRoot();
+
+    std::vector<std::wstring> subKeyNames = { L"A", L"BEE", L"SEE" };
+    for (const auto& name : subKeyNames)
+    {
+        RegCreateVolatileSubKey(root.get(), name);
+    }
+
+    Key key{ root.get(), L"" };
+    Key::Info info = key.GetInfo();
+    REQUIRE(info.SubKeyCount == subKeyNames.size());
+
+    RegCreateVolatileSubKey(root.get(), L"deigh");
+    Key::Info updatedInfo = key.GetInfo();
+    REQUIRE(updatedInfo.SubKeyCount == subKeyNames.size() + 1);
+    REQUIRE(CompareFileTime(&info.LastWriteTime, &updatedInfo.LastWriteTime) <= 0);
+}
+
 TEST_CASE("Values_String", "[registry]")
 {
     std::wstring valueName = L"TestValueName";
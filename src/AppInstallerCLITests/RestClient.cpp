@@ -5,6 +5,7 @@
 #include "TestRestRequestHandler.h"
 #include <Rest/RestClient.h>
 #include <Rest/RestInformationCache.h>
+#include <Rest/RestResponseCache.h>
 #include <Rest/Schema/IRestClient.h>
 #include <Rest/Schema/InformationResponseDeserializer.h>
 #include <AppInstallerVersions.h>
@@ -669,3 +670,59 @@ TEST_CASE("RestInformationCache_Cache_Overwrite", "[RestInformationCache]")
     REQUIRE(cachedValue.has_value());
     REQUIRE(identifier2 == cachedValue->SourceIdentifier);
 }
+
+TEST_CASE("RestResponseCache_RoundTrip", "[RestResponseCache]")
+{
+    Settings::Stream{ Settings::Stream::RestResponseCache }.Remove();
+
+    auto digest = RestResponseCache::GetRequestDigest(L"https://test-url-com/packageManifests/Test.Id", {});
+    auto otherDigest = RestResponseCache::GetRequestDigest(L"https://test-url-com/packageManifests/Other.Id", {});
+    auto response = web::json::value::parse(R"({ "Data": { "PackageIdentifier": "Test.Id" } })");
+
+    RestResponseCache cache;
+    cache.Cache(digest, CacheControlPolicy{ L"max-age=100" }, response);
+
+    auto cachedValue = cache.Get(digest);
+    REQUIRE(cachedValue.has_value());
+    REQUIRE(response.serialize() == cachedValue->serialize());
+
+    REQUIRE(!cache.Get(otherDigest).has_value());
+}
+
+TEST_CASE("RestResponseCache_RequiresOptIn", "[RestResponseCache]")
+{
+    Settings::Stream{ Settings::Stream::RestResponseCache }.Remove();
+
+    auto digest = RestResponseCache::GetRequestDigest(L"https://test-url-com/manifestSearch", L"{}");
+    auto response = web::json::value::parse(R"({ "Data": [] })");
+
+    RestResponseCache cache;
+
+    // No cache-control header at all
+    cache.Cache(digest, {}, response);
+    REQUIRE(!cache.Get(digest).has_value());
+
+    // Explicitly not cacheable
+    cache.Cache(digest, CacheControlPolicy{ L"no-store" }, response);
+    REQUIRE(!cache.Get(digest).has_value());
+
+    // No lifetime provided
+    cache.Cache(digest, CacheControlPolicy{ L"public" }, response);
+    REQUIRE(!cache.Get(digest).has_value());
+}
+
+TEST_CASE("RestResponseCache_Expiration", "[RestResponseCache]")
+{
+    Settings::Stream{ Settings::Stream::RestResponseCache }.Remove();
+
+    auto digest = RestResponseCache::GetRequestDigest(L"https://test-url-com/manifestSearch", L"{}");
+
+    RestResponseCache cache;
+    cache.Cache(digest, CacheControlPolicy{ L"max-age=2" }, web::json::value::parse(R"({ "Data": [] })"));
+
+    REQUIRE(cache.Get(digest).has_value());
+
+    std::this_thread::sleep_for(5s);
+
+    REQUIRE(!cache.Get(digest).has_value());
+}
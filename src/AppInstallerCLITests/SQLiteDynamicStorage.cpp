@@ -41,3 +41,84 @@ TEST_CASE("SQLiteDynamicStorage_UpgradeDetection", "[sqlite_dynamic]")
     transactionLock = storage.TryBeginTransaction("test", false);
     REQUIRE(transactionLock);
 }
+
+TEST_CASE("SQLiteDynamicStorage_SnapshotRead", "[sqlite_dynamic]")
+{
+    TestCommon::TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteDynamicStorage storage{ tempFile.GetPath(), Version{ 1, 0 } };
+
+    // Snapshot reads are not available until enabled
+    REQUIRE(!storage.TryBeginSnapshotRead());
+
+    REQUIRE(storage.EnableSnapshotReads());
+
+    {
+        Builder::StatementBuilder createTable;
+        createTable.CreateTable("snapshottest").Columns({
+            Builder::ColumnBuilder("value", Builder::Type::Int64)
+            });
+        createTable.Execute(storage.GetConnection());
+
+        Builder::StatementBuilder insert;
+        insert.InsertInto("snapshottest").Values(1);
+        insert.Execute(storage.GetConnection());
+    }
+
+    auto snapshot = storage.TryBeginSnapshotRead();
+    REQUIRE(snapshot);
+
+    // A write that commits after the snapshot began must not be visible to it
+    {
+        auto transactionLock = storage.TryBeginTransaction("writer", true);
+        REQUIRE(transactionLock);
+
+        Builder::StatementBuilder insert;
+        insert.InsertInto("snapshottest").Values(2);
+        insert.Execute(storage.GetConnection());
+
+        transactionLock->Commit();
+    }
+
+    {
+        Builder::StatementBuilder count;
+        count.Select(Builder::RowCount).From("snapshottest");
+
+        Statement countStatement = count.Prepare(snapshot->GetConnection());
+        REQUIRE(countStatement.Step());
+        REQUIRE(countStatement.GetColumn<int>(0) == 1);
+    }
+
+    // A fresh snapshot sees the committed write
+    snapshot = storage.TryBeginSnapshotRead();
+    REQUIRE(snapshot);
+
+    {
+        Builder::StatementBuilder count;
+        count.Select(Builder::RowCount).From("snapshottest");
+
+        Statement countStatement = count.Prepare(snapshot->GetConnection());
+        REQUIRE(countStatement.Step());
+        REQUIRE(countStatement.GetColumn<int>(0) == 2);
+    }
+}
+
+TEST_CASE("SQLiteDynamicStorage_SnapshotRead_VersionChange", "[sqlite_dynamic]")
+{
+    TestCommon::TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteDynamicStorage storage{ tempFile.GetPath(), Version{ 1, 0 } };
+    REQUIRE(storage.EnableSnapshotReads());
+
+    // Update the database to version 2.0 behind the storage's back
+    {
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::Create);
+        Version version{ 2, 0 };
+        version.SetSchemaVersion(connection);
+    }
+
+    // The schema changed, so the snapshot is refused and the caller must take the locked path
+    REQUIRE(!storage.TryBeginSnapshotRead());
+}
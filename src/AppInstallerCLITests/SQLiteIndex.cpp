@@ -442,6 +442,113 @@ TEST_CASE("SQLiteIndexCreateLatestAndReopen", "[sqliteindex]")
     }
 }
 
+TEST_CASE("SQLiteIndexOpenFromBuffer", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteVersion versionCreated;
+
+    // Create the index with a manifest in it
+    {
+        SQLiteIndex index = SimpleTestSetup(tempFile, manifest);
+        versionCreated = index.GetVersion();
+    }
+
+    // Read the database file into memory
+    SQLite::blob_t databaseImage;
+    {
+        std::ifstream stream{ tempFile.GetPath(), std::ios_base::in | std::ios_base::binary | std::ios_base::ate };
+        REQUIRE(stream);
+        databaseImage.resize(static_cast<size_t>(stream.tellg()));
+        REQUIRE(!databaseImage.empty());
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(databaseImage.data()), static_cast<std::streamsize>(databaseImage.size()));
+        REQUIRE(stream);
+    }
+
+    // Open the in-memory image and verify that the contents are visible
+    SQLiteIndex index = SQLiteIndex::OpenFromBuffer(std::move(databaseImage));
+    REQUIRE(index.GetVersion() == versionCreated);
+
+    SearchRequest request;
+    request.Query = RequestMatch(MatchType::Exact, manifest.Id);
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+}
+
+TEST_CASE("SQLiteIndex_V2_1_FtsFallbackWhenUnusable", "[sqliteindex][V2_1]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+
+    {
+        SQLiteIndex index = SimpleTestSetup(tempFile, manifest, SQLiteVersion{ 2, 1 });
+        index.PrepareForPackaging();
+    }
+
+    SearchRequest request;
+    request.Query = RequestMatch(MatchType::Substring, "Test");
+
+    // The packaged index searches through the FTS table.
+    {
+        SQLiteIndex index = SQLiteIndex::Open(tempFile, SQLiteStorageBase::OpenDisposition::Read);
+        auto results = index.Search(request);
+        REQUIRE(results.Matches.size() == 1);
+    }
+
+    // Replace the FTS table with a plain table of the same name; the usability probe must
+    // reject it and search must fall back to the non-FTS path rather than failing.
+    {
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadWrite);
+        Statement::Create(connection, "DROP TABLE [packages_fts]").Execute();
+        Statement::Create(connection, "CREATE TABLE [packages_fts]([id] TEXT)").Execute();
+    }
+
+    {
+        SQLiteIndex index = SQLiteIndex::Open(tempFile, SQLiteStorageBase::OpenDisposition::Read);
+        auto results = index.Search(request);
+        REQUIRE(results.Matches.size() == 1);
+    }
+}
+
+TEST_CASE("SQLiteIndex_InterruptSearch_ScopedToOperation", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest);
+
+    // An interrupt for an operation that has no search running on the connection must be a
+    // no-op; in particular it must not fail searches that run afterward.
+    index.InterruptSearch(std::this_thread::get_id());
+    index.InterruptSearch(std::thread::id{});
+
+    SearchRequest request;
+    request.Query = RequestMatch(MatchType::Exact, manifest.Id);
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+
+    // A search run on a worker thread on behalf of another operation carries that
+    // operation's identity rather than its own thread's.
+    std::thread::id operationId = std::this_thread::get_id();
+    std::thread::id observedOperationId;
+    std::thread worker([&]()
+        {
+            SearchOperationIdScope operationIdScope{ operationId };
+            observedOperationId = GetCurrentSearchOperationId();
+            results = index.Search(request);
+        });
+    worker.join();
+    REQUIRE(observedOperationId == operationId);
+    REQUIRE(results.Matches.size() == 1);
+    REQUIRE(GetCurrentSearchOperationId() == operationId);
+}
+
 TEST_CASE("SQLiteIndexCreateAndAddManifest", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -466,6 +573,22 @@ TEST_CASE("SQLiteIndexCreateAndAddManifestFile", "[sqliteindex]")
     index.AddManifest(manifestFile, manifestPath);
 }
 
+TEST_CASE("SQLiteIndexAddManifestBatch", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile);
+
+    TestDataFile manifestFile{ "Manifest-Good.yaml" };
+    std::filesystem::path manifestPath{ "microsoft/msixsdk/microsoft.msixsdk-1.7.32.yaml" };
+
+    index.AddManifestBatch({ { manifestFile, manifestPath } });
+
+    // A batch containing an already present manifest fails and is rolled back as a whole.
+    REQUIRE_THROWS_HR(index.AddManifestBatch({ { manifestFile, manifestPath } }), HRESULT_FROM_WIN32(ERROR_ALREADY_EXISTS));
+}
+
 TEST_CASE("SQLiteIndexCreateAndAddManifestDuplicate", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -559,6 +682,43 @@ TEST_CASE("SQLiteIndex_AddUpdateRemoveManifestWithDependencies", "[sqliteindex][
     index.RemoveManifest(manifest);
 }
 
+TEST_CASE("SQLiteIndex_GetDependencyClosureByManifestRowIds", "[sqliteindex][V1_4]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest leafManifest, midManifest, rootManifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, leafManifest, SQLiteVersion::Latest());
+
+    auto& publisher2 = "Test2";
+    CreateFakeManifest(midManifest, publisher2);
+    midManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, leafManifest.Id, "1.0.0"));
+    index.AddManifest(midManifest, GetPathFromManifest(midManifest));
+
+    auto& publisher3 = "Test3";
+    CreateFakeManifest(rootManifest, publisher3);
+    rootManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, midManifest.Id, "1.0.0"));
+    index.AddManifest(rootManifest, GetPathFromManifest(rootManifest));
+
+    auto rootManifestId = index.GetManifestIdByManifest(rootManifest);
+    REQUIRE(rootManifestId.has_value());
+
+    // The closure of the root must contain both the direct and the transitive dependency.
+    auto closure = index.GetDependencyClosureByManifestRowIds({ rootManifestId.value() });
+    REQUIRE(closure.size() == 2);
+
+    Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadOnly);
+    auto midPackageRowId = Schema::V1_0::IdTable::SelectIdByValue(connection, midManifest.Id);
+    auto leafPackageRowId = Schema::V1_0::IdTable::SelectIdByValue(connection, leafManifest.Id);
+    REQUIRE(midPackageRowId.has_value());
+    REQUIRE(leafPackageRowId.has_value());
+    REQUIRE(closure.find({ midPackageRowId.value(), "1.0.0" }) != closure.end());
+    REQUIRE(closure.find({ leafPackageRowId.value(), "1.0.0" }) != closure.end());
+
+    // An empty input produces an empty closure.
+    REQUIRE(index.GetDependencyClosureByManifestRowIds({}).empty());
+}
+
 TEST_CASE("SQLiteIndex_AddManifestWithDependencies_MissingPackage", "[sqliteindex][V1_4]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -801,6 +961,34 @@ TEST_CASE("SQLiteIndex_RemoveManifest", "[sqliteindex][V1_0]")
     REQUIRE(Schema::V1_0::CommandsTable::IsEmpty(connection));
 }
 
+TEST_CASE("SQLiteIndex_ContainsManifest", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest);
+
+    // The first probe seeds the key set from the database.
+    REQUIRE(index.ContainsManifest(manifest));
+
+    Manifest other = manifest;
+    other.Id = "test.other";
+    REQUIRE_FALSE(index.ContainsManifest(other));
+
+    // Changes made through this object are reflected without reseeding.
+    index.AddManifest(other, "test/other/test.other-1.0.0.yaml");
+    REQUIRE(index.ContainsManifest(other));
+
+    index.RemoveManifest(manifest);
+    REQUIRE_FALSE(index.ContainsManifest(manifest));
+
+    // Matching is case insensitive, like the database lookups.
+    Manifest upperCase = other;
+    upperCase.Id = "TEST.Other";
+    REQUIRE(index.ContainsManifest(upperCase));
+}
+
 TEST_CASE("SQLiteIndex_RemoveManifestWithDependencies", "[sqliteindex][V1_4]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -2574,6 +2762,36 @@ TEST_CASE("SQLiteIndex_Search_Query_ProductCodeMatch", "[sqliteindex]")
     }
 }
 
+TEST_CASE("SQLiteIndex_Search_SystemReferenceStringExactInclusions", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = SearchTestSetup(tempFile, {
+        { "Id1", "Name1", "Moniker", "Version", "Channel", { "Tag" }, { "Command" }, "Path1", { "PFN1" }, { "PC1" } },
+        { "Id2", "Name2", "Moniker", "Version", "Channel", { "ID3" }, { "Command" }, "Path2", { "PFN2" }, { "PC2" } },
+        { "Id3", "Name3", "Moniker", "Version", "Channel", { "Tag" }, { "Command" }, "Path3", { "PFN3" }, { "PC3" } },
+        });
+
+    SQLiteVersion testVersion = TestPrepareForRead(index);
+
+    // The shape of an installed correlation probe: only exact system reference string matches.
+    SearchRequest request;
+    request.Inclusions.emplace_back(PackageMatchField::PackageFamilyName, MatchType::Exact, "pfn1");
+    request.Inclusions.emplace_back(PackageMatchField::ProductCode, MatchType::Exact, "pc2");
+
+    auto results = index.Search(request);
+
+    if (ArePackageFamilyNameAndProductCodeSupported(index, testVersion))
+    {
+        REQUIRE(results.Matches.size() == 2);
+    }
+    else
+    {
+        REQUIRE(results.Matches.size() == 0);
+    }
+}
+
 TEST_CASE("SQLiteIndex_Search_PackageFamilyNameSubstring", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -2851,6 +3069,49 @@ TEST_CASE("SQLiteIndex_GetMultiProperty_Command", "[sqliteindex]")
     REQUIRE(props[0] == "Command");
 }
 
+TEST_CASE("SQLiteIndex_GetMultiProperty_Batched", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = SearchTestSetup(tempFile, {
+        { "Id1", "Name1", "Moniker", "Version", "Channel", { "Tag1", "Tag2" }, { "Command" }, "Path1", {}, { "PC1", "PC2" } },
+        { "Id2", "Name2", "Moniker", "Version", "Channel", {}, { "Command" }, "Path2", {}, {} },
+        });
+
+    SQLiteVersion testVersion = TestPrepareForRead(index);
+
+    SearchRequest request;
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 2);
+
+    SQLiteIndex::IdType id1 = 0;
+    SQLiteIndex::IdType id2 = 0;
+    for (const auto& match : results.Matches)
+    {
+        if (index.GetPropertyByPrimaryId(match.first, PackageVersionProperty::Id).value() == "Id1")
+        {
+            id1 = match.first;
+        }
+        else
+        {
+            id2 = match.first;
+        }
+    }
+
+    auto props = index.GetMultiPropertyByPrimaryIds({ id1, id2 }, PackageVersionMultiProperty::Tag);
+
+    // Only the package with tags is present in the result.
+    REQUIRE(props.size() == 1);
+    REQUIRE(props.count(id1) == 1);
+
+    const auto& tags = props[id1];
+    REQUIRE(tags.size() == 2);
+    REQUIRE(std::find(tags.begin(), tags.end(), "Tag1") != tags.end());
+    REQUIRE(std::find(tags.begin(), tags.end(), "Tag2") != tags.end());
+}
+
 TEST_CASE("SQLiteIndex_ManifestMetadata", "[sqliteindex][V1_7]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -3963,3 +4224,101 @@ TEST_CASE("SQLiteIndex_VersionStringPreserved", "[sqliteindex]")
 
     REQUIRE(extractedVersion == version);
 }
+
+TEST_CASE("SQLiteIndex_Statistics", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile);
+
+    SQLiteIndex::Statistics statistics = index.GetStatistics();
+    REQUIRE(statistics.PackageCount == 0);
+    REQUIRE(statistics.VersionCount == 0);
+
+    // The first call cached the counts; subsequent writes must keep them accurate.
+    Manifest manifest1;
+    CreateFakeManifest(manifest1, "Test", "1.0.0");
+    index.AddManifest(manifest1, GetPathFromManifest(manifest1));
+
+    Manifest manifest1v2;
+    CreateFakeManifest(manifest1v2, "Test", "2.0.0");
+    index.AddManifest(manifest1v2, GetPathFromManifest(manifest1v2));
+
+    Manifest manifest2;
+    CreateFakeManifest(manifest2, "Other", "1.0.0");
+    index.AddManifest(manifest2, GetPathFromManifest(manifest2));
+
+    statistics = index.GetStatistics();
+    REQUIRE(statistics.PackageCount == 2);
+    REQUIRE(statistics.VersionCount == 3);
+
+    index.RemoveManifest(manifest1);
+
+    statistics = index.GetStatistics();
+    REQUIRE(statistics.PackageCount == 2);
+    REQUIRE(statistics.VersionCount == 2);
+
+    index.RemoveManifest(manifest1v2);
+
+    statistics = index.GetStatistics();
+    REQUIRE(statistics.PackageCount == 1);
+    REQUIRE(statistics.VersionCount == 1);
+}
+
+TEST_CASE("SQLiteIndex_Statistics_AfterPackaging", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest);
+
+    Manifest secondVersion;
+    CreateFakeManifest(secondVersion, "Test", "2.0.0");
+    index.AddManifest(secondVersion, GetPathFromManifest(secondVersion));
+
+    SQLiteVersion testVersion = TestPrepareForRead(index);
+
+    SQLiteIndex::Statistics statistics = index.GetStatistics();
+    REQUIRE(statistics.PackageCount == 1);
+
+    if (testVersion.MajorVersion == 2)
+    {
+        // A packaged 2.0 index holds only the latest version of each package.
+        REQUIRE(statistics.VersionCount == 1);
+    }
+    else
+    {
+        REQUIRE(statistics.VersionCount == 2);
+    }
+}
+
+TEST_CASE("SQLiteIndex_SearchBudget", "[sqliteindex]")
+{
+    // A zero budget never expires.
+    Schema::SearchBudget unlimited{ std::chrono::milliseconds::zero() };
+    REQUIRE(!unlimited.IsExhausted());
+    REQUIRE(!unlimited.WasExhausted());
+
+    // A tiny budget expires and stays expired.
+    Schema::SearchBudget tiny{ std::chrono::milliseconds{ 1 } };
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+    REQUIRE(tiny.IsExhausted());
+    REQUIRE(tiny.WasExhausted());
+
+    // A generous budget does not disturb the search results.
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest);
+
+    SearchRequest request;
+    request.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Id, MatchType::Exact, manifest.Id));
+    request.TimeBudget = std::chrono::minutes{ 5 };
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+    REQUIRE(!results.Truncated);
+}
@@ -234,6 +234,41 @@ TEST_CASE("SQLiteIndexSource_IsSame", "[sqliteindexsource]")
     REQUIRE(result1.Matches[0].Package->GetAvailable()[0]->IsSame(result2.Matches[0].Package->GetAvailable()[0].get()));
 }
 
+TEST_CASE("SQLiteIndexSource_GetSharedOrOpen", "[sqliteindexsource]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SourceDetails details;
+    Manifest manifest;
+    std::string relativePath;
+    std::shared_ptr<SQLiteIndexSource> source = SimpleTestSetup(tempFile, details, manifest, relativePath);
+
+    std::filesystem::path key = tempFile.GetPath();
+
+    size_t openCalls = 0;
+    auto open = [&]() { ++openCalls; return source; };
+
+    auto first = SQLiteIndexSource::GetSharedOrOpen(key, open);
+    REQUIRE(openCalls == 1);
+    REQUIRE(first.get() == source.get());
+
+    // A second request for the same file shares the already open source.
+    auto second = SQLiteIndexSource::GetSharedOrOpen(key, open);
+    REQUIRE(openCalls == 1);
+    REQUIRE(second.get() == source.get());
+
+    // Once every reference has been released, the file is opened again;
+    // an empty result (as from a cancelled open) is not cached.
+    first.reset();
+    second.reset();
+    source.reset();
+
+    auto third = SQLiteIndexSource::GetSharedOrOpen(key, [&]() { ++openCalls; return std::shared_ptr<SQLiteIndexSource>{}; });
+    REQUIRE(openCalls == 2);
+    REQUIRE(!third);
+}
+
 TEST_CASE("SQLiteIndexSource_Package_ProductCodes", "[sqliteindexsource]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -112,6 +112,74 @@ TEST_CASE("SQLiteWrapperMemoryCreate", "[sqlitewrapper]")
     SelectFromSimpleTestTableOnlyOneRow(connection, firstVal, secondVal);
 }
 
+TEST_CASE("SQLiteWrapperCachedStatementReuse", "[sqlitewrapper]")
+{
+    Connection connection = Connection::Create(SQLITE_MEMORY_DB_CONNECTION_TARGET, Connection::OpenDisposition::Create);
+
+    CreateSimpleTestTable(connection);
+
+    InsertIntoSimpleTestTable(connection, 1, "test");
+    InsertIntoSimpleTestTable(connection, 2, "test2");
+
+    std::string select = "select first from simpletest where second = ?";
+
+    {
+        Statement statement = Statement::CreateCached(connection, select);
+        statement.Bind(1, "test"s);
+        REQUIRE(statement.Step());
+        REQUIRE(statement.GetColumn<int>(0) == 1);
+    }
+
+    // The second use gets the cached statement back, reset and with cleared bindings.
+    {
+        Statement statement = Statement::CreateCached(connection, select);
+        REQUIRE(statement.GetState() == Statement::State::Prepared);
+        statement.Bind(1, "test2"s);
+        REQUIRE(statement.Step());
+        REQUIRE(statement.GetColumn<int>(0) == 2);
+        REQUIRE_FALSE(statement.Step());
+    }
+}
+
+TEST_CASE("SQLiteWrapperBindValueSetChunk", "[sqlitewrapper]")
+{
+    Connection connection = Connection::Create(SQLITE_MEMORY_DB_CONNECTION_TARGET, Connection::OpenDisposition::Create);
+
+    CreateSimpleTestTable(connection);
+
+    // More values than one chunk to force both a full and a null padded chunk.
+    std::vector<int> values;
+    for (int i = 0; i < static_cast<int>(ValueSetChunkSize) + 10; ++i)
+    {
+        InsertIntoSimpleTestTable(connection, i, std::to_string(i));
+        values.push_back(i);
+    }
+
+    Builder::StatementBuilder builder;
+    builder.Select(s_firstColumn).From(s_tableName).Where(s_firstColumn).In(ValueSetChunkSize);
+
+    Statement statement = builder.PrepareCached(connection);
+
+    std::vector<int> found;
+
+    for (size_t offset = 0; offset < values.size(); offset += ValueSetChunkSize)
+    {
+        if (offset != 0)
+        {
+            statement.Reset();
+        }
+
+        statement.BindValueSetChunk(1, values, offset, ValueSetChunkSize);
+
+        while (statement.Step())
+        {
+            found.push_back(statement.GetColumn<int>(0));
+        }
+    }
+
+    REQUIRE(found == values);
+}
+
 TEST_CASE("SQLiteWrapperFileCreateAndReopen", "[sqlitewrapper]")
 {
     TestCommon::TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -312,6 +380,24 @@ TEST_CASE("SQLiteWrapper_PrepareFailure", "[sqlitewrapper]")
     REQUIRE_THROWS_HR(builder.Prepare(connection), MAKE_HRESULT(SEVERITY_ERROR, FACILITY_SQLITE, SQLITE_ERROR));
 }
 
+TEST_CASE("SQLiteWrapper_Interrupt", "[sqlitewrapper]")
+{
+    Connection connection = Connection::Create(SQLITE_MEMORY_DB_CONNECTION_TARGET, Connection::OpenDisposition::Create);
+
+    // A query that runs until interrupted.
+    Statement statement = Statement::Create(connection, "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c) SELECT x FROM c WHERE x = 0");
+
+    std::thread interruptThread([&]()
+        {
+            std::this_thread::sleep_for(100ms);
+            connection.Interrupt();
+        });
+
+    REQUIRE_THROWS_HR(statement.Step(), MAKE_HRESULT(SEVERITY_ERROR, FACILITY_SQLITE, SQLITE_INTERRUPT));
+
+    interruptThread.join();
+}
+
 TEST_CASE("SQLiteWrapper_BusyTimeout_None", "[sqlitewrapper]")
 {
     TestCommon::TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
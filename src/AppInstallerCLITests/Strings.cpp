@@ -20,6 +20,9 @@ TEST_CASE("UTF8Length", "[strings]")
     REQUIRE(UTF8Length("bye\xE2\x80\xA6") == 4); // "bye…"
     REQUIRE(UTF8Length("\xf0\x9f\xa6\x86") == 1); // [duck emoji]
     REQUIRE(UTF8Length("\xf0\x9d\x85\xa0\xf0\x9d\x85\xa0") == 2); // [8th note][8th note]
+    REQUIRE(UTF8Length("an ascii string long enough for the bulk path") == 45);
+    REQUIRE(UTF8Length("long enough for the bulk path K\xC3\xA4se") == 34); // "Käse"
+    REQUIRE(UTF8Length("\r\n") == 1); // CRLF is a single grapheme cluster
 }
 
 TEST_CASE("UTF8Substring", "[strings]")
@@ -53,6 +56,8 @@ TEST_CASE("UTF8ColumnWidth", "[strings]")
     REQUIRE(UTF8ColumnWidth("\xf0\x9d\x85\xa0\xf0\x9d\x85\xa0") == 2); // [8th note][8th note]
     REQUIRE(UTF8ColumnWidth("\xe6\xb5\x8b\xe8\xaf\x95") == 4); // 测试
     REQUIRE(UTF8ColumnWidth("te\xe6\xb5\x8bs\xe8\xaf\x95t") == 8); // te测s试t
+    REQUIRE(UTF8ColumnWidth("an ascii string long enough for the bulk path") == 45);
+    REQUIRE(UTF8ColumnWidth("long enough for the bulk path \xe6\xb5\x8b") == 32); // 测
 }
 
 TEST_CASE("UTF8TrimRightToColumnWidth", "[strings]")
@@ -83,6 +88,9 @@ TEST_CASE("Normalize", "[strings]")
 
     // Ligature fi => f + i
     REQUIRE(Normalize(u8"\xFB01") == u8"fi");
+
+    // A non-ASCII character past the ASCII fast path chunk size still normalizes
+    REQUIRE(Normalize(u8"LongAsciiPrefix\x41\x308") == u8"LongAsciiPrefix\xC4");
 }
 
 TEST_CASE("NormalizedString", "[strings]")
@@ -142,6 +150,23 @@ TEST_CASE("FoldCase", "[strings]")
     REQUIRE(FoldCase("foldcase"sv) == FoldCase("FOLDCASE"sv));
     REQUIRE(FoldCase(u8"f\xF6ldcase"sv) == FoldCase(u8"F\xD6LDCASE"sv));
     REQUIRE(FoldCase(u8"foldc\x430se"sv) == FoldCase(u8"FOLDC\x410SE"sv));
+
+    // The ASCII fast path agrees with full case folding
+    REQUIRE(FoldCase("MiXeD-Case_Identifier.123!"sv) == "mixed-case_identifier.123!");
+}
+
+TEST_CASE("GenerateSortKey", "[strings]")
+{
+    REQUIRE(GenerateSortKey("").empty());
+
+    // Byte comparison of keys matches case-insensitive collation of the sources
+    REQUIRE(GenerateSortKey("alpha") == GenerateSortKey("ALPHA"));
+    REQUIRE(GenerateSortKey("alpha") < GenerateSortKey("beta"));
+    REQUIRE(GenerateSortKey("Beta") > GenerateSortKey("alpha"));
+    REQUIRE(GenerateSortKey("alpha") < GenerateSortKey("alphabet"));
+
+    // Accented characters collate with their base letter rather than after 'z'
+    REQUIRE(GenerateSortKey("\xC3\xA9clair") < GenerateSortKey("zebra"));
 }
 
 TEST_CASE("ExpandEnvironmentVariables", "[strings]")
@@ -158,6 +183,44 @@ TEST_CASE("ExpandEnvironmentVariables", "[strings]")
     REQUIRE(ExpandEnvironmentVariables(L"%TEMP%") == tempPath);
 }
 
+TEST_CASE("ConvertIntoBuffer", "[strings]")
+{
+    std::string utf8 = "\xe6\xb5\x8b\xe8\xaf\x95";
+    std::wstring utf16 = ConvertToUTF16(utf8);
+
+    std::wstring wideBuffer = L"previous contents";
+    ConvertToUTF16(utf8, wideBuffer);
+    REQUIRE(wideBuffer == utf16);
+
+    std::string narrowBuffer = "previous contents";
+    ConvertToUTF8(utf16, narrowBuffer);
+    REQUIRE(narrowBuffer == utf8);
+
+    ConvertToUTF16("", wideBuffer);
+    REQUIRE(wideBuffer.empty());
+
+    ConvertToUTF8(L"", narrowBuffer);
+    REQUIRE(narrowBuffer.empty());
+}
+
+TEST_CASE("StackUTF16", "[strings]")
+{
+    std::string shortString = "\xe6\xb5\x8b\xe8\xaf\x95";
+    StackUTF16 shortConverted{ shortString };
+    REQUIRE(shortConverted.get() == ConvertToUTF16(shortString));
+    REQUIRE(shortConverted.c_str()[shortConverted.get().size()] == L'\0');
+
+    StackUTF16 emptyConverted{ "" };
+    REQUIRE(emptyConverted.get().empty());
+    REQUIRE(emptyConverted.c_str()[0] == L'\0');
+
+    // Larger than the stack buffer, forcing the heap fallback.
+    std::string longString(1024, 'a');
+    StackUTF16 longConverted{ longString };
+    REQUIRE(longConverted.get() == ConvertToUTF16(longString));
+    REQUIRE(longConverted.c_str()[longConverted.get().size()] == L'\0');
+}
+
 TEST_CASE("PathOutput", "[strings]")
 {
     std::string original = "\xe6\xb5\x8b\xe8\xaf\x95";
@@ -242,6 +305,8 @@ TEST_CASE("HexStrings", "[strings]")
 
     REQUIRE(value == ConvertToHexString(buffer));
     REQUIRE(std::equal(buffer.begin(), buffer.end(), ParseFromHexString(value).begin()));
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), ParseFromHexString("000102030405060708090A0B0C0D0E0F").begin()));
+    REQUIRE_THROWS_HR(ParseFromHexString("0g"), E_INVALIDARG);
 }
 
 TEST_CASE("Join", "[strings]")
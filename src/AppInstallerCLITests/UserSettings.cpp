@@ -681,6 +681,26 @@ TEST_CASE("SettingsMaxResumes", "[settings]")
     }
 }
 
+TEST_CASE("SettingsUpgradePrefetchCount", "[settings]")
+{
+    auto again = DeleteUserSettingsFiles();
+
+    SECTION("Default is disabled")
+    {
+        UserSettingsTest userSettingTest;
+
+        REQUIRE(userSettingTest.Get<Setting::NetworkUpgradePrefetchCount>() == 0);
+    }
+    SECTION("Modify upgrade prefetch count")
+    {
+        std::string_view json = R"({ "network": { "upgradePrefetchCount": 5 } })";
+        SetSetting(Stream::PrimaryUserSettings, json);
+        UserSettingsTest userSettingTest;
+
+        REQUIRE(userSettingTest.Get<Setting::NetworkUpgradePrefetchCount>() == 5);
+    }
+}
+
 TEST_CASE("LoggingChannels", "[settings]")
 {
     auto again = DeleteUserSettingsFiles();
@@ -29,6 +29,19 @@ TEST_CASE("VersionParse", "[versions]")
     }
 }
 
+TEST_CASE("VersionParseRepeated", "[versions]")
+{
+    // The second parse of the same input is served from the parse cache.
+    Version first("1.2.3.4-alpha");
+    Version second("1.2.3.4-alpha");
+    REQUIRE(first == second);
+    REQUIRE(first.GetParts().size() == second.GetParts().size());
+
+    // The same string with different split characters parses differently.
+    Version differentSplit("1.2.3.4-alpha", ".-");
+    REQUIRE(differentSplit.GetParts().size() == 5);
+}
+
 TEST_CASE("VersionParsePlusDash", "[versions]")
 {
     Version version("1.2.3.4-alpha", ".-");
@@ -37,6 +37,9 @@ TEST_CASE("YamlParserTypes", "[YAML]")
 
     auto localTag = document["LocalTag"];
     CHECK(localTag.GetTagType() == Node::TagType::Unknown);
+
+    // The view accessor sees the same value as the copying one.
+    CHECK(strTrue.as<std::string_view>() == strTrue.as<std::string>());
 }
 
 TEST_CASE("YamlMergeMappingNode", "[YAML]")
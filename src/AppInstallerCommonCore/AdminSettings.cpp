@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "AppInstallerLogging.h"
 #include "AppInstallerStrings.h"
+#include "Public/AppInstallerSHA256.h"
 #include "winget/Settings.h"
 #include "winget/AdminSettings.h"
 #include "winget/GroupPolicy.h"
@@ -52,6 +53,39 @@ namespace AppInstaller::Settings
             std::optional<std::string> DefaultProxy;
         };
 
+        // Caches the values parsed from the most recently seen stream contents, keyed by the
+        // content hash. The admin settings are consulted on several paths within a single
+        // command and each query constructs a fresh reader; the stream still has to be read
+        // every time so that changes made by other processes are observed, but parsing the
+        // same bytes again is wasted work.
+        struct ParsedAdminSettingsCache
+        {
+            std::optional<AdminSettingValues> TryGet(const Utility::SHA256::HashBuffer& hash)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                if (m_hash && Utility::SHA256::AreEqual(m_hash.value(), hash))
+                {
+                    return m_values;
+                }
+
+                return std::nullopt;
+            }
+
+            void Store(Utility::SHA256::HashBuffer&& hash, const AdminSettingValues& values)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                m_hash = std::move(hash);
+                m_values = values;
+            }
+
+        private:
+            std::mutex m_lock;
+            std::optional<Utility::SHA256::HashBuffer> m_hash;
+            AdminSettingValues m_values;
+        };
+
+        ParsedAdminSettingsCache s_parsedAdminSettingsCache;
+
         struct AdminSettingsInternal
         {
             AdminSettingsInternal();
@@ -211,6 +245,13 @@ namespace AppInstaller::Settings
 
             std::string adminSettingsYaml = Utility::ReadEntireStream(*stream);
 
+            Utility::SHA256::HashBuffer contentHash = Utility::SHA256::ComputeHash(adminSettingsYaml);
+            if (auto cachedValues = s_parsedAdminSettingsCache.TryGet(contentHash))
+            {
+                m_settingValues = std::move(cachedValues).value();
+                return;
+            }
+
             YAML::Node document;
             try
             {
@@ -247,6 +288,8 @@ namespace AppInstaller::Settings
                 m_settingValues.DefaultProxy.emplace(std::move(defaultProxy));
             }
 
+            s_parsedAdminSettingsCache.Store(std::move(contentHash), m_settingValues);
+
             AICLI_LOG(Core, Verbose, << "Admin settings loaded successfully");
         }
 
@@ -45,6 +45,90 @@ namespace AppInstaller::Logging
             Telemetry().LogFailure(info);
         }
 
+        // Whether event formatting and emission should move off of the calling thread.
+        std::atomic_bool s_asyncTelemetryEnabled{ false };
+
+        // Bounded queue that moves telemetry formatting and emission to a background thread.
+        // When the queue is full the caller emits inline rather than dropping the event.
+        struct AsyncTelemetryQueue
+        {
+            static constexpr size_t s_capacity = 64;
+
+            static AsyncTelemetryQueue& Instance()
+            {
+                static AsyncTelemetryQueue instance;
+                return instance;
+            }
+
+            ~AsyncTelemetryQueue()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    m_stopping = true;
+                }
+                m_wake.notify_all();
+
+                if (m_worker.joinable())
+                {
+                    m_worker.join();
+                }
+            }
+
+            bool TryEnqueue(std::function<void()>&& work)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    if (m_stopping || m_queue.size() >= s_capacity)
+                    {
+                        return false;
+                    }
+
+                    if (!m_worker.joinable())
+                    {
+                        m_worker = std::thread(&AsyncTelemetryQueue::Run, this);
+                    }
+
+                    m_queue.emplace_back(std::move(work));
+                }
+
+                m_wake.notify_one();
+                return true;
+            }
+
+        private:
+            void Run()
+            {
+                std::unique_lock<std::mutex> lock{ m_lock };
+                for (;;)
+                {
+                    m_wake.wait(lock, [&]() { return m_stopping || !m_queue.empty(); });
+
+                    // Drain any remaining events before stopping.
+                    if (m_queue.empty())
+                    {
+                        return;
+                    }
+
+                    std::function<void()> work = std::move(m_queue.front());
+                    m_queue.pop_front();
+
+                    lock.unlock();
+                    try
+                    {
+                        work();
+                    }
+                    CATCH_LOG();
+                    lock.lock();
+                }
+            }
+
+            std::mutex m_lock;
+            std::condition_variable m_wake;
+            std::deque<std::function<void()>> m_queue;
+            std::thread m_worker;
+            bool m_stopping = false;
+        };
+
         FailureTypeEnum ConvertWilFailureTypeToFailureType(wil::FailureType failureType)
         {
             switch (failureType)
@@ -192,32 +276,40 @@ namespace AppInstaller::Logging
     {
         if (IsTelemetryEnabled())
         {
-            auto anonMessage = AnonymizeString(failure.pszMessage);
-
-            AICLI_TraceLoggingWriteActivity(
-                "FailureInfo",
-                TraceLoggingUInt32(m_subExecutionId, "SubExecutionId"),
-                TraceLoggingHResult(failure.hr, "HResult"),
-                AICLI_TraceLoggingWStringView(anonMessage, "Message"),
-                TraceLoggingString(failure.pszModule, "Module"),
-                TraceLoggingUInt32(failure.threadId, "ThreadId"),
-                TraceLoggingUInt32(static_cast<uint32_t>(failure.type), "Type"),
-                TraceLoggingString(failure.pszFile, "File"),
-                TraceLoggingUInt32(failure.uLineNumber, "Line"),
-                TraceLoggingUInt32(m_executionStage, "ExecutionStage"),
-                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
-                TraceLoggingKeyword(MICROSOFT_KEYWORD_CRITICAL_DATA));
+            std::wstring message = StringOrEmptyIfNull(failure.pszMessage);
+            std::string module = StringOrEmptyIfNull(failure.pszModule);
+            std::string file = StringOrEmptyIfNull(failure.pszFile);
+            bool messageIsAnonymized = false;
 
             if (m_useSummary)
             {
+                message = AnonymizeString(message);
+                messageIsAnonymized = true;
+
                 m_summary.FailureHResult = failure.hr;
-                m_summary.FailureMessage = anonMessage;
-                m_summary.FailureModule = StringOrEmptyIfNull(failure.pszModule);
+                m_summary.FailureMessage = message;
+                m_summary.FailureModule = module;
                 m_summary.FailureThreadId = failure.threadId;
                 m_summary.FailureType = ConvertWilFailureTypeToFailureType(failure.type);
-                m_summary.FailureFile = StringOrEmptyIfNull(failure.pszFile);
+                m_summary.FailureFile = file;
                 m_summary.FailureLine = failure.uLineNumber;
             }
+
+            bool deferred = false;
+            if (s_asyncTelemetryEnabled)
+            {
+                deferred = AsyncTelemetryQueue::Instance().TryEnqueue(
+                    [logger = *this, hr = failure.hr, threadId = failure.threadId, type = static_cast<uint32_t>(failure.type),
+                     message, module, file, line = failure.uLineNumber, messageIsAnonymized]()
+                    {
+                        logger.EmitFailureTelemetry(hr, threadId, type, message, module, file, line, messageIsAnonymized);
+                    });
+            }
+
+            if (!deferred)
+            {
+                EmitFailureTelemetry(failure.hr, failure.threadId, static_cast<uint32_t>(failure.type), message, module, file, failure.uLineNumber, messageIsAnonymized);
+            }
         }
 
         // Also send failure to the log
@@ -347,21 +439,31 @@ namespace AppInstaller::Logging
 
         if (IsTelemetryEnabled())
         {
-            auto anonMessage = AnonymizeString(Utility::ConvertToUTF16(message));
-
-            AICLI_TraceLoggingWriteActivity(
-                "Exception",
-                TraceLoggingUInt32(m_subExecutionId, "SubExecutionId"),
-                AICLI_TraceLoggingStringView(exceptionTypeString, "Type"),
-                AICLI_TraceLoggingWStringView(anonMessage, "Message"),
-                TraceLoggingUInt32(m_executionStage, "ExecutionStage"),
-                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
-                TraceLoggingKeyword(MICROSOFT_KEYWORD_CRITICAL_DATA));
+            std::wstring messageUTF16 = Utility::ConvertToUTF16(message);
+            bool messageIsAnonymized = false;
 
             if (m_useSummary)
             {
+                messageUTF16 = AnonymizeString(messageUTF16);
+                messageIsAnonymized = true;
+
                 m_summary.FailureType = type;
-                m_summary.FailureMessage = anonMessage;
+                m_summary.FailureMessage = messageUTF16;
+            }
+
+            bool deferred = false;
+            if (s_asyncTelemetryEnabled)
+            {
+                deferred = AsyncTelemetryQueue::Instance().TryEnqueue(
+                    [logger = *this, type, messageUTF16, messageIsAnonymized]()
+                    {
+                        logger.EmitExceptionTelemetry(type, messageUTF16, messageIsAnonymized);
+                    });
+            }
+
+            if (!deferred)
+            {
+                EmitExceptionTelemetry(type, messageUTF16, messageIsAnonymized);
             }
         }
 
@@ -970,6 +1072,40 @@ namespace AppInstaller::Logging
     }
     catch (...) { return std::wstring{ input }; }
 
+    void TelemetryTraceLogger::EmitFailureTelemetry(HRESULT hr, uint32_t threadId, uint32_t type, const std::wstring& message, const std::string& module, const std::string& file, uint32_t line, bool messageIsAnonymized) const noexcept
+    {
+        std::wstring anonMessage = messageIsAnonymized ? message : AnonymizeString(message);
+
+        AICLI_TraceLoggingWriteActivity(
+            "FailureInfo",
+            TraceLoggingUInt32(m_subExecutionId, "SubExecutionId"),
+            TraceLoggingHResult(hr, "HResult"),
+            AICLI_TraceLoggingWStringView(anonMessage, "Message"),
+            TraceLoggingString(module.c_str(), "Module"),
+            TraceLoggingUInt32(threadId, "ThreadId"),
+            TraceLoggingUInt32(type, "Type"),
+            TraceLoggingString(file.c_str(), "File"),
+            TraceLoggingUInt32(line, "Line"),
+            TraceLoggingUInt32(m_executionStage, "ExecutionStage"),
+            TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_CRITICAL_DATA));
+    }
+
+    void TelemetryTraceLogger::EmitExceptionTelemetry(FailureTypeEnum type, const std::wstring& message, bool messageIsAnonymized) const noexcept
+    {
+        auto exceptionTypeString = LogExceptionTypeToString(type);
+        std::wstring anonMessage = messageIsAnonymized ? message : AnonymizeString(message);
+
+        AICLI_TraceLoggingWriteActivity(
+            "Exception",
+            TraceLoggingUInt32(m_subExecutionId, "SubExecutionId"),
+            AICLI_TraceLoggingStringView(exceptionTypeString, "Type"),
+            AICLI_TraceLoggingWStringView(anonMessage, "Message"),
+            TraceLoggingUInt32(m_executionStage, "ExecutionStage"),
+            TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_CRITICAL_DATA));
+    }
+
 #ifndef AICLI_DISABLE_TEST_HOOKS
     static std::shared_ptr<TelemetryTraceLogger> s_TelemetryTraceLogger_TestOverride;
 #endif
@@ -1003,6 +1139,17 @@ namespace AppInstaller::Logging
         wil::SetResultLoggingCallback(wilResultLoggingCallback);
     }
 
+    void EnableAsyncTelemetryEmission(bool enable)
+    {
+        if (enable)
+        {
+            // Ensure that the queue outlives any logger that may defer events to it.
+            AsyncTelemetryQueue::Instance();
+        }
+
+        s_asyncTelemetryEnabled = enable;
+    }
+
     void UseGlobalTelemetryLoggerActivityIdOnly()
     {
         s_useGlobalTelemetryActivityId = true;
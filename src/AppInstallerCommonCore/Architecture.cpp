@@ -227,30 +227,37 @@ namespace AppInstaller::Utility
 
     Architecture GetSystemArchitecture()
     {
-        Architecture systemArchitecture = Architecture::Unknown;
+        // The machine architecture cannot change while the process runs, and this is
+        // called per installer during applicability checks; determine it once.
+        static Architecture s_systemArchitecture = []()
+        {
+            Architecture systemArchitecture = Architecture::Unknown;
 
-        USHORT processArchitecture = IMAGE_FILE_MACHINE_UNKNOWN;
-        USHORT machineArchitecture = IMAGE_FILE_MACHINE_UNKNOWN;
-        // Just log the error if failed and return architecture Unknown.
-        LOG_IF_WIN32_BOOL_FALSE(IsWow64Process2(GetCurrentProcess(), &processArchitecture, &machineArchitecture));
+            USHORT processArchitecture = IMAGE_FILE_MACHINE_UNKNOWN;
+            USHORT machineArchitecture = IMAGE_FILE_MACHINE_UNKNOWN;
+            // Just log the error if failed and return architecture Unknown.
+            LOG_IF_WIN32_BOOL_FALSE(IsWow64Process2(GetCurrentProcess(), &processArchitecture, &machineArchitecture));
 
-        switch (machineArchitecture)
-        {
-        case IMAGE_FILE_MACHINE_AMD64:
-            systemArchitecture = Architecture::X64;
-            break;
-        case IMAGE_FILE_MACHINE_ARM:
-            systemArchitecture = Architecture::Arm;
-            break;
-        case IMAGE_FILE_MACHINE_ARM64:
-            systemArchitecture = Architecture::Arm64;
-            break;
-        case IMAGE_FILE_MACHINE_I386:
-            systemArchitecture = Architecture::X86;
-            break;
-        }
+            switch (machineArchitecture)
+            {
+            case IMAGE_FILE_MACHINE_AMD64:
+                systemArchitecture = Architecture::X64;
+                break;
+            case IMAGE_FILE_MACHINE_ARM:
+                systemArchitecture = Architecture::Arm;
+                break;
+            case IMAGE_FILE_MACHINE_ARM64:
+                systemArchitecture = Architecture::Arm64;
+                break;
+            case IMAGE_FILE_MACHINE_I386:
+                systemArchitecture = Architecture::X86;
+                break;
+            }
+
+            return systemArchitecture;
+        }();
 
-        return systemArchitecture;
+        return s_systemArchitecture;
     }
 
     const std::vector<Architecture>& GetApplicableArchitectures()
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Public/winget/Archive.h"
+#include "Public/AppInstallerLogging.h"
+#include "Public/AppInstallerStrings.h"
 
 // TODO: Move include statement to pch.h and resolve build errors
 #pragma warning( push )
@@ -9,11 +11,138 @@
 #include <pure.h>
 #pragma warning ( pop )
 
+#include <zlib.h>
+
 namespace AppInstaller::Archive
 {
     using unique_pidlist_absolute = wil::unique_any<PIDLIST_ABSOLUTE, decltype(&::CoTaskMemFree), ::CoTaskMemFree>;
     using unique_lpitemidlist = wil::unique_any<LPITEMIDLIST, decltype(&::CoTaskMemFree), ::CoTaskMemFree>;
 
+    namespace
+    {
+        // Zip format constants used by the direct-read extraction path.
+        constexpr uint32_t s_EndOfCentralDirectorySignature = 0x06054b50;
+        constexpr uint32_t s_Zip64EndOfCentralDirectoryLocatorSignature = 0x07064b50;
+        constexpr uint32_t s_Zip64EndOfCentralDirectorySignature = 0x06064b50;
+        constexpr uint32_t s_CentralDirectoryHeaderSignature = 0x02014b50;
+        constexpr uint32_t s_LocalFileHeaderSignature = 0x04034b50;
+        constexpr uint16_t s_Zip64ExtraFieldTag = 0x0001;
+        constexpr uint16_t s_CompressionMethodStore = 0;
+        constexpr uint16_t s_CompressionMethodDeflate = 8;
+        constexpr uint16_t s_EncryptedFlagMask = 0x1;
+
+        // The end of central directory record is 22 bytes plus up to 64KB of comment.
+        constexpr size_t s_EndOfCentralDirectorySearchLimit = (64 << 10) + 22;
+
+        // Sanity cap on the central directory size; real world archives are far below this.
+        constexpr uint64_t s_CentralDirectorySizeLimit = 256 << 20;
+
+        constexpr size_t s_ExtractionBufferSize = 64 << 10;
+
+        // Reads a little endian integral value at a potentially unaligned location.
+        template <typename T>
+        T ReadLE(const uint8_t* buffer)
+        {
+            T value{};
+            std::memcpy(&value, buffer, sizeof(T));
+            return value;
+        }
+
+        // Normalizes a zip entry name for comparison against a manifest relative path.
+        std::string NormalizeZipEntryName(std::string_view name)
+        {
+            std::string result = Utility::FoldCase(name);
+            std::replace(result.begin(), result.end(), '\\', '/');
+            return result;
+        }
+
+        struct ZipEntry
+        {
+            uint16_t Flags = 0;
+            uint16_t CompressionMethod = 0;
+            uint64_t CompressedSize = 0;
+            uint64_t LocalHeaderOffset = 0;
+        };
+
+        // Streams a single entry's data out of the archive to the target file.
+        HRESULT ExtractZipEntry(std::ifstream& stream, const ZipEntry& entry, const std::filesystem::path& targetPath)
+        {
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_UNSUPPORTED_TYPE), WI_IsFlagSet(entry.Flags, s_EncryptedFlagMask));
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_UNSUPPORTED_TYPE),
+                entry.CompressionMethod != s_CompressionMethodStore && entry.CompressionMethod != s_CompressionMethodDeflate);
+
+            // The central directory values are authoritative; the local header is only read to
+            // find where the entry data begins.
+            uint8_t localHeader[30];
+            stream.seekg(static_cast<std::streamoff>(entry.LocalHeaderOffset));
+            stream.read(reinterpret_cast<char*>(localHeader), sizeof(localHeader));
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream || ReadLE<uint32_t>(localHeader) != s_LocalFileHeaderSignature);
+
+            uint16_t nameLength = ReadLE<uint16_t>(localHeader + 26);
+            uint16_t extraLength = ReadLE<uint16_t>(localHeader + 28);
+            stream.seekg(static_cast<std::streamoff>(entry.LocalHeaderOffset + sizeof(localHeader) + nameLength + extraLength));
+
+            std::filesystem::create_directories(targetPath.parent_path());
+            std::ofstream output{ targetPath, std::ios::binary | std::ios::trunc };
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_CANNOT_MAKE), !output);
+
+            std::vector<uint8_t> inputBuffer(s_ExtractionBufferSize);
+
+            if (entry.CompressionMethod == s_CompressionMethodStore)
+            {
+                uint64_t remaining = entry.CompressedSize;
+                while (remaining)
+                {
+                    size_t chunk = static_cast<size_t>(std::min<uint64_t>(remaining, inputBuffer.size()));
+                    stream.read(reinterpret_cast<char*>(inputBuffer.data()), chunk);
+                    RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream);
+                    output.write(reinterpret_cast<const char*>(inputBuffer.data()), chunk);
+                    remaining -= chunk;
+                }
+            }
+            else
+            {
+                std::vector<uint8_t> outputBuffer(s_ExtractionBufferSize);
+
+                z_stream zipStream{};
+                // Negative window bits select a raw deflate stream, which is what zip entries use.
+                RETURN_HR_IF(E_OUTOFMEMORY, inflateInit2(&zipStream, -MAX_WBITS) != Z_OK);
+                auto inflateCleanup = wil::scope_exit([&]() { inflateEnd(&zipStream); });
+
+                uint64_t remaining = entry.CompressedSize;
+                int inflateResult = Z_OK;
+
+                while (inflateResult != Z_STREAM_END)
+                {
+                    RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), remaining == 0);
+
+                    size_t chunk = static_cast<size_t>(std::min<uint64_t>(remaining, inputBuffer.size()));
+                    stream.read(reinterpret_cast<char*>(inputBuffer.data()), chunk);
+                    RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream);
+                    remaining -= chunk;
+
+                    zipStream.next_in = inputBuffer.data();
+                    zipStream.avail_in = static_cast<uInt>(chunk);
+
+                    do
+                    {
+                        zipStream.next_out = outputBuffer.data();
+                        zipStream.avail_out = static_cast<uInt>(outputBuffer.size());
+
+                        inflateResult = inflate(&zipStream, Z_NO_FLUSH);
+                        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), inflateResult != Z_OK && inflateResult != Z_STREAM_END);
+
+                        output.write(reinterpret_cast<const char*>(outputBuffer.data()), outputBuffer.size() - zipStream.avail_out);
+                    }
+                    while (zipStream.avail_out == 0 && inflateResult != Z_STREAM_END);
+                }
+            }
+
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_WRITE_FAULT), !output);
+            return S_OK;
+        }
+    }
+
     HRESULT TryExtractArchive(const std::filesystem::path& archivePath, const std::filesystem::path& destPath)
     {
         wil::com_ptr<IFileOperation> pFileOperation;
@@ -49,6 +178,156 @@ namespace AppInstaller::Archive
         return S_OK;
     }
 
+    HRESULT TryExtractFilesFromZipArchive(const std::filesystem::path& archivePath, const std::filesystem::path& destPath, const std::vector<std::string>& relativeFilePaths) try
+    {
+        RETURN_HR_IF(E_INVALIDARG, relativeFilePaths.empty());
+
+        std::ifstream stream{ archivePath, std::ios::in | std::ios::binary };
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND), !stream);
+
+        stream.seekg(0, std::ios::end);
+        uint64_t fileSize = static_cast<uint64_t>(stream.tellg());
+
+        // Locate the end of central directory record by scanning back over any archive comment.
+        size_t tailSize = static_cast<size_t>(std::min<uint64_t>(fileSize, s_EndOfCentralDirectorySearchLimit));
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), tailSize < 22);
+
+        std::vector<uint8_t> tail(tailSize);
+        stream.seekg(static_cast<std::streamoff>(fileSize - tailSize));
+        stream.read(reinterpret_cast<char*>(tail.data()), tail.size());
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream);
+
+        size_t eocdTailOffset = tailSize;
+        for (size_t i = tailSize - 22; ; --i)
+        {
+            if (ReadLE<uint32_t>(tail.data() + i) == s_EndOfCentralDirectorySignature)
+            {
+                eocdTailOffset = i;
+                break;
+            }
+
+            if (i == 0)
+            {
+                break;
+            }
+        }
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), eocdTailOffset == tailSize);
+
+        const uint8_t* eocd = tail.data() + eocdTailOffset;
+        uint64_t entryCount = ReadLE<uint16_t>(eocd + 10);
+        uint64_t centralDirectorySize = ReadLE<uint32_t>(eocd + 12);
+        uint64_t centralDirectoryOffset = ReadLE<uint32_t>(eocd + 16);
+
+        if (entryCount == 0xFFFF || centralDirectorySize == 0xFFFFFFFF || centralDirectoryOffset == 0xFFFFFFFF)
+        {
+            // Zip64; the locator record immediately precedes the end of central directory record.
+            uint64_t eocdFileOffset = fileSize - tailSize + eocdTailOffset;
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), eocdFileOffset < 20);
+
+            uint8_t locator[20];
+            stream.seekg(static_cast<std::streamoff>(eocdFileOffset - 20));
+            stream.read(reinterpret_cast<char*>(locator), sizeof(locator));
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream || ReadLE<uint32_t>(locator) != s_Zip64EndOfCentralDirectoryLocatorSignature);
+
+            uint8_t eocd64[56];
+            stream.seekg(static_cast<std::streamoff>(ReadLE<uint64_t>(locator + 8)));
+            stream.read(reinterpret_cast<char*>(eocd64), sizeof(eocd64));
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream || ReadLE<uint32_t>(eocd64) != s_Zip64EndOfCentralDirectorySignature);
+
+            entryCount = ReadLE<uint64_t>(eocd64 + 32);
+            centralDirectorySize = ReadLE<uint64_t>(eocd64 + 40);
+            centralDirectoryOffset = ReadLE<uint64_t>(eocd64 + 48);
+        }
+
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), centralDirectorySize > s_CentralDirectorySizeLimit || centralDirectoryOffset + centralDirectorySize > fileSize);
+
+        std::vector<uint8_t> centralDirectory(static_cast<size_t>(centralDirectorySize));
+        stream.seekg(static_cast<std::streamoff>(centralDirectoryOffset));
+        stream.read(reinterpret_cast<char*>(centralDirectory.data()), centralDirectory.size());
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !stream);
+
+        // Map from normalized entry name to the output location for the entries we want.
+        std::map<std::string, std::filesystem::path> wanted;
+        for (const auto& relativeFilePath : relativeFilePaths)
+        {
+            wanted.emplace(NormalizeZipEntryName(relativeFilePath), destPath / Utility::ConvertToUTF16(relativeFilePath));
+        }
+
+        size_t position = 0;
+        for (uint64_t i = 0; i < entryCount && !wanted.empty(); ++i)
+        {
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), position + 46 > centralDirectory.size());
+            const uint8_t* header = centralDirectory.data() + position;
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), ReadLE<uint32_t>(header) != s_CentralDirectoryHeaderSignature);
+
+            ZipEntry entry;
+            entry.Flags = ReadLE<uint16_t>(header + 8);
+            entry.CompressionMethod = ReadLE<uint16_t>(header + 10);
+            entry.CompressedSize = ReadLE<uint32_t>(header + 20);
+            uint64_t uncompressedSize = ReadLE<uint32_t>(header + 24);
+            uint16_t nameLength = ReadLE<uint16_t>(header + 28);
+            uint16_t extraLength = ReadLE<uint16_t>(header + 30);
+            uint16_t commentLength = ReadLE<uint16_t>(header + 32);
+            entry.LocalHeaderOffset = ReadLE<uint32_t>(header + 42);
+
+            size_t nextPosition = position + 46 + nameLength + extraLength + commentLength;
+            RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), nextPosition > centralDirectory.size());
+
+            std::string_view entryName{ reinterpret_cast<const char*>(header + 46), nameLength };
+            auto itr = wanted.find(NormalizeZipEntryName(entryName));
+
+            if (itr != wanted.end())
+            {
+                // Pull 64-bit values out of the zip64 extra field when the 32-bit ones overflowed.
+                const uint8_t* extra = header + 46 + nameLength;
+                size_t extraPosition = 0;
+                while (extraPosition + 4 <= extraLength)
+                {
+                    uint16_t tag = ReadLE<uint16_t>(extra + extraPosition);
+                    uint16_t dataSize = ReadLE<uint16_t>(extra + extraPosition + 2);
+                    RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), extraPosition + 4 + dataSize > extraLength);
+
+                    if (tag == s_Zip64ExtraFieldTag)
+                    {
+                        const uint8_t* data = extra + extraPosition + 4;
+                        size_t dataPosition = 0;
+
+                        // Fields are present only for values that are 0xFFFFFFFF, in a fixed order.
+                        if (uncompressedSize == 0xFFFFFFFF && dataPosition + 8 <= dataSize)
+                        {
+                            uncompressedSize = ReadLE<uint64_t>(data + dataPosition);
+                            dataPosition += 8;
+                        }
+                        if (entry.CompressedSize == 0xFFFFFFFF && dataPosition + 8 <= dataSize)
+                        {
+                            entry.CompressedSize = ReadLE<uint64_t>(data + dataPosition);
+                            dataPosition += 8;
+                        }
+                        if (entry.LocalHeaderOffset == 0xFFFFFFFF && dataPosition + 8 <= dataSize)
+                        {
+                            entry.LocalHeaderOffset = ReadLE<uint64_t>(data + dataPosition);
+                            dataPosition += 8;
+                        }
+                        break;
+                    }
+
+                    extraPosition += 4 + static_cast<size_t>(dataSize);
+                }
+
+                AICLI_LOG(Core, Info, << "Extracting zip entry [" << entryName << "] to " << itr->second);
+                RETURN_IF_FAILED(ExtractZipEntry(stream, entry, itr->second));
+                wanted.erase(itr);
+            }
+
+            position = nextPosition;
+        }
+
+        // Every requested file must have been found for this path to be used.
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_PATH_NOT_FOUND), !wanted.empty());
+        return S_OK;
+    }
+    CATCH_RETURN()
+
 #ifndef AICLI_DISABLE_TEST_HOOKS
     static bool* s_ScanArchiveResult_TestHook_Override = nullptr;
 
@@ -67,12 +346,21 @@ namespace AppInstaller::Archive
         }
 #endif
 
+        // Read the archive in one sized block; iterator based reads pull the file in
+        // byte by byte, which dominates the scan time for large installers.
         std::ifstream instream{ zipPath, std::ios::in | std::ios::binary };
-        std::vector<uint8_t> data{ { std::istreambuf_iterator<char>{ instream } }, std::istreambuf_iterator<char>{} };
+        std::vector<uint8_t> data;
+
+        if (instream)
+        {
+            instream.seekg(0, std::ios::end);
+            data.resize(static_cast<size_t>(instream.tellg()));
+            instream.seekg(0);
+            instream.read(reinterpret_cast<char*>(data.data()), data.size());
+        }
 
-        uint8_t* buffer = &data[0];
         uint64_t flag = 0;
-        int scanResult = pure_zip(buffer, data.size(), flag);
+        int scanResult = pure_zip(data.data(), data.size(), flag);
 
         return scanResult == 0;
     }
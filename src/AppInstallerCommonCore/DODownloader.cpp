@@ -330,6 +330,11 @@ namespace AppInstaller::Utility
                 std::optional<UINT64> initialTransferAmount;
                 bool transferChange = false;
 
+                // DO can deliver status changes far faster than progress is worth reporting;
+                // coalesce them so that the sink sees at most ~30 updates per second.
+                constexpr auto minimumProgressInterval = std::chrono::milliseconds(33);
+                std::chrono::steady_clock::time_point lastProgressReport{};
+
                 while (!m_progress.IsCancelledBy(CancelReason::Any))
                 {
                     if (!transferChange)
@@ -371,7 +376,12 @@ namespace AppInstaller::Utility
                     case DODownloadState_Transferring:
                         if (m_currentStatus.BytesTransferred || m_currentStatus.BytesTotal)
                         {
-                            m_progress.OnProgress(m_currentStatus.BytesTransferred, m_currentStatus.BytesTotal, ProgressType::Bytes);
+                            auto now = std::chrono::steady_clock::now();
+                            if (now - lastProgressReport >= minimumProgressInterval)
+                            {
+                                m_progress.OnProgress(m_currentStatus.BytesTransferred, m_currentStatus.BytesTotal, ProgressType::Bytes);
+                                lastProgressReport = now;
+                            }
                         }
 
                         if (!initialTransferAmount)
@@ -431,7 +441,7 @@ namespace AppInstaller::Utility
         THROW_IF_FAILED(DeliveryOptimization::DODownloadStatusCallback::Create(progress, &callback));
 
         download.Uri(url);
-        download.ForegroundPriority(true);
+        download.ForegroundPriority(!info || !info->BackgroundPriority);
         download.LocalPath(dest);
         download.CallbackInterface(callback.get());
 
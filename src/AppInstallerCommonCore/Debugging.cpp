@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Public/winget/Debugging.h"
+#include "Public/AppInstallerFileLogger.h"
+#include "Public/AppInstallerLogging.h"
 #include "Public/AppInstallerRuntime.h"
 #include "Public/AppInstallerDateTime.h"
 
@@ -11,6 +13,7 @@ namespace AppInstaller::Debugging
     {
         constexpr std::string_view c_minidumpPrefix = "Minidump";
         constexpr std::string_view c_minidumpExtension = ".mdmp";
+        constexpr std::string_view c_crashContextExtension = ".txt";
 
         struct SelfInitiatedMinidumpHelper
         {
@@ -22,6 +25,8 @@ namespace AppInstaller::Debugging
                 {
                     m_file.reset();
                     DeleteFile(m_filePath.wstring().c_str());
+                    m_contextFile.reset();
+                    DeleteFile(m_contextFilePath.wstring().c_str());
                 }
             }
 
@@ -33,6 +38,13 @@ namespace AppInstaller::Debugging
 
             static LONG WINAPI UnhandledExceptionCallback(EXCEPTION_POINTERS* ExceptionInfo)
             {
+                // Dump the in-memory event ring first; raw writes to an already open handle
+                // cannot deadlock on logger or heap locks the way the normal log path can.
+                Instance().WriteEventRing();
+
+                // Get any queued log messages onto disk before the process goes down.
+                Logging::FileLogger::DrainAll();
+
                 MINIDUMP_EXCEPTION_INFORMATION exceptionInformation{};
                 // The unhandled exception filter is executed in the context of the failing thread.
                 exceptionInformation.ThreadId = GetCurrentThreadId();
@@ -65,6 +77,15 @@ namespace AppInstaller::Debugging
                             FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr));
                         THROW_LAST_ERROR_IF(!m_file);
 
+                        // Create the crash context file alongside the minidump now so that writing
+                        // it at crash time requires no allocation or file creation.
+                        m_contextFilePath = m_filePath;
+                        m_contextFilePath.replace_extension(c_crashContextExtension);
+
+                        m_contextFile.reset(CreateFile(m_contextFilePath.wstring().c_str(), GENERIC_READ | GENERIC_WRITE,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr));
+                        THROW_LAST_ERROR_IF(!m_contextFile);
+
                         SetUnhandledExceptionFilter(UnhandledExceptionCallback);
                     });
 
@@ -73,16 +94,37 @@ namespace AppInstaller::Debugging
 
             void WriteMinidump()
             {
+                WriteEventRing();
+
                 std::thread([&]() {
                     MiniDumpWriteDump(GetCurrentProcess(), GetCurrentProcessId(), Instance().m_file.get(), MiniDumpNormal, nullptr, nullptr, nullptr);
                     Instance().m_keepFile = true;
                     }).join();
             }
 
+            // Writes the raw contents of the event ring to the crash context file.
+            void WriteEventRing()
+            {
+                Logging::EventRing::RawView ring = Logging::EventRing::GetRawView();
+                DWORD written = 0;
+
+                if (ring.FirstSize)
+                {
+                    WriteFile(m_contextFile.get(), ring.First, static_cast<DWORD>(ring.FirstSize), &written, nullptr);
+                }
+
+                if (ring.SecondSize)
+                {
+                    WriteFile(m_contextFile.get(), ring.Second, static_cast<DWORD>(ring.SecondSize), &written, nullptr);
+                }
+            }
+
         private:
             std::once_flag m_enableFlag;
             std::filesystem::path m_filePath;
             wil::unique_handle m_file;
+            std::filesystem::path m_contextFilePath;
+            wil::unique_handle m_contextFile;
             std::atomic_bool m_keepFile{ false };
         };
     }
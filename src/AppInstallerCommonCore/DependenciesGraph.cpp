@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "winget\DependenciesGraph.h"
+#include <winget/SharedThreadGlobals.h>
 
 namespace AppInstaller::Manifest
 {
@@ -26,9 +27,9 @@ namespace AppInstaller::Manifest
         m_toCheck = std::vector<Dependency>();
     }
 
-    void DependencyGraph::BuildGraph()
+    void DependencyGraph::BuildGraph(bool evaluateConcurrently)
     {
-        if (!m_rootDependencyEvaluated) 
+        if (!m_rootDependencyEvaluated)
         {
             const DependencyList& rootDependencies = getDependencies(m_root);
             rootDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
@@ -45,21 +46,56 @@ namespace AppInstaller::Manifest
             return;
         }
 
-        for (unsigned int i = 0; i < m_toCheck.size(); ++i)
+        // Evaluate the nodes breadth first; all of the nodes at one depth are independent
+        // of each other, so when requested they can be evaluated on concurrent threads.
+        // The results are always applied to the graph serially and in order so that the
+        // resulting graph is identical to the one produced by a serial evaluation.
+        ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+        size_t waveBegin = 0;
+        while (waveBegin < m_toCheck.size())
         {
-            auto node = m_toCheck.at(i);
+            size_t waveEnd = m_toCheck.size();
 
-            const auto& nodeDependencies = getDependencies(node);
-            nodeDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
+            std::vector<std::future<DependencyList>> waveFutures;
+            if (evaluateConcurrently && waveEnd - waveBegin > 1)
+            {
+                for (size_t i = waveBegin + 1; i < waveEnd; ++i)
                 {
-                    if (!HasNode(dependency))
+                    Dependency node = m_toCheck.at(i);
+                    waveFutures.emplace_back(std::async(std::launch::async, [this, node, callerGlobals]() -> DependencyList
+                        {
+                            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                            if (callerGlobals)
+                            {
+                                previousGlobals = callerGlobals->SetForCurrentThread();
+                            }
+
+                            return getDependencies(node);
+                        }));
+                }
+            }
+
+            for (size_t i = waveBegin; i < waveEnd; ++i)
+            {
+                // Copy the node as applying results may grow m_toCheck.
+                Dependency node = m_toCheck.at(i);
+
+                // The first node of a wave is always evaluated on the calling thread.
+                DependencyList nodeDependencies = (waveFutures.empty() || i == waveBegin) ? getDependencies(node) : waveFutures[i - waveBegin - 1].get();
+                nodeDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
                     {
-                        m_toCheck.push_back(dependency);
-                        AddNode(dependency);
-                    }
+                        if (!HasNode(dependency))
+                        {
+                            m_toCheck.push_back(dependency);
+                            AddNode(dependency);
+                        }
+
+                        AddAdjacent(node, dependency);
+                    });
+            }
 
-                    AddAdjacent(node, dependency);
-                });
+            waveBegin = waveEnd;
         }
 
         CheckForLoopsAndGetOrder();
@@ -387,10 +387,14 @@ namespace AppInstaller::Deployment
     {
         std::wstring wideFamilyName = Utility::ConvertToUTF16(packageFamilyName);
 
-        PackageManager packageManager;
-        auto packages = packageManager.FindPackagesForUser({}, wideFamilyName);
-
-        return packages.begin() != packages.end();
+        // Query through the flat API rather than PackageManager::FindPackagesForUser;
+        // it answers the same question for the current user without activating the
+        // deployment server, which costs tens of milliseconds per call.
+        UINT32 count = 0;
+        UINT32 bufferLength = 0;
+        LONG result = GetPackagesByPackageFamily(wideFamilyName.c_str(), &count, nullptr, &bufferLength, nullptr);
+
+        return (result == ERROR_SUCCESS || result == ERROR_INSUFFICIENT_BUFFER) && count != 0;
     }
 
     void RegisterPackage(
@@ -125,160 +125,470 @@ namespace AppInstaller::Utility
     }
 #endif
 
-    DownloadResult WinINetDownloadToStream(
-        const std::string& url,
-        std::ostream& dest,
-        IProgressCallback& progress,
-        std::optional<DownloadInfo> info)
+    namespace
     {
-        // For AICLI_LOG usages with string literals.
-        #pragma warning(push)
-        #pragma warning(disable:26449)
+        // The number of times an interrupted transfer is continued with a ranged request before giving up.
+        constexpr size_t s_DownloadRangedRetryLimit = 3;
 
-        AICLI_LOG(Core, Info, << "WinINet downloading from url: " << url);
+        // The initial and maximum sizes of the transfer buffer; it grows while the connection keeps it full.
+        constexpr DWORD s_DownloadBufferSizeMin = 1024 * 1024;
+        constexpr DWORD s_DownloadBufferSizeMax = 4 * 1024 * 1024;
 
-        auto agentWide = Utility::ConvertToUTF16(Runtime::GetDefaultUserAgent().get());
-        wil::unique_hinternet session;
+        // The minimum content length for which resume state is persisted across invocations.
+        constexpr uint64_t s_DownloadResumeMinimumSize = 128ull << 20;
 
-        const auto& proxyUri = Network().GetProxyUri();
-        if (proxyUri)
+        // The result of a single download attempt.
+        enum class DownloadAttemptResult
         {
-            AICLI_LOG(Core, Info, << "Using proxy " << proxyUri.value());
-            session.reset(InternetOpen(
-                agentWide.c_str(),
-                INTERNET_OPEN_TYPE_PROXY,
-                Utility::ConvertToUTF16(proxyUri.value()).c_str(),
-                NULL,
-                0));
-        }
-        else
+            Completed,
+            Cancelled,
+            // The server answered a ranged request with the full content; the caller must start over.
+            CannotResume,
+        };
+
+        // State from the response of a download attempt.
+        struct DownloadAttemptState
         {
-            session.reset(InternetOpen(
-                agentWide.c_str(),
-                INTERNET_OPEN_TYPE_PRECONFIG,
-                NULL,
-                NULL,
-                0));
-        }
+            LONGLONG TotalLength = 0;
+            bool SupportsRanges = false;
+            std::string ContentType;
+            std::string ETag;
+        };
 
-        THROW_LAST_ERROR_IF_NULL_MSG(session, "InternetOpen() failed.");
+        // Gets the path of the file used to persist resume information next to the download target.
+        std::filesystem::path GetResumeStatePath(const std::filesystem::path& dest)
+        {
+            std::filesystem::path result = dest;
+            result += L".resume";
+            return result;
+        }
 
-        std::string customHeaders;
-        if (info && info->RequestHeaders.size() > 0)
+        // Persists the information needed to resume the download in a later invocation.
+        void WriteResumeState(const std::filesystem::path& statePath, const std::string& url, const DownloadAttemptState& state)
         {
-            for (const auto& header : info->RequestHeaders)
+            try
             {
-                customHeaders += header.Name + ": " + header.Value + "\r\n";
+                std::ofstream stream{ statePath, std::ofstream::trunc };
+                stream << url << '\n' << state.ETag << '\n' << state.TotalLength << '\n';
             }
+            CATCH_LOG();
         }
-        std::wstring customHeadersWide = Utility::ConvertToUTF16(customHeaders);
-
-        auto urlWide = Utility::ConvertToUTF16(url);
-        wil::unique_hinternet urlFile(InternetOpenUrl(
-            session.get(),
-            urlWide.c_str(),
-            customHeadersWide.empty() ? NULL : customHeadersWide.c_str(),
-            customHeadersWide.empty() ? 0 : (DWORD)(customHeadersWide.size()),
-            INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS, // This allows http->https redirection
-            0));
-        THROW_LAST_ERROR_IF_NULL_MSG(urlFile, "InternetOpenUrl() failed.");
-
-        // Check http return status
-        DWORD requestStatus = 0;
-        DWORD cbRequestStatus = sizeof(requestStatus);
-
-        THROW_LAST_ERROR_IF_MSG(!HttpQueryInfoW(urlFile.get(),
-            HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
-            &requestStatus,
-            &cbRequestStatus,
-            nullptr), "Query download request status failed.");
-
-        constexpr DWORD TooManyRequest = 429;
-
-        switch (requestStatus)
-        {
-        case HTTP_STATUS_OK:
-            // All good
-            break;
-        case TooManyRequest:
-        case HTTP_STATUS_SERVICE_UNAVAIL:
+
+        // Reads previously persisted resume information; returns the offset to resume from (0 when not resumable).
+        uint64_t ReadResumeState(const std::filesystem::path& statePath, const std::filesystem::path& dest, const std::string& url, std::string& etag)
         {
-            THROW_EXCEPTION(ServiceUnavailableException(GetRetryAfter(urlFile)));
-        }
-        default:
-            AICLI_LOG(Core, Error, << "Download request failed. Returned status: " << requestStatus);
-            THROW_HR_MSG(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, requestStatus), "Download request status is not success.");
+            try
+            {
+                if (!std::filesystem::exists(statePath) || !std::filesystem::exists(dest))
+                {
+                    return 0;
+                }
+
+                std::ifstream stream{ statePath };
+                std::string storedUrl;
+                std::string storedETag;
+                uint64_t totalLength = 0;
+
+                std::getline(stream, storedUrl);
+                std::getline(stream, storedETag);
+                stream >> totalLength;
+
+                uint64_t destSize = static_cast<uint64_t>(std::filesystem::file_size(dest));
+
+                // Only resume when the state refers to the same content and the partial file is plausible.
+                if (!stream.fail() && storedUrl == url && !storedETag.empty() && totalLength > 0 && destSize > 0 && destSize < totalLength)
+                {
+                    etag = storedETag;
+                    return destSize;
+                }
+            }
+            CATCH_LOG();
+
+            return 0;
         }
 
-        AICLI_LOG(Core, Verbose, << "Download request status success.");
+        // Performs a single download request, writing the body to dest.
+        // When startOffset is not zero a ranged request is made; if the server answers with the
+        // full content instead, CannotResume is returned without writing anything.
+        DownloadAttemptResult WinINetDownloadAttempt(
+            const std::string& url,
+            std::ostream& dest,
+            IProgressCallback& progress,
+            const std::optional<DownloadInfo>& info,
+            uint64_t startOffset,
+            const std::string& ifRangeETag,
+            const std::filesystem::path& resumeStatePath,
+            SHA256& hashEngine,
+            DownloadAttemptState& state,
+            uint64_t& bytesWritten)
+        {
+            // For AICLI_LOG usages with string literals.
+            #pragma warning(push)
+            #pragma warning(disable:26449)
 
-        // Get content length. Don't fail the download if failed.
-        LONGLONG contentLength = 0;
-        DWORD cbContentLength = sizeof(contentLength);
+            auto agentWide = Utility::ConvertToUTF16(Runtime::GetDefaultUserAgent().get());
+            wil::unique_hinternet session;
 
-        HttpQueryInfoW(
-            urlFile.get(),
-            HTTP_QUERY_CONTENT_LENGTH | HTTP_QUERY_FLAG_NUMBER64,
-            &contentLength,
-            &cbContentLength,
-            nullptr);
-        AICLI_LOG(Core, Verbose, << "Download size: " << contentLength);
+            const auto& proxyUri = Network().GetProxyUri();
+            if (proxyUri)
+            {
+                AICLI_LOG(Core, Info, << "Using proxy " << proxyUri.value());
+                session.reset(InternetOpen(
+                    agentWide.c_str(),
+                    INTERNET_OPEN_TYPE_PROXY,
+                    Utility::ConvertToUTF16(proxyUri.value()).c_str(),
+                    NULL,
+                    0));
+            }
+            else
+            {
+                session.reset(InternetOpen(
+                    agentWide.c_str(),
+                    INTERNET_OPEN_TYPE_PRECONFIG,
+                    NULL,
+                    NULL,
+                    0));
+            }
 
-        std::string contentType = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_CONTENT_TYPE));
-        AICLI_LOG(Core, Verbose, << "Content Type: " << contentType);
+            THROW_LAST_ERROR_IF_NULL_MSG(session, "InternetOpen() failed.");
 
-        // Setup hash engine
-        SHA256 hashEngine;
+            std::string customHeaders;
+            if (info && info->RequestHeaders.size() > 0)
+            {
+                for (const auto& header : info->RequestHeaders)
+                {
+                    customHeaders += header.Name + ": " + header.Value + "\r\n";
+                }
+            }
 
-        const int bufferSize = 1024 * 1024; // 1MB
-        auto buffer = std::make_unique<BYTE[]>(bufferSize);
+            if (startOffset > 0)
+            {
+                customHeaders += "Range: bytes=" + std::to_string(startOffset) + "-\r\n";
 
-        BOOL readSuccess = true;
-        DWORD bytesRead = 0;
-        LONGLONG bytesDownloaded = 0;
+                // If-Range makes the server send the full content when it no longer matches,
+                // which we detect below by the 200 status and report as CannotResume.
+                if (!ifRangeETag.empty())
+                {
+                    customHeaders += "If-Range: " + ifRangeETag + "\r\n";
+                }
+            }
 
-        do
-        {
-            if (progress.IsCancelledBy(CancelReason::Any))
+            std::wstring customHeadersWide = Utility::ConvertToUTF16(customHeaders);
+
+            auto urlWide = Utility::ConvertToUTF16(url);
+            wil::unique_hinternet urlFile(InternetOpenUrl(
+                session.get(),
+                urlWide.c_str(),
+                customHeadersWide.empty() ? NULL : customHeadersWide.c_str(),
+                customHeadersWide.empty() ? 0 : (DWORD)(customHeadersWide.size()),
+                INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS, // This allows http->https redirection
+                0));
+            THROW_LAST_ERROR_IF_NULL_MSG(urlFile, "InternetOpenUrl() failed.");
+
+            // Check http return status
+            DWORD requestStatus = 0;
+            DWORD cbRequestStatus = sizeof(requestStatus);
+
+            THROW_LAST_ERROR_IF_MSG(!HttpQueryInfoW(urlFile.get(),
+                HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
+                &requestStatus,
+                &cbRequestStatus,
+                nullptr), "Query download request status failed.");
+
+            constexpr DWORD TooManyRequest = 429;
+            constexpr DWORD RangeNotSatisfiable = 416;
+
+            switch (requestStatus)
             {
-                AICLI_LOG(Core, Info, << "Download cancelled.");
-                return {};
+            case HTTP_STATUS_OK:
+                if (startOffset > 0)
+                {
+                    // The server ignored the range, or the content behind the If-Range changed.
+                    AICLI_LOG(Core, Info, << "Server returned full content for ranged request; the download must start over.");
+                    return DownloadAttemptResult::CannotResume;
+                }
+                break;
+            case HTTP_STATUS_PARTIAL_CONTENT:
+                state.SupportsRanges = true;
+                break;
+            case RangeNotSatisfiable:
+                AICLI_LOG(Core, Info, << "Requested range is not satisfiable; the download must start over.");
+                return DownloadAttemptResult::CannotResume;
+            case TooManyRequest:
+            case HTTP_STATUS_SERVICE_UNAVAIL:
+            {
+                THROW_EXCEPTION(ServiceUnavailableException(GetRetryAfter(urlFile)));
+            }
+            default:
+                AICLI_LOG(Core, Error, << "Download request failed. Returned status: " << requestStatus);
+                THROW_HR_MSG(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, requestStatus), "Download request status is not success.");
             }
 
-            readSuccess = InternetReadFile(urlFile.get(), buffer.get(), bufferSize, &bytesRead);
+            AICLI_LOG(Core, Verbose, << "Download request status success.");
 
-            THROW_LAST_ERROR_IF_MSG(!readSuccess, "InternetReadFile() failed.");
+            // Get content length. Don't fail the download if failed.
+            LONGLONG contentLength = 0;
+            DWORD cbContentLength = sizeof(contentLength);
 
-            hashEngine.Add(buffer.get(), bytesRead);
+            HttpQueryInfoW(
+                urlFile.get(),
+                HTTP_QUERY_CONTENT_LENGTH | HTTP_QUERY_FLAG_NUMBER64,
+                &contentLength,
+                &cbContentLength,
+                nullptr);
+            AICLI_LOG(Core, Verbose, << "Download size: " << contentLength);
 
-            dest.write((char*)buffer.get(), bytesRead);
+            if (requestStatus == HTTP_STATUS_PARTIAL_CONTENT)
+            {
+                // The content length of a ranged response only covers the remainder.
+                state.TotalLength = (contentLength > 0) ? static_cast<LONGLONG>(startOffset) + contentLength : 0;
+            }
+            else
+            {
+                state.TotalLength = contentLength;
+
+                // Accept-Ranges advertises that an interrupted transfer can be continued with a ranged request.
+                state.SupportsRanges = (GetHttpQueryString(urlFile, HTTP_QUERY_ACCEPT_RANGES) == L"bytes");
+            }
 
-            bytesDownloaded += bytesRead;
+            state.ContentType = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_CONTENT_TYPE));
+            AICLI_LOG(Core, Verbose, << "Content Type: " << state.ContentType);
 
-            if (bytesRead != 0)
+            state.ETag = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_ETAG));
+
+            // Persist the resume state before streaming the body so that an interrupted
+            // invocation can pick up from wherever the partial file ends.
+            if (!resumeStatePath.empty() && state.SupportsRanges && !state.ETag.empty() &&
+                state.TotalLength > 0 && static_cast<uint64_t>(state.TotalLength) >= s_DownloadResumeMinimumSize)
             {
-                progress.OnProgress(bytesDownloaded, contentLength, ProgressType::Bytes);
+                WriteResumeState(resumeStatePath, url, state);
             }
 
-        } while (bytesRead != 0);
+            DWORD bufferSize = s_DownloadBufferSizeMin;
+            auto buffer = std::make_unique<BYTE[]>(s_DownloadBufferSizeMax);
+
+            // Let WinINet buffer ahead of us up to the largest size we will read.
+            DWORD readBufferSize = s_DownloadBufferSizeMax;
+            InternetSetOption(urlFile.get(), INTERNET_OPTION_READ_BUFFER_SIZE, &readBufferSize, sizeof(readBufferSize));
+
+            BOOL readSuccess = true;
+            DWORD bytesRead = 0;
+
+            do
+            {
+                if (progress.IsCancelledBy(CancelReason::Any))
+                {
+                    AICLI_LOG(Core, Info, << "Download cancelled.");
+                    return DownloadAttemptResult::Cancelled;
+                }
+
+                readSuccess = InternetReadFile(urlFile.get(), buffer.get(), bufferSize, &bytesRead);
+
+                THROW_LAST_ERROR_IF_MSG(!readSuccess, "InternetReadFile() failed.");
+
+                // A completely filled buffer means the connection is outpacing us;
+                // read larger chunks to reduce per-call and write overhead.
+                if (bytesRead == bufferSize && bufferSize < s_DownloadBufferSizeMax)
+                {
+                    bufferSize *= 2;
+                }
+
+                hashEngine.Add(buffer.get(), bytesRead);
 
-        dest.flush();
+                dest.write((char*)buffer.get(), bytesRead);
 
-        // Check download size matches if content length is provided in response header
-        if (contentLength > 0)
+                bytesWritten += bytesRead;
+
+                if (bytesRead != 0)
+                {
+                    progress.OnProgress(bytesWritten, static_cast<uint64_t>(state.TotalLength), ProgressType::Bytes);
+                }
+
+            } while (bytesRead != 0);
+
+            dest.flush();
+
+            #pragma warning(pop)
+
+            return DownloadAttemptResult::Completed;
+        }
+
+        // Runs a download, continuing interrupted transfers with ranged requests when the server supports them.
+        // Returns CannotResume only when startOffset could not be honored; result is filled in on Completed.
+        DownloadAttemptResult WinINetDownloadWithRetry(
+            const std::string& url,
+            std::ostream& dest,
+            IProgressCallback& progress,
+            const std::optional<DownloadInfo>& info,
+            uint64_t startOffset,
+            const std::string& ifRangeETag,
+            const std::filesystem::path& resumeStatePath,
+            SHA256& hashEngine,
+            DownloadResult& result)
         {
-            THROW_HR_IF(APPINSTALLER_CLI_ERROR_DOWNLOAD_SIZE_MISMATCH, bytesDownloaded != contentLength);
+            AICLI_LOG(Core, Info, << "WinINet downloading from url: " << url);
+
+            DownloadAttemptState state;
+            uint64_t bytesWritten = startOffset;
+
+            for (size_t attempt = 0;; ++attempt)
+            {
+                uint64_t attemptOffset = bytesWritten;
+
+                try
+                {
+                    DownloadAttemptResult attemptResult = WinINetDownloadAttempt(
+                        url, dest, progress, info, attemptOffset,
+                        state.ETag.empty() ? ifRangeETag : state.ETag,
+                        resumeStatePath, hashEngine, state, bytesWritten);
+
+                    if (attemptResult != DownloadAttemptResult::Completed)
+                    {
+                        return attemptResult;
+                    }
+
+                    break;
+                }
+                catch (const ServiceUnavailableException&)
+                {
+                    // The caller handles retry-after semantics for these.
+                    throw;
+                }
+                catch (const wil::ResultException&)
+                {
+                    // Only continue when some of the body arrived and the server supports ranges;
+                    // anything that failed before that point is a hard error.
+                    if (!state.SupportsRanges || bytesWritten == attemptOffset || attempt + 1 >= s_DownloadRangedRetryLimit)
+                    {
+                        throw;
+                    }
+
+                    dest.flush();
+                    AICLI_LOG(Core, Warning, << "Transfer interrupted after " << bytesWritten << " bytes; continuing with a ranged request.");
+                }
+            }
+
+            // Check download size matches if content length is provided in response header
+            if (state.TotalLength > 0)
+            {
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_DOWNLOAD_SIZE_MISMATCH, static_cast<LONGLONG>(bytesWritten) != state.TotalLength);
+            }
+
+            result.SizeInBytes = bytesWritten;
+            result.ContentType = std::move(state.ContentType);
+            result.Sha256Hash = hashEngine.Get();
+            AICLI_LOG(Core, Info, << "Download hash: " << SHA256::ConvertToString(result.Sha256Hash));
+
+            AICLI_LOG(Core, Info, << "Download completed.");
+
+            return DownloadAttemptResult::Completed;
         }
 
-        DownloadResult result;
-        result.SizeInBytes = static_cast<uint64_t>(bytesDownloaded);
-        result.ContentType = std::move(contentType);
-        result.Sha256Hash = hashEngine.Get();
-        AICLI_LOG(Core, Info, << "Download hash: " << SHA256::ConvertToString(result.Sha256Hash));
+        // Downloads to a file, resuming a previous partial download of the same content when possible.
+        DownloadResult WinINetDownloadToFile(
+            const std::string& url,
+            const std::filesystem::path& dest,
+            IProgressCallback& progress,
+            const std::optional<DownloadInfo>& info,
+            bool persistResumeState)
+        {
+            std::filesystem::path resumeStatePath = GetResumeStatePath(dest);
+            std::string resumeETag;
+            uint64_t resumeOffset = persistResumeState ? ReadResumeState(resumeStatePath, dest, url, resumeETag) : 0;
+
+            for (bool restarted = false;; restarted = true)
+            {
+                SHA256 hashEngine;
+
+                if (resumeOffset > 0)
+                {
+                    AICLI_LOG(Core, Info, << "Resuming previous download at offset " << resumeOffset);
 
-        AICLI_LOG(Core, Info, << "Download completed.");
+                    // Feed the existing partial content through the hash engine so that the
+                    // final hash covers the whole file.
+                    std::ifstream existing{ dest, std::ifstream::binary };
+                    const size_t bufferSize = 1024 * 1024; // 1MB
+                    auto buffer = std::make_unique<BYTE[]>(bufferSize);
+                    uint64_t remaining = resumeOffset;
+
+                    while (remaining > 0 && existing.good())
+                    {
+                        existing.read((char*)buffer.get(), static_cast<std::streamsize>(std::min<uint64_t>(remaining, bufferSize)));
+                        std::streamsize streamed = existing.gcount();
+                        if (streamed <= 0)
+                        {
+                            break;
+                        }
+
+                        hashEngine.Add(buffer.get(), static_cast<size_t>(streamed));
+                        remaining -= static_cast<uint64_t>(streamed);
+                    }
 
-        #pragma warning(pop)
+                    if (remaining != 0)
+                    {
+                        // The partial file could not be read back; start over.
+                        AICLI_LOG(Core, Warning, << "Could not read back partial download; restarting from the beginning.");
+                        resumeOffset = 0;
+                        resumeETag.clear();
+                        continue;
+                    }
+                }
+
+                if (resumeOffset == 0)
+                {
+                    std::ofstream emptyDestFile(dest);
+                    emptyDestFile.close();
+                    ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
+                }
+
+                // Use std::ofstream::app to append to previous file so that it will not
+                // create a new file and clear motw.
+                std::ofstream outfile(dest, std::ofstream::binary | std::ofstream::app);
+
+                DownloadResult result;
+                DownloadAttemptResult downloadResult = WinINetDownloadWithRetry(
+                    url, outfile, progress, info, resumeOffset, resumeETag,
+                    persistResumeState ? resumeStatePath : std::filesystem::path{}, hashEngine, result);
+
+                if (downloadResult == DownloadAttemptResult::CannotResume && !restarted)
+                {
+                    resumeOffset = 0;
+                    resumeETag.clear();
+                    continue;
+                }
+
+                THROW_HR_IF(E_UNEXPECTED, downloadResult == DownloadAttemptResult::CannotResume);
+
+                if (downloadResult == DownloadAttemptResult::Cancelled)
+                {
+                    // Keep the resume state; a later invocation for the same url picks up the partial file.
+                    return {};
+                }
+
+                if (persistResumeState)
+                {
+                    std::error_code error;
+                    std::filesystem::remove(resumeStatePath, error);
+                }
+
+                return result;
+            }
+        }
+    }
+
+    DownloadResult WinINetDownloadToStream(
+        const std::string& url,
+        std::ostream& dest,
+        IProgressCallback& progress,
+        std::optional<DownloadInfo> info)
+    {
+        SHA256 hashEngine;
+        DownloadResult result;
+
+        if (WinINetDownloadWithRetry(url, dest, progress, info, 0, {}, {}, hashEngine, result) == DownloadAttemptResult::Cancelled)
+        {
+            return {};
+        }
 
         return result;
     }
@@ -402,14 +712,8 @@ namespace AppInstaller::Utility
             }
         }
 
-        std::ofstream emptyDestFile(dest);
-        emptyDestFile.close();
-        ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
-
-        // Use std::ofstream::app to append to previous empty file so that it will not
-        // create a new file and clear motw.
-        std::ofstream outfile(dest, std::ofstream::binary | std::ofstream::app);
-        return WinINetDownloadToStream(url, outfile, progress, info);
+        // Only installers are large enough to be worth resuming across invocations.
+        return WinINetDownloadToFile(url, dest, progress, info, type == DownloadType::Installer);
     }
 
     using namespace std::string_view_literals;
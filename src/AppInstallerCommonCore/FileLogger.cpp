@@ -22,10 +22,10 @@ namespace AppInstaller::Logging
         static constexpr std::string_view s_fileLoggerDefaultFileExt = ".log"sv;
 
         // Send to a string first to create a single block to write to a file.
-        std::string ToLogLine(Channel channel, Level level, std::string_view message)
+        std::string ToLogLine(Channel channel, Level level, std::chrono::system_clock::time_point time, std::string_view message)
         {
             std::stringstream strstr;
-            strstr << std::chrono::system_clock::now() << " <" << GetLevelChar(level) << "> [" << std::setw(GetMaxChannelNameLength()) << std::left << std::setfill(' ') << GetChannelName(channel) << "] " << message;
+            strstr << time << " <" << GetLevelChar(level) << "> [" << std::setw(GetMaxChannelNameLength()) << std::left << std::setfill(' ') << GetChannelName(channel) << "] " << message;
             return std::move(strstr).str();
         }
 
@@ -35,8 +35,116 @@ namespace AppInstaller::Logging
             auto offsetPosition = static_cast<std::ofstream::off_type>(position);
             return maximum > offsetPosition ? maximum - offsetPosition : 0;
         }
+
+        // Bound on queued messages; an emitting thread blocks briefly when the ring is full
+        // rather than dropping messages or growing without limit.
+        constexpr size_t s_fileLoggerAsyncQueueLimit = 4096;
+
+        // The active file loggers, so that termination handlers can drain them.
+        std::mutex s_activeFileLoggersLock;
+        std::vector<FileLogger*> s_activeFileLoggers;
     }
 
+    // Moves log line formatting and file writes off of the emitting thread; messages are
+    // queued and a background thread writes them, flushing whenever it catches up.
+    struct FileLogger::AsyncWriter
+    {
+        // A queued message; everything needed to format the log line on the writer thread.
+        struct Message
+        {
+            Logging::Channel MessageChannel;
+            Logging::Level MessageLevel;
+            std::chrono::system_clock::time_point Time;
+            std::string Text;
+            // True for WriteDirect messages, which arrive already formatted.
+            bool Preformatted = false;
+        };
+
+        AsyncWriter(FileLogger& owner) : m_owner(owner)
+        {
+            m_thread = std::thread(&AsyncWriter::Run, this);
+        }
+
+        ~AsyncWriter()
+        {
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                m_stopping = true;
+            }
+            m_condition.notify_all();
+            // The writer drains the queue before it exits.
+            m_thread.join();
+        }
+
+        void Enqueue(Message&& message)
+        {
+            {
+                std::unique_lock<std::mutex> lock{ m_lock };
+                m_condition.wait(lock, [this]() { return m_queue.size() < s_fileLoggerAsyncQueueLimit || m_stopping; });
+                m_queue.emplace_back(std::move(message));
+            }
+            m_condition.notify_all();
+        }
+
+        void Drain()
+        {
+            std::unique_lock<std::mutex> lock{ m_lock };
+            // The timeout keeps a drain from a termination handler from hanging the process
+            // if the writer thread is not making progress.
+            m_condition.wait_for(lock, 5s, [this]() { return m_queue.empty() && !m_writing; });
+            m_owner.m_stream.flush();
+        }
+
+    private:
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock{ m_lock };
+
+            while (!m_stopping || !m_queue.empty())
+            {
+                if (m_queue.empty())
+                {
+                    m_condition.wait(lock);
+                    continue;
+                }
+
+                std::deque<Message> batch;
+                batch.swap(m_queue);
+                m_writing = true;
+
+                // Emitters may continue to queue while the batch is written.
+                lock.unlock();
+                m_condition.notify_all();
+
+                for (Message& message : batch)
+                {
+                    std::string line = message.Preformatted ?
+                        std::move(message.Text) :
+                        ToLogLine(message.MessageChannel, message.MessageLevel, message.Time, message.Text);
+                    std::string_view lineView = line;
+                    m_owner.HandleMaximumFileSize(lineView);
+                    m_owner.m_stream << lineView << '\n';
+                }
+
+                // Flushing once per batch keeps the file current without paying for a flush
+                // on every message like the synchronous path did.
+                m_owner.m_stream.flush();
+
+                lock.lock();
+                m_writing = false;
+                m_condition.notify_all();
+            }
+        }
+
+        FileLogger& m_owner;
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        std::deque<Message> m_queue;
+        bool m_writing = false;
+        bool m_stopping = false;
+        std::thread m_thread;
+    };
+
     FileLogger::FileLogger() : FileLogger(s_fileLoggerDefaultFilePrefix) {}
 
     FileLogger::FileLogger(const std::filesystem::path& filePath)
@@ -45,6 +153,7 @@ namespace AppInstaller::Logging
         m_filePath = filePath;
         InitializeDefaultMaximumFileSize();
         OpenFileLoggerStream();
+        StartAsyncWriter();
     }
 
     FileLogger::FileLogger(const std::string_view fileNamePrefix)
@@ -54,10 +163,23 @@ namespace AppInstaller::Logging
         m_filePath /= fileNamePrefix.data() + ('-' + Utility::GetCurrentTimeForFilename() + s_fileLoggerDefaultFileExt.data());
         InitializeDefaultMaximumFileSize();
         OpenFileLoggerStream();
+        StartAsyncWriter();
     }
 
     FileLogger::~FileLogger()
     {
+        {
+            std::lock_guard<std::mutex> lock{ s_activeFileLoggersLock };
+            auto itr = std::find(s_activeFileLoggers.begin(), s_activeFileLoggers.end(), this);
+            if (itr != s_activeFileLoggers.end())
+            {
+                s_activeFileLoggers.erase(itr);
+            }
+        }
+
+        // Stopping the writer drains any remaining messages.
+        m_asyncWriter.reset();
+
         m_stream.flush();
         // When std::ofstream is constructed from an existing File handle, it does not call fclose on destruction
         // Only calling close() explicitly will close the file handle.
@@ -94,15 +216,13 @@ namespace AppInstaller::Logging
 
     void FileLogger::Write(Channel channel, Level level, std::string_view message) noexcept try
     {
-        std::string log = ToLogLine(channel, level, message);
-        WriteDirect(channel, level, log);
+        m_asyncWriter->Enqueue({ channel, level, std::chrono::system_clock::now(), std::string{ message }, false });
     }
     catch (...) {}
 
-    void FileLogger::WriteDirect(Channel, Level, std::string_view message) noexcept try
+    void FileLogger::WriteDirect(Channel channel, Level level, std::string_view message) noexcept try
     {
-        HandleMaximumFileSize(message);
-        m_stream << message << std::endl;
+        m_asyncWriter->Enqueue({ channel, level, {}, std::string{ message }, true });
     }
     catch (...) {}
 
@@ -110,6 +230,9 @@ namespace AppInstaller::Logging
     {
         if (tag == Tag::HeadersComplete)
         {
+            // The queued header writes must reach the file before the position is captured.
+            Drain();
+
             auto currentPosition = m_stream.tellp();
             if (currentPosition != std::ofstream::pos_type{ -1 })
             {
@@ -165,6 +288,25 @@ namespace AppInstaller::Logging
             }).detach();
     }
 
+    void FileLogger::Drain()
+    {
+        if (m_asyncWriter)
+        {
+            m_asyncWriter->Drain();
+        }
+    }
+
+    void FileLogger::DrainAll() noexcept try
+    {
+        std::lock_guard<std::mutex> lock{ s_activeFileLoggersLock };
+
+        for (FileLogger* logger : s_activeFileLoggers)
+        {
+            logger->Drain();
+        }
+    }
+    catch (...) {}
+
     void FileLogger::OpenFileLoggerStream() 
     {
         // Prevent other writers to our log file, but allow readers
@@ -187,6 +329,14 @@ namespace AppInstaller::Logging
         }
     }
 
+    void FileLogger::StartAsyncWriter()
+    {
+        m_asyncWriter = std::make_unique<AsyncWriter>(*this);
+
+        std::lock_guard<std::mutex> lock{ s_activeFileLoggersLock };
+        s_activeFileLoggers.push_back(this);
+    }
+
     void FileLogger::InitializeDefaultMaximumFileSize()
     {
         m_maximumSize = static_cast<std::ofstream::off_type>(Settings::User().Get<Settings::Setting::LoggingFileIndividualSizeLimitInMB>()) << 20;
@@ -229,6 +379,6 @@ namespace AppInstaller::Logging
     {
         m_stream.seekp(m_headersEnd);
         // Yes, we may go over the size limit slightly due to this and the unaccounted for newlines
-        m_stream << ToLogLine(Channel::Core, Level::Info, "--- log file has wrapped ---") << std::endl;
+        m_stream << ToLogLine(Channel::Core, Level::Info, std::chrono::system_clock::now(), "--- log file has wrapped ---") << std::endl;
     }
 }
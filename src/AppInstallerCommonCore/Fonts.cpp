@@ -11,6 +11,7 @@
 #include <winget/Manifest.h>
 #include <winget/ManifestCommon.h>
 #include <winget/Registry.h>
+#include <winget/SharedThreadGlobals.h>
 #include <ShObjIdl_core.h>
 #include <propkey.h>
 #include <wingdi.h>
@@ -455,11 +456,49 @@ namespace AppInstaller::Fonts
 
         try
         {
-            // Create font file info for each package file
-            for (const auto& file : context.PackageFiles)
+            // Create font file info for each package file. Reading the font data dominates this
+            // and the files are independent, so large packages are spread across threads.
+            const size_t fileCount = context.PackageFiles.size();
+            std::vector<FontFileInfo> fileInfos(fileCount);
+
+            size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency(), fileCount);
+            if (threadCount > 1)
             {
-                result.FontFileInfos.push_back(CreateFontFileInfo(context, file));
+                ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+                std::atomic_size_t nextFile{ 0 };
+
+                std::vector<std::future<void>> futures;
+                for (size_t thread = 0; thread < threadCount; ++thread)
+                {
+                    futures.emplace_back(std::async(std::launch::async, [&, callerGlobals]()
+                        {
+                            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                            if (callerGlobals)
+                            {
+                                previousGlobals = callerGlobals->SetForCurrentThread();
+                            }
+
+                            for (size_t i = nextFile++; i < fileCount; i = nextFile++)
+                            {
+                                fileInfos[i] = CreateFontFileInfo(context, context.PackageFiles[i]);
+                            }
+                        }));
+                }
+
+                for (auto& future : futures)
+                {
+                    future.get();
+                }
             }
+            else
+            {
+                for (size_t i = 0; i < fileCount; ++i)
+                {
+                    fileInfos[i] = CreateFontFileInfo(context, context.PackageFiles[i]);
+                }
+            }
+
+            result.FontFileInfos = std::move(fileInfos);
 
             // We create an overall status for the validation with the following determination:
             // If ALL of the files are OK, the package is OK.
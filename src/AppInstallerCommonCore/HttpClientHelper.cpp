@@ -6,6 +6,7 @@
 #include <winget/HttpClientHelper.h>
 #include <winget/NetworkSettings.h>
 #include <winhttp.h>
+#include <random>
 
 namespace AppInstaller::Http
 {
@@ -50,10 +51,34 @@ namespace AppInstaller::Http
 
             return 0s;
         }
+
+        // The maximum number of attempts for a single request when the service is throttling.
+        constexpr uint32_t c_maximumRequestAttempts = 3;
+
+        // The total number of retries shared across all requests made through one helper.
+        constexpr uint32_t c_sharedRetryBudget = 8;
+
+        constexpr std::chrono::seconds c_defaultRetryDelay = 8s;
+        constexpr std::chrono::seconds c_maximumRetryDelay = 60s;
+
+        // Computes the wait before retrying a throttled request, honoring any Retry-After value
+        // from the service and applying jitter so that clients do not retry in lockstep.
+        std::chrono::milliseconds GetJitteredRetryDelay(std::chrono::seconds retryAfter, uint32_t attempt)
+        {
+            std::chrono::seconds base = (retryAfter != 0s) ? retryAfter : std::chrono::seconds{ c_defaultRetryDelay.count() << attempt };
+            base = std::min(base, c_maximumRetryDelay);
+
+            auto baseMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(base).count();
+
+            thread_local std::mt19937 generator{ std::random_device{}() };
+            std::uniform_int_distribution<decltype(baseMilliseconds)> distribution(baseMilliseconds / 2, baseMilliseconds);
+
+            return std::chrono::milliseconds{ distribution(generator) };
+        }
     }
 
     HttpClientHelper::HttpClientHelper(std::shared_ptr<web::http::http_pipeline_stage> stage)
-        : m_defaultRequestHandlerStage(std::move(stage))
+        : m_defaultRequestHandlerStage(std::move(stage)), m_retryBudget(c_sharedRetryBudget)
     {
         const auto& proxyUri = Settings::Network().GetProxyUri();
         if (proxyUri)
@@ -65,6 +90,17 @@ namespace AppInstaller::Http
         {
             AICLI_LOG(Repo, Info, << "REST HTTP Client helper does not use proxy");
         }
+
+        // Enable HTTP/2 where the server supports it so that concurrent requests to one host
+        // multiplex over a single connection rather than opening more.
+        m_clientConfig.set_nativesessionhandle_options([](web::http::client::native_handle handle)
+            {
+                DWORD protocols = WINHTTP_PROTOCOL_FLAG_HTTP2;
+                if (!WinHttpSetOption(reinterpret_cast<HINTERNET>(handle), WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL, &protocols, sizeof(protocols)))
+                {
+                    LOG_LAST_ERROR_MSG("Could not enable HTTP/2 for the session");
+                }
+            });
     }
 
     pplx::task<web::http::http_response> HttpClientHelper::Post(
@@ -74,8 +110,10 @@ namespace AppInstaller::Http
         const HttpClientHelper::HttpRequestHeaders& authHeaders) const
     {
         AICLI_LOG(Repo, Info, << "Sending http POST request to: " << utility::conversions::to_utf8string(uri));
-        web::http::client::http_client client = GetClient(uri);
+        web::http::uri fullUri{ uri };
+        web::http::client::http_client client = GetClient(fullUri);
         web::http::http_request request{ web::http::methods::POST };
+        request.set_request_uri(fullUri.resource());
         request.headers().set_content_type(web::http::details::mime_types::application_json);
         request.set_body(body.serialize());
 
@@ -104,22 +142,39 @@ namespace AppInstaller::Http
         const HttpClientHelper::HttpRequestHeaders& authHeaders,
         const HttpResponseHandler& customHandler) const try
     {
-        web::http::http_response httpResponse;
-        Post(uri, body, headers, authHeaders).then([&httpResponse](const web::http::http_response& response)
+        for (uint32_t attempt = 0;; ++attempt)
+        {
+            web::http::http_response httpResponse;
+            Post(uri, body, headers, authHeaders).then([&httpResponse](const web::http::http_response& response)
+                {
+                    httpResponse = response;
+                }).wait();
+
+            if (customHandler)
             {
-                httpResponse = response;
-            }).wait();
+                auto handlerResult = customHandler(httpResponse);
+                if (!handlerResult.UseDefaultHandling)
+                {
+                    return std::move(handlerResult.Result);
+                }
+            }
 
-        if (customHandler)
-        {
-            auto handlerResult = customHandler(httpResponse);
-            if (!handlerResult.UseDefaultHandling)
+            try
+            {
+                return ValidateAndExtractResponse(httpResponse);
+            }
+            catch (const AppInstaller::Utility::ServiceUnavailableException& sue)
             {
-                return std::move(handlerResult.Result);
+                if (attempt + 1 >= c_maximumRequestAttempts || !TryAcquireRetry())
+                {
+                    throw;
+                }
+
+                auto delay = GetJitteredRetryDelay(sue.RetryAfter(), attempt);
+                AICLI_LOG(Repo, Info, << "Service unavailable; retrying POST in " << delay.count() << " ms");
+                std::this_thread::sleep_for(delay);
             }
         }
-
-        return ValidateAndExtractResponse(httpResponse);
     }
     catch (web::http::http_exception& exception)
     {
@@ -132,8 +187,10 @@ namespace AppInstaller::Http
         const HttpClientHelper::HttpRequestHeaders& authHeaders) const
     {
         AICLI_LOG(Repo, Info, << "Sending http GET request to: " << utility::conversions::to_utf8string(uri));
-        web::http::client::http_client client = GetClient(uri);
+        web::http::uri fullUri{ uri };
+        web::http::client::http_client client = GetClient(fullUri);
         web::http::http_request request{ web::http::methods::GET };
+        request.set_request_uri(fullUri.resource());
         request.headers().set_content_type(web::http::details::mime_types::application_json);
 
         // Add headers
@@ -160,47 +217,124 @@ namespace AppInstaller::Http
         const HttpClientHelper::HttpRequestHeaders& authHeaders,
         const HttpResponseHandler& customHandler) const try
     {
-        web::http::http_response httpResponse;
-        Get(uri, headers, authHeaders).then([&httpResponse](const web::http::http_response& response)
+        for (uint32_t attempt = 0;; ++attempt)
+        {
+            web::http::http_response httpResponse;
+            Get(uri, headers, authHeaders).then([&httpResponse](const web::http::http_response& response)
+                {
+                    httpResponse = response;
+                }).wait();
+
+            if (customHandler)
             {
-                httpResponse = response;
-            }).wait();
+                auto handlerResult = customHandler(httpResponse);
+                if (!handlerResult.UseDefaultHandling)
+                {
+                    return std::move(handlerResult.Result);
+                }
+            }
 
-        if (customHandler)
-        {
-            auto handlerResult = customHandler(httpResponse);
-            if (!handlerResult.UseDefaultHandling)
+            try
+            {
+                return ValidateAndExtractResponse(httpResponse);
+            }
+            catch (const AppInstaller::Utility::ServiceUnavailableException& sue)
             {
-                return std::move(handlerResult.Result);
+                if (attempt + 1 >= c_maximumRequestAttempts || !TryAcquireRetry())
+                {
+                    throw;
+                }
+
+                auto delay = GetJitteredRetryDelay(sue.RetryAfter(), attempt);
+                AICLI_LOG(Repo, Info, << "Service unavailable; retrying GET in " << delay.count() << " ms");
+                std::this_thread::sleep_for(delay);
             }
         }
-
-        return ValidateAndExtractResponse(httpResponse);
     }
     catch (web::http::http_exception& exception)
     {
         RethrowAsWilException(exception);
     }
 
+    void HttpClientHelper::WarmUp(const utility::string_t& uri) const try
+    {
+        AICLI_LOG(Repo, Verbose, << "Warming up connection to: " << utility::conversions::to_utf8string(uri));
+        web::http::uri fullUri{ uri };
+        web::http::client::http_client client = GetClient(fullUri);
+        web::http::http_request request{ web::http::methods::HEAD };
+        request.set_request_uri(fullUri.resource());
+        EnsureDefaultUserAgent(request);
+
+        // Fire and forget; the goal is only to get DNS resolution and the TLS handshake done
+        // (and cached by the resolver and schannel) before the first real request needs them.
+        client.request(request).then([](pplx::task<web::http::http_response> response)
+            {
+                try
+                {
+                    response.get();
+                }
+                CATCH_LOG();
+            });
+    }
+    CATCH_LOG();
+
     void HttpClientHelper::SetPinningConfiguration(const Certificates::PinningConfiguration& configuration, std::shared_ptr<ThreadLocalStorage::ThreadGlobals> threadGlobals)
     {
         m_clientConfig.set_nativehandle_servercertificate_validation([pinConfig = configuration, globals = std::move(threadGlobals)](web::http::client::native_handle handle)
             {
                 NativeHandleServerCertificateValidation(handle, pinConfig, globals.get());
             });
+
+        // Existing pooled clients do not carry the new configuration.
+        {
+            std::lock_guard<std::mutex> lock{ m_clientsLock };
+            m_clients.clear();
+        }
+    }
+
+    void HttpClientHelper::SetRetryBudget(uint32_t budget)
+    {
+        m_retryBudget = budget;
+    }
+
+    bool HttpClientHelper::TryAcquireRetry() const
+    {
+        uint32_t current = m_retryBudget.load();
+
+        while (current != 0)
+        {
+            if (m_retryBudget.compare_exchange_weak(current, current - 1))
+            {
+                return true;
+            }
+        }
+
+        return false;
     }
 
-    web::http::client::http_client HttpClientHelper::GetClient(const utility::string_t& uri) const
+    web::http::client::http_client HttpClientHelper::GetClient(const web::http::uri& uri) const
     {
-        web::http::client::http_client client{ uri, m_clientConfig };
+        // Pool clients per authority; a new client means a new WinHTTP session and thus a new
+        // TLS handshake, while reusing one lets all requests to the host share its connections.
+        utility::string_t authority = uri.authority().to_string();
+
+        std::lock_guard<std::mutex> lock{ m_clientsLock };
 
-        // Add default custom handlers if any.
-        if (m_defaultRequestHandlerStage)
+        auto itr = m_clients.find(authority);
+        if (itr == m_clients.end())
         {
-            client.add_handler(m_defaultRequestHandlerStage);
+            web::http::client::http_client client{ uri.authority(), m_clientConfig };
+
+            // Add default custom handlers if any.
+            if (m_defaultRequestHandlerStage)
+            {
+                client.add_handler(m_defaultRequestHandlerStage);
+            }
+
+            itr = m_clients.emplace(std::move(authority), std::move(client)).first;
         }
 
-        return client;
+        return itr->second;
     }
 
     std::optional<web::json::value> HttpClientHelper::ValidateAndExtractResponse(const web::http::http_response& response) const
@@ -170,6 +170,30 @@ namespace AppInstaller::Utility::HttpStream
             winrt::check_hresult(ULong64Sub(downloadJobEndPosition, downloadJobStartPosition, &downloadJobSize));
         }
 
+        // Coalesce small jobs into a larger ranged request. The package reader inspects the zip
+        // central directory, signature, and block map with many small reads clustered near the end
+        // of the file; fetching a larger surrounding chunk here turns dozens of tiny ranged GETs
+        // into a few large ones, with the extra pages served from the cache afterwards.
+        constexpr ULONG64 minimumDownloadSize = static_cast<ULONG64>(MIN_DOWNLOAD_PAGES) * PAGE_SIZE;
+        if (downloadJobSize != 0U && downloadJobSize < minimumDownloadSize)
+        {
+            ULONG64 budget = minimumDownloadSize - downloadJobSize;
+
+            // Extend backward first (footer reads walk toward the start of the file),
+            // rounding up to whole pages so that the job start stays page aligned.
+            ULONG64 backwardExtension = std::min(((budget + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE, downloadJobStartPosition);
+            downloadJobStartPosition -= backwardExtension;
+            budget -= std::min(budget, backwardExtension);
+
+            // Spend any remaining budget extending toward the end of the file.
+            if (budget != 0U && downloadJobEndPosition < fileSize)
+            {
+                downloadJobEndPosition = std::min(downloadJobEndPosition + budget, fileSize);
+            }
+
+            winrt::check_hresult(ULong64Sub(downloadJobEndPosition, downloadJobStartPosition, &downloadJobSize));
+        }
+
         if (downloadJobSize != 0U)
         {
             // start download job
@@ -21,6 +21,7 @@ namespace AppInstaller::Utility::HttpStream
     public:
         static constexpr UINT32 PAGE_SIZE = 2 << 16;   // each entry in the cache is 64 KB
         static constexpr UINT32 MAX_PAGES = 200;       // cache size capped at 12.5 MB (200 * 64KB)
+        static constexpr UINT32 MIN_DOWNLOAD_PAGES = 4;// small downloads are coalesced up to this many pages
 
         // Returns a buffer matching the requested range by reading the parts of the range that are cached
         // and downloading the rest using the provided httpClientWrapper object
@@ -12,6 +12,7 @@
 #include "winget/MSStoreDownload.h"
 #include "winget/NetworkSettings.h"
 #include "winget/Rest.h"
+#include "winget/SharedThreadGlobals.h"
 #include "winget/UserSettings.h"
 #ifndef WINGET_DISABLE_FOR_FUZZING
 #include <sfsclient/SFSClient.h>
@@ -1177,6 +1178,32 @@ namespace AppInstaller::MSStore
     MSStoreDownloadInfo MSStoreDownloadContext::GetDownloadInfo()
     {
 #ifndef WINGET_DISABLE_FOR_FUZZING
+        // The SFS query cannot start until the display catalog provides the WuCategoryId,
+        // but the SFS client itself can be initialized while that roundtrip is in flight.
+        std::future<void> sfsClientInitialization;
+#ifndef AICLI_DISABLE_TEST_HOOKS
+        if (!TestHooks::s_SfsClient_AppContents_Override)
+#endif
+        {
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+            sfsClientInitialization = std::async(std::launch::async, [callerGlobals]()
+                {
+                    std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                    if (callerGlobals)
+                    {
+                        previousGlobals = callerGlobals->SetForCurrentThread();
+                    }
+
+                    // Initialization failures are only logged here; the SFS query below
+                    // retries the initialization and surfaces the error to the caller.
+                    try
+                    {
+                        SfsClientDetails::GetSfsClientInstance();
+                    }
+                    CATCH_LOG();
+                });
+        }
+
         auto displayCatalogPackage = DisplayCatalogDetails::CallDisplayCatalogAndGetPreferredPackage(m_productId, m_locale, m_architecture, GetAuthHeaders(m_displayCatalogAuthenticator));
         auto downloadInfo = SfsClientDetails::CallSfsClientAndGetMSStoreDownloadInfo(displayCatalogPackage.WuCategoryId, m_architecture, m_platform, m_targetOSVersion);
         downloadInfo.ContentId = displayCatalogPackage.ContentId;
@@ -33,9 +33,14 @@ namespace AppInstaller::Manifest
             {
                 // Unvirtualized resources restricted capability is only supported for >= 10.0.18362
                 // TODO: Add support for OS versions that don't support virtualization.
-                if (installer.EffectiveInstallerType() == InstallerTypeEnum::Portable && !Runtime::IsCurrentOSVersionGreaterThanOrEqual(Utility::Version("10.0.18362")))
+                if (installer.EffectiveInstallerType() == InstallerTypeEnum::Portable)
                 {
-                    return InapplicabilityFlags::OSVersion;
+                    // The OS version cannot change while the process runs; check it once.
+                    static const bool s_portableSupported = Runtime::IsCurrentOSVersionGreaterThanOrEqual(Utility::Version("10.0.18362"));
+                    if (!s_portableSupported)
+                    {
+                        return InapplicabilityFlags::OSVersion;
+                    }
                 }
 
                 return InapplicabilityFlags::None;
@@ -582,7 +587,10 @@ namespace AppInstaller::Manifest
                     preference = Settings::User().Get<Settings::Setting::InstallLocalePreference>();
                     if (preference.empty())
                     {
-                        preference = Locale::GetUserPreferredLanguages();
+                        // The comparator is recreated per package (notably for `upgrade --all`),
+                        // and the preferred languages query goes through WinRT; snapshot it once.
+                        static const std::vector<std::string> s_userPreferredLanguages = Locale::GetUserPreferredLanguages();
+                        preference = s_userPreferredLanguages;
                     }
                 }
 
@@ -686,7 +694,10 @@ namespace AppInstaller::Manifest
 
             static std::unique_ptr<MarketFilter> Create()
             {
-                return std::make_unique<MarketFilter>(Runtime::GetOSRegion());
+                // The region query goes through WinRT and does not change within an
+                // invocation; snapshot it once rather than per package.
+                static const Manifest::string_t s_market{ Runtime::GetOSRegion() };
+                return std::make_unique<MarketFilter>(s_market);
             }
 
             InapplicabilityFlags IsApplicable(const ManifestInstaller& installer) override
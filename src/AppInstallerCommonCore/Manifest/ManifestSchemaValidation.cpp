@@ -413,11 +413,36 @@ namespace AppInstaller::Manifest::YamlParser
         return JsonSchema::LoadSchemaDoc(schemaStr);
     }
 
+    namespace
+    {
+        // Populated schemas, keyed by manifest version and type. Schema parse and population
+        // are expensive relative to validating a single document, and index and batch
+        // operations validate many manifests against the same handful of schemas.
+        const valijson::Schema& GetPopulatedSchema(const ManifestVer& manifestVersion, ManifestTypeEnum manifestType)
+        {
+            static std::mutex s_schemaCacheLock;
+            static std::map<std::pair<std::string, ManifestTypeEnum>, valijson::Schema> s_schemaCache;
+
+            std::lock_guard<std::mutex> lock{ s_schemaCacheLock };
+
+            auto key = std::make_pair(manifestVersion.ToString(), manifestType);
+            auto itr = s_schemaCache.find(key);
+            if (itr == s_schemaCache.end())
+            {
+                // Copy constructor of valijson::Schema was private; construct in place.
+                // Entries are never erased, so references remain valid after the lock is released.
+                itr = s_schemaCache.emplace(
+                    std::piecewise_construct, std::make_tuple(std::move(key)), std::make_tuple()).first;
+                JsonSchema::PopulateSchema(LoadSchemaDoc(manifestVersion, manifestType), itr->second);
+            }
+
+            return itr->second;
+        }
+    }
+
     std::vector<ValidationError> ValidateAgainstSchema(const std::vector<YamlManifestInfo>& manifestList, const ManifestVer& manifestVersion)
     {
         std::vector<ValidationError> errors;
-        // A list of schema validator to avoid multiple loadings of same schema
-        std::map<ManifestTypeEnum, valijson::Schema> schemaList;
 
         for (const auto& entry : manifestList)
         {
@@ -427,16 +452,7 @@ namespace AppInstaller::Manifest::YamlParser
                 continue;
             }
 
-            if (schemaList.find(entry.ManifestType) == schemaList.end())
-            {
-                // Copy constructor of valijson::Schema was private
-                valijson::Schema& newSchema = schemaList.emplace(
-                    std::piecewise_construct, std::make_tuple(entry.ManifestType), std::make_tuple()).first->second;
-                Json::Value schemaJson = LoadSchemaDoc(manifestVersion, entry.ManifestType);
-                JsonSchema::PopulateSchema(schemaJson, newSchema);
-            }
-
-            const auto& schema = schemaList.find(entry.ManifestType)->second;
+            const auto& schema = GetPopulatedSchema(manifestVersion, entry.ManifestType);
             Json::Value manifestJson = ManifestYamlNodeToJson(entry.Root);
             valijson::ValidationResults results;
 
@@ -46,7 +46,7 @@ namespace AppInstaller::Manifest::YamlParser
             }
             else
             {
-                auto manifestType = ConvertToManifestTypeEnum(entry.Root["ManifestType"].as<std::string>());
+                auto manifestType = ConvertToManifestTypeEnum(entry.Root["ManifestType"].as<std::string_view>());
 
                 switch (manifestType)
                 {
@@ -522,16 +522,35 @@ namespace AppInstaller::Manifest::YamlParser
         {
             if (std::filesystem::is_directory(inputPath))
             {
+                std::vector<std::filesystem::path> files;
+
                 for (const auto& file : std::filesystem::directory_iterator(inputPath))
                 {
                     THROW_HR_IF_MSG(HRESULT_FROM_WIN32(ERROR_DIRECTORY_NOT_SUPPORTED), std::filesystem::is_directory(file.path()), "Subdirectory not supported in manifest path");
+                    files.emplace_back(file.path());
+                }
+
+                // The files are independent until the merge, so load them in parallel.
+                // A multi-locale manifest can easily have tens of files.
+                std::vector<std::future<YamlManifestInfo>> loads;
+                loads.reserve(files.size());
+
+                for (const auto& file : files)
+                {
+                    loads.emplace_back(std::async(files.size() > 1 ? std::launch::async : std::launch::deferred, [&file]()
+                        {
+                            YamlManifestInfo manifestInfo;
+                            YAML::Document doc = YAML::LoadDocument(file);
+                            manifestInfo.DocumentSchemaHeader = doc.GetSchemaHeader();
+                            manifestInfo.Root = std::move(doc).GetRoot();
+                            manifestInfo.FileName = file.filename().u8string();
+                            return manifestInfo;
+                        }));
+                }
 
-                    YamlManifestInfo manifestInfo;
-                    YAML::Document doc = YAML::LoadDocument(file.path());
-                    manifestInfo.DocumentSchemaHeader = doc.GetSchemaHeader();
-                    manifestInfo.Root = std::move(doc).GetRoot();
-                    manifestInfo.FileName = file.path().filename().u8string();
-                    docList.emplace_back(std::move(manifestInfo));
+                for (auto& load : loads)
+                {
+                    docList.emplace_back(load.get());
                 }
             }
             else
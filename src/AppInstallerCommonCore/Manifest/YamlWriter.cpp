@@ -776,9 +776,16 @@ namespace AppInstaller::Manifest::YamlWriter
 
     std::string YamlWriter::ManifestToYamlString(const Manifest& manifest, const ManifestInstaller& installer)
     {
-        YAML::Emitter out;
-        PopulateManifestYamlEmitter(out, manifest, installer);
-        return out.str();
+        std::ostringstream stream;
+        ManifestToYamlStream(manifest, installer, stream);
+        return stream.str();
+    }
+
+    void YamlWriter::ManifestToYamlStream(const Manifest& manifest, const ManifestInstaller& installer, std::ostream& out)
+    {
+        YAML::Emitter emitter;
+        PopulateManifestYamlEmitter(emitter, manifest, installer);
+        emitter.Emit(out);
     }
 
     void YamlWriter::OutputYamlFile(const Manifest& manifest, const ManifestInstaller& installer, const std::filesystem::path& out)
@@ -794,11 +801,8 @@ namespace AppInstaller::Manifest::YamlWriter
             THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_CANNOT_MAKE), !std::filesystem::is_directory(parentDirectory));
         }
 
-        YAML::Emitter emitter;
-        PopulateManifestYamlEmitter(emitter, manifest, installer);
-
         std::ofstream outFileStream(out);
-        emitter.Emit(outFileStream);
+        ManifestToYamlStream(manifest, installer, outFileStream);
         outFileStream.close();
     }
 }
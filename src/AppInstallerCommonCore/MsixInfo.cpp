@@ -189,6 +189,49 @@ namespace AppInstaller::Msix
             WriteStreamToFileHandle(stream.Get(), size, target, progress);
         }
 
+        // Reads the appx file into memory.
+        std::vector<byte> ReadAppxFileToByteVector(IAppxFile* appxFile, IProgressCallback& progress)
+        {
+            UINT64 size = 0;
+            THROW_IF_FAILED(appxFile->GetSize(&size));
+
+            ComPtr<IStream> stream;
+            THROW_IF_FAILED(appxFile->GetStream(&stream));
+
+            std::vector<byte> result;
+            result.resize(static_cast<size_t>(size));
+
+            UINT64 totalBytesRead = 0;
+
+            while (totalBytesRead < size && !progress.IsCancelledBy(CancelReason::Any))
+            {
+                constexpr ULONG readSize = 1 << 20;
+                ULONG bytesToRead = static_cast<ULONG>(std::min<UINT64>(readSize, size - totalBytesRead));
+
+                ULONG bytesRead = 0;
+                HRESULT hr = stream->Read(result.data() + totalBytesRead, bytesToRead, &bytesRead);
+
+                if (bytesRead)
+                {
+                    // If we got bytes, just accept them and keep going.
+                    LOG_IF_FAILED(hr);
+
+                    totalBytesRead += bytesRead;
+                    progress.OnProgress(totalBytesRead, size, ProgressType::Bytes);
+                }
+                else
+                {
+                    // If the stream returned an error, throw it
+                    THROW_IF_FAILED(hr);
+
+                    // The stream ended before reaching the declared size.
+                    THROW_WIN32(ERROR_HANDLE_EOF);
+                }
+            }
+
+            return result;
+        }
+
         bool ValidateMsixTrustInfo(const std::filesystem::path& msixPath, bool verifyMicrosoftOrigin)
         {
             bool result = false;
@@ -825,6 +868,23 @@ namespace AppInstaller::Msix
         WriteAppxFileToFileHandle(appxFile.Get(), target, progress);
     }
 
+    std::vector<byte> MsixInfo::ReadFileContents(std::string_view packageFile, IProgressCallback& progress)
+    {
+        std::wstring fileUTF16 = Utility::ConvertToUTF16(packageFile);
+
+        ComPtr<IAppxFile> appxFile;
+        if (m_isBundle)
+        {
+            THROW_IF_FAILED(m_bundleReader->GetPayloadPackage(fileUTF16.c_str(), &appxFile));
+        }
+        else
+        {
+            THROW_IF_FAILED(m_packageReader->GetPayloadFile(fileUTF16.c_str(), &appxFile));
+        }
+
+        return ReadAppxFileToByteVector(appxFile.Get(), progress);
+    }
+
     WriteLockedMsixFile::WriteLockedMsixFile(const std::filesystem::path& path)
     {
         m_file = Utility::ManagedFile::OpenWriteLockedFile(path, 0);
@@ -21,6 +21,15 @@ namespace AppInstaller::Manifest
     static constexpr std::string_view s_FieldName_Sha256Hash = "s256H"sv;
 
     static constexpr std::string_view s_SchemaVersion_1_0 = "1.0"sv;
+    static constexpr std::string_view s_SchemaVersion_2_0 = "2.0"sv;
+
+    // The compact format begins with this marker immediately followed by the schema version
+    // and a newline; it cannot be confused with a YAML document, which lets Deserialize
+    // accept either format. Each subsequent line is one version with its fields separated
+    // by the unit separator character, optional fields left empty when absent.
+    static constexpr std::string_view s_CompactFormatMarker = "wgvd"sv;
+    static constexpr char s_CompactFieldSeparator = '\x1f';
+    static constexpr char s_CompactLineSeparator = '\n';
 
     static constexpr DWORD CompressionAlgorithm = COMPRESS_ALGORITHM_MSZIP;
     static constexpr bool CompressionSetLevel1 = false;
@@ -60,6 +69,45 @@ namespace AppInstaller::Manifest
                 manifest.AddVersion(std::move(versionData));
             }
         }
+
+        void AppendCompactField(std::string& out, std::string_view value)
+        {
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_INVALID_MANIFEST,
+                value.find(s_CompactFieldSeparator) != std::string_view::npos ||
+                value.find(s_CompactLineSeparator) != std::string_view::npos);
+            out += value;
+        }
+
+        void DeserializeCompact_2_0(std::string_view input, PackageVersionDataManifest& manifest)
+        {
+            for (std::string_view line : Utility::Split(input, s_CompactLineSeparator))
+            {
+                if (line.empty())
+                {
+                    continue;
+                }
+
+                std::vector<std::string_view> fields = Utility::Split(line, s_CompactFieldSeparator);
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_INVALID_MANIFEST, fields.size() != 5);
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_INVALID_MANIFEST, fields[0].empty() || fields[3].empty() || fields[4].empty());
+
+                PackageVersionDataManifest::VersionData versionData;
+
+                versionData.Version.Assign(std::string{ fields[0] });
+                if (!fields[1].empty())
+                {
+                    versionData.ArpMinVersion = std::string{ fields[1] };
+                }
+                if (!fields[2].empty())
+                {
+                    versionData.ArpMaxVersion = std::string{ fields[2] };
+                }
+                versionData.ManifestRelativePath = std::string{ fields[3] };
+                versionData.ManifestHash = std::string{ fields[4] };
+
+                manifest.AddVersion(std::move(versionData));
+            }
+        }
     }
 
     std::string_view PackageVersionDataManifest::VersionManifestFileName()
@@ -95,6 +143,11 @@ namespace AppInstaller::Manifest
         return Compression::Decompressor(CompressionAlgorithm);
     }
 
+    Compression::Decompressor& PackageVersionDataManifest::GetThreadLocalDecompressor()
+    {
+        return Compression::GetThreadLocalDecompressor(CompressionAlgorithm);
+    }
+
     PackageVersionDataManifest::VersionData::VersionData(
         const Utility::VersionAndChannel& versionAndChannel,
         std::optional<std::string> arpMinVersion,
@@ -128,8 +181,31 @@ namespace AppInstaller::Manifest
         return m_versions;
     }
 
-    std::string PackageVersionDataManifest::Serialize()
+    std::string PackageVersionDataManifest::Serialize(SerializationFormat format)
     {
+        if (format == SerializationFormat::Compact_2_0)
+        {
+            std::string result{ s_CompactFormatMarker };
+            result += s_SchemaVersion_2_0;
+            result += s_CompactLineSeparator;
+
+            for (const auto& version : m_versions)
+            {
+                anon::AppendCompactField(result, version.Version.ToString());
+                result += s_CompactFieldSeparator;
+                anon::AppendCompactField(result, version.ArpMinVersion.value_or(std::string{}));
+                result += s_CompactFieldSeparator;
+                anon::AppendCompactField(result, version.ArpMaxVersion.value_or(std::string{}));
+                result += s_CompactFieldSeparator;
+                anon::AppendCompactField(result, version.ManifestRelativePath);
+                result += s_CompactFieldSeparator;
+                anon::AppendCompactField(result, version.ManifestHash);
+                result += s_CompactLineSeparator;
+            }
+
+            return result;
+        }
+
         YAML::Emitter out;
         out << YAML::BeginMap;
         out << YAML::Key << s_FieldName_SchemaVersion << YAML::Value << s_SchemaVersion_1_0;
@@ -164,6 +240,25 @@ namespace AppInstaller::Manifest
     {
         AICLI_LOG_LARGE_STRING(Core, Verbose, << "PackageVersionDataManifest deserializing:", input);
 
+        if (input.substr(0, s_CompactFormatMarker.size()) == s_CompactFormatMarker)
+        {
+            std::string_view remainder = input.substr(s_CompactFormatMarker.size());
+            size_t lineEnd = remainder.find(s_CompactLineSeparator);
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_INVALID_MANIFEST, lineEnd == std::string_view::npos);
+
+            Utility::Version schemaVersion{ std::string{ remainder.substr(0, lineEnd) } };
+
+            if (schemaVersion.PartAt(0).Integer == 2)
+            {
+                anon::DeserializeCompact_2_0(remainder.substr(lineEnd + 1), *this);
+                return;
+            }
+            else
+            {
+                THROW_HR(APPINSTALLER_CLI_ERROR_UNSUPPORTED_MANIFESTVERSION);
+            }
+        }
+
         YAML::Node document = YAML::Load(input);
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_INVALID_MANIFEST, !document.IsMap());
 
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/winget/PerformanceTrace.h"
+#include "Public/AppInstallerTelemetry.h"
+#include <winget/SQLiteWrapper.h>
+
+namespace AppInstaller::Logging
+{
+    namespace
+    {
+        void SQLiteStepTraceCallback(size_t connectionId, size_t statementId, int64_t durationInMicroseconds, bool hasRow)
+        {
+            TraceLoggingWriteActivity(g_hTraceProvider,
+                "SQLiteStep",
+                Telemetry().GetActivityId(),
+                Telemetry().GetParentActivityId(),
+                TraceLoggingKeyword(KEYWORD_PERFTRACE),
+                TraceLoggingUInt64(static_cast<UINT64>(connectionId), "Connection"),
+                TraceLoggingUInt64(static_cast<UINT64>(statementId), "Statement"),
+                TraceLoggingInt64(durationInMicroseconds, "DurationInMicroseconds"),
+                TraceLoggingBool(hasRow, "HasRow"));
+        }
+
+        // Installs the statement timing callbacks alongside provider registration so that
+        // query timing is available whenever the performance keyword is enabled.
+        struct SQLiteStepTraceRegistration
+        {
+            SQLiteStepTraceRegistration()
+            {
+                SQLite::SetStatementStepTrace(IsPerformanceTraceEnabled, SQLiteStepTraceCallback);
+            }
+        };
+
+        SQLiteStepTraceRegistration g_SQLiteStepTraceRegistration{};
+    }
+
+    bool IsPerformanceTraceEnabled()
+    {
+        return !!TraceLoggingProviderEnabled(g_hTraceProvider, WINEVENT_LEVEL_VERBOSE, KEYWORD_PERFTRACE);
+    }
+
+    PerformanceTraceSpan::PerformanceTraceSpan(std::string_view name) :
+        m_active(IsPerformanceTraceEnabled())
+    {
+        if (m_active)
+        {
+            m_name = name;
+
+            TraceLoggingWriteActivity(g_hTraceProvider,
+                "PerfSpan",
+                Telemetry().GetActivityId(),
+                Telemetry().GetParentActivityId(),
+                TraceLoggingKeyword(KEYWORD_PERFTRACE),
+                TraceLoggingOpcode(WINEVENT_OPCODE_START),
+                TraceLoggingCountedUtf8String(m_name.data(), static_cast<ULONG>(m_name.size()), "Name"));
+        }
+    }
+
+    PerformanceTraceSpan::~PerformanceTraceSpan()
+    {
+        if (m_active)
+        {
+            TraceLoggingWriteActivity(g_hTraceProvider,
+                "PerfSpan",
+                Telemetry().GetActivityId(),
+                Telemetry().GetParentActivityId(),
+                TraceLoggingKeyword(KEYWORD_PERFTRACE),
+                TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+                TraceLoggingCountedUtf8String(m_name.data(), static_cast<ULONG>(m_name.size()), "Name"));
+        }
+    }
+}
@@ -64,7 +64,7 @@ namespace AppInstaller::Deployment
         std::string_view packageFullName,
         IProgressCallback& callback);
 
-    // Calls winrt::Windows::Management::Deployment::PackageManager::FindPackagesForUser
+    // Determines if any package with the given family name is registered for the current user.
     bool IsRegistered(std::string_view packageFamilyName);
 
     // Calls winrt::Windows::Management::Deployment::PackageManager::RegisterPackageByFamilyNameAsync
@@ -43,6 +43,9 @@ namespace AppInstaller::Utility
         std::string DisplayName;
         std::string ContentId;
         std::vector<DownloadRequestHeader> RequestHeaders;
+        // Requests background priority for the download; only Delivery Optimization
+        // honors this, the other downloaders run at their normal priority.
+        bool BackgroundPriority = false;
     };
 
     // Properties about the downloaded file.
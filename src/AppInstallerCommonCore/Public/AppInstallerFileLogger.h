@@ -5,6 +5,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -22,8 +23,9 @@ namespace AppInstaller::Logging
         FileLogger(const FileLogger&) = delete;
         FileLogger& operator=(const FileLogger&) = delete;
 
-        FileLogger(FileLogger&&) = default;
-        FileLogger& operator=(FileLogger&&) = default;
+        // Active loggers register themselves for DrainAll, so the object must not move.
+        FileLogger(FileLogger&&) = delete;
+        FileLogger& operator=(FileLogger&&) = delete;
 
         // The default value for the maximum size comes from settings.
         // Setting the maximum size to 0 will disable the maximum.
@@ -52,15 +54,29 @@ namespace AppInstaller::Logging
         static void BeginCleanup();
         static void BeginCleanup(const std::filesystem::path& filePath);
 
+        // Waits until all messages queued so far have been written to the file and flushed.
+        void Drain();
+
+        // Drains all active file loggers; intended for termination handlers that are about
+        // to end the process while queued messages may remain.
+        static void DrainAll() noexcept;
+
     private:
+        // The asynchronous channel between emitting threads and the background writer.
+        struct AsyncWriter;
+
         std::string m_name;
         std::filesystem::path m_filePath;
         std::ofstream m_stream;
+        std::unique_ptr<AsyncWriter> m_asyncWriter;
         std::ofstream::pos_type m_headersEnd = 0;
         std::ofstream::off_type m_maximumSize = 0;
 
         void OpenFileLoggerStream();
 
+        // Starts the background writer and registers this logger for DrainAll.
+        void StartAsyncWriter();
+
         // Initializes the default maximum file size.
         void InitializeDefaultMaximumFileSize();
 
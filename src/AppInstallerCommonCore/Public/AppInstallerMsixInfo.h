@@ -103,6 +103,9 @@ namespace AppInstaller::Msix
         // Writes the package file to the given file handle.
         void WriteToFileHandle(std::string_view packageFile, HANDLE target, IProgressCallback& progress);
 
+        // Reads the package file into memory.
+        std::vector<byte> ReadFileContents(std::string_view packageFile, IProgressCallback& progress);
+
         // Get application package manifests from msix and msixbundle.
         std::vector<MsixPackageManifest> GetAppPackageManifests(bool includeStub = false) const;
 
@@ -304,6 +304,13 @@ namespace AppInstaller::Logging
         std::wstring AnonymizeString(const wchar_t* input) const noexcept;
         std::wstring AnonymizeString(std::wstring_view input) const noexcept;
 
+        // Emits the FailureInfo event; when asynchronous emission is enabled this runs on
+        // a background thread against a copy of the logger taken at the call site.
+        void EmitFailureTelemetry(HRESULT hr, uint32_t threadId, uint32_t type, const std::wstring& message, const std::string& module, const std::string& file, uint32_t line, bool messageIsAnonymized) const noexcept;
+
+        // Emits the Exception event; same threading behavior as EmitFailureTelemetry.
+        void EmitExceptionTelemetry(FailureTypeEnum type, const std::wstring& message, bool messageIsAnonymized) const noexcept;
+
         // Flags used to determine whether to send telemetry. All of them are set during initialization and
         // are CopyConstructibleAtomic to minimize the impact of multiple simultaneous initialization attempts.
         // m_isSettingEnabled starts as false so we can don't send telemetry until we have read the
@@ -336,6 +343,12 @@ namespace AppInstaller::Logging
     // Turns on wil failure telemetry and logging.
     void EnableWilFailureTelemetry();
 
+    // Turns on asynchronous telemetry emission: failure and exception events are formatted and
+    // written by a background thread, with pending events flushed at process exit. When the
+    // bounded queue is full, events are emitted inline as before. The summary data used for
+    // the COM summary event is always updated on the calling thread.
+    void EnableAsyncTelemetryEmission(bool enable = true);
+
     // TODO: Temporary code to keep existing telemetry behavior for command execution cases.
     void UseGlobalTelemetryLoggerActivityIdOnly();
 
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #pragma once
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace AppInstaller::Archive
 {
@@ -14,5 +16,12 @@ namespace AppInstaller::Archive
 
     HRESULT TryExtractArchive(const std::filesystem::path& archivePath, const std::filesystem::path& destPath);
 
+    // Extracts only the given relative file paths from a zip archive by reading its central
+    // directory directly, writing each entry under destPath with its relative path preserved.
+    // Entry name matching is case insensitive and ignores path separator differences.
+    // Returns a failure when the archive is not a supported zip or any requested entry is
+    // missing, so that callers can fall back to a full extraction.
+    HRESULT TryExtractFilesFromZipArchive(const std::filesystem::path& archivePath, const std::filesystem::path& destPath, const std::vector<std::string>& relativeFilePaths);
+
     bool ScanZipFile(const std::filesystem::path& zipPath);
 }
@@ -13,7 +13,10 @@ namespace AppInstaller::Manifest
 
         DependencyGraph(const Dependency& root, std::function<const DependencyList(const Dependency&)> infoFunction);
 
-        void BuildGraph();
+        // Builds the graph by evaluating the dependencies of each node.
+        // When evaluateConcurrently is set, nodes at the same depth are evaluated on
+        // concurrent threads; the info function must then be safe to call concurrently.
+        void BuildGraph(bool evaluateConcurrently = false);
 
         void AddNode(const Dependency& node);
 
@@ -5,7 +5,10 @@
 #include <winget/SharedThreadGlobals.h>
 #include <cpprest/http_client.h>
 #include <cpprest/json.h>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -36,20 +39,41 @@ namespace AppInstaller::Http
 
         std::optional<web::json::value> HandleGet(const utility::string_t& uri, const HttpRequestHeaders& headers = {}, const HttpRequestHeaders& authHeaders = {}, const HttpResponseHandler& customHandler = {}) const;
 
+        // Starts a background request to the uri so that DNS resolution and the TLS handshake
+        // complete (and get cached by the system) before the first real request needs them.
+        // Does not block; failures are logged and ignored.
+        void WarmUp(const utility::string_t& uri) const;
+
         void SetPinningConfiguration(const Certificates::PinningConfiguration& configuration, std::shared_ptr<ThreadLocalStorage::ThreadGlobals> threadGlobals = {});
 
+        // Sets the remaining number of retries shared across all requests made through this helper.
+        // Setting 0 makes throttled requests fail without retrying.
+        void SetRetryBudget(uint32_t budget);
+
     protected:
         std::optional<web::json::value> ValidateAndExtractResponse(const web::http::http_response& response) const;
 
         std::optional<web::json::value> ExtractJsonResponse(const web::http::http_response& response) const;
 
     private:
-        web::http::client::http_client GetClient(const utility::string_t& uri) const;
+        // Gets the client to use for the given uri; clients are pooled per authority so that
+        // repeated requests to the same host reuse the underlying session and its connections.
+        web::http::client::http_client GetClient(const web::http::uri& uri) const;
 
         // Translates a cpprestsdk http_exception to a WIL exception.
         static void RethrowAsWilException(const web::http::http_exception& exception);
 
+        // Attempts to take a retry from the shared budget; returns false when it is exhausted.
+        bool TryAcquireRetry() const;
+
         std::shared_ptr<web::http::http_pipeline_stage> m_defaultRequestHandlerStage;
         web::http::client::http_client_config m_clientConfig;
+
+        // Retries for throttled requests draw from this shared budget so that many requests
+        // against an already struggling service cannot multiply the retry load.
+        mutable std::atomic<uint32_t> m_retryBudget;
+
+        mutable std::mutex m_clientsLock;
+        mutable std::map<utility::string_t, web::http::client::http_client> m_clients;
     };
 }
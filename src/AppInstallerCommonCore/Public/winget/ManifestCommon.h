@@ -418,27 +418,27 @@ namespace AppInstaller::Manifest
         std::vector<DesiredStateConfigurationResourceInfo> Resources;
     };
 
-    InstallerTypeEnum ConvertToInstallerTypeEnum(const std::string& in);
+    InstallerTypeEnum ConvertToInstallerTypeEnum(std::string_view in);
 
-    UpdateBehaviorEnum ConvertToUpdateBehaviorEnum(const std::string& in);
+    UpdateBehaviorEnum ConvertToUpdateBehaviorEnum(std::string_view in);
 
     ScopeEnum ConvertToScopeEnum(std::string_view in);
 
-    InstallModeEnum ConvertToInstallModeEnum(const std::string& in);
+    InstallModeEnum ConvertToInstallModeEnum(std::string_view in);
 
     PlatformEnum ConvertToPlatformEnum(std::string_view in);
 
     PlatformEnum ConvertToPlatformEnumForMSStoreDownload(std::string_view in);
 
-    ElevationRequirementEnum ConvertToElevationRequirementEnum(const std::string& in);
+    ElevationRequirementEnum ConvertToElevationRequirementEnum(std::string_view in);
 
-    UnsupportedArgumentEnum ConvertToUnsupportedArgumentEnum(const std::string& in);
+    UnsupportedArgumentEnum ConvertToUnsupportedArgumentEnum(std::string_view in);
 
-    ManifestTypeEnum ConvertToManifestTypeEnum(const std::string& in);
+    ManifestTypeEnum ConvertToManifestTypeEnum(std::string_view in);
 
-    ExpectedReturnCodeEnum ConvertToExpectedReturnCodeEnum(const std::string& in);
+    ExpectedReturnCodeEnum ConvertToExpectedReturnCodeEnum(std::string_view in);
 
-    InstalledFileTypeEnum ConvertToInstalledFileTypeEnum(const std::string& in);
+    InstalledFileTypeEnum ConvertToInstalledFileTypeEnum(std::string_view in);
 
     IconFileTypeEnum ConvertToIconFileTypeEnum(std::string_view in);
 
@@ -83,6 +83,8 @@ namespace AppInstaller::Manifest
         std::vector<FieldProcessInfo> DesiredStateConfigurationPowerShellResourceFieldInfos;
         std::vector<FieldProcessInfo> DesiredStateConfigurationDSCv3FieldInfos;
         std::vector<FieldProcessInfo> DesiredStateConfigurationDSCv3ResourceFieldInfos;
+        std::vector<FieldProcessInfo> ShadowRootFieldInfos;
+        std::vector<FieldProcessInfo> ShadowLocalizationFieldInfos;
 
         // Cache of Installers node and Localization node
         YAML::Node const* m_p_installersNode = nullptr;
@@ -115,6 +117,13 @@ namespace AppInstaller::Manifest
         std::vector<FieldProcessInfo> GetShadowRootFieldProcessInfo();
         std::vector<FieldProcessInfo> GetShadowLocalizationFieldProcessInfo();
 
+        // Lazily built per field list: lower cased field name to field info.
+        // Field lookup is on the hot path of parsing; this replaces a case-insensitive
+        // scan of the list for every key encountered.
+        std::map<const std::vector<FieldProcessInfo>*, std::map<std::string, const FieldProcessInfo*, std::less<>>> m_fieldLookupCache;
+
+        const FieldProcessInfo* FindFieldProcessInfo(const std::vector<FieldProcessInfo>& fieldInfos, std::string_view key);
+
         // This method takes YAML root node and list of manifest field info.
         // Yaml lib does not support case-insensitive search and it allows duplicate keys. If duplicate keys exist,
         // the value is undefined. So in this method, we will iterate through the node map and process each individual
@@ -14,6 +14,15 @@ namespace AppInstaller::Manifest::YamlWriter
     /// <returns>Yaml string.</returns>
     std::string ManifestToYamlString(const Manifest& manifest, const ManifestInstaller& installer);
 
+    /// <summary>
+    /// Writes the manifest and a single installer to the given stream.
+    /// The yaml text is emitted incrementally, so the full document is never buffered.
+    /// </summary>
+    /// <param name="manifest">Manifest object.</param>
+    /// <param name="installer">Manifest installer object.</param>
+    /// <param name="out">Stream to write the yaml to.</param>
+    void ManifestToYamlStream(const Manifest& manifest, const ManifestInstaller& installer, std::ostream& out);
+
     /// <summary>
     /// Exports the manifest and single manifest installer to a yaml file.
     /// </summary>
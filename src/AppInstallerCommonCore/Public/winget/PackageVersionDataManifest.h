@@ -26,6 +26,10 @@ namespace AppInstaller::Manifest
         // Creates the decompressor used by the PackageVersionDataManifest.
         static Compression::Decompressor CreateDecompressor();
 
+        // Gets the decompressor used by the PackageVersionDataManifest, cached on the calling thread.
+        // Prefer this when decompressing many version data manifests.
+        static Compression::Decompressor& GetThreadLocalDecompressor();
+
         // Data on an individual version.
         struct VersionData
         {
@@ -45,6 +49,17 @@ namespace AppInstaller::Manifest
             std::string ManifestHash;
         };
 
+        // The format to use when serializing the manifest.
+        enum class SerializationFormat
+        {
+            // The YAML based 1.0 schema; readable by all clients.
+            Yaml_1_0,
+            // The compact line based 2.0 schema; smaller and cheaper to parse than YAML,
+            // but only readable by clients that understand it. Deserialize accepts both
+            // formats, distinguishing them by the leading version marker.
+            Compact_2_0,
+        };
+
         // Adds the given version data to the manifest.
         void AddVersion(VersionData&& versionData);
 
@@ -52,7 +67,7 @@ namespace AppInstaller::Manifest
         const std::vector<VersionData>& Versions() const;
 
         // Returns a serialized version of the current manifest data.
-        std::string Serialize();
+        std::string Serialize(SerializationFormat format = SerializationFormat::Yaml_1_0);
 
         // Parses the input into this objects data.
         void Deserialize(std::string_view input);
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace AppInstaller::Logging
+{
+    // Determines whether an ETW session is currently listening for performance trace events.
+    // Callers can use this to avoid constructing event payloads that would only be dropped.
+    bool IsPerformanceTraceEnabled();
+
+    // Emits TraceLogging start/stop events around a scope under a dedicated keyword,
+    // allowing WPA to attribute wall clock time per scope without symbol resolution.
+    // Does nothing when no session is listening for the keyword.
+    struct PerformanceTraceSpan
+    {
+        PerformanceTraceSpan(std::string_view name);
+        ~PerformanceTraceSpan();
+
+        PerformanceTraceSpan(const PerformanceTraceSpan&) = delete;
+        PerformanceTraceSpan& operator=(const PerformanceTraceSpan&) = delete;
+
+        PerformanceTraceSpan(PerformanceTraceSpan&&) = delete;
+        PerformanceTraceSpan& operator=(PerformanceTraceSpan&&) = delete;
+
+    private:
+        std::string m_name;
+        bool m_active = false;
+    };
+}
@@ -82,6 +82,8 @@ namespace AppInstaller::Settings
         constexpr static StreamDefinition AdminSettings{ Type::Secure, "admin_settings"sv };
         // The REST information cache.
         constexpr static StreamDefinition RestInformationCache{ Type::Encrypted, "rest_information"sv };
+        // The REST response cache (search and manifest responses).
+        constexpr static StreamDefinition RestResponseCache{ Type::StandardFile, "rest_responses"sv };
 
         // Gets a Stream for the StreamDefinition.
         // If the stream is synchronized, attempts to Set the value can fail due to another writer
@@ -96,6 +96,7 @@ namespace AppInstaller::Settings
         EnableSixelDisplay,
         // Source
         AutoUpdateTimeInMinutes,
+        BackgroundSourceUpdate,
         // Experimental
         EFExperimentalCmd,
         EFExperimentalArg,
@@ -125,6 +126,7 @@ namespace AppInstaller::Settings
         NetworkDownloader,
         NetworkDOProgressTimeoutInSeconds,
         NetworkWingetAlternateSourceURL,
+        NetworkUpgradePrefetchCount,
         // Logging
         LoggingLevelPreference,
         LoggingChannelPreference,
@@ -188,6 +190,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::EnableSixelDisplay, bool, bool, false, ".visual.enableSixels"sv);
         // Source
         SETTINGMAPPING_SPECIALIZATION_POLICY(Setting::AutoUpdateTimeInMinutes, uint32_t, std::chrono::minutes, 15min, ".source.autoUpdateIntervalInMinutes"sv, ValuePolicy::SourceAutoUpdateIntervalInMinutes);
+        SETTINGMAPPING_SPECIALIZATION(Setting::BackgroundSourceUpdate, bool, bool, false, ".source.backgroundUpdate"sv);
         // Experimental
         SETTINGMAPPING_SPECIALIZATION(Setting::EFExperimentalCmd, bool, bool, false, ".experimentalFeatures.experimentalCmd"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::EFExperimentalArg, bool, bool, false, ".experimentalFeatures.experimentalArg"sv);
@@ -224,6 +227,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDownloader, std::string, InstallerDownloader, InstallerDownloader::Default, ".network.downloader"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDOProgressTimeoutInSeconds, uint32_t, std::chrono::seconds, 60s, ".network.doProgressTimeoutInSeconds"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkWingetAlternateSourceURL, bool, bool, true, ".network.enableWingetAlternateSourceURL"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::NetworkUpgradePrefetchCount, uint32_t, uint32_t, 0, ".network.upgradePrefetchCount"sv);
 #ifndef AICLI_DISABLE_TEST_HOOKS
         // Debug
         SETTINGMAPPING_SPECIALIZATION(Setting::EnableSelfInitiatedMinidump, bool, bool, false, ".debugging.enableSelfInitiatedMinidump"sv);
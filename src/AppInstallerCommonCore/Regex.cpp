@@ -29,16 +29,36 @@ namespace AppInstaller::Regex
             {
                 std::string pattern;
                 Options options = Options::None;
+            };
+
+            // A view of a key; cache lookups use this so that a hit does not
+            // have to copy the pattern string just to probe the map.
+            struct key_view
+            {
+                std::string_view pattern;
+                Options options = Options::None;
+            };
 
-                bool operator<(const key& other) const
+            struct key_less
+            {
+                using is_transparent = void;
+
+                static key_view AsView(const key& value) { return { value.pattern, value.options }; }
+                static key_view AsView(const key_view& value) { return value; }
+
+                template <typename A, typename B>
+                bool operator()(const A& a, const B& b) const
                 {
-                    if (pattern < other.pattern)
+                    key_view aView = AsView(a);
+                    key_view bView = AsView(b);
+
+                    if (aView.pattern < bView.pattern)
                     {
                         return true;
                     }
-                    else if (pattern == other.pattern)
+                    else if (aView.pattern == bView.pattern)
                     {
-                        return ToIntegral(options) < ToIntegral(other.options);
+                        return ToIntegral(aView.options) < ToIntegral(bView.options);
                     }
                     else
                     {
@@ -49,15 +69,13 @@ namespace AppInstaller::Regex
 
             struct statics
             {
-                std::map<key, impl> map;
+                std::map<key, impl, key_less> map;
                 wil::srwlock lock;
             };
 
             static statics s_regex_cache;
 
-            key requested;
-            requested.pattern = pattern;
-            requested.options = options;
+            key_view requested{ pattern, options };
 
             {
                 // Attempt to find in the cache
@@ -80,7 +98,7 @@ namespace AppInstaller::Regex
             }
             else
             {
-                return std::make_unique<impl>(s_regex_cache.map.emplace(std::move(requested), impl{ pattern, options }).first->second);
+                return std::make_unique<impl>(s_regex_cache.map.emplace(key{ std::string{ pattern }, options }, impl{ pattern, options }).first->second);
             }
         }
 
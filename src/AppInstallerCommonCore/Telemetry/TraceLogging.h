@@ -15,6 +15,8 @@
 #define KEYWORD_SCROLLVIEWER     0x0000000000000008
 #define KEYWORD_SWIPECONTROL     0x0000000000000010
 #define KEYWORD_COMMANDBARFLYOUT 0x0000000000000020
+// Keyword for low-overhead performance spans; enable it on the provider in a WPR profile to capture them.
+#define KEYWORD_PERFTRACE        0x0000000000000040
 
 // Common output formats
 #define TRACE_MSG_METH L"%s[0x%p]()\n"
@@ -157,7 +157,9 @@ namespace AppInstaller::Settings
             }
 
             const Json::Path jsonPath(path);
-            Json::Value result = jsonPath.resolve(root);
+            // resolve() hands back a reference into the root; taking it by value would
+            // deep copy the resolved subtree for every setting.
+            const Json::Value& result = jsonPath.resolve(root);
             if (!result.isNull())
             {
                 auto jsonValue = GetValue<typename details::SettingMapping<S>::json_t>(result);
@@ -281,6 +283,7 @@ namespace AppInstaller::Settings
             return {};
         }
 
+        WINGET_VALIDATE_PASS_THROUGH(BackgroundSourceUpdate)
         WINGET_VALIDATE_PASS_THROUGH(EnableSixelDisplay)
         WINGET_VALIDATE_PASS_THROUGH(EFExperimentalCmd)
         WINGET_VALIDATE_PASS_THROUGH(EFExperimentalArg)
@@ -295,6 +298,7 @@ namespace AppInstaller::Settings
         WINGET_VALIDATE_PASS_THROUGH(DisableInstallNotes)
         WINGET_VALIDATE_PASS_THROUGH(UninstallPurgePortablePackage)
         WINGET_VALIDATE_PASS_THROUGH(NetworkWingetAlternateSourceURL)
+        WINGET_VALIDATE_PASS_THROUGH(NetworkUpgradePrefetchCount)
         WINGET_VALIDATE_PASS_THROUGH(MaxResumes)
         WINGET_VALIDATE_PASS_THROUGH(LoggingFileTotalSizeLimitInMB)
         WINGET_VALIDATE_PASS_THROUGH(LoggingFileIndividualSizeLimitInMB)
@@ -653,7 +657,7 @@ namespace AppInstaller::Settings
             {
                 AICLI_LOG(Core, Info, << "Settings loaded from custom settings");
                 m_type = UserSettingsType::Custom;
-                settingsRoot = settingsJson.value();
+                settingsRoot = std::move(settingsJson).value();
             }
         }
         else
@@ -663,7 +667,7 @@ namespace AppInstaller::Settings
             {
                 AICLI_LOG(Core, Info, << "Settings loaded from " << Stream::PrimaryUserSettings.Name);
                 m_type = UserSettingsType::Standard;
-                settingsRoot = settingsJson.value();
+                settingsRoot = std::move(settingsJson).value();
             }
 
             // Settings didn't parse or doesn't exist, try with backup.
@@ -675,7 +679,7 @@ namespace AppInstaller::Settings
                     AICLI_LOG(Core, Info, << "Settings loaded from " << Stream::BackupUserSettings.Name);
                     m_warnings.emplace_back(StringResource::String::SettingsWarningLoadedBackupSettings);
                     m_type = UserSettingsType::Backup;
-                    settingsRoot = settingsBackupJson.value();
+                    settingsRoot = std::move(settingsBackupJson).value();
                 }
                 else
                 {
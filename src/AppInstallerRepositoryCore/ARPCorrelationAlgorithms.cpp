@@ -144,9 +144,9 @@ namespace AppInstaller::Repository::Correlation
     double WordsEditDistanceMatchConfidenceAlgorithm::ComputeConfidence(const ARPEntry& arpEntry) const
     {
         // Name and Publisher are available as multi properties, but for ARP entries there will only be 0 or 1 values.
-        NameAndPublisher arpNameAndPublisher(
-            NormalizeAndPrepareName(arpEntry.Entry->GetLatestVersion()->GetProperty(PackageVersionProperty::Name).get()),
-            NormalizeAndPreparePublisher(arpEntry.Entry->GetLatestVersion()->GetProperty(PackageVersionProperty::Publisher).get()));
+        const NameAndPublisher& arpNameAndPublisher = GetPreparedARPEntry(
+            arpEntry.Entry->GetLatestVersion()->GetProperty(PackageVersionProperty::Name).get(),
+            arpEntry.Entry->GetLatestVersion()->GetProperty(PackageVersionProperty::Publisher).get());
 
         // Get the best score across all localizations
         double bestMatchingScore = 0;
@@ -180,6 +180,21 @@ namespace AppInstaller::Repository::Correlation
         return result;
     }
 
+    const WordsEditDistanceMatchConfidenceAlgorithm::NameAndPublisher& WordsEditDistanceMatchConfidenceAlgorithm::GetPreparedARPEntry(std::string_view name, std::string_view publisher) const
+    {
+        auto key = std::make_pair(std::string{ name }, std::string{ publisher });
+
+        std::lock_guard<std::mutex> lock{ m_arpEntryCacheLock };
+
+        auto itr = m_arpEntryCache.find(key);
+        if (itr == m_arpEntryCache.end())
+        {
+            itr = m_arpEntryCache.emplace(std::move(key), NameAndPublisher{ NormalizeAndPrepareName(name), NormalizeAndPreparePublisher(publisher) }).first;
+        }
+
+        return itr->second;
+    }
+
     WordSequence WordsEditDistanceMatchConfidenceAlgorithm::PrepareString(std::string_view s) const
     {
         return Utility::SplitIntoWords(Utility::FoldCase(s));
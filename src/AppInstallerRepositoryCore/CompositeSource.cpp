@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "CompositeSource.h"
 #include <winget/ExperimentalFeature.h>
+#include <winget/SharedThreadGlobals.h>
 
 using namespace AppInstaller::Settings;
 
@@ -20,6 +21,71 @@ namespace AppInstaller::Repository
             };
         }
 
+        // The outcome of searching a single sub-source; Exception is set if the search threw.
+        struct SourceSearchOutcome
+        {
+            SearchResult Result;
+            std::exception_ptr Exception;
+        };
+
+        // Runs the search against each of the given sources on its own thread, preserving source order in the outcomes.
+        // Failure handling is intentionally left to the caller so that existing semantics are kept.
+        std::vector<SourceSearchOutcome> SearchSourcesConcurrently(const std::vector<Source>& sources, const SearchRequest& request)
+        {
+            std::vector<SourceSearchOutcome> outcomes(sources.size());
+
+            auto searchInto = [&request](const Source& source, SourceSearchOutcome& outcome)
+            {
+                try
+                {
+                    outcome.Result = source.Search(request);
+                }
+                catch (...)
+                {
+                    outcome.Exception = std::current_exception();
+                }
+            };
+
+            if (sources.size() == 1)
+            {
+                // No value in spawning a thread for a single source.
+                searchInto(sources[0], outcomes[0]);
+                return outcomes;
+            }
+
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+            std::thread::id searchOperationId = GetCurrentSearchOperationId();
+
+            std::vector<std::thread> threads;
+            threads.reserve(sources.size());
+
+            for (size_t i = 0; i < sources.size(); ++i)
+            {
+                threads.emplace_back([&, i]()
+                    {
+                        // Propagate the caller's thread globals so that logging from the search continues
+                        // to work, and the search operation identity so that interrupting the operation
+                        // reaches the searches running on these threads.
+                        std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                        if (callerGlobals)
+                        {
+                            previousGlobals = callerGlobals->SetForCurrentThread();
+                        }
+
+                        SearchOperationIdScope operationIdScope{ searchOperationId };
+
+                        searchInto(sources[i], outcomes[i]);
+                    });
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            return outcomes;
+        }
+
         // Returns true for fields that provide a strong match; one that is not based on a heuristic.
         bool IsStrongMatchField(PackageMatchField field)
         {
@@ -825,7 +891,38 @@ namespace AppInstaller::Repository
         template <typename T>
         void SortResultMatches(std::vector<T>& matches)
         {
-            std::stable_sort(matches.begin(), matches.end(), ResultMatchComparator());
+            // The comparator reads only the two criteria enums, while each match also carries
+            // the package pointer and the criteria strings. Sorting compact keys keeps the sort
+            // loop within a dense array and moves each match into place once at the end.
+            struct CriteriaKey
+            {
+                MatchType Type;
+                PackageMatchField Field;
+            };
+
+            struct MatchSortKey
+            {
+                CriteriaKey MatchCriteria;
+                size_t Index;
+            };
+
+            std::vector<MatchSortKey> keys;
+            keys.reserve(matches.size());
+            for (size_t i = 0; i < matches.size(); ++i)
+            {
+                keys.push_back({ { matches[i].MatchCriteria.Type, matches[i].MatchCriteria.Field }, i });
+            }
+
+            std::stable_sort(keys.begin(), keys.end(), ResultMatchComparator());
+
+            std::vector<T> sortedMatches;
+            sortedMatches.reserve(matches.size());
+            for (const MatchSortKey& key : keys)
+            {
+                sortedMatches.emplace_back(std::move(matches[key.Index]));
+            }
+
+            matches = std::move(sortedMatches);
         }
 
         // A copy of the standard match that holds a CompositePackage instead.
@@ -869,6 +966,11 @@ namespace AppInstaller::Repository
                     return Field == other.Field && String1 == other.String1 && String2 == other.String2;
                 }
 
+                PackageMatchField GetField() const
+                {
+                    return Field;
+                }
+
                 void AddToFilters(
                     std::vector<PackageMatchFilter>& filters) const
                 {
@@ -883,12 +985,67 @@ namespace AppInstaller::Repository
                     }
                 }
 
+                // Gets a hash of the reference string for use by the correlation filter.
+                uint64_t Hash() const
+                {
+                    std::hash<std::string> hasher;
+                    return static_cast<uint64_t>(hasher(String1.get())) ^ (static_cast<uint64_t>(hasher(String2.get())) << 1) ^ (static_cast<uint64_t>(Field) << 24);
+                }
+
             private:
                 PackageMatchField Field;
                 Utility::LocIndString String1;
                 Utility::LocIndString String2;
             };
 
+            // A bloom filter over the installed source's system reference strings.
+            // Allows the available to installed correlation to skip probing the installed source
+            // for the typical search hit that is not installed; a false positive only means that
+            // the installed search runs as it always did.
+            struct SystemReferenceStringFilter
+            {
+                // Sized for a generous installed population (tens of thousands of reference strings)
+                // while keeping the false positive rate negligible.
+                static constexpr uint64_t c_filterBits = 1 << 20;
+
+                void Add(const SystemReferenceString& value)
+                {
+                    for (uint64_t hash : GetHashes(value))
+                    {
+                        m_bits[static_cast<size_t>(hash % c_filterBits)] = true;
+                    }
+                }
+
+                bool MayContain(const SystemReferenceString& value) const
+                {
+                    for (uint64_t hash : GetHashes(value))
+                    {
+                        if (!m_bits[static_cast<size_t>(hash % c_filterBits)])
+                        {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+
+            private:
+                static std::array<uint64_t, 2> GetHashes(const SystemReferenceString& value)
+                {
+                    uint64_t first = value.Hash();
+
+                    // Derive a second independent hash by remixing the first.
+                    uint64_t second = first + 0x9E3779B97F4A7C15ull;
+                    second ^= second >> 30;
+                    second *= 0xBF58476D1CE4E5B9ull;
+                    second ^= second >> 27;
+
+                    return { first, second };
+                }
+
+                std::vector<bool> m_bits = std::vector<bool>(c_filterBits, false);
+            };
+
             // Data relevant to correlation for a package.
             struct PackageData
             {
@@ -913,6 +1070,23 @@ namespace AppInstaller::Repository
                     return result;
                 }
 
+                // Creates a search request using only the exact system reference strings.
+                // The normalized name and publisher inclusions are the expensive part of a
+                // correlation search, and most installed packages correlate without them.
+                SearchRequest CreateExactInclusionsSearchRequest(SearchPurpose searchPurpose) const
+                {
+                    SearchRequest result;
+                    for (const auto& srs : SystemReferenceStrings)
+                    {
+                        if (srs.GetField() != PackageMatchField::NormalizedNameAndPublisher)
+                        {
+                            srs.AddToFilters(result.Inclusions);
+                        }
+                    }
+                    result.Purpose = searchPurpose;
+                    return result;
+                }
+
                 std::shared_ptr<IPackage> AddSystemReferenceStringsFromTrackingPackage(const PackageTrackingCatalog& trackingCatalog, const Utility::LocIndString& identifier, std::string_view sourceIdentifier)
                 {
                     SearchRequest trackingRequest;
@@ -1031,8 +1205,12 @@ namespace AppInstaller::Repository
             {
                 std::shared_ptr<IPackage> availablePackage = OnlyAvailable(availableMatch.Package);
 
-                for (auto& match : Matches)
+                // Only matches whose identifier bucket contains this package can compare the same,
+                // so the IsSame checks are limited to the bucket rather than the entire result.
+                for (size_t matchIndex : GetBucket(m_availableIdentifierBuckets, availablePackage->GetProperty(PackageProperty::Id)))
                 {
+                    CompositeResultMatch& match = Matches[matchIndex];
+
                     if (match.Package->IsSameAsAnyAvailable(availablePackage.get()))
                     {
                         if (ResultMatchComparator{}(availableMatch, match))
@@ -1070,33 +1248,63 @@ namespace AppInstaller::Repository
             }
 
             // Determines if the results contain the given installed package.
-            bool ContainsInstalledPackage(const IPackage* installedPackage) const 
+            bool ContainsInstalledPackage(const IPackage* installedPackage) const
             {
-                for (auto& match : Matches)
-                {
-                    if (match.Package->ContainsInstalledPackage(installedPackage))
-                    {
-                        return true;
-                    }
-                }
-
-                return false;
+                return FindInstalledPackage(installedPackage) != nullptr;
             }
 
             // Determines if the results contain the given installed package.
             std::shared_ptr<CompositePackage> FindInstalledPackage(const IPackage* installedPackage) const
             {
-                for (auto& match : Matches)
+                if (installedPackage)
                 {
-                    if (match.Package->ContainsInstalledPackage(installedPackage))
+                    for (size_t matchIndex : GetBucket(m_installedIdentifierBuckets, installedPackage->GetProperty(PackageProperty::Id)))
                     {
-                        return match.Package;
+                        if (Matches[matchIndex].Package->ContainsInstalledPackage(installedPackage))
+                        {
+                            return Matches[matchIndex].Package;
+                        }
                     }
                 }
 
                 return {};
             }
 
+            // Adds a match to the result, indexing its package identifiers for the lookups above.
+            // Returns the package that was added.
+            const std::shared_ptr<CompositePackage>& AddMatch(std::shared_ptr<CompositePackage> package, PackageMatchFilter matchCriteria)
+            {
+                size_t matchIndex = Matches.size();
+                Matches.emplace_back(std::move(package), std::move(matchCriteria));
+
+                const std::shared_ptr<CompositePackage>& addedPackage = Matches.back().Package;
+
+                std::shared_ptr<IPackage> installedPackage = addedPackage->GetInstalled();
+                if (installedPackage)
+                {
+                    AddToBucket(m_installedIdentifierBuckets, installedPackage->GetProperty(PackageProperty::Id), matchIndex);
+                }
+
+                for (const auto& availablePackage : addedPackage->GetAvailablePackages())
+                {
+                    AddToBucket(m_availableIdentifierBuckets, availablePackage->GetProperty(PackageProperty::Id), matchIndex);
+                }
+
+                m_matchIndexByPackage[addedPackage.get()] = matchIndex;
+
+                return addedPackage;
+            }
+
+            // Adds an available package to a match already in the result, keeping the identifier buckets current.
+            void AddAvailablePackageToMatch(const std::shared_ptr<CompositePackage>& package, std::shared_ptr<ICompositePackage> availablePackage, bool setPrimary)
+            {
+                auto itr = m_matchIndexByPackage.find(package.get());
+                THROW_HR_IF(E_UNEXPECTED, itr == m_matchIndexByPackage.end());
+
+                AddToBucket(m_availableIdentifierBuckets, availablePackage->GetProperty(PackageProperty::Id), itr->second);
+                package->AddAvailablePackage(std::move(availablePackage), setPrimary);
+            }
+
             // *Destructively* converts the result to the standard variant.
             SearchResult ConvertToSearchResult()
             {
@@ -1159,6 +1367,26 @@ namespace AppInstaller::Repository
                 return result;
             }
 
+            // Folds the outcome of an already performed search into the failure set; the equivalent of
+            // SearchAndHandleFailures for searches that were run concurrently up front.
+            SearchResult HandleSearchOutcome(const Source& source, SourceSearchOutcome&& outcome)
+            {
+                if (outcome.Exception)
+                {
+                    if (AddFailureIfSourceNotPresent({ source.GetDetails().Name, outcome.Exception }))
+                    {
+                        AICLI_LOG(Repo, Warning, << "Failed to search source for correlation: " << source.GetDetails().Name);
+                    }
+                }
+
+                for (SearchResult::Failure& failure : outcome.Result.Failures)
+                {
+                    AddFailureIfSourceNotPresent(std::move(failure));
+                }
+
+                return std::move(outcome.Result);
+            }
+
             // Group results in an attempt to have a single result that covers all installed versions.
             // This is expected to be called immediately after the installed search portion,
             // when each result will contain a single installed version and some number of available packages.
@@ -1367,6 +1595,30 @@ namespace AppInstaller::Repository
             std::vector<CompositeResultMatch> Matches;
             bool Truncated = false;
             std::vector<SearchResult::Failure> Failures;
+
+        private:
+            // Buckets of indices into Matches, keyed by case folded package identifier.
+            // Packages can only compare the same (IPackage::IsSame) when they represent the same
+            // underlying record, which implies an identical identifier; a bucket therefore holds
+            // every candidate for the IsSame based lookups, keeping broad result merges from
+            // scanning the entire accumulated result for each incoming match.
+            using IdentifierBuckets = std::map<std::string, std::vector<size_t>>;
+
+            static void AddToBucket(IdentifierBuckets& buckets, const Utility::LocIndString& identifier, size_t matchIndex)
+            {
+                buckets[Utility::FoldCase(identifier)].push_back(matchIndex);
+            }
+
+            static const std::vector<size_t>& GetBucket(const IdentifierBuckets& buckets, const Utility::LocIndString& identifier)
+            {
+                static const std::vector<size_t> s_empty{};
+                auto itr = buckets.find(Utility::FoldCase(identifier));
+                return itr == buckets.end() ? s_empty : itr->second;
+            }
+
+            IdentifierBuckets m_availableIdentifierBuckets;
+            IdentifierBuckets m_installedIdentifierBuckets;
+            std::map<const CompositePackage*, size_t> m_matchIndexByPackage;
         };
 
         std::shared_ptr<ICompositePackage> GetTrackedPackageFromAvailableSource(CompositeResult& result, const Source& source, const Utility::LocIndString& identifier)
@@ -1429,6 +1681,19 @@ namespace AppInstaller::Repository
         }
     }
 
+    void CompositeSource::InterruptSearches(std::thread::id operationId) const
+    {
+        if (m_installedSource)
+        {
+            m_installedSource.InterruptSearches(operationId);
+        }
+
+        for (const auto& source : m_availableSources)
+        {
+            source.InterruptSearches(operationId);
+        }
+    }
+
     void* CompositeSource::CastTo(ISourceType type)
     {
         if (type == SourceType)
@@ -1486,6 +1751,18 @@ namespace AppInstaller::Repository
             SearchResult installedResult = m_installedSource.Search(request);
             result.Truncated = installedResult.Truncated;
 
+            // The installed packages and their system reference strings, gathered up front so that
+            // each available source can be asked about all of them in a single query.
+            struct InstalledEntry
+            {
+                std::shared_ptr<CompositePackage> Package;
+                PackageMatchFilter MatchCriteria;
+                CompositeResult::PackageData Data;
+            };
+
+            std::vector<InstalledEntry> installedEntries;
+            installedEntries.reserve(installedResult.Matches.size());
+
             for (auto&& match : installedResult.Matches)
             {
                 if (!match.Package)
@@ -1510,7 +1787,83 @@ namespace AppInstaller::Repository
                     continue;
                 }
 
-                auto installedPackageData = result.GetSystemReferenceStrings(installedPackage.get());
+                installedEntries.emplace_back(InstalledEntry{ std::move(compositePackage), std::move(match.MatchCriteria), result.GetSystemReferenceStrings(installedPackage.get()) });
+            }
+
+            // A match from a batched correlation search, attributed back to the individual installed
+            // packages by intersecting its reference strings with theirs. A match whose reference
+            // strings identify no installed package at all was produced by looser matching within the
+            // source; it cannot be attributed and is presented to every installed package, leaving the
+            // match criteria based disambiguation below to sort it out as it always has.
+            struct BatchedAvailableMatch
+            {
+                ResultMatch Match;
+                CompositeResult::PackageData Data;
+                bool Attributable = false;
+            };
+
+            auto sharesReferenceString = [](const CompositeResult::PackageData& available, const CompositeResult::PackageData& installed)
+                {
+                    return std::any_of(available.SystemReferenceStrings.begin(), available.SystemReferenceStrings.end(),
+                        [&](const CompositeResult::SystemReferenceString& srs) { return installed.SystemReferenceStrings.count(srs) != 0; });
+                };
+
+            // Each available source is queried once with the union of every installed package's
+            // reference strings, rather than once per installed package; some sources serve the
+            // searches remotely and the per-package requests dominate the scan time there.
+            // A source without a batched entry falls back to the per-package searches below.
+            std::vector<std::optional<std::vector<BatchedAvailableMatch>>> batchedAvailableMatches(m_availableSources.size());
+
+            CompositeResult::PackageData allInstalledData;
+            for (const auto& entry : installedEntries)
+            {
+                for (const auto& srs : entry.Data.SystemReferenceStrings)
+                {
+                    allInstalledData.AddIfNotPresent(CompositeResult::SystemReferenceString{ srs });
+                }
+            }
+
+            if (!allInstalledData.SystemReferenceStrings.empty())
+            {
+                SearchRequest batchedReferenceSearch = allInstalledData.CreateInclusionsSearchRequest(SearchPurpose::CorrelationToAvailable);
+
+                for (size_t sourceIndex = 0; sourceIndex < m_availableSources.size(); ++sourceIndex)
+                {
+                    const Source& source = m_availableSources[sourceIndex];
+
+                    if (!source.GetDetails().SupportInstalledSearchCorrelation)
+                    {
+                        continue;
+                    }
+
+                    AICLI_LOG(Repo, Verbose, << "Running batched correlation search against source: " << source.GetDetails().Name << " [" << source.GetIdentifier() << ']');
+                    SearchResult batchedResult = result.SearchAndHandleFailures(source, batchedReferenceSearch);
+
+                    if (batchedResult.Truncated)
+                    {
+                        AICLI_LOG(Repo, Verbose, << " ... batched correlation search was truncated; using per-package searches");
+                        continue;
+                    }
+
+                    std::vector<BatchedAvailableMatch> batchedMatches;
+                    batchedMatches.reserve(batchedResult.Matches.size());
+
+                    for (auto&& batchedMatch : batchedResult.Matches)
+                    {
+                        CompositeResult::PackageData availableData;
+                        availableData.AddSystemReferenceStrings(OnlyAvailable(batchedMatch.Package).get());
+                        bool attributable = sharesReferenceString(availableData, allInstalledData);
+                        batchedMatches.emplace_back(BatchedAvailableMatch{ std::move(batchedMatch), std::move(availableData), attributable });
+                    }
+
+                    batchedAvailableMatches[sourceIndex] = std::move(batchedMatches);
+                }
+            }
+
+            for (auto& entry : installedEntries)
+            {
+                auto installedPackage = entry.Package->GetInstalled();
+                const auto& installedPackageData = entry.Data;
 
                 // Create a search request to run against all available sources
                 if (!installedPackageData.SystemReferenceStrings.empty())
@@ -1519,8 +1872,9 @@ namespace AppInstaller::Repository
                     AICLI_LOG(Repo, Verbose, << "Finding available package from installed package using system reference search: " << systemReferenceSearch.ToString());
 
                     // Search sources and add to result
-                    for (const auto& source : m_availableSources)
+                    for (size_t sourceIndex = 0; sourceIndex < m_availableSources.size(); ++sourceIndex)
                     {
+                        const Source& source = m_availableSources[sourceIndex];
                         AICLI_LOG(Repo, Verbose, << " ... searching source: " << source.GetDetails().Name << " [" << source.GetIdentifier() << ']');
 
                         // Find the tracking result with the latest timestamp.
@@ -1542,18 +1896,43 @@ namespace AppInstaller::Repository
                             }
                         }
 
-                        if (trackingPackage && trackingPackageTime > compositePackage->GetTrackingPackageWriteTime())
+                        if (trackingPackage && trackingPackageTime > entry.Package->GetTrackingPackageWriteTime())
                         {
                             AICLI_LOG(Repo, Verbose, << " ... setting latest tracking package to: " << trackingPackage->GetProperty(PackageProperty::Id));
-                            compositePackage->SetTracking(source, trackingPackage, trackingPackageTime);
+                            entry.Package->SetTracking(source, trackingPackage, trackingPackageTime);
                             trackingSet = true;
                         }
 
                         // Attempt to correlate local packages against this source if supported.
                         SearchResult availableResult;
-                        if (source.GetDetails().SupportInstalledSearchCorrelation)
+                        const auto& batchedForSource = batchedAvailableMatches[sourceIndex];
+                        if (batchedForSource)
                         {
-                            availableResult = result.SearchAndHandleFailures(source, systemReferenceSearch);
+                            // Select this package's matches from the batched correlation result.
+                            for (const auto& batchedMatch : batchedForSource.value())
+                            {
+                                if (!batchedMatch.Attributable || sharesReferenceString(batchedMatch.Data, installedPackageData))
+                                {
+                                    availableResult.Matches.push_back(batchedMatch.Match);
+                                }
+                            }
+                        }
+                        else if (source.GetDetails().SupportInstalledSearchCorrelation)
+                        {
+                            // Two tier search: most installed packages correlate through their
+                            // exact reference strings, so only fall back to including the
+                            // normalized name and publisher search when those find nothing.
+                            SearchRequest exactReferenceSearch = installedPackageData.CreateExactInclusionsSearchRequest(SearchPurpose::CorrelationToAvailable);
+
+                            if (!exactReferenceSearch.Inclusions.empty())
+                            {
+                                availableResult = result.SearchAndHandleFailures(source, exactReferenceSearch);
+                            }
+
+                            if (availableResult.Matches.empty() && exactReferenceSearch.Inclusions.size() != systemReferenceSearch.Inclusions.size())
+                            {
+                                availableResult = result.SearchAndHandleFailures(source, systemReferenceSearch);
+                            }
                         }
 
                         auto availablePackage = GetMatchingPackage(availableResult.Matches,
@@ -1588,13 +1967,13 @@ namespace AppInstaller::Repository
                         if (availablePackage)
                         {
                             AICLI_LOG(Repo, Verbose, << " ... adding available package: " << availablePackage->GetProperty(PackageProperty::Id));
-                            compositePackage->AddAvailablePackage(availablePackage, trackingSet);
+                            entry.Package->AddAvailablePackage(availablePackage, trackingSet);
                         }
                     }
                 }
 
                 // Move the installed result into the composite result
-                result.Matches.emplace_back(std::move(compositePackage), std::move(match.MatchCriteria));
+                result.AddMatch(std::move(entry.Package), std::move(entry.MatchCriteria));
             }
 
             // Optimization for the "everything installed" case, no need to allow for reverse correlations
@@ -1604,12 +1983,52 @@ namespace AppInstaller::Repository
             }
         }
 
-        // Search available sources
-        for (const auto& source : m_availableSources)
+        // Search available sources; the searches run concurrently, while the correlation work below stays serial.
+        std::vector<SourceSearchOutcome> availableOutcomes = SearchSourcesConcurrently(m_availableSources, request);
+
+        // Building the installed reference filter below costs a full enumeration of the
+        // installed source; with only a handful of matches (the exact install case), the
+        // direct correlation probes are cheaper than that enumeration.
+        constexpr size_t referenceFilterMinimumMatches = 5;
+        size_t totalAvailableMatches = 0;
+        for (const auto& outcome : availableOutcomes)
+        {
+            totalAvailableMatches += outcome.Result.Matches.size();
+        }
+
+        // Filter over the installed system reference strings, built lazily on the first
+        // available match that needs reverse correlation. Most search hits are not installed,
+        // so the membership check lets us skip the installed probe for them entirely.
+        std::unique_ptr<CompositeResult::SystemReferenceStringFilter> installedReferenceFilter;
+
+        auto getInstalledReferenceFilter = [&]() -> const CompositeResult::SystemReferenceStringFilter&
+        {
+            if (!installedReferenceFilter)
+            {
+                installedReferenceFilter = std::make_unique<CompositeResult::SystemReferenceStringFilter>();
+
+                for (const auto& installedMatch : m_installedSource.Search({}).Matches)
+                {
+                    std::shared_ptr<IPackage> installedPackage = installedMatch.Package->GetInstalled();
+                    if (installedPackage)
+                    {
+                        for (const auto& srs : result.GetSystemReferenceStrings(installedPackage.get()).SystemReferenceStrings)
+                        {
+                            installedReferenceFilter->Add(srs);
+                        }
+                    }
+                }
+            }
+
+            return *installedReferenceFilter;
+        };
+
+        for (size_t sourceIndex = 0; sourceIndex < m_availableSources.size(); ++sourceIndex)
         {
+            const Source& source = m_availableSources[sourceIndex];
             auto trackingCatalog = source.GetTrackingCatalog();
 
-            SearchResult availableResult = result.SearchAndHandleFailures(source, request);
+            SearchResult availableResult = result.HandleSearchOutcome(source, std::move(availableOutcomes[sourceIndex]));
             bool downloadManifests = source.QueryFeatureFlag(SourceFeatureFlag::ManifestMayContainAdditionalSystemReferenceStrings);
 
             for (auto&& match : availableResult.Matches)
@@ -1631,7 +2050,14 @@ namespace AppInstaller::Repository
                 // If no package was found that was already in the results, do a correlation lookup with the installed
                 // source to create a new composite package entry if we find any packages there.
                 bool foundInstalledMatch = false;
-                if (!packageData->SystemReferenceStrings.empty())
+
+                const auto& packageReferenceStrings = packageData->SystemReferenceStrings;
+                bool mayCorrelate = !packageReferenceStrings.empty() &&
+                    (totalAvailableMatches < referenceFilterMinimumMatches ||
+                        std::any_of(packageReferenceStrings.begin(), packageReferenceStrings.end(),
+                            [&](const auto& srs) { return getInstalledReferenceFilter().MayContain(srs); }));
+
+                if (mayCorrelate)
                 {
                     // Create a search request to run against the installed source
                     SearchRequest systemReferenceSearch = packageData->CreateInclusionsSearchRequest(SearchPurpose::CorrelationToInstalled);
@@ -1700,8 +2126,7 @@ namespace AppInstaller::Repository
                         }
                         else
                         {
-                            result.Matches.emplace_back(std::make_shared<CompositePackage>(installedMatch.Package), match.MatchCriteria);
-                            resultPackage = result.Matches.back().Package;
+                            resultPackage = result.AddMatch(std::make_shared<CompositePackage>(installedMatch.Package), match.MatchCriteria);
                         }
 
                         bool setPrimary = false;
@@ -1716,7 +2141,7 @@ namespace AppInstaller::Repository
                             }
                         }
 
-                        resultPackage->AddAvailablePackage(std::move(match.Package), setPrimary);
+                        result.AddAvailablePackageToMatch(resultPackage, std::move(match.Package), setPrimary);
 
                         foundInstalledMatch = true;
                     }
@@ -1725,7 +2150,7 @@ namespace AppInstaller::Repository
                 // If there was no correlation for this package, add it without one.
                 if ((m_searchBehavior == CompositeSearchBehavior::AllPackages || m_searchBehavior == CompositeSearchBehavior::AvailablePackages) && !foundInstalledMatch)
                 {
-                    result.Matches.emplace_back(std::make_shared<CompositePackage>(std::shared_ptr<ICompositePackage>{}, std::move(match.Package)), match.MatchCriteria);
+                    result.AddMatch(std::make_shared<CompositePackage>(std::shared_ptr<ICompositePackage>{}, std::move(match.Package)), match.MatchCriteria);
                 }
             }
         }
@@ -1746,25 +2171,22 @@ namespace AppInstaller::Repository
     {
         SearchResult result;
 
-        // Search available sources
-        for (const auto& source : m_availableSources)
+        // Search available sources concurrently and merge in source order
+        std::vector<SourceSearchOutcome> outcomes = SearchSourcesConcurrently(m_availableSources, request);
+
+        for (size_t sourceIndex = 0; sourceIndex < m_availableSources.size(); ++sourceIndex)
         {
-            SearchResult oneSourceResult;
+            SourceSearchOutcome& outcome = outcomes[sourceIndex];
 
-            try
-            {
-                oneSourceResult = source.Search(request);
-            }
-            catch (...)
+            if (outcome.Exception)
             {
-                LOG_CAUGHT_EXCEPTION();
-                AICLI_LOG(Repo, Warning, << "Failed to search source: " << source.GetDetails().Name);
-                result.Failures.emplace_back(SearchResult::Failure{ source.GetDetails().Name, std::current_exception() });
+                AICLI_LOG(Repo, Warning, << "Failed to search source: " << m_availableSources[sourceIndex].GetDetails().Name);
+                result.Failures.emplace_back(SearchResult::Failure{ m_availableSources[sourceIndex].GetDetails().Name, outcome.Exception });
             }
 
             // Move into the single result
-            std::move(oneSourceResult.Matches.begin(), oneSourceResult.Matches.end(), std::back_inserter(result.Matches));
-            std::move(oneSourceResult.Failures.begin(), oneSourceResult.Failures.end(), std::back_inserter(result.Failures));
+            std::move(outcome.Result.Matches.begin(), outcome.Result.Matches.end(), std::back_inserter(result.Matches));
+            std::move(outcome.Result.Failures.begin(), outcome.Result.Failures.end(), std::back_inserter(result.Failures));
         }
 
         SortResultMatches(result.Matches);
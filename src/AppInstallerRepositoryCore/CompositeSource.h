@@ -32,6 +32,9 @@ namespace AppInstaller::Repository
         // Execute a search on the source.
         SearchResult Search(const SearchRequest& request) const override;
 
+        // Interrupts a search currently executing on the composited sources for the given operation.
+        void InterruptSearches(std::thread::id operationId) const override;
+
         // Casts to the requested type.
         void* CastTo(ISourceType type) override;
 
@@ -5,6 +5,7 @@
 #include <winget/SharedThreadGlobals.h>
 #include <functional>
 #include <memory>
+#include <thread>
 
 namespace AppInstaller::Repository
 {
@@ -20,6 +21,30 @@ namespace AppInstaller::Repository
         OpenExceptionProxy,
     };
 
+    // Gets the identity of the search operation that the current thread is working on, used
+    // to scope search interruption. An operation is identified by the thread on which it
+    // began; a search that fans out to worker threads applies the spawning operation's
+    // identity to each worker so that interrupting the operation reaches the statements
+    // those workers are running.
+    std::thread::id GetCurrentSearchOperationId();
+
+    // Applies the given search operation identity to the current thread for the scope's
+    // lifetime; used when running part of a search on a worker thread on behalf of an
+    // operation that began elsewhere.
+    struct SearchOperationIdScope
+    {
+        SearchOperationIdScope(std::thread::id operationId);
+        ~SearchOperationIdScope();
+
+        SearchOperationIdScope(const SearchOperationIdScope&) = delete;
+        SearchOperationIdScope& operator=(const SearchOperationIdScope&) = delete;
+        SearchOperationIdScope(SearchOperationIdScope&&) = delete;
+        SearchOperationIdScope& operator=(SearchOperationIdScope&&) = delete;
+
+    private:
+        std::thread::id m_previous;
+    };
+
     // Internal interface for interacting with a source from outside of the repository lib.
     struct ISource
     {
@@ -44,6 +69,12 @@ namespace AppInstaller::Repository
         // Execute a search on the source.
         virtual SearchResult Search(const SearchRequest& request) const = 0;
 
+        // Interrupts a search currently executing on the source for the given operation,
+        // causing it to fail promptly. Searches run for other operations are unaffected,
+        // as the source object may be shared across independent operations. Sources that
+        // cannot be interrupted do nothing.
+        virtual void InterruptSearches(std::thread::id) const {}
+
         // Gets this object as the requested type, or null if it is not the requested type.
         virtual void* CastTo(ISourceType type) = 0;
     };
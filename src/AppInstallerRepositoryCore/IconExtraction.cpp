@@ -13,67 +13,238 @@ namespace AppInstaller::Repository
 
     namespace
     {
-        // Struct used as data object passed to Enumerate callback function of EnumResourceNamesEx
-        struct EnumGroupIconProcParameter
+        // Reads icon resources directly from a PE file through a read only memory mapped view.
+        // LoadLibraryEx with LOAD_LIBRARY_AS_IMAGE_RESOURCE takes the loader lock and maps the
+        // whole image; when collecting icons for hundreds of installed binaries, walking the
+        // resource directory from the file bytes touches only the few pages that actually hold
+        // the headers and the icon data.
+        struct PEResourceReader
         {
-            // Input to specify icon index
-            int IconIndex = 0;
-            // The result Resource handle of the group icon
-            HRSRC ResourceHandle = nullptr;
-            // How many icons were already found
-            int IconsFound = 0;
-        };
+            explicit PEResourceReader(const std::filesystem::path& binaryPath)
+            {
+                m_file.reset(CreateFileW(binaryPath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+                THROW_LAST_ERROR_IF(!m_file);
 
-        BOOL CALLBACK EnumGroupIconProc(HMODULE hModule, LPCWSTR lpType, LPWSTR lpName, LONG_PTR lParam)
-        {
-            EnumGroupIconProcParameter* parameter = reinterpret_cast<EnumGroupIconProcParameter*>(lParam);
-            bool foundRequestedIcon = false;
+                LARGE_INTEGER fileSize{};
+                THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(m_file.get(), &fileSize));
+                m_size = static_cast<size_t>(fileSize.QuadPart);
+
+                m_mapping.reset(CreateFileMappingW(m_file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+                THROW_LAST_ERROR_IF(!m_mapping);
+
+                m_view.reset(reinterpret_cast<BYTE*>(MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0, 0, 0)));
+                THROW_LAST_ERROR_IF_NULL(m_view);
+
+                // Locate the resource directory from the headers; both PE32 and PE32+ are handled.
+                const IMAGE_DOS_HEADER& dosHeader = StructAt<IMAGE_DOS_HEADER>(0);
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT), dosHeader.e_magic != IMAGE_DOS_SIGNATURE || dosHeader.e_lfanew < 0);
+
+                size_t ntHeadersOffset = static_cast<size_t>(dosHeader.e_lfanew);
+                const IMAGE_NT_HEADERS32& ntHeaders = StructAt<IMAGE_NT_HEADERS32>(ntHeadersOffset);
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT), ntHeaders.Signature != IMAGE_NT_SIGNATURE);
+
+                IMAGE_DATA_DIRECTORY resourceDirectory{};
+                if (ntHeaders.OptionalHeader.Magic == IMAGE_NT_OPTIONAL_HDR32_MAGIC)
+                {
+                    THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT), ntHeaders.OptionalHeader.NumberOfRvaAndSizes <= IMAGE_DIRECTORY_ENTRY_RESOURCE);
+                    resourceDirectory = ntHeaders.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_RESOURCE];
+                }
+                else if (ntHeaders.OptionalHeader.Magic == IMAGE_NT_OPTIONAL_HDR64_MAGIC)
+                {
+                    const IMAGE_NT_HEADERS64& ntHeaders64 = StructAt<IMAGE_NT_HEADERS64>(ntHeadersOffset);
+                    THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT), ntHeaders64.OptionalHeader.NumberOfRvaAndSizes <= IMAGE_DIRECTORY_ENTRY_RESOURCE);
+                    resourceDirectory = ntHeaders64.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_RESOURCE];
+                }
+                else
+                {
+                    THROW_HR(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT));
+                }
+
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_RESOURCE_DATA_NOT_FOUND), resourceDirectory.VirtualAddress == 0);
 
-            // Find icon by resource name
-            if (parameter->IconIndex < 0)
+                m_sectionsOffset = ntHeadersOffset + FIELD_OFFSET(IMAGE_NT_HEADERS32, OptionalHeader) + ntHeaders.FileHeader.SizeOfOptionalHeader;
+                m_sectionCount = ntHeaders.FileHeader.NumberOfSections;
+                // Validate that the whole section table is in bounds.
+                (void)Data(m_sectionsOffset, static_cast<size_t>(m_sectionCount) * sizeof(IMAGE_SECTION_HEADER));
+
+                m_resourceDirectoryOffset = RvaToOffset(resourceDirectory.VirtualAddress);
+            }
+
+            // Gets the raw data of the group icon selected by the icon index convention used in
+            // DisplayIcon values: a non-negative index selects that ordinal group icon in resource
+            // directory order, while a negative index selects the group icon with that resource id,
+            // including string names of the "#id" form.
+            std::optional<std::pair<const BYTE*, DWORD>> FindGroupIcon(int iconIndex) const
             {
-                if (IS_INTRESOURCE(lpName))
+                std::optional<DWORD> typeDirectory = FindTypeDirectory(static_cast<WORD>(reinterpret_cast<ULONG_PTR>(RT_GROUP_ICON)));
+                if (!typeDirectory)
+                {
+                    return std::nullopt;
+                }
+
+                auto [entries, count] = GetDirectoryEntries(typeDirectory.value());
+                int iconsFound = 0;
+
+                for (size_t i = 0; i < count; ++i)
                 {
-                    if (-parameter->IconIndex == LOWORD(lpName))
+                    const IMAGE_RESOURCE_DIRECTORY_ENTRY& entry = entries[i];
+                    bool foundRequestedIcon = false;
+
+                    // Find icon by resource name
+                    if (iconIndex < 0)
                     {
-                        // Found icon by MAKEINTRESOURCE name
+                        if (!entry.NameIsString)
+                        {
+                            // Found icon by MAKEINTRESOURCE name
+                            foundRequestedIcon = (-iconIndex == entry.Id);
+                        }
+                        else
+                        {
+                            std::wstring name = GetEntryName(entry);
+                            if (!name.empty() && name[0] == L'#')
+                            {
+                                try
+                                {
+                                    // Found icon by number as string #12
+                                    foundRequestedIcon = (-iconIndex == std::stoi(name.substr(1), nullptr, 0));
+                                }
+                                catch (...)
+                                {
+                                    // Error occurred, stop enumerating
+                                    return std::nullopt;
+                                }
+                            }
+                        }
+                    }
+                    else if (iconIndex == iconsFound)
+                    {
+                        // Found icon by index
                         foundRequestedIcon = true;
                     }
+
+                    if (foundRequestedIcon)
+                    {
+                        return GetEntryData(entry);
+                    }
+
+                    iconsFound++;
+                }
+
+                return std::nullopt;
+            }
+
+            // Gets the raw data of the icon image with the given resource id.
+            std::optional<std::pair<const BYTE*, DWORD>> FindIcon(WORD id) const
+            {
+                std::optional<DWORD> typeDirectory = FindTypeDirectory(static_cast<WORD>(reinterpret_cast<ULONG_PTR>(RT_ICON)));
+                if (!typeDirectory)
+                {
+                    return std::nullopt;
                 }
-                else if (lpName[0] == TEXT('#'))
+
+                auto [entries, count] = GetDirectoryEntries(typeDirectory.value());
+
+                for (size_t i = 0; i < count; ++i)
                 {
-                    std::wstring resourceIdString = lpName + 1; // skip the #
-                    try
+                    if (!entries[i].NameIsString && entries[i].Id == id)
                     {
-                        auto resourceId = std::stoi(resourceIdString.c_str(), nullptr, 0);
-                        if (-parameter->IconIndex == resourceId)
-                        {
-                            // Found icon by number as string #12
-                            foundRequestedIcon = true;
-                        }
+                        return GetEntryData(entries[i]);
                     }
-                    catch (...)
+                }
+
+                return std::nullopt;
+            }
+
+        private:
+            // Gets a pointer to bounds checked bytes of the view.
+            const BYTE* Data(size_t offset, size_t size) const
+            {
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT), offset > m_size || size > m_size - offset);
+                return m_view.get() + offset;
+            }
+
+            template <typename T>
+            const T& StructAt(size_t offset) const
+            {
+                return *reinterpret_cast<const T*>(Data(offset, sizeof(T)));
+            }
+
+            // Converts a virtual address into a file offset through the section table.
+            size_t RvaToOffset(DWORD rva) const
+            {
+                for (WORD i = 0; i < m_sectionCount; ++i)
+                {
+                    const IMAGE_SECTION_HEADER& section = StructAt<IMAGE_SECTION_HEADER>(m_sectionsOffset + static_cast<size_t>(i) * sizeof(IMAGE_SECTION_HEADER));
+                    if (rva >= section.VirtualAddress && rva - section.VirtualAddress < section.SizeOfRawData)
+                    {
+                        return static_cast<size_t>(rva) - section.VirtualAddress + section.PointerToRawData;
+                    }
+                }
+
+                THROW_HR(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT));
+            }
+
+            // Gets the entries of the resource directory at the given offset from the resource
+            // root; named entries come first, then id entries, as the resource compiler wrote them.
+            std::pair<const IMAGE_RESOURCE_DIRECTORY_ENTRY*, size_t> GetDirectoryEntries(DWORD directoryOffset) const
+            {
+                const IMAGE_RESOURCE_DIRECTORY& directory = StructAt<IMAGE_RESOURCE_DIRECTORY>(m_resourceDirectoryOffset + directoryOffset);
+                size_t count = static_cast<size_t>(directory.NumberOfNamedEntries) + directory.NumberOfIdEntries;
+                const BYTE* entries = Data(m_resourceDirectoryOffset + directoryOffset + sizeof(IMAGE_RESOURCE_DIRECTORY), count * sizeof(IMAGE_RESOURCE_DIRECTORY_ENTRY));
+                return { reinterpret_cast<const IMAGE_RESOURCE_DIRECTORY_ENTRY*>(entries), count };
+            }
+
+            // Finds the directory for the given resource type in the root directory.
+            std::optional<DWORD> FindTypeDirectory(WORD type) const
+            {
+                auto [entries, count] = GetDirectoryEntries(0);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (!entries[i].NameIsString && entries[i].Id == type && entries[i].DataIsDirectory)
                     {
-                        // Error occurred, stop enumerating
-                        return FALSE;
+                        return entries[i].OffsetToDirectory;
                     }
                 }
+
+                return std::nullopt;
             }
-            else if (parameter->IconIndex == parameter->IconsFound)
+
+            // Gets the name of a string named directory entry.
+            std::wstring GetEntryName(const IMAGE_RESOURCE_DIRECTORY_ENTRY& entry) const
             {
-                // Found icon by index
-                foundRequestedIcon = TRUE;
+                const IMAGE_RESOURCE_DIR_STRING_U& name = StructAt<IMAGE_RESOURCE_DIR_STRING_U>(m_resourceDirectoryOffset + entry.NameOffset);
+                const BYTE* characters = Data(m_resourceDirectoryOffset + entry.NameOffset + sizeof(WORD), static_cast<size_t>(name.Length) * sizeof(WCHAR));
+                return { reinterpret_cast<const WCHAR*>(characters), name.Length };
             }
 
-            if (foundRequestedIcon)
+            // Resolves a name level entry to its resource bytes through the language directory,
+            // taking the first language present as the resource loader fallback would.
+            std::optional<std::pair<const BYTE*, DWORD>> GetEntryData(const IMAGE_RESOURCE_DIRECTORY_ENTRY& entry) const
             {
-                parameter->ResourceHandle = FindResourceExW(hModule, lpType, lpName, 0);
-                return FALSE;
+                if (!entry.DataIsDirectory)
+                {
+                    return std::nullopt;
+                }
+
+                auto [languageEntries, languageCount] = GetDirectoryEntries(entry.OffsetToDirectory);
+                if (languageCount == 0 || languageEntries[0].DataIsDirectory)
+                {
+                    return std::nullopt;
+                }
+
+                const IMAGE_RESOURCE_DATA_ENTRY& dataEntry = StructAt<IMAGE_RESOURCE_DATA_ENTRY>(m_resourceDirectoryOffset + languageEntries[0].OffsetToData);
+                const BYTE* data = Data(RvaToOffset(dataEntry.OffsetToData), dataEntry.Size);
+                return std::make_pair(data, dataEntry.Size);
             }
 
-            // Continue enumerating
-            parameter->IconsFound++;
-            return TRUE;
+            wil::unique_handle m_file;
+            wil::unique_handle m_mapping;
+            wil::unique_mapview_ptr<BYTE> m_view;
+            size_t m_size = 0;
+            size_t m_sectionsOffset = 0;
+            WORD m_sectionCount = 0;
+            size_t m_resourceDirectoryOffset = 0;
         };
 
         void WriteIconDirHeaderToByteArray(std::vector<BYTE>& data, const ICONDIR& iconDir)
@@ -87,6 +258,82 @@ namespace AppInstaller::Repository
             data.insert(data.end(), toBeWritten, toBeWritten + sizeof(iconDir.idCount));
         }
 
+        // An icon extraction result cached for the lifetime of the process.
+        // Re-extracting validates against the source file's last write time, so a replaced
+        // binary is noticed while repeated metadata queries for the same package avoid
+        // re-opening the binary and walking its resources.
+        struct CachedExtractedIcons
+        {
+            std::filesystem::file_time_type LastWriteTime;
+            int IconIndex = 0;
+            std::vector<ExtractedIconInfo> Icons;
+        };
+
+        std::mutex s_extractedIconCacheLock;
+        std::map<std::string, CachedExtractedIcons> s_extractedIconCache;
+
+        // Bound the cache size; icons are small but a server process can see many packages.
+        // The cache is simply dropped when full, as eviction order is not worth tracking here.
+        constexpr size_t s_extractedIconCacheLimit = 256;
+
+        // A snapshot of the ProductIcon property of every installed MSI product, captured in a
+        // single enumeration pass on first use. Each MsiGetProductInfo call round trips to the
+        // installer service, which adds up when collecting icons for hundreds of MSI products;
+        // the snapshot pays that cost once. It shares the lifetime and staleness trade-off of
+        // the extracted icon cache above: a product installed after the first use is not seen.
+        struct MsiProductIconSnapshot
+        {
+            static const MsiProductIconSnapshot& Instance()
+            {
+                static MsiProductIconSnapshot instance;
+                return instance;
+            }
+
+            // Gets the icon path for the given product code; empty if there is none.
+            std::wstring GetProductIconPath(const std::string& productCode) const
+            {
+                auto itr = m_iconPaths.find(Utility::FoldCase(std::string_view{ productCode }));
+                return itr != m_iconPaths.end() ? itr->second : std::wstring{};
+            }
+
+        private:
+            MsiProductIconSnapshot()
+            {
+                try
+                {
+                    // A product code is always a GUID with braces.
+                    wchar_t productCode[39];
+
+                    for (DWORD index = 0; MsiEnumProductsW(index, productCode) == ERROR_SUCCESS; ++index)
+                    {
+                        std::wstring iconPath;
+                        iconPath.resize(MAX_PATH);
+                        DWORD iconPathSize = wil::safe_cast<DWORD>(iconPath.size());
+                        UINT status = MsiGetProductInfoW(productCode, INSTALLPROPERTY_PRODUCTICON, iconPath.data(), &iconPathSize);
+
+                        if (status == ERROR_MORE_DATA)
+                        {
+                            // The size returned does not count the null terminator.
+                            iconPathSize++;
+                            iconPath.resize(iconPathSize);
+                            status = MsiGetProductInfoW(productCode, INSTALLPROPERTY_PRODUCTICON, iconPath.data(), &iconPathSize);
+                        }
+
+                        if (status == ERROR_SUCCESS && iconPathSize != 0)
+                        {
+                            iconPath.resize(iconPathSize);
+                            m_iconPaths.emplace(Utility::FoldCase(std::string_view{ Utility::ConvertToUTF8(productCode) }), std::move(iconPath));
+                        }
+                    }
+
+                    AICLI_LOG(Repo, Verbose, << "MSI product icon snapshot captured " << m_iconPaths.size() << " entries");
+                }
+                CATCH_LOG();
+            }
+
+            std::map<std::string, std::wstring> m_iconPaths;
+        };
+
         void AppendIconDirEntryToByteArray(std::vector<BYTE>& data, const ICONDIRENTRY& iconDirEntry)
         {
             data.insert(data.end(), iconDirEntry.bWidth);
@@ -108,32 +355,15 @@ namespace AppInstaller::Repository
     {
         try
         {
-            wil::unique_hmodule module;
-            module.reset(LoadLibraryEx(binaryPath.c_str(), nullptr, LOAD_LIBRARY_AS_DATAFILE | LOAD_LIBRARY_AS_IMAGE_RESOURCE));
-            THROW_LAST_ERROR_IF_NULL(module);
-
-            EnumGroupIconProcParameter param;
-            param.IconIndex = iconIndex;
+            PEResourceReader resourceReader{ binaryPath };
 
-#pragma warning( push )
-#pragma warning ( disable : 4302 )
             // First find the requested group icon
-            EnumResourceNamesExW(
-                module.get(),
-                MAKEINTRESOURCE(RT_GROUP_ICON),
-                EnumGroupIconProc,
-                reinterpret_cast<LONG_PTR>(&param),
-                (RESOURCE_ENUM_MUI | RESOURCE_ENUM_LN | RESOURCE_ENUM_VALIDATE),
-                0);
-#pragma warning( pop )
-
-            if (param.ResourceHandle)
+            std::optional<std::pair<const BYTE*, DWORD>> groupIconData = resourceReader.FindGroupIcon(iconIndex);
+
+            if (groupIconData)
             {
-                // Load and Lock to get a pointer to a GRPICONDIR
-                HGLOBAL groupIconResourceHandle = LoadResource(module.get(), param.ResourceHandle);
-                THROW_LAST_ERROR_IF_NULL(groupIconResourceHandle);
-                LPGRPICONDIR groupIconDir = reinterpret_cast<LPGRPICONDIR>(LockResource(groupIconResourceHandle));
-                THROW_LAST_ERROR_IF_NULL(groupIconDir);
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT), groupIconData->second < sizeof(GRPICONDIR));
+                const GRPICONDIR* groupIconDir = reinterpret_cast<const GRPICONDIR*>(groupIconData->first);
 
                 // Basic validation
                 if (groupIconDir->idReserved != 0 || groupIconDir->idType != 1 || groupIconDir->idCount == 0)
@@ -141,6 +371,9 @@ namespace AppInstaller::Repository
                     return {};
                 }
 
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_BAD_EXE_FORMAT),
+                    groupIconData->second < sizeof(GRPICONDIR) + (static_cast<DWORD>(groupIconDir->idCount) - 1) * sizeof(GRPICONDIRENTRY));
+
                 struct SingleIconImage
                 {
                     ICONDIRENTRY DirEntry = { 0 };
@@ -168,14 +401,9 @@ namespace AppInstaller::Repository
                     iconEntry.DirEntry.dwImageOffset = imageOffset;
 
                     // Load individual icon content
-                    HRSRC iconResourceHandle = FindResourceExW(module.get(), RT_ICON, MAKEINTRESOURCE(groupIconDir->idEntries[i].nID), 0);
-                    THROW_LAST_ERROR_IF_NULL(iconResourceHandle);
-                    HGLOBAL iconResourceContentHandle = LoadResource(module.get(), iconResourceHandle);
-                    THROW_LAST_ERROR_IF_NULL(iconResourceContentHandle);
-                    iconEntry.Content.second = SizeofResource(module.get(), iconResourceHandle);
-                    THROW_LAST_ERROR_IF(iconEntry.Content.second == 0);
-                    iconEntry.Content.first = reinterpret_cast<BYTE*>(LockResource(iconResourceContentHandle));
-                    THROW_LAST_ERROR_IF_NULL(iconEntry.Content.first);
+                    std::optional<std::pair<const BYTE*, DWORD>> iconData = resourceReader.FindIcon(groupIconDir->idEntries[i].nID);
+                    THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_RESOURCE_DATA_NOT_FOUND), !iconData || iconData->second == 0);
+                    iconEntry.Content = iconData.value();
 
                     // This will be the next image offset.
                     imageOffset += iconEntry.Content.second;
@@ -240,21 +468,8 @@ namespace AppInstaller::Repository
             std::wstring iconPathRaw;
             if (arpHelper.GetBoolValue(arpEntry, arpHelper.WindowsInstaller))
             {
-                // For msi, get icon from ProductInfo
-                auto productCodeWide = Utility::ConvertToUTF16(productCode);
-                DWORD iconPathSize = 0;
-                if (ERROR_MORE_DATA == MsiGetProductInfoW(productCodeWide.c_str(), INSTALLPROPERTY_PRODUCTICON, nullptr, &iconPathSize))
-                {
-                    std::wstring iconPathBuffer;
-                    // The iconPathSize returned in previous call does not count the null terminator.
-                    iconPathSize++;
-                    iconPathBuffer.resize(iconPathSize);
-                    if (ERROR_SUCCESS == MsiGetProductInfoW(productCodeWide.c_str(), INSTALLPROPERTY_PRODUCTICON, iconPathBuffer.data(), &iconPathSize))
-                    {
-                        iconPathBuffer.resize(iconPathSize);
-                        iconPathRaw = iconPathBuffer;
-                    }
-                }
+                // For msi, get icon from the product info snapshot
+                iconPathRaw = MsiProductIconSnapshot::Instance().GetProductIconPath(productCode);
             }
             else
             {
@@ -274,6 +489,18 @@ namespace AppInstaller::Repository
 
                 if (std::filesystem::exists(iconPath))
                 {
+                    std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(iconPath);
+                    std::string cacheKey = iconPath.u8string();
+
+                    {
+                        std::lock_guard<std::mutex> lock{ s_extractedIconCacheLock };
+                        auto itr = s_extractedIconCache.find(cacheKey);
+                        if (itr != s_extractedIconCache.end() && itr->second.LastWriteTime == lastWriteTime && itr->second.IconIndex == iconIndex)
+                        {
+                            return itr->second.Icons;
+                        }
+                    }
+
                     auto extension = iconPath.extension().u8string();
                     std::vector<BYTE> iconContent;
                     if (Utility::CaseInsensitiveEquals(extension, ".ico"))
@@ -287,6 +514,7 @@ namespace AppInstaller::Repository
                     }
 
                     // Construct ExtractedIconInfo return result
+                    std::vector<ExtractedIconInfo> result;
                     if (!iconContent.empty())
                     {
                         ExtractedIconInfo iconInfo;
@@ -296,8 +524,22 @@ namespace AppInstaller::Repository
                         iconInfo.IconSha256 = Utility::SHA256::ComputeHash(iconContent.data(), static_cast<uint32_t>(iconContent.size()));
                         iconInfo.IconContent = std::move(iconContent);
 
-                        return { std::move(iconInfo) };
+                        result.emplace_back(std::move(iconInfo));
                     }
+
+                    // Also cache empty results so that binaries without icon resources are not
+                    // re-inspected on every metadata query.
+                    {
+                        std::lock_guard<std::mutex> lock{ s_extractedIconCacheLock };
+                        if (s_extractedIconCache.size() >= s_extractedIconCacheLimit)
+                        {
+                            s_extractedIconCache.clear();
+                        }
+
+                        s_extractedIconCache[cacheKey] = CachedExtractedIcons{ lastWriteTime, iconIndex, result };
+                    }
+
+                    return result;
                 }
             }
         }
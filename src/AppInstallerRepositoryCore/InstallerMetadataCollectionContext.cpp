@@ -143,6 +143,29 @@ namespace AppInstaller::Repository::Metadata
             return std::move(optString).value();
         }
 
+        // A stream buffer that discards the characters written and only counts them; used to
+        // measure serialized JSON size without materializing another copy of the document.
+        struct CountingStreamBuffer : std::streambuf
+        {
+            std::streamsize Count() const { return m_count; }
+
+        protected:
+            std::streamsize xsputn(const char_type*, std::streamsize count) override
+            {
+                m_count += count;
+                return count;
+            }
+
+            int_type overflow(int_type ch) override
+            {
+                ++m_count;
+                return ch;
+            }
+
+        private:
+            std::streamsize m_count = 0;
+        };
+
         void AddFieldIfNotEmpty(web::json::value& value, const utility::string_t& field, std::string_view string)
         {
             if (!string.empty())
@@ -454,17 +477,22 @@ namespace AppInstaller::Repository::Metadata
 
         while (maximumSizeInBytes)
         {
-            // Determine current size
-            std::ostringstream temp;
+            // Determine current size; only count the serialized characters rather than
+            // materializing a full copy of the document for each probe.
+            CountingStreamBuffer countingBuffer;
+            std::ostream temp{ &countingBuffer };
             result.serialize(temp);
 
-            std::string tempStr = temp.str();
-            if (tempStr.length() > maximumSizeInBytes)
+            size_t serializedSize = static_cast<size_t>(countingBuffer.Count());
+            if (serializedSize > maximumSizeInBytes)
             {
                 if (!DropOldestHistoricalData())
                 {
                     AICLI_LOG(Repo, Error, << "Could not remove any more historical data to get under " << maximumSizeInBytes << " bytes");
-                    AICLI_LOG(Repo, Info, << "  Smallest size was " << tempStr.length() << " bytes with value:\n" << tempStr);
+
+                    std::ostringstream smallest;
+                    result.serialize(smallest);
+                    AICLI_LOG(Repo, Info, << "  Smallest size was " << serializedSize << " bytes with value:\n" << std::move(smallest).str());
                     THROW_HR(HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE));
                 }
                 result = (this->*toJsonFunction)();
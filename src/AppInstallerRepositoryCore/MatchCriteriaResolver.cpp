@@ -7,53 +7,6 @@ namespace AppInstaller::Repository
 {
     namespace
     {
-        using ValueMatchFunction = bool (*)(const Utility::NormalizedString&, const Utility::NormalizedString&);
-
-        bool ValueMatchFunction_AlwaysFalse(const Utility::NormalizedString&, const Utility::NormalizedString&)
-        {
-            return false;
-        }
-
-        bool ValueMatchFunction_Exact(const Utility::NormalizedString& a, const Utility::NormalizedString& b)
-        {
-            return a == b;
-        }
-
-        bool ValueMatchFunction_CaseInsensitive(const Utility::NormalizedString& a, const Utility::NormalizedString& b)
-        {
-            return Utility::ICUCaseInsensitiveEquals(a, b);
-        }
-
-        bool ValueMatchFunction_StartsWith(const Utility::NormalizedString& a, const Utility::NormalizedString& b)
-        {
-            return Utility::ICUCaseInsensitiveStartsWith(a, b);
-        }
-
-        bool ValueMatchFunction_Substring(const Utility::NormalizedString& a, const Utility::NormalizedString& b)
-        {
-            return Utility::ContainsSubstring(FoldCase(a), FoldCase(b));
-        }
-
-        ValueMatchFunction GetMatchTypeFunction(MatchType matchType)
-        {
-            switch (matchType)
-            {
-            case MatchType::Exact:
-                return ValueMatchFunction_Exact;
-            case MatchType::CaseInsensitive:
-                return ValueMatchFunction_CaseInsensitive;
-            case MatchType::StartsWith:
-                return ValueMatchFunction_StartsWith;
-            case MatchType::Substring:
-                return ValueMatchFunction_Substring;
-            case MatchType::Fuzzy:
-            case MatchType::FuzzySubstring:
-            case MatchType::Wildcard:
-            default:
-                return ValueMatchFunction_AlwaysFalse;
-            }
-        }
-
         PackageVersionProperty GetPackageVersionPropertyFor(PackageMatchField field)
         {
             switch (field)
@@ -87,9 +40,41 @@ namespace AppInstaller::Repository
                 THROW_HR(E_UNEXPECTED);
             }
         }
+    }
+
+    MatchCriteriaResolver::CompiledValue::CompiledValue(const RequestMatch& request) :
+        Value(request.Value), FoldedValue(Utility::FoldCase(request.Value))
+    {
+    }
+
+    MatchCriteriaResolver::MatchCriteriaResolver(const SearchRequest& request)
+    {
+        if (request.Query)
+        {
+            m_query.emplace(request.Query.value());
+        }
+
+        for (const auto& filter : request.Filters)
+        {
+            m_filters.emplace_back(filter.Field, CompiledValue{ filter });
+        }
+    }
+
+    std::optional<MatchType> MatchCriteriaResolver::GetBestMatchType(PackageMatchField field, MatchType mustBeBetterThanMatchType,
+        const Utility::NormalizedString& value, std::optional<Utility::NormalizedString>& foldedValue) const
+    {
+        auto folded = [&]() -> const Utility::NormalizedString&
+        {
+            if (!foldedValue)
+            {
+                foldedValue = Utility::FoldCase(value);
+            }
+
+            return foldedValue.value();
+        };
 
-        // Gets the best match type for the given field value and required minimum match type.
-        std::optional<MatchType> GetBestMatchType(const RequestMatch& request, MatchType mustBeBetterThanMatchType, const Utility::NormalizedString& value)
+        // Gets the best match type for the given compiled request value and required minimum match type.
+        auto evaluate = [&](const CompiledValue& request, MatchType currentBest) -> std::optional<MatchType>
         {
             if (request.Value.empty())
             {
@@ -98,65 +83,86 @@ namespace AppInstaller::Repository
 
             for (auto matchType : { MatchType::Exact, MatchType::CaseInsensitive, MatchType::StartsWith, MatchType::Substring })
             {
-                if (matchType >= mustBeBetterThanMatchType)
+                if (matchType >= currentBest)
                 {
                     break;
                 }
 
-                auto matchFunction = GetMatchTypeFunction(matchType);
+                bool matched = false;
 
-                if (matchFunction(value, request.Value))
+                switch (matchType)
+                {
+                case MatchType::Exact:
+                    matched = (value == request.Value);
+                    break;
+                case MatchType::CaseInsensitive:
+                    matched = (folded() == request.FoldedValue);
+                    break;
+                case MatchType::StartsWith:
+                    matched = (folded().size() >= request.FoldedValue.size() &&
+                        folded().compare(0, request.FoldedValue.size(), request.FoldedValue) == 0);
+                    break;
+                case MatchType::Substring:
+                    matched = Utility::ContainsSubstring(folded(), request.FoldedValue);
+                    break;
+                default:
+                    break;
+                }
+
+                if (matched)
                 {
                     return matchType;
                 }
             }
 
             return std::nullopt;
-        }
+        };
+
+        std::optional<MatchType> result;
 
-        // Gets the best match type for the given field value and required minimum match type.
-        std::optional<MatchType> GetBestMatchType(const SearchRequest& request, PackageMatchField field, MatchType mustBeBetterThanMatchType, const Utility::NormalizedString& value)
+        if (m_query)
         {
-            std::optional<MatchType> result;
+            result = evaluate(m_query.value(), mustBeBetterThanMatchType);
 
-            if (request.Query)
+            if (result)
             {
-                result = GetBestMatchType(request.Query.value(), mustBeBetterThanMatchType, value);
+                mustBeBetterThanMatchType = result.value();
+            }
+        }
 
-                if (result)
-                {
-                    mustBeBetterThanMatchType = result.value();
-                }
+        for (const auto& filter : m_filters)
+        {
+            if (result.value_or(MatchType::Wildcard) == MatchType::Exact)
+            {
+                break;
             }
 
-            for (const auto& filter : request.Filters)
+            if (filter.first == field)
             {
-                if (result.value_or(MatchType::Wildcard) == MatchType::Exact)
-                {
-                    break;
-                }
+                std::optional<MatchType> filterResult = evaluate(filter.second, mustBeBetterThanMatchType);
 
-                if (filter.Field == field)
+                if (filterResult)
                 {
-                    std::optional<MatchType> filterResult = GetBestMatchType(filter, mustBeBetterThanMatchType, value);
-
-                    if (filterResult)
-                    {
-                        result = std::move(filterResult);
-                        mustBeBetterThanMatchType = result.value();
-                    }
+                    result = std::move(filterResult);
+                    mustBeBetterThanMatchType = result.value();
                 }
             }
-
-            return result;
         }
 
+        return result;
+    }
+
+    PackageMatchFilter MatchCriteriaResolver::FindBestMatchCriteria(const IPackageVersion* packageVersion) const
+    {
+        PackageMatchFilter result{ PackageMatchField::Unknown, MatchType::Wildcard };
+
         // Gets the best match and updates the result if it should be updated.
         // Returns true to indicate that an exact match has been found.
-        bool UpdatePackageMatchFilterCheck(const SearchRequest& request, PackageMatchField field, PackageMatchFilter& result, const Utility::LocIndString& propertyValue)
+        auto updatePackageMatchFilterCheck = [&](PackageMatchField field, const Utility::LocIndString& propertyValue)
         {
             Utility::NormalizedString normalizedValue = propertyValue.get();
-            auto bestMatch = GetBestMatchType(request, field, result.Type, normalizedValue);
+            std::optional<Utility::NormalizedString> foldedValue;
+            auto bestMatch = GetBestMatchType(field, result.Type, normalizedValue, foldedValue);
 
             if (bestMatch && bestMatch.value() < result.Type)
             {
@@ -166,12 +172,7 @@ namespace AppInstaller::Repository
             }
 
             return MatchType::Exact == result.Type;
-        }
-    }
-
-    PackageMatchFilter FindBestMatchCriteria(const SearchRequest& request, const IPackageVersion* packageVersion)
-    {
-        PackageMatchFilter result{ PackageMatchField::Unknown, MatchType::Wildcard };
+        };
 
         // Single value fields
         for (auto field : { PackageMatchField::Id, PackageMatchField::Name, PackageMatchField::Moniker })
@@ -182,7 +183,7 @@ namespace AppInstaller::Repository
                 continue;
             }
 
-            if (UpdatePackageMatchFilterCheck(request, field, result, propertyValue))
+            if (updatePackageMatchFilterCheck(field, propertyValue))
             {
                 break;
             }
@@ -205,7 +206,7 @@ namespace AppInstaller::Repository
 
             for (const auto& propertyValue : propertyValues)
             {
-                if (UpdatePackageMatchFilterCheck(request, field, result, propertyValue))
+                if (updatePackageMatchFilterCheck(field, propertyValue))
                 {
                     break;
                 }
@@ -214,4 +215,9 @@ namespace AppInstaller::Repository
 
         return result;
     }
+
+    PackageMatchFilter FindBestMatchCriteria(const SearchRequest& request, const IPackageVersion* packageVersion)
+    {
+        return MatchCriteriaResolver{ request }.FindBestMatchCriteria(packageVersion);
+    }
 }
@@ -3,8 +3,42 @@
 #pragma once
 #include "Public/winget/RepositorySearch.h"
 
+#include <optional>
+#include <utility>
+#include <vector>
+
 namespace AppInstaller::Repository
 {
-    // Finds the highest rated match criteria for the package based on the search request,
+    // Resolves the best match criteria for packages against a search request.
+    // The request values are compiled once (case folded up front) so that evaluating many
+    // packages against the same request does not repeat the per value preparation.
+    struct MatchCriteriaResolver
+    {
+        explicit MatchCriteriaResolver(const SearchRequest& request);
+
+        // Finds the highest rated match criteria for the package.
+        PackageMatchFilter FindBestMatchCriteria(const IPackageVersion* packageVersion) const;
+
+    private:
+        // A request value prepared for repeated comparisons.
+        struct CompiledValue
+        {
+            explicit CompiledValue(const RequestMatch& request);
+
+            Utility::NormalizedString Value;
+            Utility::NormalizedString FoldedValue;
+        };
+
+        // Gets the best match type for the given field value and required minimum match type.
+        // foldedValue caches the folded form of value; it is computed at most once no matter
+        // how many request values and match types the value is compared against.
+        std::optional<MatchType> GetBestMatchType(PackageMatchField field, MatchType mustBeBetterThanMatchType,
+            const Utility::NormalizedString& value, std::optional<Utility::NormalizedString>& foldedValue) const;
+
+        std::optional<CompiledValue> m_query;
+        std::vector<std::pair<PackageMatchField, CompiledValue>> m_filters;
+    };
+
+    // Finds the highest rated match criteria for the package based on the search request.
     PackageMatchFilter FindBestMatchCriteria(const SearchRequest& request, const IPackageVersion* packageVersion);
 }
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ARPHelper.h"
 #include "winget/PortableARPEntry.h"
+#include <winget/ParallelWork.h>
 
 namespace AppInstaller::Repository::Microsoft
 {
@@ -242,12 +243,13 @@ namespace AppInstaller::Repository::Microsoft
                 Registry::Key arpRootKey = GetARPKey(scopeToSearch, architecture);
                 if (arpRootKey)
                 {
-                    for (const auto& entry : arpRootKey)
+                    // The product code is the name of the entry's subkey, and registry
+                    // name lookups are case insensitive; open it directly rather than
+                    // enumerating every entry under the root.
+                    std::optional<Registry::Key> entry = arpRootKey.SubKey(productCode);
+                    if (entry)
                     {
-                        if (Utility::CaseInsensitiveEquals(productCode, entry.Name()))
-                        {
-                            return entry.Open();
-                        }
+                        return std::move(entry).value();
                     }
                 }
             }
@@ -331,7 +333,7 @@ namespace AppInstaller::Repository::Microsoft
         return Utility::Version::CreateUnknown().ToString();
     }
 
-    void ARPHelper::AddMetadataIfPresent(const Registry::Key& key, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const
+    std::optional<std::string> ARPHelper::GetMetadataValue(const Registry::Key& key, const std::wstring& name) const
     {
         auto value = key[name];
         if (value)
@@ -363,30 +365,69 @@ namespace AppInstaller::Repository::Microsoft
 
             if (!valueString.empty())
             {
-                index.SetMetadataByManifestId(manifestId, metadata, valueString);
+                return valueString;
             }
         }
+
+        return std::nullopt;
+    }
+
+    void ARPHelper::AddMetadataIfPresent(const Registry::Key& key, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const
+    {
+        std::optional<std::string> valueString = GetMetadataValue(key, name);
+        if (valueString)
+        {
+            index.SetMetadataByManifestId(manifestId, metadata, valueString.value());
+        }
     }
 
     void ARPHelper::PopulateIndexFromARP(SQLiteIndex& index, Manifest::ScopeEnum scope) const
     {
         auto upgradeCodes = GetUpgradeCodes();
+        std::string_view scopeString = Manifest::ScopeToString(scope);
 
+        struct ArchitectureWork
+        {
+            Registry::Key Key;
+            std::string_view Architecture;
+            std::vector<ARPEntryData> Entries;
+        };
+
+        std::vector<ArchitectureWork> work;
         for (auto architecture : Utility::GetApplicableArchitectures())
         {
             Registry::Key arpRootKey = GetARPKey(scope, architecture);
 
             if (arpRootKey)
             {
-                PopulateIndexFromKey(index, arpRootKey, Manifest::ScopeToString(scope), Utility::ToString(architecture), upgradeCodes);
+                work.emplace_back(ArchitectureWork{ std::move(arpRootKey), Utility::ToString(architecture), {} });
             }
         }
+
+        // The registry reads per root key are independent and dominated by per-value round trips;
+        // enumerate the roots in parallel and feed the index through a single writer below.
+        Parallel::ForEachIndex(work.size(), [&](size_t index)
+            {
+                work[index].Entries = ReadARPEntries(work[index].Key, scopeString, work[index].Architecture, upgradeCodes);
+            });
+
+        for (ArchitectureWork& workItem : work)
+        {
+            WriteARPEntries(index, std::move(workItem.Entries), scopeString, workItem.Architecture);
+        }
     }
 
     void ARPHelper::PopulateIndexFromKey(SQLiteIndex& index, const Registry::Key& key, std::string_view scope, std::string_view architecture, const std::map<std::string, std::string>& upgradeCodes) const
+    {
+        WriteARPEntries(index, ReadARPEntries(key, scope, architecture, upgradeCodes), scope, architecture);
+    }
+
+    std::vector<ARPHelper::ARPEntryData> ARPHelper::ReadARPEntries(const Registry::Key& key, std::string_view scope, std::string_view architecture, const std::map<std::string, std::string>& upgradeCodes) const
     {
         AICLI_LOG(Repo, Verbose, << "Examining ARP entries for " << scope << " | " << architecture);
 
+        std::vector<ARPEntryData> result;
+
         for (const auto& arpEntry : key)
         {
             std::string productCode;
@@ -395,7 +436,9 @@ namespace AppInstaller::Repository::Microsoft
             {
                 productCode = arpEntry.Name();
 
-                Manifest::Manifest manifest;
+                ARPEntryData entryData;
+                entryData.ProductCode = productCode;
+                Manifest::Manifest& manifest = entryData.Manifest;
                 manifest.DefaultLocalization.Add<Manifest::Localization::Tags>({ "ARP" });
 
                 // Construct a unique name for this entry
@@ -484,32 +527,8 @@ namespace AppInstaller::Repository::Microsoft
                 // TODO: If we want to keep the constructed manifest around to allow for `show` type commands
                 //       against installed packages, we should use URLInfoAbout/HelpLink for the Homepage.
 
-                // TODO: Determine the best way to handle duplicates; sometimes the same package will be listed under
-                //       both x64 and x86 locations for ARP.
-                //       For now, we will attempt to insert and catch.
-                std::optional<SQLiteIndex::IdType> manifestIdOpt;
-
-                try
-                {
-                    // Use the ProductCode as a unique key for the path
-                    manifestIdOpt = index.AddManifest(manifest);
-                }
-                catch (...)
-                {
-                    // Ignore errors if they occur, they are most likely a duplicate value
-                }
-
-                if (!manifestIdOpt)
-                {
-                    AICLI_LOG(Repo, Warning,
-                        << "Ignoring duplicate ARP entry " << scope << '|' << architecture << '|' << productCode << " [" << manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>() << "]");
-                    continue;
-                }
-
-                SQLiteIndex::IdType manifestId = manifestIdOpt.value();
-
                 // Pass scope along to metadata.
-                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledScope, scope);
+                entryData.Metadata.emplace_back(PackageVersionMetadata::InstalledScope, std::string{ scope });
 
                 // TODO: Pass along architecture, although there are cases where it is not clear what architecture the package
                 //       is from it's ARP location, despite it very clearly being a specific architecture. And note that user
@@ -518,35 +537,46 @@ namespace AppInstaller::Repository::Microsoft
                 // Publisher is needed for certain scenarios but we don't store it from the manifest
                 if (manifest.DefaultLocalization.Contains(Manifest::Localization::Publisher))
                 {
-                    index.SetMetadataByManifestId(
-                        manifestId, PackageVersionMetadata::Publisher,
+                    entryData.Metadata.emplace_back(
+                        PackageVersionMetadata::Publisher,
                         manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
                 }
 
+                auto addMetadataIfPresent = [&](const std::wstring& name, PackageVersionMetadata metadata)
+                {
+                    std::optional<std::string> value = GetMetadataValue(arpKey, name);
+                    if (value)
+                    {
+                        entryData.Metadata.emplace_back(metadata, std::move(value).value());
+                    }
+                };
+
                 // Pick up InstallLocation when upgrade supports remove/install to enable this location
                 // to survive across the removal.
-                AddMetadataIfPresent(arpKey, InstallLocation, index, manifestId, PackageVersionMetadata::InstalledLocation);
+                addMetadataIfPresent(InstallLocation, PackageVersionMetadata::InstalledLocation);
 
                 // Pick up UninstallString and QuietUninstallString for uninstall.
-                AddMetadataIfPresent(arpKey, UninstallString, index, manifestId, PackageVersionMetadata::StandardUninstallCommand);
-                AddMetadataIfPresent(arpKey, QuietUninstallString, index, manifestId, PackageVersionMetadata::SilentUninstallCommand);
+                addMetadataIfPresent(UninstallString, PackageVersionMetadata::StandardUninstallCommand);
+                addMetadataIfPresent(QuietUninstallString, PackageVersionMetadata::SilentUninstallCommand);
 
                 // Pick up ModifyPath for repair.
-                AddMetadataIfPresent(arpKey, ModifyPath, index, manifestId, PackageVersionMetadata::StandardModifyCommand);
-                AddMetadataIfPresent(arpKey, NoModify, index, manifestId, PackageVersionMetadata::NoModify);
-                AddMetadataIfPresent(arpKey, NoRepair, index, manifestId, PackageVersionMetadata::NoRepair);
+                addMetadataIfPresent(ModifyPath, PackageVersionMetadata::StandardModifyCommand);
+                addMetadataIfPresent(NoModify, PackageVersionMetadata::NoModify);
+                addMetadataIfPresent(NoRepair, PackageVersionMetadata::NoRepair);
 
                 // Pick up Language to enable proper selection of language for upgrade.
-                AddMetadataIfPresent(arpKey, Language, index, manifestId, PackageVersionMetadata::InstalledLocale);
+                addMetadataIfPresent(Language, PackageVersionMetadata::InstalledLocale);
 
                 if (Manifest::ConvertToInstallerTypeEnum(GetStringValue(arpKey, std::wstring{ ToString(PortableValueName::WinGetInstallerType) })) == Manifest::InstallerTypeEnum::Portable)
                 {
                     // Portable uninstall requires the installed architecture for locating the entry in the registry.
-                    index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledArchitecture, architecture);
+                    entryData.Metadata.emplace_back(PackageVersionMetadata::InstalledArchitecture, std::string{ architecture });
                     installedType = Manifest::InstallerTypeEnum::Portable;
                 }
 
-                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledType, Manifest::InstallerTypeToString(installedType));
+                entryData.Metadata.emplace_back(PackageVersionMetadata::InstalledType, std::string{ Manifest::InstallerTypeToString(installedType) });
+
+                result.emplace_back(std::move(entryData));
             }
             catch (...)
             {
@@ -554,6 +584,43 @@ namespace AppInstaller::Repository::Microsoft
                 LOG_CAUGHT_EXCEPTION();
             }
         }
+
+        return result;
+    }
+
+    void ARPHelper::WriteARPEntries(SQLiteIndex& index, std::vector<ARPEntryData>&& entries, std::string_view scope, std::string_view architecture) const
+    {
+        for (ARPEntryData& entry : entries)
+        {
+            // TODO: Determine the best way to handle duplicates; sometimes the same package will be listed under
+            //       both x64 and x86 locations for ARP.
+            //       For now, we will attempt to insert and catch.
+            std::optional<SQLiteIndex::IdType> manifestIdOpt;
+
+            try
+            {
+                // Use the ProductCode as a unique key for the path
+                manifestIdOpt = index.AddManifest(entry.Manifest);
+            }
+            catch (...)
+            {
+                // Ignore errors if they occur, they are most likely a duplicate value
+            }
+
+            if (!manifestIdOpt)
+            {
+                AICLI_LOG(Repo, Warning,
+                    << "Ignoring duplicate ARP entry " << scope << '|' << architecture << '|' << entry.ProductCode << " [" << entry.Manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>() << "]");
+                continue;
+            }
+
+            SQLiteIndex::IdType manifestId = manifestIdOpt.value();
+
+            for (const auto& metadata : entry.Metadata)
+            {
+                index.SetMetadataByManifestId(manifestId, metadata.first, metadata.second);
+            }
+        }
     }
 
     std::vector<wil::unique_registry_watcher> ARPHelper::CreateRegistryWatchers(Manifest::ScopeEnum scope, std::function<void(Manifest::ScopeEnum, Utility::Architecture, wil::RegistryChangeKind)> callback)
@@ -585,4 +652,56 @@ namespace AppInstaller::Repository::Microsoft
 
         return result;
     }
+
+    std::string ARPHelper::GetChangeStamp() const
+    {
+        uint64_t entryCount = 0;
+        uint64_t latestWrite = 0;
+
+        auto toUInt64 = [](const FILETIME& fileTime)
+            {
+                ULARGE_INTEGER result;
+                result.LowPart = fileTime.dwLowDateTime;
+                result.HighPart = fileTime.dwHighDateTime;
+                return result.QuadPart;
+            };
+
+        auto accumulate = [&](Manifest::ScopeEnum scope)
+            {
+                for (auto architecture : Utility::GetApplicableArchitectures())
+                {
+                    Registry::Key arpRootKey = GetARPKey(scope, architecture);
+
+                    if (arpRootKey)
+                    {
+                        Registry::Key::Info rootInfo = arpRootKey.GetInfo();
+                        entryCount += rootInfo.SubKeyCount;
+                        latestWrite = std::max(latestWrite, toUInt64(rootInfo.LastWriteTime));
+
+                        // The root's last write time only reflects entries being added or removed;
+                        // take in each entry's own last write time to observe in place modifications.
+                        for (const auto& entry : arpRootKey)
+                        {
+                            try
+                            {
+                                latestWrite = std::max(latestWrite, toUInt64(entry.Open().GetInfo().LastWriteTime));
+                            }
+                            catch (...)
+                            {
+                                // The entry may have been removed while we were enumerating; the count
+                                // and root write time will already reflect such a change on the next stamp.
+                                LOG_CAUGHT_EXCEPTION();
+                            }
+                        }
+                    }
+                }
+            };
+
+        accumulate(Manifest::ScopeEnum::User);
+        accumulate(Manifest::ScopeEnum::Machine);
+
+        std::ostringstream stream;
+        stream << entryCount << ':' << latestWrite;
+        return stream.str();
+    }
 }
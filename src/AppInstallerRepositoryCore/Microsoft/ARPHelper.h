@@ -83,9 +83,28 @@ namespace AppInstaller::Repository::Microsoft
         //  MajorVersion, MinorVersion
         std::string DetermineVersion(const Registry::Key& arpKey) const;
 
+        // The data read from a single ARP entry.
+        // Registry reads are separated from index writes so that multiple ARP roots can be
+        // enumerated in parallel while feeding a single index writer.
+        struct ARPEntryData
+        {
+            AppInstaller::Manifest::Manifest Manifest;
+            std::string ProductCode;
+            std::vector<std::pair<PackageVersionMetadata, std::string>> Metadata;
+        };
+
+        // Reads a metadata value from the given key, converting it to a string if it exists.
+        std::optional<std::string> GetMetadataValue(const Registry::Key& key, const std::wstring& name) const;
+
         // Reads a value and adds it to the metadata if it exists.
         void AddMetadataIfPresent(const Registry::Key& key, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const;
 
+        // Reads all of the ARP entries under the given key; performs no index writes.
+        std::vector<ARPEntryData> ReadARPEntries(const Registry::Key& key, std::string_view scope, std::string_view architecture, const std::map<std::string, std::string>& upgradeCodes = {}) const;
+
+        // Writes previously read ARP entries to the index.
+        void WriteARPEntries(SQLiteIndex& index, std::vector<ARPEntryData>&& entries, std::string_view scope, std::string_view architecture) const;
+
         // Populates the index with the ARP entries from the given scope (machine/user).
         // Handles all of the architectures for the given scope.
         void PopulateIndexFromARP(SQLiteIndex& index, Manifest::ScopeEnum scope) const;
@@ -97,5 +116,11 @@ namespace AppInstaller::Repository::Microsoft
 
         // Creates registry watchers for the given scope
         std::vector<wil::unique_registry_watcher> CreateRegistryWatchers(Manifest::ScopeEnum scope, std::function<void(Manifest::ScopeEnum, Utility::Architecture, wil::RegistryChangeKind)> callback);
+
+        // Computes an opaque stamp describing the current state of the ARP entries across all scopes.
+        // Two stamps from the same machine compare equal only if no entry was added, removed,
+        // or modified in place between them. The stamp is built from key counts and last write
+        // times, making it much cheaper than enumerating the entry values.
+        std::string GetChangeStamp() const;
     };
 }
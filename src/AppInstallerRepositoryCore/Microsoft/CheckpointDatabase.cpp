@@ -9,6 +9,9 @@ namespace AppInstaller::Repository::Microsoft
 {
     namespace
     {
+        // How long a connection waits on another writer before failing with SQLITE_BUSY.
+        constexpr std::chrono::milliseconds s_CheckpointDatabaseBusyTimeout{ 500 };
+
         // Creates the ICheckpointDatabase interface object for the given version.
         std::unique_ptr<Schema::ICheckpointDatabase> CreateICheckpointDatabase(const SQLite::Version& version)
         {
@@ -31,6 +34,11 @@ namespace AppInstaller::Repository::Microsoft
         AICLI_LOG(Repo, Info, << "Creating new Checkpoint database with version [" << version << "] at '" << filePath << "'");
         CheckpointDatabase result{ filePath, version };
 
+        // Enable WAL so that a writer does not block concurrent readers.
+        // Must be set outside of a transaction.
+        THROW_HR_IF(E_UNEXPECTED, !result.m_dbconn.SetJournalMode("WAL"));
+        result.m_dbconn.SetBusyTimeout(s_CheckpointDatabaseBusyTimeout);
+
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(result.m_dbconn, "CheckpointDatabase_CreateNew");
 
         // Use calculated version, as incoming version could be 'latest'
@@ -102,6 +110,23 @@ namespace AppInstaller::Repository::Microsoft
         savepoint.Commit();
     }
 
+    void CheckpointDatabase::SetDataValues(IdType checkpointId, const std::vector<DataValue>& values)
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        AICLI_LOG(Repo, Verbose, << "Setting " << values.size() << " checkpoint data values");
+
+        // A single savepoint around all of the writes so that the batch commits once.
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(m_dbconn, "CheckpointDatabase_setDataValues");
+
+        for (const DataValue& value : values)
+        {
+            m_interface->SetCheckpointDataValues(m_dbconn, checkpointId, value.dataType, value.field, value.values);
+        }
+
+        SetLastWriteTime();
+        savepoint.Commit();
+    }
+
     void CheckpointDatabase::UpdateDataValue(IdType checkpointId, int dataType, const std::string& field, const std::vector<std::string>& values)
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -160,6 +185,16 @@ namespace AppInstaller::Repository::Microsoft
         AICLI_LOG(Repo, Info, << "Opened Checkpoint Index with version [" << m_version << "], last write [" << GetLastWriteTime() << "]");
         m_interface = CreateICheckpointDatabase(m_version);
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_CANNOT_WRITE_TO_UPLEVEL_INDEX, disposition == SQLiteStorageBase::OpenDisposition::ReadWrite && m_version != m_interface->GetVersion());
+
+        m_dbconn.SetBusyTimeout(s_CheckpointDatabaseBusyTimeout);
+        if (disposition == SQLiteStorageBase::OpenDisposition::ReadWrite)
+        {
+            // Migrate databases created before WAL was enabled; a no-op when already in WAL mode.
+            if (!m_dbconn.SetJournalMode("WAL"))
+            {
+                AICLI_LOG(Repo, Warning, << "Could not move checkpoint database to WAL journal mode");
+            }
+        }
     }
 
     CheckpointDatabase::CheckpointDatabase(const std::string& target, SQLite::Version version) : SQLiteStorageBase(target, version)
@@ -17,6 +17,9 @@ namespace AppInstaller::Repository::Microsoft
 
     namespace
     {
+        // How long a connection waits on another writer before failing with SQLITE_BUSY.
+        constexpr std::chrono::milliseconds s_PinningIndexBusyTimeout{ 500 };
+
         std::filesystem::path GetPinningDatabasePath()
         {
             const auto DefaultPath = Runtime::GetPathTo(Runtime::PathName::LocalState) / "pinning.db";
@@ -66,6 +69,11 @@ namespace AppInstaller::Repository::Microsoft
         AICLI_LOG(Repo, Info, << "Creating new Pinning Index with version [" << version << "] at '" << filePath << "'");
         PinningIndex result{ filePath, version };
 
+        // Enable WAL so that a writer does not block concurrent readers.
+        // Must be set outside of a transaction.
+        THROW_HR_IF(E_UNEXPECTED, !result.m_dbconn.SetJournalMode("WAL"));
+        result.m_dbconn.SetBusyTimeout(s_PinningIndexBusyTimeout);
+
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(result.m_dbconn, "pinningindex_createnew");
 
         // Use calculated version, as incoming version could be 'latest'
@@ -202,6 +210,16 @@ namespace AppInstaller::Repository::Microsoft
         AICLI_LOG(Repo, Info, << "Opened Pinning Index with version [" << m_version << "], last write [" << GetLastWriteTime() << "]");
         m_interface = CreateIPinningIndex();
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_CANNOT_WRITE_TO_UPLEVEL_INDEX, disposition == SQLiteStorageBase::OpenDisposition::ReadWrite && m_version != m_interface->GetVersion());
+
+        m_dbconn.SetBusyTimeout(s_PinningIndexBusyTimeout);
+        if (disposition == SQLiteStorageBase::OpenDisposition::ReadWrite)
+        {
+            // Migrate databases created before WAL was enabled; a no-op when already in WAL mode.
+            if (!m_dbconn.SetJournalMode("WAL"))
+            {
+                AICLI_LOG(Repo, Warning, << "Could not move pinning database to WAL journal mode");
+            }
+        }
     }
 
     PinningIndex::PinningIndex(const std::string& target, SQLite::Version version) : SQLiteStorageBase(target, version)
@@ -113,6 +113,47 @@ namespace AppInstaller::Repository::Microsoft
         }
     }
 
+    void PortableIndex::AddOrUpdatePortableFiles(const std::vector<Portable::PortableFileEntry>& files)
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        AICLI_LOG(Repo, Verbose, << "Adding or updating " << files.size() << " portable files");
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(m_dbconn, "portableindex_addorupdatefiles");
+
+        for (const auto& file : files)
+        {
+            if (m_interface->Exists(m_dbconn, file))
+            {
+                m_interface->UpdatePortableFile(m_dbconn, file);
+            }
+            else
+            {
+                m_interface->AddPortableFile(m_dbconn, file);
+            }
+        }
+
+        SetLastWriteTime();
+
+        savepoint.Commit();
+    }
+
+    void PortableIndex::RemovePortableFiles(const std::vector<Portable::PortableFileEntry>& files)
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        AICLI_LOG(Repo, Verbose, << "Removing " << files.size() << " portable files");
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(m_dbconn, "portableindex_removefiles");
+
+        for (const auto& file : files)
+        {
+            m_interface->RemovePortableFile(m_dbconn, file);
+        }
+
+        SetLastWriteTime();
+
+        savepoint.Commit();
+    }
+
     std::vector<Portable::PortableFileEntry> PortableIndex::GetAllPortableFiles()
     {
         return m_interface->GetAllPortableFiles(m_dbconn);
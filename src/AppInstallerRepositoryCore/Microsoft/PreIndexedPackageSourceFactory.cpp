@@ -515,27 +515,24 @@ namespace AppInstaller::Repository::Microsoft
             long long m_sqliteOpenMs = 0;
         };
 
-        SQLiteIndex OpenPackagedContextIndex(const SourceDetails& details, IProgressCallback& progress, PackagedSourceOpenTimer& openTimer)
+        // To work around an issue with accessing the public folder, we are temporarily
+        // constructing the location ourself.  This was already the case for the non-packaged
+        // runtime, and we can fix both in the future.  The only problem with this is that
+        // the directory in the extension *must* be Public, rather than one set by the creator.
+        std::filesystem::path GetPackagedContextIndexLocation(const Deployment::Extension& extension)
         {
-            auto extensionLookupTimer = openTimer.MeasureExtensionLookup();
-            auto extension = GetExtensionFromDetails(details);
-            extensionLookupTimer.Stop();
-            if (!extension)
-            {
-                AICLI_LOG(Repo, Info, << "Package not found " << details.Data);
-                THROW_HR(APPINSTALLER_CLI_ERROR_SOURCE_DATA_MISSING);
-            }
+            std::filesystem::path indexLocation = extension.GetPackagePath();
+            indexLocation /= s_PreIndexedPackageSourceFactory_IndexFilePath;
+            return indexLocation;
+        }
 
+        SQLiteIndex OpenPackagedContextIndexFromExtension(Deployment::Extension& extension, IProgressCallback& progress, PackagedSourceOpenTimer& openTimer)
+        {
             auto verifyTimer = openTimer.MeasureVerifyContentIntegrity();
-            THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_NEEDS_REMEDIATION), !extension->VerifyContentIntegrity(progress));
+            THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_NEEDS_REMEDIATION), !extension.VerifyContentIntegrity(progress));
             verifyTimer.Stop();
 
-            // To work around an issue with accessing the public folder, we are temporarily
-            // constructing the location ourself.  This was already the case for the non-packaged
-            // runtime, and we can fix both in the future.  The only problem with this is that
-            // the directory in the extension *must* be Public, rather than one set by the creator.
-            std::filesystem::path indexLocation = extension->GetPackagePath();
-            indexLocation /= s_PreIndexedPackageSourceFactory_IndexFilePath;
+            std::filesystem::path indexLocation = GetPackagedContextIndexLocation(extension);
 
             auto sqliteOpenTimer = openTimer.MeasureSQLiteOpen();
             auto index = SQLiteIndex::Open(indexLocation.u8string(), SQLiteIndex::OpenDisposition::Immutable);
@@ -544,6 +541,20 @@ namespace AppInstaller::Repository::Microsoft
             return index;
         }
 
+        SQLiteIndex OpenPackagedContextIndex(const SourceDetails& details, IProgressCallback& progress, PackagedSourceOpenTimer& openTimer)
+        {
+            auto extensionLookupTimer = openTimer.MeasureExtensionLookup();
+            auto extension = GetExtensionFromDetails(details);
+            extensionLookupTimer.Stop();
+            if (!extension)
+            {
+                AICLI_LOG(Repo, Info, << "Package not found " << details.Data);
+                THROW_HR(APPINSTALLER_CLI_ERROR_SOURCE_DATA_MISSING);
+            }
+
+            return OpenPackagedContextIndexFromExtension(extension.value(), progress, openTimer);
+        }
+
         struct PackagedContextSourceReference : public ISourceReference
         {
             PackagedContextSourceReference(const SourceDetails& details) : m_details(details)
@@ -566,46 +577,65 @@ namespace AppInstaller::Repository::Microsoft
             std::shared_ptr<ISource> Open(IProgressCallback& progress) override
             {
                 PackagedSourceOpenTimer openTimer{ m_details.Name };
-                auto completeOpen = [&](SQLiteIndex index)
-                    {
-                        // We didn't use to store the source identifier, so we compute it here in case it's
-                        // missing from the details.
-                        m_details.Identifier = GetPackageFamilyNameFromDetails(m_details);
-                        openTimer.MarkSucceeded();
-                        return std::make_shared<SQLiteIndexSource>(m_details, std::move(index), false, true);
-                    };
 
-                std::optional<SQLiteIndex> index;
-                bool retryUnderLock = false;
-
-                try
+                auto extensionLookupTimer = openTimer.MeasureExtensionLookup();
+                auto extension = GetExtensionFromDetails(m_details);
+                extensionLookupTimer.Stop();
+                if (!extension)
                 {
-                    index.emplace(OpenPackagedContextIndex(m_details, progress, openTimer));
+                    AICLI_LOG(Repo, Info, << "Package not found " << m_details.Data);
+                    THROW_HR(APPINSTALLER_CLI_ERROR_SOURCE_DATA_MISSING);
                 }
-                catch (...)
-                {
-                    if (progress.IsCancelledBy(CancelReason::Any))
-                    {
-                        throw;
-                    }
 
-                    LOG_CAUGHT_EXCEPTION_MSG("Optimistic packaged source open failed, retrying under lock for source: %hs", m_details.Name.c_str());
-                    retryUnderLock = true;
-                }
+                // We didn't use to store the source identifier, so we compute it here in case it's
+                // missing from the details.
+                m_details.Identifier = GetPackageFamilyNameFromDetails(m_details);
 
-                if (retryUnderLock)
-                {
-                    openTimer.MarkFallbackLocked();
-                    Synchronization::CrossProcessLock lock(CreateNameForCPL(m_details));
-                    if (!lock.Acquire(progress))
+                // The package path is versioned, so the index location identifies the index contents;
+                // concurrent opens of the same source version share a single source object, and with
+                // it a single connection and page cache, rather than one of each per open.
+                auto result = SQLiteIndexSource::GetSharedOrOpen(GetPackagedContextIndexLocation(extension.value()),
+                    [&]() -> std::shared_ptr<SQLiteIndexSource>
                     {
-                        return {};
-                    }
+                        std::optional<SQLiteIndex> index;
+                        bool retryUnderLock = false;
+
+                        try
+                        {
+                            index.emplace(OpenPackagedContextIndexFromExtension(extension.value(), progress, openTimer));
+                        }
+                        catch (...)
+                        {
+                            if (progress.IsCancelledBy(CancelReason::Any))
+                            {
+                                throw;
+                            }
+
+                            LOG_CAUGHT_EXCEPTION_MSG("Optimistic packaged source open failed, retrying under lock for source: %hs", m_details.Name.c_str());
+                            retryUnderLock = true;
+                        }
+
+                        if (retryUnderLock)
+                        {
+                            openTimer.MarkFallbackLocked();
+                            Synchronization::CrossProcessLock lock(CreateNameForCPL(m_details));
+                            if (!lock.Acquire(progress))
+                            {
+                                return {};
+                            }
+
+                            index.emplace(OpenPackagedContextIndex(m_details, progress, openTimer));
+                        }
 
-                    index.emplace(OpenPackagedContextIndex(m_details, progress, openTimer));
+                        return std::make_shared<SQLiteIndexSource>(m_details, std::move(index).value(), false, true);
+                    });
+
+                if (result)
+                {
+                    openTimer.MarkSucceeded();
                 }
 
-                return completeOpen(std::move(index.value()));
+                return result;
             }
 
         private:
@@ -627,6 +657,47 @@ namespace AppInstaller::Repository::Microsoft
 
             bool UpdateInternal(const std::string& packageLocation, const SourceDetails& details, IProgressCallback& progress, std::optional<uint64_t>& downloadedBytes) override
             {
+                // When a version of the source package is already deployed, deploying directly from the
+                // remote location allows the deployment stack to stream only the blocks that changed
+                // relative to the deployed version (per the package block map), rather than transferring
+                // the entire package. The full download below remains the fallback, and the only path for
+                // store origin sources whose additional trust validation requires the file locally.
+                if (Utility::IsUrlRemote(packageLocation) &&
+                    GetCurrentVersion(details) &&
+                    WI_IsFlagClear(details.TrustLevel, SourceTrustLevel::StoreOrigin))
+                {
+                    try
+                    {
+                        // Only the package manifest is read remotely here; ensure we are updating the same family.
+                        Msix::MsixInfo remoteMsixInfo{ packageLocation };
+                        THROW_HR_IF(APPINSTALLER_CLI_ERROR_PACKAGE_IS_BUNDLE, remoteMsixInfo.GetIsBundle());
+                        THROW_HR_IF(APPINSTALLER_CLI_ERROR_SOURCE_DATA_INTEGRITY_FAILURE,
+                            GetPackageFamilyNameFromDetails(details) != Msix::GetPackageFamilyNameFromFullName(remoteMsixInfo.GetPackageFullName()));
+
+                        winrt::Windows::Foundation::Uri remoteUri{ Utility::ConvertToUTF16(packageLocation).c_str() };
+                        Deployment::AddPackage(
+                            remoteUri,
+                            Deployment::Options{ WI_IsFlagSet(details.TrustLevel, SourceTrustLevel::Trusted) },
+                            progress);
+
+                        // The deployment stack performed the transfer, so the byte count is not observed.
+                        downloadedBytes = std::nullopt;
+
+                        AICLI_LOG(Repo, Info, << "Source update success (streaming deployment).");
+                        return true;
+                    }
+                    catch (...)
+                    {
+                        LOG_CAUGHT_EXCEPTION_MSG("Streaming source update failed; falling back to full download");
+
+                        if (progress.IsCancelledBy(CancelReason::Any))
+                        {
+                            AICLI_LOG(Repo, Info, << "Cancelling update upon request");
+                            return false;
+                        }
+                    }
+                }
+
                 // Due to complications with deployment, download the file and deploy from
                 // a local source while we investigate further.
                 bool download = Utility::IsUrlRemote(packageLocation);
@@ -741,13 +812,10 @@ namespace AppInstaller::Repository::Microsoft
                 // Validate index package trust info.
                 THROW_HR_IF(APPINSTALLER_CLI_ERROR_SOURCE_DATA_INTEGRITY_FAILURE, !indexPackage.ValidateTrustInfo(WI_IsFlagSet(m_details.TrustLevel, SourceTrustLevel::StoreOrigin)));
 
-                // Create a temp lock exclusive index file.
-                auto tempIndexFilePath = Runtime::GetNewTempFilePath();
-                auto tempIndexFile = Utility::ManagedFile::CreateWriteLockedFile(tempIndexFilePath, GENERIC_WRITE, true);
-
-                // Populate temp index file.
+                // Read the index directly out of the package into memory; extracting it to a
+                // temporary file doubled the disk writes of every source update for no gain.
                 Msix::MsixInfo packageInfo(packageLocation);
-                packageInfo.WriteToFileHandle(s_PreIndexedPackageSourceFactory_IndexFilePath, tempIndexFile.GetFileHandle(), progress);
+                std::vector<byte> indexImage = packageInfo.ReadFileContents(s_PreIndexedPackageSourceFactory_IndexFilePath, progress);
 
                 if (progress.IsCancelledBy(CancelReason::Any))
                 {
@@ -755,7 +823,7 @@ namespace AppInstaller::Repository::Microsoft
                     return {};
                 }
 
-                SQLiteIndex index = SQLiteIndex::Open(tempIndexFile.GetFilePath().u8string(), SQLiteIndex::OpenDisposition::Immutable, std::move(tempIndexFile));
+                SQLiteIndex index = SQLiteIndex::OpenFromBuffer(std::move(indexImage));
 
                 // We didn't use to store the source identifier, so we compute it here in case it's
                 // missing from the details.
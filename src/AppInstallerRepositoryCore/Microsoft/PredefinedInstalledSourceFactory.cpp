@@ -9,7 +9,10 @@
 #include <winget/ManifestInstaller.h>
 #include <winget/COMStaticStorage.h>
 #include <winget/Registry.h>
+#include <winget/Fonts.h>
 #include <AppInstallerArchitecture.h>
+#include <AppInstallerRuntime.h>
+#include <AppInstallerSHA256.h>
 #include <winget/ExperimentalFeature.h>
 
 using namespace std::string_literals;
@@ -285,6 +288,158 @@ namespace AppInstaller::Repository::Microsoft
             return index;
         }
 
+        // The registry location backing the per-user MSIX package repository.
+        // Its subkey set (and their last write times) changes whenever packages are added or removed for the user.
+        constexpr std::wstring_view s_MSIXPackageRepositoryKey = L"Software\\Classes\\Local Settings\\Software\\Microsoft\\Windows\\CurrentVersion\\AppModel\\Repository\\Packages"sv;
+
+        std::filesystem::path GetInstalledIndexCachePath()
+        {
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / "installedCache.db";
+        }
+
+        std::filesystem::path GetInstalledIndexCacheStampPath()
+        {
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / "installedCache.stamp";
+        }
+
+        // Computes a change stamp covering the registry locations that feed the installed index:
+        // the ARP uninstall roots, the font roots, and the MSIX package repository.
+        // Each location contributes its subkey names and last write times, so in-place updates
+        // to individual entries are detected as well as additions and removals.
+        // Returns nullopt when a location cannot be stamped, which disables the persistent cache.
+        std::optional<std::string> GetInstalledIndexChangeStamp()
+        {
+            std::stringstream stream;
+            bool failed = false;
+
+            auto appendKeyStamp = [&](const Registry::Key& key, char tag)
+            {
+                stream << tag << ':';
+
+                if (!key)
+                {
+                    return;
+                }
+
+                for (DWORD index = 0; !failed; ++index)
+                {
+                    wchar_t nameBuffer[256];
+                    DWORD nameLength = ARRAYSIZE(nameBuffer);
+                    FILETIME lastWrite{};
+
+                    LSTATUS status = RegEnumKeyExW(key, index, nameBuffer, &nameLength, nullptr, nullptr, nullptr, &lastWrite);
+                    if (status == ERROR_NO_MORE_ITEMS)
+                    {
+                        break;
+                    }
+                    else if (status != ERROR_SUCCESS)
+                    {
+                        AICLI_LOG(Repo, Verbose, << "Installed index change stamp enumeration failed: " << status);
+                        failed = true;
+                        break;
+                    }
+
+                    stream << Utility::ConvertToUTF8(std::wstring_view{ nameBuffer, nameLength }) << ','
+                        << lastWrite.dwHighDateTime << ',' << lastWrite.dwLowDateTime << ';';
+                }
+
+                stream << '|';
+            };
+
+            ARPHelper arpHelper;
+            for (auto scope : { Manifest::ScopeEnum::Machine, Manifest::ScopeEnum::User })
+            {
+                for (auto architecture : Utility::GetApplicableArchitectures())
+                {
+                    appendKeyStamp(arpHelper.GetARPKey(scope, architecture), 'a');
+                }
+            }
+
+            for (auto hive : { HKEY_LOCAL_MACHINE, HKEY_CURRENT_USER })
+            {
+                appendKeyStamp(Registry::Key::OpenIfExists(hive, AppInstaller::Fonts::GetFontRegistryRoot()), 'f');
+            }
+
+            Registry::Key msixRepository = Registry::Key::OpenIfExists(HKEY_CURRENT_USER, std::wstring{ s_MSIXPackageRepositoryKey });
+            if (msixRepository)
+            {
+                appendKeyStamp(msixRepository, 'm');
+            }
+            else
+            {
+                // Without visibility into the package repository we cannot trust a cached index.
+                failed = true;
+            }
+
+            if (failed)
+            {
+                return std::nullopt;
+            }
+
+            return Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(stream));
+        }
+
+        // Attempts to load the persisted installed index if its change stamp still matches the machine state.
+        std::unique_ptr<SQLiteIndex> TryLoadCachedInstalledIndex(const std::string& changeStamp) try
+        {
+            std::filesystem::path indexPath = GetInstalledIndexCachePath();
+            std::filesystem::path stampPath = GetInstalledIndexCacheStampPath();
+
+            if (!std::filesystem::exists(indexPath) || !std::filesystem::exists(stampPath))
+            {
+                return {};
+            }
+
+            std::string storedStamp;
+            {
+                std::ifstream stampStream{ stampPath };
+                std::getline(stampStream, storedStamp);
+            }
+
+            if (storedStamp != changeStamp)
+            {
+                AICLI_LOG(Repo, Verbose, << "Installed index cache stamp does not match machine state");
+                return {};
+            }
+
+            AICLI_LOG(Repo, Info, << "Reusing persisted installed index cache");
+            SQLiteIndex cached = SQLiteIndex::Open(indexPath.u8string(), SQLiteStorageBase::OpenDisposition::Read);
+
+            // Copy into memory so that the cache file is not held open.
+            return std::make_unique<SQLiteIndex>(SQLiteIndex::CopyFrom(SQLITE_MEMORY_DB_CONNECTION_TARGET, cached));
+        }
+        catch (...)
+        {
+            AICLI_LOG(Repo, Warning, << "Failed to load persisted installed index cache");
+            LOG_CAUGHT_EXCEPTION();
+            return {};
+        }
+
+        // Persists the installed index and its change stamp; best effort only.
+        void TrySaveCachedInstalledIndex(SQLiteIndex& index, const std::string& changeStamp) try
+        {
+            std::filesystem::path indexPath = GetInstalledIndexCachePath();
+            std::filesystem::path tempPath = indexPath;
+            tempPath += ".tmp";
+
+            std::filesystem::remove(tempPath);
+
+            {
+                // Scoped so that the file is closed before the rename.
+                SQLiteIndex copy = SQLiteIndex::CopyFrom(tempPath.u8string(), index);
+            }
+
+            std::filesystem::rename(tempPath, indexPath);
+
+            {
+                std::ofstream stampStream{ GetInstalledIndexCacheStampPath(), std::ios::trunc };
+                stampStream << changeStamp;
+            }
+
+            AICLI_LOG(Repo, Verbose, << "Persisted installed index cache");
+        }
+        CATCH_LOG();
+
         struct CachedInstalledIndex
         {
             struct Singleton : public WinRT::COMStaticStorageBase<CachedInstalledIndex>
@@ -328,12 +483,32 @@ namespace AppInstaller::Repository::Microsoft
                         m_forceNextUpdate = false;
                         auto scopeExit = wil::scope_exit([&]() { m_forceNextUpdate = true; });
 
+                        // Capture the change stamp before reading so that concurrent changes invalidate the persisted cache.
+                        std::optional<std::string> changeStamp = GetInstalledIndexChangeStamp();
+
+                        // On a cold start, reuse the persisted index wholesale if the machine state is unchanged.
+                        if (!m_index && changeStamp)
+                        {
+                            std::unique_ptr<SQLiteIndex> cached = TryLoadCachedInstalledIndex(changeStamp.value());
+                            if (cached)
+                            {
+                                m_index = std::move(cached);
+                                scopeExit.release();
+                                return;
+                            }
+                        }
+
                         // Populate from ARP using standard mechanism.
                         SQLiteIndex update = CreateAndPopulateIndex(PredefinedInstalledSourceFactory::Filter::ARP);
 
                         // Populate from MSIX, using localization data from the existing index if applicable.
                         PopulateIndexFromMSIX(update, Manifest::ScopeEnum::User, m_index.get());
 
+                        if (changeStamp)
+                        {
+                            TrySaveCachedInstalledIndex(update, changeStamp.value());
+                        }
+
                         m_index = std::make_unique<SQLiteIndex>(std::move(update));
                         scopeExit.release();
                     }
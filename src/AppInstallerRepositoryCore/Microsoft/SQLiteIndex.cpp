@@ -5,6 +5,7 @@
 #include <winget/SQLiteStorageBase.h>
 #include "ArpVersionValidation.h"
 #include <winget/ManifestYamlParser.h>
+#include <winget/ParallelWork.h>
 
 namespace AppInstaller::Repository::Microsoft
 {
@@ -14,6 +15,18 @@ namespace AppInstaller::Repository::Microsoft
         {
             return WI_IsFlagSet(options, SQLiteIndex::CreateOptions::LargePageSize) ? 65536 : 0;
         }
+
+        // Creates the key used by the ContainsManifest set for the given manifest fields.
+        // The index matches version keys case insensitively, so the key is case folded.
+        std::string GetManifestProbeKey(std::string_view id, std::string_view version, std::string_view channel)
+        {
+            std::string result = Utility::FoldCase(id);
+            result += '\n';
+            result += Utility::FoldCase(version);
+            result += '\n';
+            result += Utility::FoldCase(channel);
+            return result;
+        }
     }
 
     SQLiteIndex SQLiteIndex::CreateNew(const std::string& filePath, SQLite::Version version, CreateOptions options)
@@ -40,6 +53,11 @@ namespace AppInstaller::Repository::Microsoft
         return { filePath, disposition, std::move(indexFile) };
     }
 
+    SQLiteIndex SQLiteIndex::OpenFromBuffer(SQLite::blob_t&& databaseImage)
+    {
+        return { std::move(databaseImage) };
+    }
+
     SQLiteIndex SQLiteIndex::CopyFrom(const std::string& filePath, SQLiteIndex& source)
     {
         return { filePath, source };
@@ -63,6 +81,14 @@ namespace AppInstaller::Repository::Microsoft
         SetDatabaseFilePath(target);
     }
 
+    SQLiteIndex::SQLiteIndex(SQLite::blob_t&& databaseImage) :
+        SQLiteStorageBase(std::move(databaseImage))
+    {
+        m_dbconn.EnableICU();
+        AICLI_LOG(Repo, Info, << "Opened SQLite Index from memory with version [" << m_version << "], last write [" << GetLastWriteTime() << "]");
+        m_interface = Schema::CreateISQLiteIndex(m_version);
+    }
+
     SQLiteIndex::SQLiteIndex(const std::string& target, SQLiteIndex& source) :
         SQLiteStorageBase(target, source)
     {
@@ -114,6 +140,59 @@ namespace AppInstaller::Repository::Microsoft
         return AddManifestInternal(manifest, {});
     }
 
+    void SQLiteIndex::AddManifestBatch(const std::vector<ManifestBatchEntry>& manifests)
+    {
+        AICLI_LOG(Repo, Info, << "Adding batch of " << manifests.size() << " manifests");
+
+        // Parse the manifests on worker threads; only the database writes below are serialized.
+        std::vector<Manifest::Manifest> parsed(manifests.size());
+        std::vector<std::exception_ptr> parseErrors(manifests.size());
+
+        Parallel::ForEachIndex(manifests.size(), [&](size_t i)
+            {
+                // Capture the errors per manifest so that the failing path can be logged below.
+                try
+                {
+                    parsed[i] = Manifest::YamlParser::CreateFromPath(manifests[i].ManifestPath);
+                }
+                catch (...)
+                {
+                    parseErrors[i] = std::current_exception();
+                }
+            });
+
+        for (size_t i = 0; i < manifests.size(); ++i)
+        {
+            if (parseErrors[i])
+            {
+                AICLI_LOG(Repo, Error, << "Failed to parse manifest [" << manifests[i].ManifestPath << "]");
+                std::rethrow_exception(parseErrors[i]);
+            }
+        }
+
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(m_dbconn, "sqliteindex_addmanifestbatch");
+
+        for (size_t i = 0; i < manifests.size(); ++i)
+        {
+            AICLI_LOG(Repo, Verbose, << "Adding manifest for [" << parsed[i].Id << ", " << parsed[i].Version << "] at relative path [" << manifests[i].RelativePath << "]");
+            m_interface->AddManifest(m_dbconn, parsed[i], manifests[i].RelativePath);
+        }
+
+        SetLastWriteTime();
+
+        savepoint.Commit();
+
+        if (m_manifestKeys)
+        {
+            for (const auto& manifest : parsed)
+            {
+                m_manifestKeys->insert(GetManifestProbeKey(manifest.Id, manifest.Version, manifest.Channel));
+            }
+        }
+    }
+
     SQLiteIndex::IdType SQLiteIndex::AddManifestInternal(const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -132,6 +211,11 @@ namespace AppInstaller::Repository::Microsoft
 
         savepoint.Commit();
 
+        if (m_manifestKeys)
+        {
+            m_manifestKeys->insert(GetManifestProbeKey(manifest.Id, manifest.Version, manifest.Channel));
+        }
+
         return result;
     }
 
@@ -236,6 +320,11 @@ namespace AppInstaller::Repository::Microsoft
         SetLastWriteTime();
 
         savepoint.Commit();
+
+        if (m_manifestKeys)
+        {
+            m_manifestKeys->erase(GetManifestProbeKey(manifest.Id, manifest.Version, manifest.Channel));
+        }
     }
 
     void SQLiteIndex::RemoveManifestById(IdType manifestId)
@@ -247,6 +336,9 @@ namespace AppInstaller::Repository::Microsoft
         SetLastWriteTime();
 
         savepoint.Commit();
+
+        // The version key for the removed manifest is not known here; rebuild on next use.
+        m_manifestKeys.reset();
     }
 
     void SQLiteIndex::PrepareForPackaging()
@@ -274,9 +366,39 @@ namespace AppInstaller::Repository::Microsoft
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
         AICLI_LOG(Repo, Verbose, << "Performing search: " << request.ToString());
 
+        {
+            std::lock_guard<std::mutex> lockActiveSearch{ *m_activeSearchLock };
+            m_activeSearchOperation = GetCurrentSearchOperationId();
+        }
+
+        auto clearActiveSearch = wil::scope_exit([&]()
+            {
+                std::lock_guard<std::mutex> lockActiveSearch{ *m_activeSearchLock };
+                m_activeSearchOperation = {};
+            });
+
         return m_interface->Search(m_dbconn, request);
     }
 
+    void SQLiteIndex::InterruptSearch(std::thread::id operationId) const
+    {
+        // Only interrupt while the given operation's search is on the connection; an interrupt
+        // targeting another operation's search would spuriously fail one that was not
+        // cancelled. Holding the lock across the interrupt keeps the target search from
+        // completing and another caller's from taking its place before the call lands.
+        std::lock_guard<std::mutex> lockActiveSearch{ *m_activeSearchLock };
+        if (m_activeSearchOperation == operationId)
+        {
+            Interrupt();
+        }
+    }
+
+    SQLiteIndex::Statistics SQLiteIndex::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetStatistics(m_dbconn);
+    }
+
     std::optional<std::string> SQLiteIndex::GetPropertyByPrimaryId(IdType primaryId, PackageVersionProperty property) const
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -289,6 +411,12 @@ namespace AppInstaller::Repository::Microsoft
         return m_interface->GetMultiPropertyByPrimaryId(m_dbconn, primaryId, property);
     }
 
+    std::map<SQLiteIndex::IdType, std::vector<std::string>> SQLiteIndex::GetMultiPropertyByPrimaryIds(const std::vector<IdType>& primaryIds, PackageVersionMultiProperty property) const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetMultiPropertyByPrimaryIds(m_dbconn, primaryIds, property);
+    }
+
     std::optional<SQLiteIndex::IdType> SQLiteIndex::GetManifestIdByKey(IdType id, std::string_view version, std::string_view channel) const
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -300,6 +428,40 @@ namespace AppInstaller::Repository::Microsoft
         return m_interface->GetManifestIdByManifest(m_dbconn, manifest);
     }
 
+    bool SQLiteIndex::ContainsManifest(const Manifest::Manifest& manifest) const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        EnsureManifestKeysHoldingLock();
+        return m_manifestKeys->count(GetManifestProbeKey(manifest.Id, manifest.Version, manifest.Channel)) != 0;
+    }
+
+    void SQLiteIndex::EnsureManifestKeysHoldingLock() const
+    {
+        if (m_manifestKeys)
+        {
+            return;
+        }
+
+        std::unordered_set<std::string> keys;
+
+        for (const auto& match : m_interface->Search(m_dbconn, {}).Matches)
+        {
+            for (const auto& versionKey : m_interface->GetVersionKeysById(m_dbconn, match.first))
+            {
+                std::optional<std::string> id = m_interface->GetPropertyByPrimaryId(m_dbconn, versionKey.ManifestId, PackageVersionProperty::Id);
+                if (id)
+                {
+                    keys.insert(GetManifestProbeKey(
+                        id.value(),
+                        versionKey.VersionAndChannel.GetVersion().ToString(),
+                        versionKey.VersionAndChannel.GetChannel().ToString()));
+                }
+            }
+        }
+
+        m_manifestKeys = std::move(keys);
+    }
+
     std::vector<SQLiteIndex::VersionKey> SQLiteIndex::GetVersionKeysById(IdType id) const
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -334,6 +496,11 @@ namespace AppInstaller::Repository::Microsoft
         return m_interface->GetDependentsById(m_dbconn, packageId);
     }
 
+    std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> SQLiteIndex::GetDependencyClosureByManifestRowIds(const std::vector<SQLite::rowid_t>& manifestRowIds) const
+    {
+        return m_interface->GetDependencyClosureByManifestRowIds(m_dbconn, manifestRowIds);
+    }
+
     bool SQLiteIndex::MigrateTo(SQLite::Version version)
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -376,4 +543,9 @@ namespace AppInstaller::Repository::Microsoft
             break;
         }
     }
+
+    SQLite::Savepoint SQLiteIndex::CreateSavepoint(std::string_view name)
+    {
+        return SQLite::Savepoint::Create(m_dbconn, std::string{ name });
+    }
 }
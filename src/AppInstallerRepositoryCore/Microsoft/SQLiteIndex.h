@@ -17,6 +17,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -40,6 +42,9 @@ namespace AppInstaller::Repository::Microsoft
         // The type of version keys.
         using VersionKey = Schema::ISQLiteIndex::VersionKey;
 
+        // The return type of GetStatistics.
+        using Statistics = Schema::ISQLiteIndex::Statistics;
+
         SQLiteIndex(const SQLiteIndex&) = delete;
         SQLiteIndex& operator=(const SQLiteIndex&) = delete;
 
@@ -52,6 +57,9 @@ namespace AppInstaller::Repository::Microsoft
         // Opens an existing SQLiteIndex database.
         static SQLiteIndex Open(const std::string& filePath, OpenDisposition disposition, Utility::ManagedFile&& indexFile = {});
 
+        // Opens an in-memory image of an existing SQLiteIndex database file for immutable read.
+        static SQLiteIndex OpenFromBuffer(SQLite::blob_t&& databaseImage);
+
         // Creates a copy of the given index.
         static SQLiteIndex CopyFrom(const std::string& filePath, SQLiteIndex& source);
 
@@ -82,6 +90,19 @@ namespace AppInstaller::Repository::Microsoft
         // Returns the manifest id.
         IdType AddManifest(const Manifest::Manifest& manifest);
 
+        // A single entry in a batch of manifests to be added.
+        struct ManifestBatchEntry
+        {
+            std::filesystem::path ManifestPath;
+            std::filesystem::path RelativePath;
+        };
+
+        // Adds all of the given manifests to the index.
+        // The manifests are parsed on a pool of worker threads; the database writes occur on
+        // the calling thread within a single transaction. A failure on any entry causes the
+        // entire batch to be rolled back and rethrown.
+        void AddManifestBatch(const std::vector<ManifestBatchEntry>& manifests);
+
         // Updates the manifest with matching { Id, Version, Channel } in the index.
         // The return value indicates whether the index was modified by the function.
         bool UpdateManifest(const std::filesystem::path& manifestPath, const std::filesystem::path& relativePath);
@@ -128,12 +149,24 @@ namespace AppInstaller::Repository::Microsoft
         // Performs a search based on the given criteria.
         SearchResult Search(const SearchRequest& request) const;
 
+        // Interrupts the search currently executing for the given operation, if there is one.
+        // Searches run for other operations are unaffected; this object may be shared across
+        // independent operations, so a blanket connection interrupt is not safe.
+        void InterruptSearch(std::thread::id operationId) const;
+
+        // Gets summary statistics for the index contents without performing a search.
+        Statistics GetStatistics() const;
+
         // Gets the string for the given property and primary id, if present.
         std::optional<std::string> GetPropertyByPrimaryId(IdType primaryId, PackageVersionProperty property) const;
 
         // Gets the string values for the given property and primary id, if present.
         std::vector<std::string> GetMultiPropertyByPrimaryId(IdType primaryId, PackageVersionMultiProperty property) const;
 
+        // Gets the string values for the given property for each of the given primary ids, grouped by primary id.
+        // Primary ids that have no values are not present in the result.
+        std::map<IdType, std::vector<std::string>> GetMultiPropertyByPrimaryIds(const std::vector<IdType>& primaryIds, PackageVersionMultiProperty property) const;
+
         // Gets the manifest id for the given { id, version, channel }, if present.
         // If version is empty, gets the value for the 'latest' version.
         std::optional<IdType> GetManifestIdByKey(IdType id, std::string_view version, std::string_view channel) const;
@@ -141,6 +174,13 @@ namespace AppInstaller::Repository::Microsoft
         // Gets the manifest id for the given manifest, if present.
         std::optional<IdType> GetManifestIdByManifest(const Manifest::Manifest& manifest) const;
 
+        // Determines whether a manifest with the same { Id, Version, Channel } is present in the index.
+        // The first call builds an in-memory set of every version key in the index; later calls answer
+        // from that set without executing any statements, and modifications made through this object
+        // keep it current. Changes made to the database by others are not observed, and the manifest id
+        // is not produced; use GetManifestIdByManifest for either of those.
+        bool ContainsManifest(const Manifest::Manifest& manifest) const;
+
         // Gets all versions and channels for the given id.
         std::vector<VersionKey> GetVersionKeysById(IdType id) const;
 
@@ -158,6 +198,9 @@ namespace AppInstaller::Repository::Microsoft
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(SQLite::rowid_t manifestRowId) const;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(AppInstaller::Manifest::string_t packageId) const;
 
+        // Gets the transitive dependency closure of the given manifests with a single recursive query.
+        std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependencyClosureByManifestRowIds(const std::vector<SQLite::rowid_t>& manifestRowIds) const;
+
         // Migrates the index to the target version.
         // Returns false to indicate that the requested migration is not supported.
         bool MigrateTo(SQLite::Version version);
@@ -173,6 +216,9 @@ namespace AppInstaller::Repository::Microsoft
         // Some properties will persist into the database.
         void SetProperty(Property property, const std::string& value);
 
+        // Creates a savepoint over the database, allowing multiple write operations to commit together.
+        SQLite::Savepoint CreateSavepoint(std::string_view name);
+
     private:
         // Constructor used to create a new index.
         SQLiteIndex(const std::string& target, const SQLite::Version& version, CreateOptions options);
@@ -180,6 +226,9 @@ namespace AppInstaller::Repository::Microsoft
         // Constructor used to open an existing index.
         SQLiteIndex(const std::string& target, SQLiteStorageBase::OpenDisposition disposition, Utility::ManagedFile&& indexFile);
 
+        // Constructor used to open an in-memory image of an existing index.
+        SQLiteIndex(SQLite::blob_t&& databaseImage);
+
         // Constructor used to copy the given index.
         SQLiteIndex(const std::string& target, SQLiteIndex& source);
 
@@ -193,7 +242,20 @@ namespace AppInstaller::Repository::Microsoft
         bool UpdateManifestInternalHoldingLock(const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath);
         bool AddOrUpdateManifestInternal(const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath);
 
+        // Builds the key set used by ContainsManifest if it has not been built yet.
+        void EnsureManifestKeysHoldingLock() const;
+
         std::unique_ptr<Schema::ISQLiteIndex> m_interface;
         Schema::SQLiteIndexContextData m_contextData;
+
+        // Guards m_activeSearchOperation, and is held across the interrupt itself so that the
+        // search being interrupted cannot complete and be replaced by another in between.
+        std::unique_ptr<std::mutex> m_activeSearchLock = std::make_unique<std::mutex>();
+
+        // The operation whose search currently holds the connection, consulted by InterruptSearch.
+        mutable std::thread::id m_activeSearchOperation;
+
+        // The key of every manifest in the index, used by ContainsManifest; built on first use.
+        mutable std::optional<std::unordered_set<std::string>> m_manifestKeys;
     };
 }
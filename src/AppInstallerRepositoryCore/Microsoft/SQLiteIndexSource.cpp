@@ -24,6 +24,51 @@ namespace AppInstaller::Repository::Microsoft
             THROW_HR_IF(E_NOT_VALID_STATE, !source);
             return source;
         }
+
+        namespace
+        {
+            // Defers creating the version-specific package object until the result row is actually used.
+            // A search can return many more rows than the caller ends up reading (for example, when only
+            // the first page of results is rendered), so the per-row construction cost is paid on demand.
+            struct LazySQLitePackage : public SourceReference, public ICompositePackage
+            {
+                LazySQLitePackage(const std::shared_ptr<SQLiteIndexSource>& source, SQLiteIndex::IdType rowId) :
+                    SourceReference(source), m_rowId(rowId) {}
+
+                Utility::LocIndString GetProperty(PackageProperty property) const override
+                {
+                    return GetPackage()->GetProperty(property);
+                }
+
+                std::shared_ptr<IPackage> GetInstalled() override
+                {
+                    return GetPackage()->GetInstalled();
+                }
+
+                std::vector<std::shared_ptr<IPackage>> GetAvailable() override
+                {
+                    return GetPackage()->GetAvailable();
+                }
+
+            private:
+                // Creates the underlying package object on first use.
+                const std::shared_ptr<ICompositePackage>& GetPackage() const
+                {
+                    auto lock = m_packageLock.lock_exclusive();
+
+                    if (!m_package)
+                    {
+                        m_package = GetReferenceSource()->CreatePackageObject(m_rowId);
+                    }
+
+                    return m_package;
+                }
+
+                SQLiteIndex::IdType m_rowId;
+                mutable wil::srwlock m_packageLock;
+                mutable std::shared_ptr<ICompositePackage> m_package;
+            };
+        }
     }
 
     SQLiteIndexSource::SQLiteIndexSource(
@@ -54,6 +99,38 @@ namespace AppInstaller::Repository::Microsoft
         }
     }
 
+    std::shared_ptr<SQLiteIndexSource> SQLiteIndexSource::GetSharedOrOpen(
+        const std::filesystem::path& indexFile,
+        const std::function<std::shared_ptr<SQLiteIndexSource>()>& open)
+    {
+        static wil::srwlock s_sharedSourcesLock;
+        static std::map<std::filesystem::path, std::weak_ptr<SQLiteIndexSource>> s_sharedSources;
+
+        auto lock = s_sharedSourcesLock.lock_exclusive();
+
+        // Drop entries whose sources have been released so that the map does not grow
+        // with every index file ever opened by the process.
+        for (auto itr = s_sharedSources.begin(); itr != s_sharedSources.end();)
+        {
+            itr = itr->second.expired() ? s_sharedSources.erase(itr) : std::next(itr);
+        }
+
+        std::weak_ptr<SQLiteIndexSource>& entry = s_sharedSources[indexFile];
+        std::shared_ptr<SQLiteIndexSource> result = entry.lock();
+
+        if (result)
+        {
+            AICLI_LOG(Repo, Info, << "Sharing already open index source for: " << indexFile);
+        }
+        else
+        {
+            result = open();
+            entry = result;
+        }
+
+        return result;
+    }
+
     const SourceDetails& SQLiteIndexSource::GetDetails() const
     {
         return m_details;
@@ -70,26 +147,11 @@ namespace AppInstaller::Repository::Microsoft
 
         SearchResult result;
         std::shared_ptr<SQLiteIndexSource> sharedThis = NonConstSharedFromThis();
-        uint32_t majorVersion = m_index.GetVersion().MajorVersion;
 
         for (auto& indexResult : indexResults.Matches)
         {
-            std::shared_ptr<ICompositePackage> package;
-
-            switch (majorVersion)
-            {
-            case 1:
-                package = std::make_shared<details::V1::SQLitePackage>(sharedThis, indexResult.first, m_manifestCache, m_isInstalled);
-                break;
-            case 2:
-                package = std::make_shared<details::V2::SQLitePackage>(sharedThis, indexResult.first, m_manifestCache, m_packageVersionDataCache, m_isInstalled);
-                break;
-            default:
-                THROW_WIN32(ERROR_NOT_SUPPORTED);
-            }
-
             result.Matches.emplace_back(
-                std::move(package),
+                std::make_shared<details::LazySQLitePackage>(sharedThis, indexResult.first),
                 std::move(indexResult.second));
         }
 
@@ -97,6 +159,21 @@ namespace AppInstaller::Repository::Microsoft
         return result;
     }
 
+    std::shared_ptr<ICompositePackage> SQLiteIndexSource::CreatePackageObject(SQLiteIndex::IdType rowId) const
+    {
+        std::shared_ptr<SQLiteIndexSource> sharedThis = NonConstSharedFromThis();
+
+        switch (m_index.GetVersion().MajorVersion)
+        {
+        case 1:
+            return std::make_shared<details::V1::SQLitePackage>(sharedThis, rowId, m_manifestCache, m_isInstalled);
+        case 2:
+            return std::make_shared<details::V2::SQLitePackage>(sharedThis, rowId, m_manifestCache, m_packageVersionDataCache, m_isInstalled);
+        default:
+            THROW_WIN32(ERROR_NOT_SUPPORTED);
+        }
+    }
+
     void* SQLiteIndexSource::CastTo(ISourceType type)
     {
         if (type == SourceType)
@@ -4,6 +4,8 @@
 #include "Microsoft/SQLiteIndex.h"
 #include "ISource.h"
 #include <winget/FileCache.h>
+#include <filesystem>
+#include <functional>
 #include <memory>
 
 
@@ -17,9 +19,18 @@ namespace AppInstaller::Repository::Microsoft
         SQLiteIndexSource(
             const SourceDetails& details,
             SQLiteIndex&& index,
-            bool isInstalledSource = false, 
+            bool isInstalledSource = false,
             bool requireManifestHash = false);
 
+        // Gets the source wrapping the given index file, invoking the open function only if no
+        // already open source wraps the same file. The COM server commonly has many catalog
+        // objects over the same index file; sharing one source gives them a single connection
+        // and page cache rather than one of each per object. The open function may return an
+        // empty source (for instance, on cancellation), which is returned without being cached.
+        static std::shared_ptr<SQLiteIndexSource> GetSharedOrOpen(
+            const std::filesystem::path& indexFile,
+            const std::function<std::shared_ptr<SQLiteIndexSource>()>& open);
+
         SQLiteIndexSource(const SQLiteIndexSource&) = delete;
         SQLiteIndexSource& operator=(const SQLiteIndexSource&) = delete;
 
@@ -39,6 +50,12 @@ namespace AppInstaller::Repository::Microsoft
         // Execute a search on the source.
         SearchResult Search(const SearchRequest& request) const override;
 
+        // Interrupts a search currently executing on the index for the given operation.
+        void InterruptSearches(std::thread::id operationId) const override { m_index.InterruptSearch(operationId); }
+
+        // Creates the package object for the given row in the index.
+        std::shared_ptr<ICompositePackage> CreatePackageObject(SQLiteIndex::IdType rowId) const;
+
         // Casts to the requested type.
         void* CastTo(ISourceType type) override;
 
@@ -29,7 +29,7 @@ namespace AppInstaller::Repository::Microsoft::details::V2
         auto fileBytes = ReadEntireStreamAsByteArray(*fileStream);
 
         Manifest::PackageVersionDataManifest result;
-        result.Deserialize(Manifest::PackageVersionDataManifest::CreateDecompressor().Decompress(fileBytes));
+        result.Deserialize(Manifest::PackageVersionDataManifest::GetThreadLocalDecompressor().Decompress(fileBytes));
 
         return result;
     }
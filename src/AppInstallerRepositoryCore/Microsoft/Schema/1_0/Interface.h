@@ -40,6 +40,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Version 1.4 Get all the dependencies for a specific manifest.
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId) const override;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const override;
+        std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const override;
 
         // Version 1.7
         void DropTables(SQLite::Connection& connection) override;
@@ -47,6 +48,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Version 2.0
         bool MigrateFrom(SQLite::Connection& connection, const ISQLiteIndex* current) override;
 
+        // Statistics
+        Statistics GetStatistics(const SQLite::Connection& connection) const override;
+
     protected:
         virtual bool NotNeeded(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, SQLite::rowid_t id) const;
 
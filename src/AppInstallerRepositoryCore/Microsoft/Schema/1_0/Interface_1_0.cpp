@@ -85,37 +85,35 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 return {};
             }
 
-            // Convert the strings to Versions and sort them
-            struct VersionAndRow
-            {
-                SQLite::rowid_t Row = 0;
-                Utility::Version Version;
-
-                bool operator<(const VersionAndRow& other) const { return Version < other.Version; }
-            };
-
-            std::vector<VersionAndRow> versions;
-            for (auto& v : versionStrings)
+            // Convert the strings to Versions to locate the requested row; resolving either the
+            // latest or an exact version only needs a single pass, not a full sort.
+            if (version.empty())
             {
-                versions.emplace_back(VersionAndRow{ v.first, std::move(v.second) });
-            }
+                // Find the highest version
+                Utility::Version highestVersion;
 
-            std::sort(versions.begin(), versions.end());
+                for (auto& v : versionStrings)
+                {
+                    Utility::Version candidate{ std::move(v.second) };
 
-            if (version.empty())
-            {
-                // Get the last version in the list (the highest version)
-                versionIdOpt = versions.back().Row;
+                    if (!versionIdOpt || highestVersion < candidate)
+                    {
+                        versionIdOpt = v.first;
+                        highestVersion = std::move(candidate);
+                    }
+                }
             }
             else
             {
-                VersionAndRow requested;
-                requested.Version = Utility::Version{ std::string(version) };
+                Utility::Version requested{ std::string(version) };
 
-                auto itr = std::lower_bound(versions.begin(), versions.end(), requested);
-                if (itr != versions.end() && itr->Version == requested.Version)
+                for (auto& v : versionStrings)
                 {
-                    versionIdOpt = itr->Row;
+                    if (Utility::Version{ std::move(v.second) } == requested)
+                    {
+                        versionIdOpt = v.first;
+                        break;
+                    }
                 }
             }
 
@@ -196,6 +194,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // If this manifest is already present, we can't add it.
         THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_ALREADY_EXISTS), manifestResult.has_value());
 
+        // Whether this manifest brings a new package, for statistics maintenance.
+        bool isNewPackage = !IdTable::SelectIdByValue(connection, manifest.Id, true).has_value();
+
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "addmanifest_v1_0");
 
         auto [pathAdded, pathLeafId] = PathPartTable::EnsurePathExists(connection, relativePath, true);
@@ -224,6 +225,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         TagsTable::EnsureExistsAndInsert(connection, manifest.GetAggregatedTags(), manifestId);
         CommandsTable::EnsureExistsAndInsert(connection, manifest.GetAggregatedCommands(), manifestId);
 
+        // Keep any cached statistics accurate.
+        UpdateCachedStatistics(connection, isNewPackage ? 1 : 0, 1);
+
         savepoint.Commit();
 
         return manifestId;
@@ -326,9 +330,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         ManifestTable::DeleteById(connection, manifestId);
 
         // Remove all of the 1:1 data that is no longer referenced.
+        bool packageRemoved = false;
         if (NotNeeded(connection, IdTable::TableName(), IdTable::ValueName(), idId))
         {
             IdTable::DeleteById(connection, idId);
+            packageRemoved = true;
         }
         
         if (NotNeeded(connection, NameTable::TableName(), NameTable::ValueName(), nameId))
@@ -358,6 +364,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         TagsTable::DeleteIfNotNeededByManifestId(connection, manifestId);
         CommandsTable::DeleteIfNotNeededByManifestId(connection, manifestId);
 
+        // Keep any cached statistics accurate.
+        UpdateCachedStatistics(connection, packageRemoved ? -1 : 0, -1);
+
         savepoint.Commit();
     }
 
@@ -436,6 +445,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             std::vector<SQLite::rowid_t> ids = IdTable::GetAllRowIds(connection, request.MaximumResults);
 
             SearchResult result;
+            result.Matches.reserve(ids.size());
             for (SQLite::rowid_t id : ids)
             {
                 result.Matches.emplace_back(std::make_pair(id, PackageMatchFilter(PackageMatchField::Id, MatchType::Wildcard)));
@@ -453,6 +463,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         std::unique_ptr<SearchResultsTable> resultsTable = CreateSearchResultsTable(connection);
         bool inclusionsAttempted = false;
 
+        // When a time budget is given, stop starting new match searches once it expires.
+        // Filters always run to completion so that every returned match satisfies the full request.
+        SearchBudget budget{ request.TimeBudget };
+
         if (request.Query)
         {
             // Perform searches across multiple tables to populate the initial results.
@@ -467,6 +481,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             {
                 for (MatchType match : GetDefaultMatchTypeOrder(include.Type))
                 {
+                    if (budget.IsExhausted())
+                    {
+                        break;
+                    }
+
                     include.Type = match;
                     resultsTable->SearchOnField(include);
                 }
@@ -485,6 +504,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
 
             for (MatchType match : GetDefaultMatchTypeOrder(filter.Type))
             {
+                if (budget.IsExhausted())
+                {
+                    break;
+                }
+
                 filter.Type = match;
                 resultsTable->SearchOnField(filter);
             }
@@ -512,7 +536,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             resultsTable->CompleteFilter();
         }
 
-        return resultsTable->GetSearchResults(request.MaximumResults);
+        SearchResult result = resultsTable->GetSearchResults(request.MaximumResults);
+        if (budget.WasExhausted())
+        {
+            result.Truncated = true;
+        }
+
+        return result;
     }
 
     std::optional<std::string> Interface::GetPropertyByPrimaryId(const SQLite::Connection& connection, SQLite::rowid_t primaryId, PackageVersionProperty property) const
@@ -553,6 +583,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return {};
     }
 
+    std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> Interface::GetDependencyClosureByManifestRowIds(const SQLite::Connection&, const std::vector<SQLite::rowid_t>&) const
+    {
+        return {};
+    }
+
     void Interface::DropTables(SQLite::Connection& connection)
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "drop_tables_v1_0");
@@ -578,6 +613,28 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return false;
     }
 
+    ISQLiteIndex::Statistics Interface::GetStatistics(const SQLite::Connection& connection) const
+    {
+        std::optional<Statistics> cached = TryGetCachedStatistics(connection);
+        if (cached)
+        {
+            return cached.value();
+        }
+
+        Statistics result;
+        result.PackageCount = IdTable::GetCount(connection);
+        result.VersionCount = ManifestTable::GetCount(connection);
+
+        // Caching is best effort; the connection may be read only.
+        try
+        {
+            SetCachedStatistics(connection, result);
+        }
+        CATCH_LOG();
+
+        return result;
+    }
+
     std::vector<ISQLiteIndex::VersionKey> Interface::GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const
     {
         auto versionsAndChannels = ManifestTable::GetAllValuesById<IdTable, VersionTable, ChannelTable>(connection, id);
@@ -519,7 +519,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return details::ManifestTableSelectByValueIds(connection, { valueName }, { valueRowId }).has_value();
     }
 
-    bool ManifestTable::IsEmpty(SQLite::Connection& connection)
+    uint64_t ManifestTable::GetCount(const SQLite::Connection& connection)
     {
         SQLite::Builder::StatementBuilder builder;
         builder.Select(SQLite::Builder::RowCount).From(s_ManifestTable_Table_Name);
@@ -528,6 +528,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
 
         THROW_HR_IF(E_UNEXPECTED, !countStatement.Step());
 
-        return (countStatement.GetColumn<int>(0) == 0);
+        return static_cast<uint64_t>(countStatement.GetColumn<SQLite::rowid_t>(0));
+    }
+
+    bool ManifestTable::IsEmpty(SQLite::Connection& connection)
+    {
+        return (GetCount(connection) == 0);
     }
 }
@@ -236,6 +236,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 connection, SQLite::Builder::QualifiedColumn{ Table::TableName(), Table::ValueName() }, details::GetManifestTableColumnName<Table>(), log);
         }
 
+        // Gets the total number of rows in the table.
+        static uint64_t GetCount(const SQLite::Connection& connection);
+
         // Determines if the table is empty.
         static bool IsEmpty(SQLite::Connection& connection);
     };
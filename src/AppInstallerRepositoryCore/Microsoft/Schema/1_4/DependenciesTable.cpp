@@ -410,6 +410,73 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         return resultSet;
     }
 
+    std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> DependenciesTable::GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds)
+    {
+        std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> resultSet;
+
+        if (manifestRowIds.empty() || !Exists(connection))
+        {
+            return resultSet;
+        }
+
+        // Computes the transitive dependency closure in a single recursive query rather than one
+        // round trip per package. A dependency targets a package, so the recursive step follows
+        // it through every manifest of that package. The UNION deduplicates rows, which also
+        // terminates the recursion on dependency cycles.
+        //
+        // WITH RECURSIVE [closure]([package_id], [min_version]) AS (
+        //   SELECT [package_id], [min_version] FROM [dependencies] WHERE [manifest] IN (?, ...)
+        //   UNION
+        //   SELECT [dep].[package_id], [dep].[min_version] FROM [closure]
+        //   JOIN [manifest] ON [manifest].[id] = [closure].[package_id]
+        //   JOIN [dependencies] AS [dep] ON [dep].[manifest] = [manifest].[rowid]
+        // )
+        // SELECT [closure].[package_id], [closure].[min_version], [minV].[version] FROM [closure]
+        // LEFT OUTER JOIN [versions] AS [minV] ON [minV].[rowid] = [closure].[min_version]
+        std::ostringstream sql;
+        sql <<
+            "WITH RECURSIVE [closure]([package_id], [min_version]) AS ("
+            "SELECT [" << s_DependenciesTable_PackageId_Column_Name << "], [" << s_DependenciesTable_MinVersion_Column_Name << "] "
+            "FROM [" << s_DependenciesTable_Table_Name << "] "
+            "WHERE [" << s_DependenciesTable_Manifest_Column_Name << "] IN (";
+
+        for (size_t i = 0; i < manifestRowIds.size(); ++i)
+        {
+            sql << (i ? ",?" : "?");
+        }
+
+        sql <<
+            ") UNION "
+            "SELECT [dep].[" << s_DependenciesTable_PackageId_Column_Name << "], [dep].[" << s_DependenciesTable_MinVersion_Column_Name << "] "
+            "FROM [closure] "
+            "JOIN [" << ManifestTable::TableName() << "] ON [" << ManifestTable::TableName() << "].[" << IdTable::ValueName() << "] = [closure].[package_id] "
+            "JOIN [" << s_DependenciesTable_Table_Name << "] AS [dep] ON [dep].[" << s_DependenciesTable_Manifest_Column_Name << "] = [" << ManifestTable::TableName() << "].[" << SQLite::RowIDName << "]"
+            ") "
+            "SELECT [closure].[package_id], [closure].[min_version], [minV].[" << VersionTable::ValueName() << "] "
+            "FROM [closure] "
+            "LEFT OUTER JOIN [" << VersionTable::TableName() << "] AS [minV] ON [minV].[" << SQLite::RowIDName << "] = [closure].[min_version]";
+
+        SQLite::Statement select = SQLite::Statement::Create(connection, sql.str());
+
+        for (size_t i = 0; i < manifestRowIds.size(); ++i)
+        {
+            select.Bind(static_cast<int>(i + 1), manifestRowIds[i]);
+        }
+
+        while (select.Step())
+        {
+            Utility::NormalizedString version = "";
+            if (!select.GetColumnIsNull(1))
+            {
+                // If min_version is not NULL, use the corresponding value from Version table.
+                version = select.GetColumn<std::string>(2);
+            }
+            resultSet.emplace(std::make_pair(select.GetColumn<SQLite::rowid_t>(0), std::move(version)));
+        }
+
+        return resultSet;
+    }
+
     void DependenciesTable::PrepareForPackaging(SQLite::Connection& connection)
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareForPacking_V1_4");
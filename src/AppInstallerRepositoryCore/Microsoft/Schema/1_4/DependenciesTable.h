@@ -43,6 +43,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         // Get dependencies by package id.
         static std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId);
 
+        // Gets the transitive dependency closure of the given manifests in a single recursive query.
+        // Returns <PackageRowId, MinVersionString> pairs for every package reachable through the
+        // dependency graph, following each dependency package through all of its manifests.
+        static std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds);
+
         // Check dependencies table consistency.
         static bool CheckConsistency(const SQLite::Connection& connection, bool log);
 
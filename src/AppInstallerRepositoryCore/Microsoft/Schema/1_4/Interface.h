@@ -22,6 +22,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
 
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId) const override;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const override;
+        std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const override;
 
         // Version 1.7
         void DropTables(SQLite::Connection& connection) override;
@@ -134,6 +134,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         return DependenciesTable::GetDependentsById(connection, packageId);
     }
 
+    std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> Interface::GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const
+    {
+        return DependenciesTable::GetDependencyClosureByManifestRowIds(connection, manifestRowIds);
+    }
+
     void Interface::DropTables(SQLite::Connection& connection)
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "drop_tables_v1_4");
@@ -33,6 +33,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         SearchResult Search(const SQLite::Connection& connection, const SearchRequest& request) const override;
         std::optional<std::string> GetPropertyByPrimaryId(const SQLite::Connection& connection, SQLite::rowid_t primaryId, PackageVersionProperty property) const override;
         std::vector<std::string> GetMultiPropertyByPrimaryId(const SQLite::Connection& connection, SQLite::rowid_t primaryId, PackageVersionMultiProperty property) const override;
+        std::map<SQLite::rowid_t, std::vector<std::string>> GetMultiPropertyByPrimaryIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& primaryIds, PackageVersionMultiProperty property) const override;
         std::optional<SQLite::rowid_t> GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const override;
         std::optional<SQLite::rowid_t> GetManifestIdByManifest(const SQLite::Connection& connection, const Manifest::Manifest& manifest) const override;
         std::vector<VersionKey> GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const override;
@@ -47,6 +48,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         // Version 1.4 Get all the dependencies for a specific manifest.
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId) const override;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const override;
+        std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const override;
 
         // Version 1.7
         void DropTables(SQLite::Connection& connection) override;
@@ -55,6 +57,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         bool MigrateFrom(SQLite::Connection& connection, const ISQLiteIndex* current) override;
         void SetProperty(SQLite::Connection& connection, Property property, const std::string& value) override;
 
+        // Statistics
+        Statistics GetStatistics(const SQLite::Connection& connection) const override;
+
     protected:
         // Creates the search results table.
         virtual std::unique_ptr<SearchResultsTable> CreateSearchResultsTable(const SQLite::Connection& connection) const;
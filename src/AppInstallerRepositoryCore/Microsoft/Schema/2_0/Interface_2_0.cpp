@@ -18,25 +18,79 @@
 #include "Microsoft/Schema/2_0/PackageUpdateTrackingTable.h"
 
 #include <winget/PackageVersionDataManifest.h>
+#include <winget/ParallelWork.h>
 
 
 namespace AppInstaller::Repository::Microsoft::Schema::V2_0
 {
     namespace anon
     {
+        // Determines if the filter is an exact match against one of the folded system reference strings.
+        bool IsSystemReferenceStringExactMatch(const PackageMatchFilter& filter)
+        {
+            return (filter.Field == PackageMatchField::PackageFamilyName || filter.Field == PackageMatchField::ProductCode || filter.Field == PackageMatchField::UpgradeCode) &&
+                filter.Type == MatchType::Exact;
+        }
+
         // Folds the values of the fields that are stored folded.
         void FoldPackageMatchFilters(std::vector<PackageMatchFilter>& filters)
         {
             for (auto& filter : filters)
             {
-                if ((filter.Field == PackageMatchField::PackageFamilyName || filter.Field == PackageMatchField::ProductCode || filter.Field == PackageMatchField::UpgradeCode) &&
-                    filter.Type == MatchType::Exact)
+                if (IsSystemReferenceStringExactMatch(filter))
                 {
                     filter.Value = Utility::FoldCase(filter.Value);
                 }
             }
         }
 
+        // Answers a search request made up solely of exact matches on system reference strings
+        // with direct probes of their tables. The value leads the primary key of each of those
+        // tables, making every probe a single index seek with no results table to build up.
+        ISQLiteIndex::SearchResult SystemReferenceStringSearch(const SQLite::Connection& connection, const SearchRequest& request)
+        {
+            ISQLiteIndex::SearchResult result;
+
+            for (const auto& inclusion : request.Inclusions)
+            {
+                std::vector<SQLite::rowid_t> primaryIds;
+
+                switch (inclusion.Field)
+                {
+                case PackageMatchField::PackageFamilyName:
+                    primaryIds = PackageFamilyNameTable::GetPrimaryIdsByValue(connection, inclusion.Value);
+                    break;
+                case PackageMatchField::ProductCode:
+                    primaryIds = ProductCodeTable::GetPrimaryIdsByValue(connection, inclusion.Value);
+                    break;
+                case PackageMatchField::UpgradeCode:
+                    primaryIds = UpgradeCodeTable::GetPrimaryIdsByValue(connection, inclusion.Value);
+                    break;
+                default:
+                    THROW_HR(E_UNEXPECTED);
+                }
+
+                for (SQLite::rowid_t primaryId : primaryIds)
+                {
+                    if (std::find_if(result.Matches.begin(), result.Matches.end(),
+                        [&](const auto& match) { return match.first == primaryId; }) != result.Matches.end())
+                    {
+                        continue;
+                    }
+
+                    if (request.MaximumResults && result.Matches.size() >= request.MaximumResults)
+                    {
+                        result.Truncated = true;
+                        return result;
+                    }
+
+                    result.Matches.emplace_back(std::make_pair(primaryId, inclusion));
+                }
+            }
+
+            return result;
+        }
+
         // Update NormalizedNameAndPublisher with normalization and folding
         // Returns true if the normalized name contains normalization field of fieldsToInclude
         bool UpdateNormalizedNameAndPublisher(
@@ -279,6 +333,37 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         }
     }
 
+    std::map<SQLite::rowid_t, std::vector<std::string>> Interface::GetMultiPropertyByPrimaryIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& primaryIds, PackageVersionMultiProperty property) const
+    {
+        EnsureInternalInterface(connection);
+
+        if (m_internalInterface)
+        {
+            return m_internalInterface->GetMultiPropertyByPrimaryIds(connection, primaryIds, property);
+        }
+
+        switch (property)
+        {
+        case PackageVersionMultiProperty::PackageFamilyName:
+            return PackageFamilyNameTable::GetValuesByPrimaryIds(connection, primaryIds);
+        case PackageVersionMultiProperty::ProductCode:
+            return ProductCodeTable::GetValuesByPrimaryIds(connection, primaryIds);
+            // These values are not right, as they are normalized.  But they are good enough for now and all we have.
+        case PackageVersionMultiProperty::Name:
+            return NormalizedPackageNameTable::GetValuesByPrimaryIds(connection, primaryIds);
+        case PackageVersionMultiProperty::Publisher:
+            return NormalizedPackagePublisherTable::GetValuesByPrimaryIds(connection, primaryIds);
+        case PackageVersionMultiProperty::UpgradeCode:
+            return UpgradeCodeTable::GetValuesByPrimaryIds(connection, primaryIds);
+        case PackageVersionMultiProperty::Tag:
+            return TagsTable::GetValuesByPrimaryIds(connection, primaryIds);
+        case PackageVersionMultiProperty::Command:
+            return CommandsTable::GetValuesByPrimaryIds(connection, primaryIds);
+        default:
+            return {};
+        }
+    }
+
     std::optional<SQLite::rowid_t> Interface::GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const
     {
         EnsureInternalInterface(connection);
@@ -358,6 +443,18 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         THROW_HR(E_NOT_VALID_STATE);
     }
 
+    std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> Interface::GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const
+    {
+        EnsureInternalInterface(connection);
+
+        if (m_internalInterface)
+        {
+            return m_internalInterface->GetDependencyClosureByManifestRowIds(connection, manifestRowIds);
+        }
+
+        THROW_HR(E_NOT_VALID_STATE);
+    }
+
     void Interface::DropTables(SQLite::Connection& connection)
     {
         EnsureInternalInterface(connection);
@@ -434,6 +531,36 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         }
     }
 
+    ISQLiteIndex::Statistics Interface::GetStatistics(const SQLite::Connection& connection) const
+    {
+        EnsureInternalInterface(connection);
+
+        if (m_internalInterface)
+        {
+            return m_internalInterface->GetStatistics(connection);
+        }
+
+        std::optional<Statistics> cached = TryGetCachedStatistics(connection);
+        if (cached)
+        {
+            return cached.value();
+        }
+
+        // A packaged index holds a single row per package, containing only its latest version.
+        Statistics result;
+        result.PackageCount = PackagesTable::GetCount(connection);
+        result.VersionCount = result.PackageCount;
+
+        // Caching is best effort; the connection may be read only.
+        try
+        {
+            SetCachedStatistics(connection, result);
+        }
+        CATCH_LOG();
+
+        return result;
+    }
+
     std::unique_ptr<SearchResultsTable> Interface::CreateSearchResultsTable(const SQLite::Connection& connection) const
     {
         return std::make_unique<SearchResultsTable>(connection);
@@ -537,6 +664,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             std::vector<SQLite::rowid_t> ids = PackagesTable::GetAllRowIds(connection, PackagesTable::IdColumn::Name, request.MaximumResults);
 
             SearchResult result;
+            result.Matches.reserve(ids.size());
             for (SQLite::rowid_t id : ids)
             {
                 result.Matches.emplace_back(std::make_pair(id, PackageMatchFilter(PackageMatchField::Id, MatchType::Wildcard)));
@@ -547,6 +675,15 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             return result;
         }
 
+        // Installed correlation probes are commonly nothing but exact matches on the folded
+        // system reference strings; answer those directly rather than paying for the
+        // temporary results table machinery on every probe.
+        if (!request.Query && request.Filters.empty() && !request.Inclusions.empty() &&
+            std::all_of(request.Inclusions.begin(), request.Inclusions.end(), anon::IsSystemReferenceStringExactMatch))
+        {
+            return anon::SystemReferenceStringSearch(connection, request);
+        }
+
         // First phase, create the search results table and populate it with the initial results.
         // If the Query is provided, we search across many fields and put results in together.
         // If Inclusions has fields, we add these to the data.
@@ -554,6 +691,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         std::unique_ptr<SearchResultsTable> resultsTable = CreateSearchResultsTable(connection);
         bool inclusionsAttempted = false;
 
+        // When a time budget is given, stop starting new match searches once it expires.
+        // Filters always run to completion so that every returned match satisfies the full request.
+        SearchBudget budget{ request.TimeBudget };
+
         if (request.Query)
         {
             // Perform searches across multiple tables to populate the initial results.
@@ -568,6 +709,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             {
                 for (MatchType match : GetDefaultMatchTypeOrder(include.Type))
                 {
+                    if (budget.IsExhausted())
+                    {
+                        break;
+                    }
+
                     include.Type = match;
                     resultsTable->SearchOnField(include);
                 }
@@ -586,6 +732,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
 
             for (MatchType match : GetDefaultMatchTypeOrder(filter.Type))
             {
+                if (budget.IsExhausted())
+                {
+                    break;
+                }
+
                 filter.Type = match;
                 resultsTable->SearchOnField(filter);
             }
@@ -613,7 +764,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             resultsTable->CompleteFilter();
         }
 
-        return resultsTable->GetSearchResults(request.MaximumResults);
+        SearchResult result = resultsTable->GetSearchResults(request.MaximumResults);
+        if (budget.WasExhausted())
+        {
+            result.Truncated = true;
+        }
+
+        return result;
     }
 
     void Interface::PrepareForPackaging(const SQLiteIndexContext& context, bool vacuum)
@@ -643,9 +800,15 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
 
         THROW_WIN32_IF(ERROR_INVALID_STATE, baseOutputDirectory.empty() || baseOutputDirectory.is_relative());
 
-        // Output all of the changed package version manifests since the base time to the target location
-        for (const auto& packageData : PackageUpdateTrackingTable::GetUpdatesSince(connection, updateBaseTime))
+        // Output all of the changed package version manifests since the base time to the target location.
+        // The manifest data is read from the database up front; the file output that remains is
+        // independent per package and safe to fan out across the worker budget.
+        std::vector<PackageUpdateTrackingTable::PackageData> updatedPackages = PackageUpdateTrackingTable::GetUpdatesSince(connection, updateBaseTime);
+
+        Parallel::ForEachIndex(updatedPackages.size(), [&](size_t index)
         {
+            const auto& packageData = updatedPackages[index];
+
             std::filesystem::path packageDirectory = baseOutputDirectory /
                 Manifest::PackageVersionDataManifest::GetRelativeDirectoryPath(packageData.PackageIdentifier, Utility::SHA256::ConvertToString(packageData.Hash));
 
@@ -660,7 +823,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             stream.write(reinterpret_cast<const char*>(packageData.Manifest.data()), packageData.Manifest.size());
             THROW_LAST_ERROR_IF(stream.fail());
             stream.flush();
-        }
+        });
 
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareforpackaging_v2_0");
 
@@ -749,6 +912,15 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         // Drop 1.7 tables
         m_internalInterface->DropTables(connection);
 
+        // The conversion collapsed each package to its latest version; refresh any cached statistics.
+        if (TryGetCachedStatistics(connection))
+        {
+            Statistics statistics;
+            statistics.PackageCount = PackagesTable::GetCount(connection);
+            statistics.VersionCount = statistics.PackageCount;
+            SetCachedStatistics(connection, statistics);
+        }
+
         savepoint.Commit();
 
         m_internalInterface.reset();
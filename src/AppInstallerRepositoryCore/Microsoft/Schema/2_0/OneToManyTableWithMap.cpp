@@ -110,7 +110,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
                 SQLite::Builder::StatementBuilder selectBuilder;
                 selectBuilder.Select(valueName).From(tableName).Where(SQLite::RowIDName).Equals(rowid);
 
-                SQLite::Statement select = selectBuilder.Prepare(connection);
+                SQLite::Statement select = selectBuilder.PrepareCached(connection);
 
                 if (select.Step())
                 {
@@ -266,7 +266,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
                 From({ tableName, s_OneToManyTableWithMap_MapTable_Suffix }).As("map").Join(tableName).
                 On(QCol("map", valueName), QCol(tableName, SQLite::RowIDName)).Where(QCol("map", s_OneToManyTableWithMap_MapTable_PrimaryName)).Equals(manifestId);
 
-            SQLite::Statement statement = builder.Prepare(connection);
+            // The same statement text is used for every package's values; reuse the compiled statement.
+            SQLite::Statement statement = builder.PrepareCached(connection);
 
             while (statement.Step())
             {
@@ -276,6 +277,76 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             return result;
         }
 
+        std::map<SQLite::rowid_t, std::vector<std::string>> OneToManyTableWithMapGetValuesByPrimaryIds(
+            const SQLite::Connection& connection,
+            std::string_view tableName,
+            std::string_view valueName,
+            const std::vector<SQLite::rowid_t>& primaryIds)
+        {
+            using QCol = SQLite::Builder::QualifiedColumn;
+            constexpr std::string_view s_map = "map"sv;
+
+            std::map<SQLite::rowid_t, std::vector<std::string>> result;
+
+            if (primaryIds.empty())
+            {
+                return result;
+            }
+
+            // The packaged index drops the map table's (package, value) index, so any filter on the
+            // primary id costs a sequential scan of the map table. When many ids are requested, a
+            // single scan filtered in memory is cheaper than one scan per chunk of bound ids.
+            if (primaryIds.size() > SQLite::ValueSetChunkSize)
+            {
+                std::set<SQLite::rowid_t> idFilter{ primaryIds.begin(), primaryIds.end() };
+
+                SQLite::Builder::StatementBuilder builder;
+                builder.Select({ QCol(s_map, s_OneToManyTableWithMap_MapTable_PrimaryName), QCol(tableName, valueName) }).
+                    From({ tableName, s_OneToManyTableWithMap_MapTable_Suffix }).As(s_map).Join(tableName).
+                    On(QCol(s_map, valueName), QCol(tableName, SQLite::RowIDName));
+
+                SQLite::Statement statement = builder.PrepareCached(connection);
+
+                while (statement.Step())
+                {
+                    SQLite::rowid_t primaryId = statement.GetColumn<SQLite::rowid_t>(0);
+
+                    if (idFilter.find(primaryId) != idFilter.end())
+                    {
+                        result[primaryId].emplace_back(statement.GetColumn<std::string>(1));
+                    }
+                }
+
+                return result;
+            }
+
+            // Prepare for a fixed parameter count and bind the ids in chunks, so that the
+            // cached statement is reused regardless of how many ids are requested.
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select({ QCol(s_map, s_OneToManyTableWithMap_MapTable_PrimaryName), QCol(tableName, valueName) }).
+                From({ tableName, s_OneToManyTableWithMap_MapTable_Suffix }).As(s_map).Join(tableName).
+                On(QCol(s_map, valueName), QCol(tableName, SQLite::RowIDName)).Where(QCol(s_map, s_OneToManyTableWithMap_MapTable_PrimaryName)).In(SQLite::ValueSetChunkSize);
+
+            SQLite::Statement statement = builder.PrepareCached(connection);
+
+            for (size_t offset = 0; offset < primaryIds.size(); offset += SQLite::ValueSetChunkSize)
+            {
+                if (offset != 0)
+                {
+                    statement.Reset();
+                }
+
+                statement.BindValueSetChunk(1, primaryIds, offset, SQLite::ValueSetChunkSize);
+
+                while (statement.Step())
+                {
+                    result[statement.GetColumn<SQLite::rowid_t>(0)].emplace_back(statement.GetColumn<std::string>(1));
+                }
+            }
+
+            return result;
+        }
+
         void OneToManyTableWithMapEnsureExistsAndInsert(SQLite::Connection& connection,
             std::string_view tableName, std::string_view valueName,
             const std::vector<std::string>& values, SQLite::rowid_t manifestId)
@@ -3,6 +3,7 @@
 #pragma once
 #include <winget/SQLiteWrapper.h>
 #include <winget/SQLiteStatementBuilder.h>
+#include <map>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -40,6 +41,14 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             std::string_view valueName,
             SQLite::rowid_t primaryId);
 
+        // Gets all values associated with each of the given primary ids in a single query.
+        // Primary ids that have no values are not present in the result.
+        std::map<SQLite::rowid_t, std::vector<std::string>> OneToManyTableWithMapGetValuesByPrimaryIds(
+            const SQLite::Connection& connection,
+            std::string_view tableName,
+            std::string_view valueName,
+            const std::vector<SQLite::rowid_t>& primaryIds);
+
         // Ensures that the value exists and inserts mapping entries.
         void OneToManyTableWithMapEnsureExistsAndInsert(SQLite::Connection& connection,
             std::string_view tableName, std::string_view valueName, 
@@ -100,6 +109,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             return details::OneToManyTableWithMapGetValuesByPrimaryId(connection, TableInfo::TableName(), TableInfo::ValueName(), primaryId);
         }
 
+        // Gets all values associated with each of the given primary ids in a single query.
+        // Primary ids that have no values are not present in the result.
+        static std::map<SQLite::rowid_t, std::vector<std::string>> GetValuesByPrimaryIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& primaryIds)
+        {
+            return details::OneToManyTableWithMapGetValuesByPrimaryIds(connection, TableInfo::TableName(), TableInfo::ValueName(), primaryIds);
+        }
+
         // Ensures that all values exist in the data table, and inserts into the mapping table for the given primary id.
         static void EnsureExistsAndInsert(SQLite::Connection& connection, const std::vector<std::string>& values, SQLite::rowid_t primaryId)
         {
@@ -88,7 +88,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             SQLite::Builder::StatementBuilder builder;
             builder.Select(columns).From(s_PackagesTable_Table_Name).Where(SQLite::RowIDName).Equals(id);
 
-            SQLite::Statement result = builder.Prepare(connection);
+            // Property reads recur with the same statement text for every package in a result set.
+            SQLite::Statement result = builder.PrepareCached(connection);
 
             if (stepAndVerify)
             {
@@ -57,6 +57,12 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
     }
 
     // A table in which each row represents a single package.
+    // The main table of the packaged 2.0 index; one row per package, describing its latest version.
+    // Installer applicability data (architecture, installer type, scope) is deliberately absent:
+    // it is per installer rather than per package, and is evaluated client side from the
+    // downloaded manifest. Filtering on it here would require packaging every installer's
+    // dimensions and keeping them in sync with manifest semantics, for candidates that the
+    // manifest selection stage already rejects cheaply.
     struct PackagesTable
     {
         // Get the table name.
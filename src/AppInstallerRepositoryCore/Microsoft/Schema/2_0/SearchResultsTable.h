@@ -51,7 +51,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             PackageMatchField field,
             std::string_view manifestAlias,
             std::string_view valueAlias,
-            bool useLike) const;
+            MatchType match) const;
 
         static bool MatchUsesLike(MatchType match);
         void BindStatementForMatchType(SQLite::Statement& statement, MatchType match, int bindIndex, std::string_view value);
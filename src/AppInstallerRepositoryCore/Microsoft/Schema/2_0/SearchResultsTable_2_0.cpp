@@ -221,7 +221,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
 
     std::vector<int> SearchResultsTable::BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, PackageMatchField field, MatchType match) const
     {
-        return BuildSearchStatement(builder, field, s_SearchResultsTable_SubSelect_PackageAlias, s_SearchResultsTable_SubSelect_ValueAlias, MatchUsesLike(match));
+        return BuildSearchStatement(builder, field, s_SearchResultsTable_SubSelect_PackageAlias, s_SearchResultsTable_SubSelect_ValueAlias, match);
     }
 
     std::vector<int> SearchResultsTable::BuildSearchStatement(
@@ -229,8 +229,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         PackageMatchField field,
         std::string_view manifestAlias,
         std::string_view valueAlias,
-        bool useLike) const
+        MatchType match) const
     {
+        bool useLike = MatchUsesLike(match);
         std::vector<int> result;
 
         switch (field)
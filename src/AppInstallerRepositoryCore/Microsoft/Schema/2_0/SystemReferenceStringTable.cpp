@@ -68,6 +68,67 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             return result;
         }
 
+        std::vector<SQLite::rowid_t> SystemReferenceStringTableGetPrimaryIdsByValue(
+            const SQLite::Connection& connection,
+            std::string_view tableName,
+            std::string_view valueName,
+            const std::string& value)
+        {
+            std::vector<SQLite::rowid_t> result;
+
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select(s_SystemReferenceStringTable_PrimaryName).
+                From(tableName).Where(valueName).Equals(value);
+
+            SQLite::Statement statement = builder.Prepare(connection);
+
+            while (statement.Step())
+            {
+                result.emplace_back(statement.GetColumn<SQLite::rowid_t>(0));
+            }
+
+            return result;
+        }
+
+        std::map<SQLite::rowid_t, std::vector<std::string>> SystemReferenceStringTableGetValuesByPrimaryIds(
+            const SQLite::Connection& connection,
+            std::string_view tableName,
+            std::string_view valueName,
+            const std::vector<SQLite::rowid_t>& primaryIds)
+        {
+            std::map<SQLite::rowid_t, std::vector<std::string>> result;
+
+            if (primaryIds.empty())
+            {
+                return result;
+            }
+
+            // Prepare for a fixed parameter count and bind the ids in chunks, so that the
+            // cached statement is reused regardless of how many ids are requested.
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select({ s_SystemReferenceStringTable_PrimaryName, valueName }).
+                From(tableName).Where(s_SystemReferenceStringTable_PrimaryName).In(SQLite::ValueSetChunkSize);
+
+            SQLite::Statement statement = builder.PrepareCached(connection);
+
+            for (size_t offset = 0; offset < primaryIds.size(); offset += SQLite::ValueSetChunkSize)
+            {
+                if (offset != 0)
+                {
+                    statement.Reset();
+                }
+
+                statement.BindValueSetChunk(1, primaryIds, offset, SQLite::ValueSetChunkSize);
+
+                while (statement.Step())
+                {
+                    result[statement.GetColumn<SQLite::rowid_t>(0)].emplace_back(statement.GetColumn<std::string>(1));
+                }
+            }
+
+            return result;
+        }
+
         void SystemReferenceStringTableEnsureExists(
             SQLite::Connection& connection,
             std::string_view tableName,
@@ -4,6 +4,7 @@
 #include <winget/SQLiteWrapper.h>
 #include <winget/SQLiteStatementBuilder.h>
 #include <AppInstallerStrings.h>
+#include <map>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -29,6 +30,21 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             std::string_view valueName,
             SQLite::rowid_t primaryId);
 
+        // Gets the primary ids associated with the given value.
+        std::vector<SQLite::rowid_t> SystemReferenceStringTableGetPrimaryIdsByValue(
+            const SQLite::Connection& connection,
+            std::string_view tableName,
+            std::string_view valueName,
+            const std::string& value);
+
+        // Gets all values associated with each of the given primary ids in a single query.
+        // Primary ids that have no values are not present in the result.
+        std::map<SQLite::rowid_t, std::vector<std::string>> SystemReferenceStringTableGetValuesByPrimaryIds(
+            const SQLite::Connection& connection,
+            std::string_view tableName,
+            std::string_view valueName,
+            const std::vector<SQLite::rowid_t>& primaryIds);
+
         // Ensures that the value exists and inserts mapping entries.
         void SystemReferenceStringTableEnsureExists(
             SQLite::Connection& connection,
@@ -101,6 +117,20 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
             return details::SystemReferenceStringTableGetValuesByPrimaryId(connection, TableInfo::TableName(), TableInfo::ValueName(), primaryId);
         }
 
+        // Gets all values associated with each of the given primary ids in a single query.
+        // Primary ids that have no values are not present in the result.
+        static std::map<SQLite::rowid_t, std::vector<std::string>> GetValuesByPrimaryIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& primaryIds)
+        {
+            return details::SystemReferenceStringTableGetValuesByPrimaryIds(connection, TableInfo::TableName(), TableInfo::ValueName(), primaryIds);
+        }
+
+        // Gets the primary ids associated with the given value.
+        // The value leads the primary key of the table, so this is a single index seek.
+        static std::vector<SQLite::rowid_t> GetPrimaryIdsByValue(const SQLite::Connection& connection, const std::string& value)
+        {
+            return details::SystemReferenceStringTableGetPrimaryIdsByValue(connection, TableInfo::TableName(), TableInfo::ValueName(), value);
+        }
+
         // Ensures that all values exist in the data table, and inserts into the mapping table for the given primary id.
         static void EnsureExists(SQLite::Connection& connection, const std::vector<std::string>& values, SQLite::rowid_t primaryId)
         {
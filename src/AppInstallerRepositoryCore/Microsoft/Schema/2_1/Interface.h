@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "Microsoft/Schema/2_0/Interface.h"
+
+#include <optional>
+
+namespace AppInstaller::Repository::Microsoft::Schema::V2_1
+{
+    // Interface to this schema version exposed through ISQLiteIndex.
+    // Adds an FTS5 table over the searchable package text, making substring and
+    // prefix queries index lookups rather than LIKE scans.
+    struct Interface : public V2_0::Interface
+    {
+        Interface(Utility::NormalizationVersion normVersion = Utility::NormalizationVersion::Initial);
+
+        // Version 1.0
+        SQLite::Version GetVersion() const override;
+
+    protected:
+        std::unique_ptr<V2_0::SearchResultsTable> CreateSearchResultsTable(const SQLite::Connection& connection) const override;
+
+        void PrepareForPackaging(const SQLiteIndexContext& context, bool vacuum) override;
+
+    private:
+        // Whether the FTS table is present and usable by the running SQLite; probed on first search.
+        mutable std::optional<bool> m_ftsUsable;
+    };
+}
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/2_1/Interface.h"
+
+#include "Microsoft/Schema/2_1/PackagesFtsTable.h"
+#include "Microsoft/Schema/2_1/SearchResultsTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V2_1
+{
+    Interface::Interface(Utility::NormalizationVersion normVersion) : V2_0::Interface(normVersion)
+    {
+    }
+
+    SQLite::Version Interface::GetVersion() const
+    {
+        return { 2, 1 };
+    }
+
+    std::unique_ptr<V2_0::SearchResultsTable> Interface::CreateSearchResultsTable(const SQLite::Connection& connection) const
+    {
+        if (!m_ftsUsable.has_value())
+        {
+            m_ftsUsable = PackagesFtsTable::IsUsable(connection);
+        }
+
+        if (m_ftsUsable.value())
+        {
+            return std::make_unique<SearchResultsTable>(connection);
+        }
+
+        // An index without a usable FTS table falls back to the 2.0 search behavior, either
+        // because it was not packaged with one or because the running SQLite cannot use the
+        // one that it was packaged with.
+        return V2_0::Interface::CreateSearchResultsTable(connection);
+    }
+
+    void Interface::PrepareForPackaging(const SQLiteIndexContext& context, bool vacuum)
+    {
+        // Create the 2.0 data tables first, then build the FTS table from them.
+        V2_0::Interface::PrepareForPackaging(context, false);
+
+        SQLite::Connection& connection = context.Connection;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareforpackaging_v2_1");
+
+        PackagesFtsTable::Drop(connection);
+        PackagesFtsTable::CreateAndPopulate(connection);
+
+        savepoint.Commit();
+
+        // The table was just (re)created; any usability determination made before this is stale.
+        m_ftsUsable.reset();
+
+        if (vacuum)
+        {
+            Vacuum(connection);
+        }
+    }
+}
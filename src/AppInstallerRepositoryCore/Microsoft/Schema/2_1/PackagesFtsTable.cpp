@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/2_1/PackagesFtsTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V2_1
+{
+    using namespace SQLite;
+
+    static constexpr std::string_view s_PackagesFtsTable_Table_Name = "packages_fts"sv;
+
+    namespace
+    {
+        // The virtual table syntax is not expressible through the statement builder, so the
+        // creation and population statements are kept as literal text here.
+        // remove_diacritics 2 is more thorough but requires SQLite 3.27; the oldest supported
+        // OS builds ship an earlier winsqlite3, and FTS5 refuses to connect to a table whose
+        // declared tokenizer options it does not recognize, so stay within what they provide.
+        constexpr char const* s_PackagesFtsTable_CreateSQL =
+            "CREATE VIRTUAL TABLE [packages_fts] USING fts5([id], [name], [moniker], tokenize='unicode61 remove_diacritics 1')";
+
+        constexpr char const* s_PackagesFtsTable_PopulateSQL =
+            "INSERT INTO [packages_fts] ([rowid], [id], [name], [moniker]) SELECT [rowid], [id], [name], [moniker] FROM [packages]";
+    }
+
+    std::string_view PackagesFtsTable::TableName()
+    {
+        return s_PackagesFtsTable_Table_Name;
+    }
+
+    void PackagesFtsTable::CreateAndPopulate(SQLite::Connection& connection)
+    {
+        Savepoint savepoint = Savepoint::Create(connection, "createpackagesfts_v2_1");
+
+        Statement::Create(connection, s_PackagesFtsTable_CreateSQL).Execute();
+        Statement::Create(connection, s_PackagesFtsTable_PopulateSQL).Execute();
+
+        savepoint.Commit();
+    }
+
+    void PackagesFtsTable::Drop(SQLite::Connection& connection)
+    {
+        Builder::StatementBuilder dropTableBuilder;
+        dropTableBuilder.DropTableIfExists(s_PackagesFtsTable_Table_Name);
+
+        dropTableBuilder.Execute(connection);
+    }
+
+    bool PackagesFtsTable::Exists(const SQLite::Connection& connection)
+    {
+        Builder::StatementBuilder builder;
+        builder.Select(Builder::RowCount).From(Builder::Schema::MainTable).
+            Where(Builder::Schema::TypeColumn).Equals(Builder::Schema::Type_Table).And(Builder::Schema::NameColumn).Equals(s_PackagesFtsTable_Table_Name);
+
+        Statement statement = builder.Prepare(connection);
+        THROW_HR_IF(E_UNEXPECTED, !statement.Step());
+        return statement.GetColumn<int64_t>(0) != 0;
+    }
+
+    bool PackagesFtsTable::IsUsable(const SQLite::Connection& connection) try
+    {
+        if (!Exists(connection))
+        {
+            return false;
+        }
+
+        // Preparing a statement against the virtual table makes FTS5 instantiate the tokenizer
+        // recorded in the table's declaration; an SQLite that does not support the declared
+        // options fails here rather than on every search. Stepping exercises the MATCH path.
+        Statement probe = Statement::Create(connection, "SELECT [rowid] FROM [packages_fts] WHERE [packages_fts] MATCH 'probe' LIMIT 1");
+        probe.Step();
+        return true;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        AICLI_LOG(Repo, Warning, << "The FTS package search table is present but not usable by the running SQLite; falling back to non-FTS search");
+        return false;
+    }
+
+    int PackagesFtsTable::BuildSearchStatement(Builder::StatementBuilder& builder, std::string_view valueName, std::string_view primaryAlias, std::string_view valueAlias)
+    {
+        using QCol = Builder::QualifiedColumn;
+
+        builder.Select().
+            Column(QCol(s_PackagesFtsTable_Table_Name, SQLite::RowIDName)).As(primaryAlias).
+            Column(QCol(s_PackagesFtsTable_Table_Name, valueName)).As(valueAlias).
+        From(s_PackagesFtsTable_Table_Name).Where(QCol(s_PackagesFtsTable_Table_Name, valueName));
+
+        builder.Match(Builder::Unbound);
+        return builder.GetLastBindIndex();
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/SQLiteWrapper.h>
+#include <winget/SQLiteStatementBuilder.h>
+
+#include <string_view>
+
+using namespace std::string_view_literals;
+
+namespace AppInstaller::Repository::Microsoft::Schema::V2_1
+{
+    // An FTS5 table over the searchable package text columns.
+    // Built during PrepareForPackaging from the packages table, with rowids matching the
+    // packages table rowids; substring and prefix searches become token index lookups
+    // rather than LIKE scans over the entire table.
+    struct PackagesFtsTable
+    {
+        // The indexed columns; these mirror the packages table columns they are built from.
+        static constexpr std::string_view IdColumn = "id"sv;
+        static constexpr std::string_view NameColumn = "name"sv;
+        static constexpr std::string_view MonikerColumn = "moniker"sv;
+
+        // Get the table name.
+        static std::string_view TableName();
+
+        // Creates the table and populates it from the packages table.
+        static void CreateAndPopulate(SQLite::Connection& connection);
+
+        // Drops the table.
+        static void Drop(SQLite::Connection& connection);
+
+        // Determine if the table currently exists in the database.
+        static bool Exists(const SQLite::Connection& connection);
+
+        // Determine if the table exists and can be queried with the running SQLite.
+        // The index may have been built by a newer SQLite than the one reading it; FTS5
+        // cannot connect to a table whose declared tokenizer options it does not support,
+        // in which case searches must avoid the table entirely.
+        static bool IsUsable(const SQLite::Connection& connection);
+
+        // Builds a search select against the table, like:
+        //      SELECT [packages_fts].[rowid] AS p, [packages_fts].[<column>] AS v FROM [packages_fts]
+        //      WHERE [packages_fts].[<column>] MATCH <expression>
+        // Returns the bind index for the match expression.
+        static int BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, std::string_view valueName, std::string_view primaryAlias, std::string_view valueAlias);
+    };
+}
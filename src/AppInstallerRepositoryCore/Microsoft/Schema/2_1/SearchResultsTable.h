@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "Microsoft/Schema/2_0/SearchResultsTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V2_1
+{
+    // Search results table that routes inexact matches on the packages table text columns
+    // through the FTS5 table rather than LIKE scans.
+    struct SearchResultsTable : public V2_0::SearchResultsTable
+    {
+        SearchResultsTable(const SQLite::Connection& connection);
+
+        SearchResultsTable(const SearchResultsTable&) = delete;
+        SearchResultsTable& operator=(const SearchResultsTable&) = delete;
+
+        SearchResultsTable(SearchResultsTable&&) = default;
+        SearchResultsTable& operator=(SearchResultsTable&&) = default;
+
+    protected:
+        std::vector<int> BuildSearchStatement(
+            SQLite::Builder::StatementBuilder& builder,
+            PackageMatchField field,
+            std::string_view manifestAlias,
+            std::string_view valueAlias,
+            MatchType match) const override;
+
+        void BindStatementForMatchType(SQLite::Statement& statement, const PackageMatchFilter& filter, const std::vector<int>& bindIndex) override;
+
+        // Determines whether the given field and match type are served by the FTS table.
+        static bool UsesFtsMatch(PackageMatchField field, MatchType match);
+
+        // Creates the FTS5 match expression for the given match type and value.
+        static std::string BuildMatchExpression(MatchType match, std::string_view value);
+    };
+}
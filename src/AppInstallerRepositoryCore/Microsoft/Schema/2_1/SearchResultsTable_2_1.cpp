@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/2_1/SearchResultsTable.h"
+#include "Microsoft/Schema/2_1/PackagesFtsTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V2_1
+{
+    namespace
+    {
+        using namespace std::string_literals;
+
+        std::string_view GetFtsColumn(PackageMatchField field)
+        {
+            switch (field)
+            {
+            case PackageMatchField::Id:
+                return PackagesFtsTable::IdColumn;
+            case PackageMatchField::Name:
+                return PackagesFtsTable::NameColumn;
+            case PackageMatchField::Moniker:
+                return PackagesFtsTable::MonikerColumn;
+            default:
+                THROW_HR(E_UNEXPECTED);
+            }
+        }
+    }
+
+    SearchResultsTable::SearchResultsTable(const SQLite::Connection& connection) :
+        V2_0::SearchResultsTable(connection)
+    {
+    }
+
+    std::vector<int> SearchResultsTable::BuildSearchStatement(
+        SQLite::Builder::StatementBuilder& builder,
+        PackageMatchField field,
+        std::string_view manifestAlias,
+        std::string_view valueAlias,
+        MatchType match) const
+    {
+        if (UsesFtsMatch(field, match))
+        {
+            return { PackagesFtsTable::BuildSearchStatement(builder, GetFtsColumn(field), manifestAlias, valueAlias) };
+        }
+
+        return V2_0::SearchResultsTable::BuildSearchStatement(builder, field, manifestAlias, valueAlias, match);
+    }
+
+    void SearchResultsTable::BindStatementForMatchType(SQLite::Statement& statement, const PackageMatchFilter& filter, const std::vector<int>& bindIndex)
+    {
+        if (UsesFtsMatch(filter.Field, filter.Type))
+        {
+            statement.Bind(bindIndex[0], BuildMatchExpression(filter.Type, filter.Value));
+            return;
+        }
+
+        V2_0::SearchResultsTable::BindStatementForMatchType(statement, filter, bindIndex);
+    }
+
+    bool SearchResultsTable::UsesFtsMatch(PackageMatchField field, MatchType match)
+    {
+        switch (field)
+        {
+        case PackageMatchField::Id:
+        case PackageMatchField::Name:
+        case PackageMatchField::Moniker:
+            break;
+        default:
+            return false;
+        }
+
+        switch (match)
+        {
+        case MatchType::CaseInsensitive:
+        case MatchType::StartsWith:
+        case MatchType::Substring:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    std::string SearchResultsTable::BuildMatchExpression(MatchType match, std::string_view value)
+    {
+        // Wrap the value as an FTS5 phrase (doubling embedded quotes) so that the query
+        // syntax tokenizes it the same way the indexed text was tokenized.
+        std::string phrase = "\""s;
+        for (char c : value)
+        {
+            phrase += c;
+            if (c == '"')
+            {
+                phrase += c;
+            }
+        }
+        phrase += '"';
+
+        switch (match)
+        {
+        case MatchType::StartsWith:
+            // Match when the phrase starts the column value, allowing the last token to be a prefix.
+            return "^"s + phrase + "*";
+        case MatchType::Substring:
+            // Match the phrase anywhere, allowing the last token to be a prefix.
+            return phrase + "*";
+        default:
+            // Tokens are already case folded by the tokenizer, giving case insensitive equality.
+            return phrase;
+        }
+    }
+}
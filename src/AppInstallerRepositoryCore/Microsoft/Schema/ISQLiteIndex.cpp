@@ -12,9 +12,21 @@
 #include "Microsoft/Schema/1_6/Interface.h"
 #include "Microsoft/Schema/1_7/Interface.h"
 #include "Microsoft/Schema/2_0/Interface.h"
+#include "Microsoft/Schema/2_1/Interface.h"
+
+#include <winget/SQLiteMetadataTable.h>
 
 namespace AppInstaller::Repository::Microsoft::Schema
 {
+    using namespace std::string_view_literals;
+
+    namespace
+    {
+        // The names used to cache the index statistics in the metadata table.
+        static constexpr std::string_view s_MetadataValueName_PackageCount = "packageCount"sv;
+        static constexpr std::string_view s_MetadataValueName_VersionCount = "versionCount"sv;
+    }
+
     void ISQLiteIndex::PrepareForPackaging(const SQLiteIndexContext& context)
     {
         PrepareForPackaging(context.Connection);
@@ -25,6 +37,57 @@ namespace AppInstaller::Repository::Microsoft::Schema
         THROW_WIN32(ERROR_NOT_SUPPORTED);
     }
 
+    std::map<SQLite::rowid_t, std::vector<std::string>> ISQLiteIndex::GetMultiPropertyByPrimaryIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& primaryIds, PackageVersionMultiProperty property) const
+    {
+        std::map<SQLite::rowid_t, std::vector<std::string>> result;
+
+        for (SQLite::rowid_t primaryId : primaryIds)
+        {
+            std::vector<std::string> values = GetMultiPropertyByPrimaryId(connection, primaryId, property);
+
+            if (!values.empty())
+            {
+                result.emplace(primaryId, std::move(values));
+            }
+        }
+
+        return result;
+    }
+
+    std::optional<ISQLiteIndex::Statistics> ISQLiteIndex::TryGetCachedStatistics(const SQLite::Connection& connection)
+    {
+        std::optional<int64_t> packageCount = SQLite::MetadataTable::TryGetNamedValue<int64_t>(connection, s_MetadataValueName_PackageCount);
+        std::optional<int64_t> versionCount = SQLite::MetadataTable::TryGetNamedValue<int64_t>(connection, s_MetadataValueName_VersionCount);
+
+        if (!packageCount || !versionCount)
+        {
+            return std::nullopt;
+        }
+
+        Statistics result;
+        result.PackageCount = static_cast<uint64_t>(packageCount.value());
+        result.VersionCount = static_cast<uint64_t>(versionCount.value());
+        return result;
+    }
+
+    void ISQLiteIndex::SetCachedStatistics(const SQLite::Connection& connection, const Statistics& statistics)
+    {
+        SQLite::MetadataTable::SetNamedValue(connection, s_MetadataValueName_PackageCount, static_cast<int64_t>(statistics.PackageCount));
+        SQLite::MetadataTable::SetNamedValue(connection, s_MetadataValueName_VersionCount, static_cast<int64_t>(statistics.VersionCount));
+    }
+
+    void ISQLiteIndex::UpdateCachedStatistics(const SQLite::Connection& connection, int64_t packageDelta, int64_t versionDelta)
+    {
+        std::optional<Statistics> cached = TryGetCachedStatistics(connection);
+
+        if (cached)
+        {
+            cached->PackageCount = static_cast<uint64_t>(static_cast<int64_t>(cached->PackageCount) + packageDelta);
+            cached->VersionCount = static_cast<uint64_t>(static_cast<int64_t>(cached->VersionCount) + versionDelta);
+            SetCachedStatistics(connection, cached.value());
+        }
+    }
+
     std::unique_ptr<ISQLiteIndex> CreateISQLiteIndex(const SQLite::Version& version)
     {
         if (version.MajorVersion == 1 ||
@@ -49,9 +112,10 @@ namespace AppInstaller::Repository::Microsoft::Schema
         // Unless it is prepared for packaging, it will be identical to a 1.N index.
         if (version.MajorVersion == 2)
         {
-            constexpr std::array<std::unique_ptr<ISQLiteIndex>(*)(), 1> versionCreatorMap =
+            constexpr std::array<std::unique_ptr<ISQLiteIndex>(*)(), 2> versionCreatorMap =
             {
                 []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V2_0::Interface>()); },
+                []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V2_1::Interface>()); },
             };
 
             return versionCreatorMap[std::min(static_cast<size_t>(version.MinorVersion), versionCreatorMap.size() - 1)]();
@@ -9,7 +9,9 @@
 #include <winget/Manifest.h>
 #include <winget/NameNormalization.h>
 
+#include <chrono>
 #include <filesystem>
+#include <map>
 #include <optional>
 
 
@@ -22,6 +24,39 @@ namespace AppInstaller::Repository::Microsoft::Schema
         SQLiteIndexContextData& Data;
     };
 
+    // Tracks the time budget of a search request; a zero budget never expires.
+    struct SearchBudget
+    {
+        SearchBudget(std::chrono::milliseconds budget)
+        {
+            if (budget != std::chrono::milliseconds::zero())
+            {
+                m_deadline = std::chrono::steady_clock::now() + budget;
+            }
+        }
+
+        // Determines whether the budget has expired; once expired, it stays expired.
+        bool IsExhausted()
+        {
+            if (!m_exhausted && std::chrono::steady_clock::now() >= m_deadline)
+            {
+                m_exhausted = true;
+            }
+
+            return m_exhausted;
+        }
+
+        // Gets whether the budget was ever seen as expired, without checking the clock again.
+        bool WasExhausted() const
+        {
+            return m_exhausted;
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_deadline = std::chrono::steady_clock::time_point::max();
+        bool m_exhausted = false;
+    };
+
     // The common interface used to interact with all schema versions of the index.
     struct ISQLiteIndex
     {
@@ -38,6 +73,15 @@ namespace AppInstaller::Repository::Microsoft::Schema
         // The non-version specific return value of GetMetadataByManifestId.
         using MetadataResult = std::vector<std::pair<PackageVersionMetadata, std::string>>;
 
+        // Summary statistics describing the contents of the index.
+        struct Statistics
+        {
+            // The number of distinct packages.
+            uint64_t PackageCount = 0;
+            // The total number of versions across all packages.
+            uint64_t VersionCount = 0;
+        };
+
         // Version 1.0
 
         // Gets the schema version that this index interface is built for.
@@ -106,6 +150,11 @@ namespace AppInstaller::Repository::Microsoft::Schema
         // Gets the string values for the given property and primary id, if present.
         virtual std::vector<std::string> GetMultiPropertyByPrimaryId(const SQLite::Connection& connection, SQLite::rowid_t primaryId, PackageVersionMultiProperty property) const = 0;
 
+        // Gets the string values for the given property for each of the given primary ids, grouped by primary id.
+        // Primary ids that have no values are not present in the result.
+        // The default implementation queries each primary id individually; schema versions that can batch the reads override it.
+        virtual std::map<SQLite::rowid_t, std::vector<std::string>> GetMultiPropertyByPrimaryIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& primaryIds, PackageVersionMultiProperty property) const;
+
         // Gets the manifest id for the given { id, version, channel }, if present.
         // If version is empty, gets the value for the 'latest' version.
         virtual std::optional<SQLite::rowid_t> GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const = 0;
@@ -137,6 +186,9 @@ namespace AppInstaller::Repository::Microsoft::Schema
 
         virtual std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const = 0;
 
+        // Gets the transitive dependency closure of the given manifests with a single recursive query.
+        virtual std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const = 0;
+
         // Version 1.7
 
         // Drops all tables that would have been created.
@@ -151,6 +203,24 @@ namespace AppInstaller::Repository::Microsoft::Schema
 
         // Set the property value.
         virtual void SetProperty(SQLite::Connection& connection, Property property, const std::string& value);
+
+        // Statistics
+
+        // Gets summary statistics for the index contents without performing a search.
+        // Values cached in the metadata table are used when present; otherwise the counts
+        // are computed directly and cached on a best effort basis.
+        virtual Statistics GetStatistics(const SQLite::Connection& connection) const = 0;
+
+    protected:
+        // Reads the statistics cached in the metadata table, if present.
+        static std::optional<Statistics> TryGetCachedStatistics(const SQLite::Connection& connection);
+
+        // Caches the given statistics in the metadata table.
+        static void SetCachedStatistics(const SQLite::Connection& connection, const Statistics& statistics);
+
+        // Applies the given deltas to the statistics cached in the metadata table, if present.
+        // Write operations use this to keep the cache accurate without recounting.
+        static void UpdateCachedStatistics(const SQLite::Connection& connection, int64_t packageDelta, int64_t versionDelta);
     };
 
     DEFINE_ENUM_FLAG_OPERATORS(ISQLiteIndex::CreateOptions);
@@ -107,6 +107,50 @@ namespace AppInstaller::Repository
         std::vector<ValidationError> dependenciesError;
         bool foundErrors = false;
 
+        // The graph evaluates independent nodes on concurrent threads; the index serializes
+        // its own access, but the error state and resolution caches need their own guards.
+        std::mutex resultsLock;
+        std::mutex cacheLock;
+        // The same package is often a dependency of several nodes (possibly with different
+        // minimum versions), so resolve each package against the index only once.
+        std::map<Manifest::string_t, std::optional<SQLiteIndex::VersionKey>> latestVersionCache;
+        std::map<SQLite::rowid_t, Manifest::string_t> packageIdCache;
+
+        auto getLatestVersion = [&](const Manifest::string_t& packageId)
+        {
+            {
+                std::lock_guard<std::mutex> lock{ cacheLock };
+                auto itr = latestVersionCache.find(packageId);
+                if (itr != latestVersionCache.end())
+                {
+                    return itr->second;
+                }
+            }
+
+            auto packageLatest = GetPackageLatestVersion(index, packageId);
+
+            std::lock_guard<std::mutex> lock{ cacheLock };
+            return latestVersionCache.emplace(packageId, std::move(packageLatest)).first->second;
+        };
+
+        auto getPackageId = [&](SQLite::rowid_t packageRowId)
+        {
+            {
+                std::lock_guard<std::mutex> lock{ cacheLock };
+                auto itr = packageIdCache.find(packageRowId);
+                if (itr != packageIdCache.end())
+                {
+                    return itr->second;
+                }
+            }
+
+            auto manifestRowId = index->GetManifestIdByKey(packageRowId, "", "");
+            auto packageId = index->GetPropertyByPrimaryId(manifestRowId.value(), PackageVersionProperty::Id);
+
+            std::lock_guard<std::mutex> lock{ cacheLock };
+            return packageIdCache.emplace(packageRowId, std::move(packageId).value()).first->second;
+        };
+
         DependencyGraph graph
         {
             rootId,
@@ -118,9 +162,10 @@ namespace AppInstaller::Repository
                     return GetDependencies(manifest, DependencyType::Package);
                 }
 
-                auto packageLatest = GetPackageLatestVersion(index, node.Id());
+                auto packageLatest = getLatestVersion(node.Id());
                 if (!packageLatest.has_value())
                 {
+                    std::lock_guard<std::mutex> lock{ resultsLock };
                     dependenciesError.emplace_back(
                         ManifestError::MissingManifestDependenciesNode, "PackageIdentifier", node.Id());
                     foundErrors = true;
@@ -129,6 +174,7 @@ namespace AppInstaller::Repository
 
                 if (node.MinVersion > packageLatest->VersionAndChannel.GetVersion())
                 {
+                    std::lock_guard<std::mutex> lock{ resultsLock };
                     dependenciesError.emplace_back(ManifestError::NoSuitableMinVersionDependency, "PackageIdentifier", node.Id());
                     foundErrors = true;
                     return depList;
@@ -140,9 +186,7 @@ namespace AppInstaller::Repository
                     packageLatestDependencies.end(),
                     [&](std::pair<SQLite::rowid_t, Utility::NormalizedString> row)
                     {
-                        auto manifestRowId = index->GetManifestIdByKey(row.first, "", "");
-                        auto packageId = index->GetPropertyByPrimaryId(manifestRowId.value(), PackageVersionProperty::Id);
-                        Dependency dep(DependencyType::Package, packageId.value(), row.second);
+                        Dependency dep(DependencyType::Package, getPackageId(row.first), row.second);
                         depList.Add(dep);
                     });
 
@@ -150,7 +194,7 @@ namespace AppInstaller::Repository
             }
         };
 
-        graph.BuildGraph();
+        graph.BuildGraph(true);
 
         if (foundErrors)
         {
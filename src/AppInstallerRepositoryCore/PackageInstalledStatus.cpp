@@ -12,17 +12,28 @@ namespace AppInstaller::Repository
 {
     namespace
     {
-        HRESULT CheckInstalledLocationStatus(const std::filesystem::path& installedLocation)
+        // Map to cache already determined install location statuses.
+        using InstalledLocationStatusMap = std::map<std::filesystem::path, HRESULT>;
+
+        HRESULT CheckInstalledLocationStatus(const std::filesystem::path& installedLocation, InstalledLocationStatusMap& locationStatuses)
         {
             HRESULT installLocationStatus = WINGET_INSTALLED_STATUS_INSTALL_LOCATION_NOT_APPLICABLE;
             if (!installedLocation.empty())
             {
+                auto itr = locationStatuses.find(installedLocation);
+                if (itr != locationStatuses.end())
+                {
+                    return itr->second;
+                }
+
                 // Use the none throw version, if the directory cannot be reached, it's treated as not found and later file checks are not performed.
                 std::error_code error;
                 installLocationStatus =
                     std::filesystem::exists(installedLocation, error) && std::filesystem::is_directory(installedLocation, error) ?
                     WINGET_INSTALLED_STATUS_INSTALL_LOCATION_FOUND :
                     WINGET_INSTALLED_STATUS_INSTALL_LOCATION_NOT_FOUND;
+
+                locationStatuses.emplace(installedLocation, installLocationStatus);
             }
 
             return installLocationStatus;
@@ -43,6 +54,13 @@ namespace AppInstaller::Repository
         };
         using FileHashMap = std::map<std::filesystem::path, Utility::SHA256::HashBuffer, FilePathComparator>;
 
+        // File system evidence shared across all of the packages in a batched check.
+        struct InstalledStatusCheckContext
+        {
+            FileHashMap FileHashes;
+            InstalledLocationStatusMap LocationStatuses;
+        };
+
         HRESULT CheckInstalledFileStatus(
             const std::filesystem::path& filePath,
             const Utility::SHA256::HashBuffer& expectedHash,
@@ -79,7 +97,8 @@ namespace AppInstaller::Repository
 
         std::vector<InstallerInstalledStatus> CheckInstalledStatusInternal(
             const std::shared_ptr<ICompositePackage>& package,
-            InstalledStatusType checkTypes)
+            InstalledStatusType checkTypes,
+            InstalledStatusCheckContext& context)
         {
             using namespace AppInstaller::Manifest;
 
@@ -87,7 +106,6 @@ namespace AppInstaller::Repository
             bool checkFileHash = false;
             std::shared_ptr<IPackageVersion> installedVersion = GetInstalledVersion(package);
             std::shared_ptr<IPackageVersion> availableVersion;
-            FileHashMap fileHashes;
 
             // Variables for metadata from installed version.
             InstallerTypeEnum installedType = InstallerTypeEnum::Unknown;
@@ -111,7 +129,7 @@ namespace AppInstaller::Repository
                 installedLocation = Filesystem::GetExpandedPath(installedMetadata[PackageVersionMetadata::InstalledLocation]);
                 installedLocale = installedMetadata[PackageVersionMetadata::InstalledLocale];
                 installedArchitecture = Utility::ConvertToArchitectureEnum(installedMetadata[PackageVersionMetadata::InstalledArchitecture]);
-                installedLocationStatus = CheckInstalledLocationStatus(installedLocation);
+                installedLocationStatus = CheckInstalledLocationStatus(installedLocation, context.LocationStatuses);
 
                 // Determine available version.
                 Utility::Version installedVersionAsVersion{ installedVersion->GetProperty(PackageVersionProperty::Version) };
@@ -188,7 +206,7 @@ namespace AppInstaller::Repository
                         for (auto const& file : installer.InstallationMetadata.Files)
                         {
                             std::filesystem::path filePath = installedLocation / Utility::ConvertToUTF16(file.RelativeFilePath);
-                            auto fileStatus = CheckInstalledFileStatus(filePath, checkFileHash ? file.FileSha256 : Utility::SHA256::HashBuffer{}, fileHashes);
+                            auto fileStatus = CheckInstalledFileStatus(filePath, checkFileHash ? file.FileSha256 : Utility::SHA256::HashBuffer{}, context.FileHashes);
 
                             installerStatus.Status.emplace_back(
                                 InstalledStatusType::AppsAndFeaturesEntryInstallLocationFile,
@@ -202,7 +220,7 @@ namespace AppInstaller::Repository
                 if (WI_IsAnyFlagSet(checkTypes, InstalledStatusType::AllDefaultInstallLocationChecks) && installer.InstallationMetadata.HasData())
                 {
                     auto defaultInstalledLocation = Filesystem::GetExpandedPath(installer.InstallationMetadata.DefaultInstallLocation);
-                    HRESULT defaultInstalledLocationStatus = CheckInstalledLocationStatus(defaultInstalledLocation);
+                    HRESULT defaultInstalledLocationStatus = CheckInstalledLocationStatus(defaultInstalledLocation, context.LocationStatuses);
 
                     // Default install location status
                     if (WI_IsFlagSet(checkTypes, InstalledStatusType::DefaultInstallLocation))
@@ -220,7 +238,7 @@ namespace AppInstaller::Repository
                         for (auto const& file : installer.InstallationMetadata.Files)
                         {
                             std::filesystem::path filePath = defaultInstalledLocation / Utility::ConvertToUTF16(file.RelativeFilePath);
-                            auto fileStatus = CheckInstalledFileStatus(filePath, checkFileHash ? file.FileSha256 : Utility::SHA256::HashBuffer{}, fileHashes);
+                            auto fileStatus = CheckInstalledFileStatus(filePath, checkFileHash ? file.FileSha256 : Utility::SHA256::HashBuffer{}, context.FileHashes);
 
                             installerStatus.Status.emplace_back(
                                 InstalledStatusType::DefaultInstallLocationFile,
@@ -242,6 +260,24 @@ namespace AppInstaller::Repository
 
     std::vector<InstallerInstalledStatus> CheckPackageInstalledStatus(const std::shared_ptr<ICompositePackage>& package, InstalledStatusType checkTypes)
     {
-        return CheckInstalledStatusInternal(package, checkTypes);
+        InstalledStatusCheckContext context;
+        return CheckInstalledStatusInternal(package, checkTypes, context);
+    }
+
+    std::vector<std::vector<InstallerInstalledStatus>> CheckPackageInstalledStatus(const std::vector<std::shared_ptr<ICompositePackage>>& packages, InstalledStatusType checkTypes)
+    {
+        // Packages frequently share install locations and files (suites, shared runtimes);
+        // one context across the batch means each directory and file is inspected once.
+        InstalledStatusCheckContext context;
+
+        std::vector<std::vector<InstallerInstalledStatus>> result;
+        result.reserve(packages.size());
+
+        for (const auto& package : packages)
+        {
+            result.emplace_back(CheckInstalledStatusInternal(package, checkTypes, context));
+        }
+
+        return result;
     }
 }
@@ -52,7 +52,20 @@ namespace AppInstaller::Repository
                 {
                     // TODO: Check schema version and upgrade as necessary when there is a relevant new schema.
                     //       Could write this all now but it will be better tested when there is a new schema.
-                    return SQLiteIndex::Open(trackingDB.u8string(), SQLiteIndex::OpenDisposition::ReadWrite);
+                    SQLiteIndex result = SQLiteIndex::Open(trackingDB.u8string(), SQLiteIndex::OpenDisposition::ReadWrite);
+
+                    // Uninstall records leave free pages behind and the file never shrinks on its
+                    // own; compact it once a quarter of it is unused so that its size tracks the
+                    // live install history rather than everything ever recorded.
+                    constexpr double c_freePageRatioForCompaction = 0.25;
+                    double freePageRatio = result.GetFreePageRatio();
+                    if (freePageRatio > c_freePageRatioForCompaction)
+                    {
+                        AICLI_LOG(Repo, Info, << "Compacting tracking catalog; free page ratio was " << freePageRatio);
+                        result.Vacuum();
+                    }
+
+                    return result;
                 }
                 catch(...)
                 {
@@ -151,7 +164,27 @@ namespace AppInstaller::Repository
 
     struct PackageTrackingCatalog::implementation
     {
-        std::shared_ptr<Microsoft::SQLiteIndexSource> Source;
+        // The catalog is created for a source before we know whether the flow will actually
+        // touch it; opening (and potentially creating) the database is deferred to first use
+        // to keep it off the critical path of flows that never read or write tracking data.
+        std::shared_ptr<Microsoft::SQLiteIndexSource> GetSource()
+        {
+            std::lock_guard<std::mutex> lock{ m_sourceLock };
+
+            if (!m_source)
+            {
+                ProgressCallback dummyProgress;
+                m_source = SourceCast<SQLiteIndexSource>(ISourceFactory::GetForType(Details.Type)->Create(Details)->Open(dummyProgress));
+            }
+
+            return m_source;
+        }
+
+        SourceDetails Details;
+
+    private:
+        std::mutex m_sourceLock;
+        std::shared_ptr<Microsoft::SQLiteIndexSource> m_source;
     };
 
     PackageTrackingCatalog::PackageTrackingCatalog() = default;
@@ -178,11 +211,9 @@ namespace AppInstaller::Repository
         details.Origin = SourceOrigin::PackageTracking;
         details.Data = sourceIdentifier;
 
-        ProgressCallback dummyProgress;
-
         PackageTrackingCatalog result;
         result.m_implementation = std::make_shared<PackageTrackingCatalog::implementation>();
-        result.m_implementation->Source = SourceCast<SQLiteIndexSource>(ISourceFactory::GetForType(details.Type)->Create(details)->Open(dummyProgress));
+        result.m_implementation->Details = std::move(details);
 
         return result;
     }
@@ -211,7 +242,7 @@ namespace AppInstaller::Repository
 
     SearchResult PackageTrackingCatalog::Search(const SearchRequest& request) const
     {
-        return m_implementation->Source->Search(request);
+        return m_implementation->GetSource()->Search(request);
     }
 
     struct PackageTrackingCatalog::Version::implementation
@@ -230,7 +261,7 @@ namespace AppInstaller::Repository
 
     void PackageTrackingCatalog::Version::SetMetadata(PackageVersionMetadata metadata, const Utility::NormalizedString& value)
     {
-        auto& index = m_catalog->m_implementation->Source->GetIndex();
+        auto& index = m_catalog->m_implementation->GetSource()->GetIndex();
         index.SetMetadataByManifestId(m_implementation->Id, metadata, value);
     }
 
@@ -242,7 +273,10 @@ namespace AppInstaller::Repository
         // TODO: Store additional information from these if needed
         UNREFERENCED_PARAMETER(isUpgrade);
 
-        auto& index = m_implementation->Source->GetIndex();
+        auto& index = m_implementation->GetSource()->GetIndex();
+
+        // Commit all of the tracking writes for this install as one transaction.
+        SQLite::Savepoint savepoint = index.CreateSavepoint("packagetracking_recordinstall");
 
         // Strip ARP version information from the manifest if it is present
         for (auto& arpRangeRemovedInstaller : manifest.Installers)
@@ -284,6 +318,8 @@ namespace AppInstaller::Repository
             index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledLocale, installer.Locale);
         }
 
+        savepoint.Commit();
+
         std::shared_ptr<Version::implementation> result = std::make_shared<Version::implementation>();
         result->Id = manifestId;
         return { *this, std::move(result) };
@@ -291,12 +327,15 @@ namespace AppInstaller::Repository
 
     void PackageTrackingCatalog::RecordUninstall(const Utility::LocIndString& packageIdentifier)
     {
-        auto& index = m_implementation->Source->GetIndex();
+        auto& index = m_implementation->GetSource()->GetIndex();
 
         SearchRequest idSearch;
         idSearch.Filters.emplace_back(PackageMatchField::Id, MatchType::CaseInsensitive, packageIdentifier.get());
         auto searchResult = index.Search(idSearch);
 
+        // Commit the removal of all versions as one transaction.
+        SQLite::Savepoint savepoint = index.CreateSavepoint("packagetracking_recorduninstall");
+
         for (const auto& match : searchResult.Matches)
         {
             auto versions = index.GetVersionKeysById(match.first);
@@ -306,12 +345,14 @@ namespace AppInstaller::Repository
                 index.RemoveManifestById(version.ManifestId);
             }
         }
+
+        savepoint.Commit();
     }
 
 #ifndef AICLI_DISABLE_TEST_HOOKS
     std::filesystem::path PackageTrackingCatalog::GetFilePath() const
     {
-        return m_implementation->Source->GetIndex().GetContextData().Get<Schema::Property::DatabaseFilePath>();
+        return m_implementation->GetSource()->GetIndex().GetContextData().Get<Schema::Property::DatabaseFilePath>();
     }
 #endif
 
@@ -157,6 +157,12 @@ namespace AppInstaller::Repository
     }
 
     LatestApplicableVersionData GetLatestApplicableVersion(const std::shared_ptr<ICompositePackage>& composite)
+    {
+        Pinning::PinningData pinningData{ Pinning::PinningData::Disposition::ReadOnly };
+        return GetLatestApplicableVersion(composite, pinningData);
+    }
+
+    LatestApplicableVersionData GetLatestApplicableVersion(const std::shared_ptr<ICompositePackage>& composite, Pinning::PinningData& pinningData)
     {
         using namespace AppInstaller::Pinning;
 
@@ -165,7 +171,6 @@ namespace AppInstaller::Repository
         auto installedVersion = AppInstaller::Repository::GetInstalledVersion(composite);
         auto availableVersions = AppInstaller::Repository::GetAvailableVersionsForInstalledVersion(composite, installedVersion);
 
-        PinningData pinningData{ PinningData::Disposition::ReadOnly };
         auto evaluator = pinningData.CreatePinStateEvaluator(PinBehavior::ConsiderPins, installedVersion);
 
         AppInstaller::Manifest::ManifestComparator::Options options;
@@ -85,12 +85,14 @@ namespace AppInstaller::Pinning
     {
         THROW_HR_IF(E_NOT_VALID_STATE, !IsDatabaseConnected());
         m_database->AddOrUpdatePin(pin);
+        m_evaluationPins.reset();
     }
 
     void PinningData::RemovePin(const PinKey& pinKey)
     {
         THROW_HR_IF(E_NOT_VALID_STATE, !IsDatabaseConnected());
         m_database->RemovePin(pinKey);
+        m_evaluationPins.reset();
     }
 
     std::optional<Pin> PinningData::GetPin(const PinKey& pinKey)
@@ -106,14 +108,15 @@ namespace AppInstaller::Pinning
     bool PinningData::ResetAllPins(std::string_view sourceId)
     {
         THROW_HR_IF(E_NOT_VALID_STATE, !IsDatabaseConnected());
+        m_evaluationPins.reset();
         return m_database->ResetAllPins(sourceId);
     }
 
     PinningData::PinStateEvaluator::PinStateEvaluator(
         PinBehavior behavior,
-        std::shared_ptr<PinningIndex> database,
+        std::shared_ptr<const std::map<PinKey, Pin>> pins,
         const std::shared_ptr<IPackageVersion>& installedVersion) :
-        m_behavior(behavior), m_database(std::move(database))
+        m_behavior(behavior), m_pins(std::move(pins))
     {
         if (m_behavior == PinBehavior::IgnorePins || !installedVersion)
         {
@@ -121,12 +124,16 @@ namespace AppInstaller::Pinning
             // Also do not consider pins when there is no installed version. This is to remain consistent with the previous
             // implementation. If this is to be changed, more install paths will need to be do pinning checks to ensure
             // that one could, for instance, block the install of a package.
-            m_database.reset();
+            m_pins.reset();
         }
-        else if (m_database)
+        else if (m_pins)
         {
             PinKey key = PinKey::GetPinKeyForInstalled(installedVersion->GetProperty(PackageVersionProperty::Id));
-            m_installedPin = m_database->GetPin(key);
+            auto itr = m_pins->find(key);
+            if (itr != m_pins->end())
+            {
+                m_installedPin = itr->second;
+            }
         }
 
         if (installedVersion)
@@ -147,7 +154,7 @@ namespace AppInstaller::Pinning
 
     std::shared_ptr<IPackageVersion> PinningData::PinStateEvaluator::GetLatestAvailableVersionForPins(const std::shared_ptr<IPackageVersionCollection>& package)
     {
-        if (!m_database)
+        if (!m_pins)
         {
             return package->GetLatestVersion();
         }
@@ -184,7 +191,7 @@ namespace AppInstaller::Pinning
 
     PinType PinningData::PinStateEvaluator::EvaluatePinType(const std::shared_ptr<AppInstaller::Repository::IPackageVersion>& packageVersion)
     {
-        if (!m_database || !packageVersion)
+        if (!m_pins || !packageVersion)
         {
             return PinType::Unknown;
         }
@@ -192,13 +199,8 @@ namespace AppInstaller::Pinning
         std::optional<Pin> incomingPin;
 
         PinKey pinKey{ packageVersion->GetProperty(PackageVersionProperty::Id).get(), packageVersion->GetSource().GetIdentifier()};
-        auto itr = m_availablePins.find(pinKey);
-        if (itr == m_availablePins.end())
-        {
-            incomingPin = m_database->GetPin(pinKey);
-            m_availablePins[pinKey] = incomingPin;
-        }
-        else
+        auto itr = m_pins->find(pinKey);
+        if (itr != m_pins->end())
         {
             incomingPin = itr->second;
         }
@@ -206,11 +208,41 @@ namespace AppInstaller::Pinning
         return GetPinnedStateForVersion(packageVersion->GetProperty(PackageVersionProperty::Version).get(), incomingPin, m_installedPin, m_behavior);
     }
 
+    std::shared_ptr<const std::map<PinKey, Pin>> PinningData::GetPinsForEvaluation()
+    {
+        if (!IsDatabaseConnected())
+        {
+            return {};
+        }
+
+        if (!m_evaluationPins)
+        {
+            // Load the entire set of pins with a single query; there are typically only a handful of them,
+            // while evaluators can be created for every package in a large upgrade candidate set.
+            std::map<PinKey, Pin> pins;
+            for (auto& pin : m_database->GetAllPins())
+            {
+                PinKey key = pin.GetKey();
+                pins.emplace(std::move(key), std::move(pin));
+            }
+
+            m_evaluationPins = std::make_shared<const std::map<PinKey, Pin>>(std::move(pins));
+        }
+
+        return m_evaluationPins;
+    }
+
     // Creates an object for use in evaluating pinning data for a given package
     PinningData::PinStateEvaluator PinningData::CreatePinStateEvaluator(
         PinBehavior behavior,
         const std::shared_ptr<IPackageVersion>& installedVersion)
     {
-        return { behavior, m_database, installedVersion };
+        // The evaluator will not use the pins in these cases, so don't bother loading them.
+        if (behavior == PinBehavior::IgnorePins || !installedVersion)
+        {
+            return { behavior, {}, installedVersion };
+        }
+
+        return { behavior, GetPinsForEvaluation(), installedVersion };
     }
 }
@@ -8,6 +8,9 @@
 #include <winget/RepositorySearch.h>
 #include <winget/RepositorySource.h>
 
+#include <map>
+#include <mutex>
+
 namespace AppInstaller::Repository::Correlation
 {
     struct EmptyMatchConfidenceAlgorithm : public IARPMatchConfidenceAlgorithm
@@ -42,8 +45,15 @@ namespace AppInstaller::Repository::Correlation
         WordSequence NormalizeAndPrepareName(std::string_view name) const;
         WordSequence NormalizeAndPreparePublisher(std::string_view publisher) const;
 
+        // Gets the prepared word sequences for an ARP entry, normalizing on first use.
+        // The same ARP entries are correlated against every manifest in a run, so the
+        // prepared forms are cached per (name, publisher) to skip repeat normalization.
+        const NameAndPublisher& GetPreparedARPEntry(std::string_view name, std::string_view publisher) const;
+
         AppInstaller::Utility::NameNormalizer m_normalizer{ AppInstaller::Utility::NormalizationVersion::InitialPreserveWhiteSpace };
         std::vector<NameAndPublisher> m_namesAndPublishers;
+        mutable std::mutex m_arpEntryCacheLock;
+        mutable std::map<std::pair<std::string, std::string>, NameAndPublisher> m_arpEntryCache;
 
         // Parameters for the algorithm
 
@@ -54,6 +54,28 @@ namespace AppInstaller::Checkpoints
             m_checkpointDatabase->SetDataValue(m_checkpointId, dataType, fieldName, values);
         }
 
+        // A field value to be written; used to batch multiple writes into one transaction.
+        struct FieldValue
+        {
+            T dataType;
+            std::string fieldName;
+            std::vector<std::string> values;
+        };
+
+        // Sets all of the given field values within a single database transaction.
+        void SetAll(const std::vector<FieldValue>& fieldValues)
+        {
+            std::vector<CheckpointDatabase::DataValue> dataValues;
+            dataValues.reserve(fieldValues.size());
+
+            for (const FieldValue& fieldValue : fieldValues)
+            {
+                dataValues.push_back({ static_cast<int>(fieldValue.dataType), fieldValue.fieldName, fieldValue.values });
+            }
+
+            m_checkpointDatabase->SetDataValues(m_checkpointId, dataValues);
+        }
+
         // Update a single existing field value for a data type.
         void Update(T dataType, const std::string& fieldName, const std::string& value)
         {
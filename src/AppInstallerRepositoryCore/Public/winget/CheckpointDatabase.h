@@ -17,6 +17,14 @@ namespace AppInstaller::Repository::Microsoft
         // An id that refers to a specific Checkpoint.
         using IdType = SQLite::rowid_t;
 
+        // A single field write; used to batch multiple writes into one transaction.
+        struct DataValue
+        {
+            int dataType;
+            std::string field;
+            std::vector<std::string> values;
+        };
+
         CheckpointDatabase(const CheckpointDatabase&) = delete;
         CheckpointDatabase& operator=(const CheckpointDatabase&) = delete;
 
@@ -50,6 +58,9 @@ namespace AppInstaller::Repository::Microsoft
         // Sets the value(s) for a data type and field.
         void SetDataValue(IdType checkpointId, int dataType, const std::string& field, const std::vector<std::string>& values);
 
+        // Sets all of the given values within a single transaction.
+        void SetDataValues(IdType checkpointId, const std::vector<DataValue>& values);
+
         // Updates the value(s) for a data type and field.
         void UpdateDataValue(IdType checkpointId, int dataType, const std::string& field, const std::vector<std::string>& values);
 
@@ -61,4 +61,8 @@ namespace AppInstaller::Repository
 
     // Checks installed status of a package.
     std::vector<InstallerInstalledStatus> CheckPackageInstalledStatus(const std::shared_ptr<ICompositePackage>& package, InstalledStatusType checkTypes = InstalledStatusType::AllChecks);
+
+    // Checks installed status of multiple packages, sharing file system evidence across the batch.
+    // The result is ordered the same as the input packages.
+    std::vector<std::vector<InstallerInstalledStatus>> CheckPackageInstalledStatus(const std::vector<std::shared_ptr<ICompositePackage>>& packages, InstalledStatusType checkTypes = InstalledStatusType::AllChecks);
 }
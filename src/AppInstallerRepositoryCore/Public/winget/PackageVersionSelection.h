@@ -3,6 +3,7 @@
 #pragma once
 #include <winget/RepositorySearch.h>
 #include <winget/ManifestComparator.h>
+#include <winget/PinningData.h>
 
 
 namespace AppInstaller::Repository
@@ -36,6 +37,11 @@ namespace AppInstaller::Repository
     // Determines the default install version and whether an update is available.
     LatestApplicableVersionData GetLatestApplicableVersion(const std::shared_ptr<ICompositePackage>& composite);
 
+    // Determines the default install version and whether an update is available, using the given
+    // pinning data. Callers evaluating many packages should create the pinning data once and pass
+    // it to each call so that the pin lookup is built once rather than once per package.
+    LatestApplicableVersionData GetLatestApplicableVersion(const std::shared_ptr<ICompositePackage>& composite, Pinning::PinningData& pinningData);
+
     // Fills the options from the given metadata, optionally including the allowed architectures.
     void GetManifestComparatorOptionsFromMetadata(AppInstaller::Manifest::ManifestComparator::Options& options, const IPackageVersion::Metadata& metadata, bool includeAllowedArchitectures = true);
 
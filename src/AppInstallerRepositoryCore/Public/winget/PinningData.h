@@ -67,7 +67,7 @@ namespace AppInstaller::Pinning
         {
             PinStateEvaluator(
                 PinBehavior behavior,
-                std::shared_ptr<AppInstaller::Repository::Microsoft::PinningIndex> database,
+                std::shared_ptr<const std::map<PinKey, Pin>> pins,
                 const std::shared_ptr<AppInstaller::Repository::IPackageVersion>& installedVersion);
 
             PinStateEvaluator(const PinStateEvaluator&);
@@ -90,11 +90,10 @@ namespace AppInstaller::Pinning
 
         private:
             PinBehavior m_behavior;
-            std::shared_ptr<AppInstaller::Repository::Microsoft::PinningIndex> m_database;
+            // All pins, loaded once by the owning PinningData and shared across evaluators.
+            std::shared_ptr<const std::map<PinKey, Pin>> m_pins;
             std::optional<Pin> m_installedPin;
             std::optional<Utility::VersionAndChannel> m_installedVersion;
-            // Cache pins for available version to reduce database lookups.
-            std::map<PinKey, std::optional<Pin>> m_availablePins;
         };
 
         // Creates an object for use in evaluating pinning data for a given package
@@ -103,6 +102,11 @@ namespace AppInstaller::Pinning
             const std::shared_ptr<AppInstaller::Repository::IPackageVersion>& installedVersion);
 
     private:
+        // Gets the pins for use by evaluators, reading them from the database on the first call.
+        std::shared_ptr<const std::map<PinKey, Pin>> GetPinsForEvaluation();
+
         std::shared_ptr<AppInstaller::Repository::Microsoft::PinningIndex> m_database;
+        // All pins in the database, loaded once and shared with the evaluators created from this object.
+        std::shared_ptr<const std::map<PinKey, Pin>> m_evaluationPins;
     };
 }
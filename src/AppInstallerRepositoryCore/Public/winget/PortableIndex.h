@@ -42,6 +42,12 @@ namespace AppInstaller::Repository::Microsoft
 
         void AddOrUpdatePortableFile(const Portable::PortableFileEntry& file);
 
+        // Adds or updates all of the given files within a single transaction.
+        void AddOrUpdatePortableFiles(const std::vector<Portable::PortableFileEntry>& files);
+
+        // Removes all of the given files within a single transaction.
+        void RemovePortableFiles(const std::vector<Portable::PortableFileEntry>& files);
+
         std::vector<Portable::PortableFileEntry> GetAllPortableFiles();
 
         bool Exists(const Portable::PortableFileEntry& file);
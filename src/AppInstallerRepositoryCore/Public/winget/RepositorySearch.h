@@ -4,9 +4,11 @@
 #include <AppInstallerErrors.h>
 #include <AppInstallerStrings.h>
 #include <AppInstallerVersions.h>
+#include <winget/InternedString.h>
 #include <winget/LocIndependent.h>
 #include <winget/Manifest.h>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <optional>
@@ -130,6 +132,11 @@ namespace AppInstaller::Repository
         // The default of 0 will place no limit.
         size_t MaximumResults{};
 
+        // The maximum time the search may spend gathering results.
+        // The default of 0 will place no limit; when the budget expires, the matches
+        // found so far are returned with the result marked as truncated.
+        std::chrono::milliseconds TimeBudget{};
+
         // Returns a value indicating whether this request is for all available data.
         bool IsForEverything() const;
 
@@ -251,11 +258,12 @@ namespace AppInstaller::Repository
     {
         PackageVersionKey() = default;
 
-        PackageVersionKey(std::string sourceId, Utility::NormalizedString version, Utility::NormalizedString channel) :
-            SourceId(std::move(sourceId)), Version(std::move(version)), Channel(std::move(channel)) {}
+        PackageVersionKey(std::string_view sourceId, Utility::NormalizedString version, Utility::NormalizedString channel) :
+            SourceId(sourceId), Version(std::move(version)), Channel(std::move(channel)) {}
 
         // The source id that this version came from.
-        std::string SourceId;
+        // Interned because the same id is repeated across every version of every package from a source.
+        Utility::InternedString SourceId;
 
         // The version.
         Utility::NormalizedString Version;
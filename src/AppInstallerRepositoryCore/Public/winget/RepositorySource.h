@@ -14,6 +14,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 
@@ -314,6 +315,12 @@ namespace AppInstaller::Repository
         // Execute a search on the source.
         SearchResult Search(const SearchRequest& request) const;
 
+        // Interrupts a search currently executing on the source for the given operation,
+        // identified by the id of the thread on which the operation began. Searches run
+        // for other operations are unaffected, as the underlying source may be shared
+        // across independent operations. Sources that cannot be interrupted do nothing.
+        void InterruptSearches(std::thread::id operationId) const;
+
         /* Source agreements */
 
         // Get required agreement fields info.
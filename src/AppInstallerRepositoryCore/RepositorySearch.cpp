@@ -69,6 +69,11 @@ namespace AppInstaller::Repository
             result << " Limit:" << MaximumResults;
         }
 
+        if (TimeBudget != std::chrono::milliseconds::zero())
+        {
+            result << " Budget:" << TimeBudget.count() << "ms";
+        }
+
         return result.str();
     }
 
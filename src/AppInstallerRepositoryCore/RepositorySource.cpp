@@ -274,6 +274,51 @@ namespace AppInstaller::Repository
         private:
             std::shared_ptr<ISourceReference> m_wrapped;
         };
+
+        // Forwards cancellation from the caller's progress while dropping progress reporting.
+        // Used when multiple sources are opened concurrently, since interleaved reports from
+        // several threads would corrupt the single progress sink.
+        struct CancellationOnlyProgress : public ProgressCallback
+        {
+            CancellationOnlyProgress(IProgressCallback& base) : m_base(base) {}
+
+            bool IsCancelledBy(CancelReason cancelReasons) override { return m_base.IsCancelledBy(cancelReasons); }
+
+        private:
+            IProgressCallback& m_base;
+        };
+
+        // Refreshes the given source on a detached, background priority thread so that the
+        // current command can proceed against the stale data immediately. The refresh is best
+        // effort; if it does not complete (or the process exits first), the source is simply
+        // updated on a later invocation.
+        void StartBackgroundSourceRefresh(SourceDetails details)
+        {
+            std::thread([details = std::move(details)]() mutable
+                {
+                    try
+                    {
+                        // This work only needs to finish eventually; stay out of the way of the command.
+                        SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+
+                        AICLI_LOG(Repo, Info, << "Starting background refresh of source: " << details.Name);
+
+                        ProgressCallback progress;
+                        AddOrUpdateResult updateResult = BackgroundUpdateSourceFromDetails(details, progress);
+
+                        if (updateResult.MetadataWritten)
+                        {
+                            SourceList sourceList;
+                            auto detailsInternal = sourceList.GetSource(details.Name);
+                            detailsInternal->CopyMetadataFieldsFrom(details);
+                            sourceList.SaveMetadata(*detailsInternal);
+                        }
+
+                        AICLI_LOG(Repo, Info, << "Background refresh of source complete: " << details.Name);
+                    }
+                    CATCH_LOG();
+                }).detach();
+        }
     }
 
     std::unique_ptr<ISourceFactory> ISourceFactory::GetForType(std::string_view type)
@@ -720,12 +765,42 @@ namespace AppInstaller::Repository
         return wellKnown && wellKnown.value() == wellKnownSource;
     }
 
+    namespace
+    {
+        // The identity of the search operation the current thread is working on; empty when
+        // the thread is not running a search on behalf of an operation that began elsewhere.
+        thread_local std::thread::id t_currentSearchOperationId;
+    }
+
+    std::thread::id GetCurrentSearchOperationId()
+    {
+        return t_currentSearchOperationId == std::thread::id{} ? std::this_thread::get_id() : t_currentSearchOperationId;
+    }
+
+    SearchOperationIdScope::SearchOperationIdScope(std::thread::id operationId) : m_previous(t_currentSearchOperationId)
+    {
+        t_currentSearchOperationId = operationId;
+    }
+
+    SearchOperationIdScope::~SearchOperationIdScope()
+    {
+        t_currentSearchOperationId = m_previous;
+    }
+
     SearchResult Source::Search(const SearchRequest& request) const
     {
         THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), !m_source);
         return m_source->Search(request);
     }
 
+    void Source::InterruptSearches(std::thread::id operationId) const
+    {
+        if (m_source)
+        {
+            m_source->InterruptSearches(operationId);
+        }
+    }
+
     ImplicitAgreementFieldEnum Source::GetAgreementFieldsFromSourceInformation() const
     {
         ImplicitAgreementFieldEnum result = ImplicitAgreementFieldEnum::None;
@@ -801,7 +876,6 @@ namespace AppInstaller::Repository
         {
             std::vector<std::shared_ptr<ISourceReference>>* sourceReferencesToOpen = nullptr;
             std::vector<std::shared_ptr<ISourceReference>> sourceReferencesForTrackingOnly;
-            std::unique_ptr<SourceList> sourceList;
 
             if (m_installedPackageInformationOnly)
             {
@@ -815,47 +889,132 @@ namespace AppInstaller::Repository
             }
             else
             {
-                // Check for updates before opening.
-                for (auto& sourceReference : m_sourceReferences)
+                sourceReferencesToOpen = &m_sourceReferences;
+            }
+
+            // The per-source work (update check plus open) and its results.
+            struct OpenOutcome
+            {
+                std::optional<SourceDetails> MetadataToSave;
+                std::optional<SourceDetails> UpdateFailure;
+                std::optional<SourceDetails> DeferredUpdate;
+                std::shared_ptr<ISource> OpenedSource;
+                std::exception_ptr OpenException;
+            };
+
+            auto processReference = [&](ISourceReference& sourceReference, IProgressCallback& progressToUse, OpenOutcome& outcome)
+            {
+                if (!m_installedPackageInformationOnly && ShouldUpdateBeforeOpen(&sourceReference, m_backgroundUpdateInterval))
                 {
-                    if (ShouldUpdateBeforeOpen(sourceReference.get(), m_backgroundUpdateInterval))
-                    {
-                        auto& details = sourceReference->GetDetails();
+                    auto& details = sourceReference.GetDetails();
 
+                    if (ShouldDeferUpdateToBackground(details))
+                    {
+                        // Open the stale data now; refresh it in the background once the open completes.
+                        outcome.DeferredUpdate = details;
+                    }
+                    else
+                    {
                         try
                         {
                             // TODO: Consider adding a context callback to indicate we are doing the same action
                             // to avoid the progress bar fill up multiple times.
-                            AddOrUpdateResult updateResult = BackgroundUpdateSourceFromDetails(details, progress);
+                            AddOrUpdateResult updateResult = BackgroundUpdateSourceFromDetails(details, progressToUse);
 
                             if (updateResult.MetadataWritten)
                             {
-                                if (sourceList == nullptr)
-                                {
-                                    sourceList = std::make_unique<SourceList>();
-                                }
-
-                                auto detailsInternal = sourceList->GetSource(details.Name);
-                                detailsInternal->CopyMetadataFieldsFrom(details);
-                                sourceList->SaveMetadata(*detailsInternal);
+                                outcome.MetadataToSave = details;
                             }
 
                             if (!updateResult.UpdateChecked)
                             {
                                 AICLI_LOG(Repo, Error, << "Failed to update source: " << details.Name);
-                                result.emplace_back(details);
+                                outcome.UpdateFailure = details;
                             }
                         }
                         catch (...)
                         {
                             LOG_CAUGHT_EXCEPTION();
                             AICLI_LOG(Repo, Warning, << "Failed to update source: " << details.Name);
-                            result.emplace_back(details);
+                            outcome.UpdateFailure = details;
                         }
                     }
                 }
 
-                sourceReferencesToOpen = &m_sourceReferences;
+                try
+                {
+                    outcome.OpenedSource = sourceReference.Open(progressToUse);
+                }
+                catch (...)
+                {
+                    outcome.OpenException = std::current_exception();
+                }
+            };
+
+            std::vector<OpenOutcome> outcomes(sourceReferencesToOpen->size());
+
+            if (sourceReferencesToOpen->size() == 1)
+            {
+                processReference(*(*sourceReferencesToOpen)[0], progress, outcomes[0]);
+            }
+            else
+            {
+                // Update and open the sources concurrently so that one slow source does not
+                // serialize behind the others; outcomes keep the configured source order.
+                ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+                std::vector<std::thread> threads;
+                threads.reserve(sourceReferencesToOpen->size());
+
+                for (size_t i = 0; i < sourceReferencesToOpen->size(); ++i)
+                {
+                    threads.emplace_back([&, i]()
+                        {
+                            // Propagate the caller's thread globals so that logging from the open continues to work.
+                            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                            if (callerGlobals)
+                            {
+                                previousGlobals = callerGlobals->SetForCurrentThread();
+                            }
+
+                            CancellationOnlyProgress threadProgress{ progress };
+                            processReference(*(*sourceReferencesToOpen)[i], threadProgress, outcomes[i]);
+                        });
+                }
+
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+
+            // Save updated metadata and collect update failures on the calling thread,
+            // since SourceList is not safe to share across the workers.
+            std::unique_ptr<SourceList> sourceList;
+
+            for (OpenOutcome& outcome : outcomes)
+            {
+                if (outcome.MetadataToSave)
+                {
+                    if (sourceList == nullptr)
+                    {
+                        sourceList = std::make_unique<SourceList>();
+                    }
+
+                    auto detailsInternal = sourceList->GetSource(outcome.MetadataToSave->Name);
+                    detailsInternal->CopyMetadataFieldsFrom(*outcome.MetadataToSave);
+                    sourceList->SaveMetadata(*detailsInternal);
+                }
+
+                if (outcome.UpdateFailure)
+                {
+                    result.emplace_back(std::move(*outcome.UpdateFailure));
+                }
+
+                if (outcome.DeferredUpdate)
+                {
+                    StartBackgroundSourceRefresh(std::move(*outcome.DeferredUpdate));
+                }
             }
 
             if (sourceReferencesToOpen->size() > 1)
@@ -864,20 +1023,19 @@ namespace AppInstaller::Repository
                 auto aggregatedSource = std::make_shared<CompositeSource>("*DefaultSource");
                 std::vector<std::shared_ptr<OpenExceptionProxy>> openExceptionProxies;
 
-                for (auto& sourceReference : *sourceReferencesToOpen)
+                for (size_t i = 0; i < sourceReferencesToOpen->size(); ++i)
                 {
+                    auto& sourceReference = (*sourceReferencesToOpen)[i];
                     AICLI_LOG(Repo, Info, << "Adding to aggregated source: " << sourceReference->GetDetails().Name);
 
-                    try
-
+                    if (outcomes[i].OpenedSource)
                     {
-                        aggregatedSource->AddAvailableSource(sourceReference->Open(progress));
+                        aggregatedSource->AddAvailableSource(std::move(outcomes[i].OpenedSource));
                     }
-                    catch (...)
+                    else
                     {
-                        LOG_CAUGHT_EXCEPTION();
                         AICLI_LOG(Repo, Warning, << "Failed to open available source: " << sourceReference->GetDetails().Name);
-                        openExceptionProxies.emplace_back(std::make_shared<OpenExceptionProxy>(sourceReference->GetDetails(), std::current_exception()));
+                        openExceptionProxies.emplace_back(std::make_shared<OpenExceptionProxy>(sourceReference->GetDetails(), outcomes[i].OpenException));
                     }
                 }
 
@@ -894,7 +1052,12 @@ namespace AppInstaller::Repository
             }
             else
             {
-                m_source = (*sourceReferencesToOpen)[0]->Open(progress);
+                if (outcomes[0].OpenException)
+                {
+                    std::rethrow_exception(outcomes[0].OpenException);
+                }
+
+                m_source = std::move(outcomes[0].OpenedSource);
             }
         }
 
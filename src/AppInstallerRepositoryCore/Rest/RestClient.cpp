@@ -84,6 +84,11 @@ namespace AppInstaller::Repository::Rest
         return m_interface->GetManifestByVersion(packageId, version, channel);
     }
 
+    std::vector<std::vector<Manifest::Manifest>> RestClient::GetManifests(const std::vector<std::string>& packageIds) const
+    {
+        return m_interface->GetManifests(packageIds);
+    }
+
     IRestClient::SearchResult RestClient::Search(const SearchRequest& request) const
     {
         return m_interface->Search(request);
@@ -151,6 +156,16 @@ namespace AppInstaller::Repository::Rest
             // Not in cache, make REST call to retrieve it
             auto headers = GetHeaders(customHeader, caller);
             CacheControlPolicy cacheControl;
+            std::wstring responseETag;
+            bool notModified = false;
+
+            // If an expired cache entry carried an entity tag, make the request conditional so
+            // that an unchanged response skips the body transfer.
+            std::optional<std::wstring> storedETag = informationCache.GetRevalidationETag(endpoint, customHeader, caller);
+            if (storedETag)
+            {
+                headers.emplace(web::http::header_names::if_none_match, storedETag.value());
+            }
 
             std::optional<web::json::value> response = helper.HandleGet(
                 endpoint,
@@ -159,16 +174,37 @@ namespace AppInstaller::Repository::Rest
                 [&](const web::http::http_response& httpResponse)
                 {
                     cacheControl = CacheControlPolicy{ httpResponse.headers().cache_control() };
+
+                    auto etagItr = httpResponse.headers().find(web::http::header_names::etag);
+                    if (etagItr != httpResponse.headers().end())
+                    {
+                        responseETag = etagItr->second;
+                    }
+
+                    if (httpResponse.status_code() == web::http::status_codes::NotModified)
+                    {
+                        notModified = true;
+                        return Http::HttpClientHelper::HttpResponseHandlerResult{ std::nullopt, false };
+                    }
+
                     return Http::HttpClientHelper::HttpResponseHandlerResult{ std::nullopt, true };
                 });
 
-            THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !response);
+            if (notModified)
+            {
+                result = informationCache.Revalidated(endpoint, customHeader, caller, cacheControl);
+            }
+
+            if (!result)
+            {
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !response);
 
-            InformationResponseDeserializer responseDeserializer;
-            result = responseDeserializer.Deserialize(response.value());
+                InformationResponseDeserializer responseDeserializer;
+                result = responseDeserializer.Deserialize(response.value());
 
-            // Cache the information value as requested
-            informationCache.Cache(endpoint, customHeader, caller, cacheControl, std::move(response).value());
+                // Cache the information value as requested
+                informationCache.Cache(endpoint, customHeader, caller, cacheControl, std::move(response).value(), std::move(responseETag));
+            }
         }
 
         return std::move(result).value();
@@ -21,6 +21,9 @@ namespace AppInstaller::Repository::Rest
 
         std::optional<Manifest::Manifest> GetManifestByVersion(const std::string& packageId, const std::string& version, const std::string& channel) const;
 
+        // Gets the manifests for multiple package ids; results align with the input order.
+        std::vector<std::vector<Manifest::Manifest>> GetManifests(const std::vector<std::string>& packageIds) const;
+
         std::string GetSourceIdentifier() const;
 
         Schema::IRestClient::Information GetSourceInformation() const;
@@ -13,6 +13,7 @@ namespace AppInstaller::Repository::Rest
         constexpr std::wstring_view s_HashName = L"hash"sv;
         constexpr std::wstring_view s_ExpirationName = L"expiration"sv;
         constexpr std::wstring_view s_DataName = L"data"sv;
+        constexpr std::wstring_view s_ETagName = L"etag"sv;
 
         // Calculates the hash of values that might change per-call.
         Utility::SHA256::HashBuffer GetHash(const std::optional<std::string>& customHeader, std::string_view caller)
@@ -46,32 +47,79 @@ namespace AppInstaller::Repository::Rest
     {
         LoadCacheView();
 
-        Utility::SHA256::HashBuffer hashValue = GetHash(customHeader, caller);
-        CacheItem* item = FindCacheItem(endpoint, hashValue);
+        CacheItem* item = FindCacheItemWithFallback(endpoint, customHeader, caller);
 
-        // If we don't find a private match, see if there is a public one.
-        if (!item)
+        if (!item || item->Expired)
         {
-            item = FindCacheItem(endpoint, {});
+            return std::nullopt;
+        }
+
+        Schema::InformationResponseDeserializer responseDeserializer;
+        return responseDeserializer.Deserialize(item->Data);
+    }
+#ifdef AICLI_DISABLE_TEST_HOOKS
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION_MSG("RestInformationCache::Get exception");
+        return std::nullopt;
+    }
+#endif
+
+    std::optional<std::wstring> RestInformationCache::GetRevalidationETag(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller)
+#ifdef AICLI_DISABLE_TEST_HOOKS
+        try
+#endif
+    {
+        CacheItem* item = FindCacheItemWithFallback(endpoint, customHeader, caller);
+
+        if (item && item->Expired && !item->ETag.empty())
+        {
+            return item->ETag;
         }
 
+        return std::nullopt;
+    }
+#ifdef AICLI_DISABLE_TEST_HOOKS
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION_MSG("RestInformationCache::GetRevalidationETag exception");
+        return std::nullopt;
+    }
+#endif
+
+    std::optional<Schema::IRestClient::Information> RestInformationCache::Revalidated(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller, const Utility::CacheControlPolicy& cacheControl)
+#ifdef AICLI_DISABLE_TEST_HOOKS
+        try
+#endif
+    {
+        CacheItem* item = FindCacheItemWithFallback(endpoint, customHeader, caller);
+
         if (!item)
         {
             return std::nullopt;
         }
 
+        item->UnixEpochExpiration = CalculateExpiration(std::chrono::seconds{ cacheControl.MaxAge });
+        item->Expired = false;
+
+        // Best effort persistence of the refreshed expiration; the data itself is unchanged.
+        if (!StoreCacheView())
+        {
+            AICLI_LOG(Repo, Verbose, << "RestInformationCache failed to persist refreshed expiration; will revalidate again next time.");
+        }
+
         Schema::InformationResponseDeserializer responseDeserializer;
         return responseDeserializer.Deserialize(item->Data);
     }
 #ifdef AICLI_DISABLE_TEST_HOOKS
     catch (...)
     {
-        LOG_CAUGHT_EXCEPTION_MSG("RestInformationCache::Get exception");
+        LOG_CAUGHT_EXCEPTION_MSG("RestInformationCache::Revalidated exception");
         return std::nullopt;
     }
 #endif
 
-    void RestInformationCache::Cache(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller, const Utility::CacheControlPolicy& cacheControl, web::json::value response)
+    void RestInformationCache::Cache(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller, const Utility::CacheControlPolicy& cacheControl, web::json::value response, std::wstring etag)
 #ifdef AICLI_DISABLE_TEST_HOOKS
         try
 #endif
@@ -107,6 +155,8 @@ namespace AppInstaller::Repository::Rest
 
             item->UnixEpochExpiration = expirationEpoch;
             item->Data = std::move(response);
+            item->ETag = etag;
+            item->Expired = false;
 
             if (StoreCacheView())
             {
@@ -166,8 +216,12 @@ namespace AppInstaller::Repository::Rest
                 continue;
             }
 
-            if (std::chrono::system_clock::now() > Utility::ConvertUnixEpochToSystemClock(expiration.value()))
+            std::optional<std::wstring> etag = JSON::GetWideStringValueFromJsonNode(cacheItemValue, std::wstring{ s_ETagName });
+
+            bool expired = std::chrono::system_clock::now() > Utility::ConvertUnixEpochToSystemClock(expiration.value());
+            if (expired && !JSON::IsValidNonEmptyStringValue(etag))
             {
+                // Without an entity tag the item cannot be revalidated; discard it.
                 AICLI_LOG(Repo, Verbose, << "RestInformationCache cache item has expired.");
                 continue;
             }
@@ -182,6 +236,12 @@ namespace AppInstaller::Repository::Rest
             CacheItem cacheItem;
             cacheItem.Endpoint = endpoint.value();
             cacheItem.UnixEpochExpiration = expiration.value();
+            cacheItem.Expired = expired;
+
+            if (JSON::IsValidNonEmptyStringValue(etag))
+            {
+                cacheItem.ETag = etag.value();
+            }
 
             std::optional<std::wstring> hash = JSON::GetWideStringValueFromJsonNode(cacheItemValue, std::wstring{ s_HashName });
             if (JSON::IsValidNonEmptyStringValue(hash))
@@ -207,6 +267,20 @@ namespace AppInstaller::Repository::Rest
         }
     }
 
+    RestInformationCache::CacheItem* RestInformationCache::FindCacheItemWithFallback(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller)
+    {
+        Utility::SHA256::HashBuffer hashValue = GetHash(customHeader, caller);
+        CacheItem* item = FindCacheItem(endpoint, hashValue);
+
+        // If we don't find a private match, see if there is a public one.
+        if (!item)
+        {
+            item = FindCacheItem(endpoint, {});
+        }
+
+        return item;
+    }
+
     RestInformationCache::CacheItem* RestInformationCache::FindCacheItem(const std::wstring& endpoint, const Utility::SHA256::HashBuffer& hash)
     {
         for (CacheItem& item : m_cacheView)
@@ -238,6 +312,11 @@ namespace AppInstaller::Repository::Rest
             cacheItemObject[std::wstring{ s_ExpirationName }] = value::value(item.UnixEpochExpiration);
             cacheItemObject[std::wstring{ s_DataName }] = item.Data;
 
+            if (!item.ETag.empty())
+            {
+                cacheItemObject[std::wstring{ s_ETagName }] = value::value(item.ETag);
+            }
+
             cacheArray[cacheArray.size()] = std::move(cacheItemValue);
         }
 
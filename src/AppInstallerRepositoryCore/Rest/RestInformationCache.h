@@ -18,8 +18,16 @@ namespace AppInstaller::Repository::Rest
         // Attempts to get a cached information response for the provided inputs.
         std::optional<Schema::IRestClient::Information> Get(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller);
 
+        // Gets the entity tag of an expired cache item for the provided inputs, if one exists.
+        // The caller can use it in an If-None-Match request to skip the response body when nothing changed.
+        std::optional<std::wstring> GetRevalidationETag(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller);
+
+        // Refreshes the expiration of an expired cache item after the server answered Not Modified,
+        // returning its stored information response.
+        std::optional<Schema::IRestClient::Information> Revalidated(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller, const Utility::CacheControlPolicy& cacheControl);
+
         // Stores the information response as appropriate.
-        void Cache(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller, const Utility::CacheControlPolicy& cacheControl, web::json::value response);
+        void Cache(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller, const Utility::CacheControlPolicy& cacheControl, web::json::value response, std::wstring etag = {});
 
     private:
         struct CacheItem
@@ -28,10 +36,17 @@ namespace AppInstaller::Repository::Rest
             Utility::SHA256::HashBuffer Hash;
             uint64_t UnixEpochExpiration = 0;
             web::json::value Data;
+            std::wstring ETag;
+            // Expired items with an entity tag are retained for revalidation; not persisted.
+            bool Expired = false;
         };
 
+        // Finds the cache item for the given inputs, preferring a private match over a public one.
+        CacheItem* FindCacheItemWithFallback(const std::wstring& endpoint, const std::optional<std::string>& customHeader, std::string_view caller);
+
         // Reads from the cache, constructing our view of the items it contains.
-        // Discards any expired items while reading the cache.
+        // Discards any expired items while reading the cache, except those with
+        // an entity tag, which are kept as expired for revalidation.
         void LoadCacheView();
 
         // Finds the cache item for the given inputs, or nullptr if it is not found.
@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "RestResponseCache.h"
+#include <winget/JsonUtil.h>
+
+namespace AppInstaller::Repository::Rest
+{
+    namespace
+    {
+        constexpr std::wstring_view s_DigestName = L"digest"sv;
+        constexpr std::wstring_view s_ExpirationName = L"expiration"sv;
+        constexpr std::wstring_view s_DataName = L"data"sv;
+
+        // The maximum number of responses kept in the cache; the response bodies can be
+        // large, so keep the cache bounded by evicting the items closest to expiring.
+        constexpr size_t s_MaxCacheItems = 32;
+    }
+
+    Utility::SHA256::HashBuffer RestResponseCache::GetRequestDigest(const utility::string_t& endpoint, const utility::string_t& payload)
+    {
+        std::stringstream stream;
+        stream << utility::conversions::to_utf8string(endpoint) << '|' << utility::conversions::to_utf8string(payload);
+
+        return Utility::SHA256::ComputeHash(stream);
+    }
+
+    std::optional<web::json::value> RestResponseCache::Get(const Utility::SHA256::HashBuffer& requestDigest)
+#ifdef AICLI_DISABLE_TEST_HOOKS
+        try
+#endif
+    {
+        LoadCacheView();
+
+        CacheItem* item = FindCacheItem(requestDigest);
+
+        if (!item)
+        {
+            return std::nullopt;
+        }
+
+        return std::move(item->Data);
+    }
+#ifdef AICLI_DISABLE_TEST_HOOKS
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION_MSG("RestResponseCache::Get exception");
+        return std::nullopt;
+    }
+#endif
+
+    void RestResponseCache::Cache(const Utility::SHA256::HashBuffer& requestDigest, const Utility::CacheControlPolicy& cacheControl, web::json::value response)
+#ifdef AICLI_DISABLE_TEST_HOOKS
+        try
+#endif
+    {
+        // Responses are only cached when the server explicitly opts in with a lifetime.
+        // Unlike the information cache, these can be large; treat no-cache as no-store.
+        if (!cacheControl.Present || cacheControl.NoStore || cacheControl.NoCache || cacheControl.MaxAge == 0)
+        {
+            return;
+        }
+
+        uint64_t expirationEpoch = Utility::ConvertSystemClockToUnixEpoch(std::chrono::system_clock::now() + std::chrono::seconds{ cacheControl.MaxAge });
+
+        // Due to the exchange semantics on the setting stream, we may have to retry storing the value.
+        for (int i = 0; i < 10; ++i)
+        {
+            CacheItem* item = FindCacheItem(requestDigest);
+
+            if (!item)
+            {
+                // Keep the cache bounded; evict the item closest to expiring to make room.
+                while (m_cacheView.size() >= s_MaxCacheItems)
+                {
+                    auto evict = std::min_element(m_cacheView.begin(), m_cacheView.end(),
+                        [](const CacheItem& a, const CacheItem& b) { return a.UnixEpochExpiration < b.UnixEpochExpiration; });
+                    m_cacheView.erase(evict);
+                }
+
+                item = &m_cacheView.emplace_back();
+                item->Digest = requestDigest;
+            }
+
+            item->UnixEpochExpiration = expirationEpoch;
+            item->Data = std::move(response);
+
+            if (StoreCacheView())
+            {
+                AICLI_LOG(Repo, Verbose, << "RestResponseCache stored response for digest: " << Utility::SHA256::ConvertToString(requestDigest));
+                return;
+            }
+            else
+            {
+                // Extract the response back from the item for the next iteration
+                response = std::move(item->Data);
+
+                // Failed to store due to the cache changing, reload and try again.
+                LoadCacheView();
+            }
+        }
+
+        AICLI_LOG(Repo, Warning, << "RestResponseCache failed to store response cache after 10 attempts.");
+    }
+#ifdef AICLI_DISABLE_TEST_HOOKS
+    CATCH_LOG();
+#endif
+
+    void RestResponseCache::LoadCacheView()
+    {
+        using namespace web::json;
+
+        std::unique_ptr<std::istream> stream = m_settingsStream.Get();
+        m_cacheView.clear();
+
+        if (!stream)
+        {
+            return;
+        }
+
+        value cacheValue = value::parse(*stream);
+
+        if (!cacheValue.is_array())
+        {
+            AICLI_LOG(Repo, Warning, << "RestResponseCache value was not an array.");
+            return;
+        }
+
+        array& cacheArray = cacheValue.as_array();
+
+        for (const value& cacheItemValue : cacheArray)
+        {
+            if (!cacheItemValue.is_object())
+            {
+                AICLI_LOG(Repo, Warning, << "RestResponseCache cache item was not an object.");
+                continue;
+            }
+
+            std::optional<uint64_t> expiration = JSON::GetRawUInt64ValueFromJsonNode(cacheItemValue, std::wstring{ s_ExpirationName });
+            if (!expiration)
+            {
+                AICLI_LOG(Repo, Warning, << "RestResponseCache cache item missing expiration.");
+                continue;
+            }
+
+            if (std::chrono::system_clock::now() > Utility::ConvertUnixEpochToSystemClock(expiration.value()))
+            {
+                AICLI_LOG(Repo, Verbose, << "RestResponseCache cache item has expired.");
+                continue;
+            }
+
+            std::optional<std::wstring> digest = JSON::GetWideStringValueFromJsonNode(cacheItemValue, std::wstring{ s_DigestName });
+            if (!JSON::IsValidNonEmptyStringValue(digest))
+            {
+                AICLI_LOG(Repo, Warning, << "RestResponseCache cache item missing digest.");
+                continue;
+            }
+
+            CacheItem cacheItem;
+            cacheItem.Digest = Utility::SHA256::ConvertToBytes(digest.value());
+            cacheItem.UnixEpochExpiration = expiration.value();
+
+            auto dataValue = JSON::GetJsonValueFromNode(cacheItemValue, std::wstring{ s_DataName });
+            if (!dataValue)
+            {
+                AICLI_LOG(Repo, Warning, << "RestResponseCache cache item missing data.");
+                continue;
+            }
+
+            cacheItem.Data = dataValue.value().get();
+            if (cacheItem.Data.is_null())
+            {
+                AICLI_LOG(Repo, Warning, << "RestResponseCache cache item data value null.");
+                continue;
+            }
+
+            m_cacheView.emplace_back(std::move(cacheItem));
+        }
+    }
+
+    RestResponseCache::CacheItem* RestResponseCache::FindCacheItem(const Utility::SHA256::HashBuffer& digest)
+    {
+        for (CacheItem& item : m_cacheView)
+        {
+            if (Utility::SHA256::AreEqual(item.Digest, digest))
+            {
+                return &item;
+            }
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] bool RestResponseCache::StoreCacheView()
+    {
+        using namespace web::json;
+
+        value cacheValue = value::array();
+        array& cacheArray = cacheValue.as_array();
+
+        for (const CacheItem& item : m_cacheView)
+        {
+            value cacheItemValue = value::object();
+            object& cacheItemObject = cacheItemValue.as_object();
+
+            cacheItemObject[std::wstring{ s_DigestName }] = value::value(Utility::ConvertToUTF16(Utility::ConvertToHexString(item.Digest)));
+            cacheItemObject[std::wstring{ s_ExpirationName }] = value::value(item.UnixEpochExpiration);
+            cacheItemObject[std::wstring{ s_DataName }] = item.Data;
+
+            cacheArray[cacheArray.size()] = std::move(cacheItemValue);
+        }
+
+        std::stringstream stream;
+        cacheValue.serialize(stream);
+
+        return m_settingsStream.Set(std::move(stream).str());
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <AppInstallerDownloader.h>
+#include <AppInstallerSHA256.h>
+#include <winget/Settings.h>
+#include <cpprest/json.h>
+#include <optional>
+#include <string>
+
+namespace AppInstaller::Repository::Rest
+{
+    // Provides access to cached search and manifest responses, keyed by a digest of the request.
+    // Responses are only cached when the server opts in via cache-control, and only until they expire.
+    struct RestResponseCache
+    {
+        // Computes the digest used to key a request.
+        static Utility::SHA256::HashBuffer GetRequestDigest(const utility::string_t& endpoint, const utility::string_t& payload);
+
+        // Attempts to get a cached response for the given request digest.
+        std::optional<web::json::value> Get(const Utility::SHA256::HashBuffer& requestDigest);
+
+        // Stores the response if the server's cache policy allows it.
+        void Cache(const Utility::SHA256::HashBuffer& requestDigest, const Utility::CacheControlPolicy& cacheControl, web::json::value response);
+
+    private:
+        struct CacheItem
+        {
+            Utility::SHA256::HashBuffer Digest;
+            uint64_t UnixEpochExpiration = 0;
+            web::json::value Data;
+        };
+
+        // Reads from the cache, constructing our view of the items it contains.
+        // Discards any expired items while reading the cache.
+        void LoadCacheView();
+
+        // Finds the cache item for the given digest, or nullptr if it is not found.
+        CacheItem* FindCacheItem(const Utility::SHA256::HashBuffer& digest);
+
+        // Attempts to store the current cache view back to the cache.
+        // Returns true if successful; false if the cache was updated since our last read and a retry is necessary.
+        [[nodiscard]] bool StoreCacheView();
+
+        Settings::Stream m_settingsStream{ Settings::Stream::RestResponseCache };
+        std::vector<CacheItem> m_cacheView;
+    };
+}
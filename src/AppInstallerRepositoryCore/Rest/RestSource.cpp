@@ -174,6 +174,30 @@ namespace AppInstaller::Repository::Rest
                 return false;
             }
 
+            // Gets the shared manifest that a previous fetch stored for the version, if any.
+            std::shared_ptr<const Manifest::Manifest> GetCachedManifest(const IRestClient::VersionInfo& versionInfo) const
+            {
+                std::scoped_lock versionsLock{ m_packageVersionsLock };
+                return GetCachedManifestInternal(versionInfo);
+            }
+
+            // Stores a manifest fetched for the given version, returning the shared object so that
+            // every version object created for this version reuses it rather than requesting it
+            // from the source again. If a concurrent fetch already stored one, that result is kept.
+            std::shared_ptr<const Manifest::Manifest> SetManifestForVersion(const IRestClient::VersionInfo& versionInfo, Manifest::Manifest&& manifest)
+            {
+                std::scoped_lock versionsLock{ m_packageVersionsLock };
+
+                std::shared_ptr<const Manifest::Manifest> cached = GetCachedManifestInternal(versionInfo);
+                if (!cached)
+                {
+                    cached = std::make_shared<const Manifest::Manifest>(std::move(manifest));
+                    m_manifestCache.emplace_back(versionInfo.VersionAndChannel, cached);
+                }
+
+                return cached;
+            }
+
         private:
             std::shared_ptr<RestPackage> NonConstSharedFromThis() const
             {
@@ -183,6 +207,21 @@ namespace AppInstaller::Repository::Rest
             // Must hold m_packageVersionsLock while calling this
             std::shared_ptr<IPackageVersion> GetLatestVersionInternal() const;
 
+            // Must hold m_packageVersionsLock while calling this
+            std::shared_ptr<const Manifest::Manifest> GetCachedManifestInternal(const IRestClient::VersionInfo& versionInfo) const
+            {
+                for (const auto& entry : m_manifestCache)
+                {
+                    if (entry.first.GetVersion() == versionInfo.VersionAndChannel.GetVersion() &&
+                        Utility::CaseInsensitiveEquals(entry.first.GetChannel().ToString(), versionInfo.VersionAndChannel.GetChannel().ToString()))
+                    {
+                        return entry.second;
+                    }
+                }
+
+                return {};
+            }
+
             // Must hold m_packageVersionsLock while calling this
             void SortVersionsInternal()
             {
@@ -194,13 +233,17 @@ namespace AppInstaller::Repository::Rest
             }
 
             IRestClient::Package m_package;
-            // Protects access to m_package.Versions
+            // Manifests fetched for versions of this package; each is shared by all of the
+            // version objects created for that version. Protected by m_packageVersionsLock.
+            mutable std::vector<std::pair<Utility::VersionAndChannel, std::shared_ptr<const Manifest::Manifest>>> m_manifestCache;
+            // Protects access to m_package.Versions and m_manifestCache
             mutable std::mutex m_packageVersionsLock;
         };
 
         void GetMultiPropertyValues(
             const RestPackage* package,
             const IRestClient::VersionInfo& versionInfo,
+            const Manifest::Manifest* manifest,
             PackageVersionMultiProperty property,
             std::vector<Utility::LocIndString>& result,
             void (*Action)(std::vector<Utility::LocIndString>&, Utility::LocIndString&&))
@@ -226,9 +269,9 @@ namespace AppInstaller::Repository::Rest
                 }
                 break;
             case PackageVersionMultiProperty::Name:
-                if (versionInfo.Manifest)
+                if (manifest)
                 {
-                    for (auto&& name : versionInfo.Manifest->GetPackageNames())
+                    for (auto&& name : manifest->GetPackageNames())
                     {
                         Action(result, Utility::LocIndString{ std::move(name) });
                     }
@@ -239,9 +282,9 @@ namespace AppInstaller::Repository::Rest
                 }
                 break;
             case PackageVersionMultiProperty::Publisher:
-                if (versionInfo.Manifest)
+                if (manifest)
                 {
-                    for (auto&& publisher : versionInfo.Manifest->GetPublishers())
+                    for (auto&& publisher : manifest->GetPublishers())
                     {
                         Action(result, Utility::LocIndString{ std::move(publisher) });
                     }
@@ -252,10 +295,10 @@ namespace AppInstaller::Repository::Rest
                 }
                 break;
             case PackageVersionMultiProperty::Locale:
-                if (versionInfo.Manifest)
+                if (manifest)
                 {
-                    Action(result, Utility::LocIndString{ versionInfo.Manifest->DefaultLocalization.Locale });
-                    for (const auto& loc : versionInfo.Manifest->Localizations)
+                    Action(result, Utility::LocIndString{ manifest->DefaultLocalization.Locale });
+                    for (const auto& loc : manifest->Localizations)
                     {
                         Action(result, Utility::LocIndString{ loc.Locale });
                     }
@@ -272,9 +315,16 @@ namespace AppInstaller::Repository::Rest
 
             for (const auto& versionInfo : m_package.Versions)
             {
+                std::shared_ptr<const Manifest::Manifest> cachedManifest;
+                if (!versionInfo.Manifest)
+                {
+                    cachedManifest = GetCachedManifestInternal(versionInfo);
+                }
+
                 GetMultiPropertyValues(
                     this,
                     versionInfo,
+                    versionInfo.Manifest ? &versionInfo.Manifest.value() : cachedManifest.get(),
                     mappedProperty,
                     result,
                     [](std::vector<Utility::LocIndString>& result, Utility::LocIndString&& string)
@@ -295,8 +345,9 @@ namespace AppInstaller::Repository::Rest
         struct PackageVersion : public SourceReference, public IPackageVersion
         {
             PackageVersion(
-                const std::shared_ptr<RestSource>& source, std::shared_ptr<RestPackage>&& package, IRestClient::VersionInfo versionInfo)
-                : SourceReference(source), m_package(std::move(package)), m_versionInfo(std::move(versionInfo)) {}
+                const std::shared_ptr<RestSource>& source, std::shared_ptr<RestPackage>&& package,
+                IRestClient::VersionInfo versionInfo, std::shared_ptr<const Manifest::Manifest> cachedManifest = {})
+                : SourceReference(source), m_package(std::move(package)), m_versionInfo(std::move(versionInfo)), m_manifest(std::move(cachedManifest)) {}
 
             // Inherited via IPackageVersion
             Utility::LocIndString GetProperty(PackageVersionProperty property) const override
@@ -322,9 +373,9 @@ namespace AppInstaller::Repository::Rest
                     {
                         return Utility::LocIndString{ m_versionInfo.ArpVersions.front().ToString() };
                     }
-                    else if (m_versionInfo.Manifest)
+                    else if (const Manifest::Manifest* manifest = AvailableManifest())
                     {
-                        auto arpVersionRange = m_versionInfo.Manifest->GetArpVersionRange();
+                        auto arpVersionRange = manifest->GetArpVersionRange();
                         return arpVersionRange.IsEmpty() ? Utility::LocIndString{} : Utility::LocIndString{ arpVersionRange.GetMinVersion().ToString() };
                     }
                     else
@@ -336,9 +387,9 @@ namespace AppInstaller::Repository::Rest
                     {
                         return Utility::LocIndString{ m_versionInfo.ArpVersions.back().ToString() };
                     }
-                    else if (m_versionInfo.Manifest)
+                    else if (const Manifest::Manifest* manifest = AvailableManifest())
                     {
-                        auto arpVersionRange = m_versionInfo.Manifest->GetArpVersionRange();
+                        auto arpVersionRange = manifest->GetArpVersionRange();
                         return arpVersionRange.IsEmpty() ? Utility::LocIndString{} : Utility::LocIndString{ arpVersionRange.GetMaxVersion().ToString() };
                     }
                     else
@@ -357,6 +408,7 @@ namespace AppInstaller::Repository::Rest
                 GetMultiPropertyValues(
                     m_package.get(),
                     m_versionInfo,
+                    AvailableManifest(),
                     property,
                     result,
                     [](std::vector<Utility::LocIndString>& result, Utility::LocIndString&& string)
@@ -382,17 +434,27 @@ namespace AppInstaller::Repository::Rest
                     return m_versionInfo.Manifest.value();
                 }
 
-                std::optional<Manifest::Manifest> manifest = GetReferenceSource()->GetRestClient().GetManifestByVersion(
-                    m_package->PackageInfo().PackageIdentifier, m_versionInfo.VersionAndChannel.GetVersion().ToString(), m_versionInfo.VersionAndChannel.GetChannel().ToString());
+                if (!m_manifest)
+                {
+                    // Another version object for this version may have fetched it already.
+                    m_manifest = m_package->GetCachedManifest(m_versionInfo);
+                }
 
-                if (!manifest)
+                if (!m_manifest)
                 {
-                    AICLI_LOG(Repo, Verbose, << "Valid manifest not found for package: " << m_package->PackageInfo().PackageIdentifier);
-                    return {};
+                    std::optional<Manifest::Manifest> manifest = GetReferenceSource()->GetRestClient().GetManifestByVersion(
+                        m_package->PackageInfo().PackageIdentifier, m_versionInfo.VersionAndChannel.GetVersion().ToString(), m_versionInfo.VersionAndChannel.GetChannel().ToString());
+
+                    if (!manifest)
+                    {
+                        AICLI_LOG(Repo, Verbose, << "Valid manifest not found for package: " << m_package->PackageInfo().PackageIdentifier);
+                        return {};
+                    }
+
+                    m_manifest = m_package->SetManifestForVersion(m_versionInfo, std::move(manifest).value());
                 }
-                
-                m_versionInfo.Manifest = std::move(manifest.value());
-                return m_versionInfo.Manifest.value();
+
+                return *m_manifest;
             }
 
             Source GetSource() const override
@@ -407,8 +469,15 @@ namespace AppInstaller::Repository::Rest
             }
 
         private:
+            // The manifest for this version, if it came inline with the search result or has been fetched.
+            const Manifest::Manifest* AvailableManifest() const
+            {
+                return m_versionInfo.Manifest ? &m_versionInfo.Manifest.value() : m_manifest.get();
+            }
+
             std::shared_ptr<RestPackage> m_package;
             IRestClient::VersionInfo m_versionInfo;
+            std::shared_ptr<const Manifest::Manifest> m_manifest;
         };
 
         std::shared_ptr<IPackageVersion> RestPackage::GetVersion(const PackageVersionKey& versionKey) const
@@ -430,7 +499,7 @@ namespace AppInstaller::Repository::Rest
                     if (CaseInsensitiveEquals(versionInfo.VersionAndChannel.GetVersion().ToString(), versionKey.Version)
                         && CaseInsensitiveEquals(versionInfo.VersionAndChannel.GetChannel().ToString(), versionKey.Channel))
                     {
-                        packageVersion = std::make_shared<PackageVersion>(source, NonConstSharedFromThis(), versionInfo);
+                        packageVersion = std::make_shared<PackageVersion>(source, NonConstSharedFromThis(), versionInfo, GetCachedManifestInternal(versionInfo));
                         break;
                     }
                 }
@@ -445,7 +514,7 @@ namespace AppInstaller::Repository::Rest
                 {
                     if (CaseInsensitiveEquals(versionInfo.VersionAndChannel.GetChannel().ToString(), versionKey.Channel))
                     {
-                        packageVersion = std::make_shared<PackageVersion>(source, NonConstSharedFromThis(), versionInfo);
+                        packageVersion = std::make_shared<PackageVersion>(source, NonConstSharedFromThis(), versionInfo, GetCachedManifestInternal(versionInfo));
                         break;
                     }
                 }
@@ -456,7 +525,7 @@ namespace AppInstaller::Repository::Rest
                 {
                     if (CaseInsensitiveEquals(versionInfo.VersionAndChannel.GetVersion().ToString(), versionKey.Version))
                     {
-                        packageVersion = std::make_shared<PackageVersion>(source, NonConstSharedFromThis(), versionInfo);
+                        packageVersion = std::make_shared<PackageVersion>(source, NonConstSharedFromThis(), versionInfo, GetCachedManifestInternal(versionInfo));
                         break;
                     }
                 }
@@ -467,7 +536,7 @@ namespace AppInstaller::Repository::Rest
 
         std::shared_ptr<IPackageVersion> RestPackage::GetLatestVersionInternal() const
         {
-            return std::make_shared<PackageVersion>(GetReferenceSource(), NonConstSharedFromThis(), m_package.Versions.front());
+            return std::make_shared<PackageVersion>(GetReferenceSource(), NonConstSharedFromThis(), m_package.Versions.front(), GetCachedManifestInternal(m_package.Versions.front()));
         }
     }
 
@@ -508,10 +577,14 @@ namespace AppInstaller::Repository::Rest
         SearchResult searchResult;
 
         std::shared_ptr<RestSource> sharedThis = NonConstSharedFromThis();
+
+        // Compile the request once; every result is evaluated against the same criteria.
+        MatchCriteriaResolver matchCriteriaResolver{ request };
+
         for (auto& result : results.Matches)
         {
             std::shared_ptr<RestPackage> package = std::make_shared<RestPackage>(sharedThis, std::move(result));
-            PackageMatchFilter packageFilter{ FindBestMatchCriteria(request, package->GetLatestVersion().get()) };
+            PackageMatchFilter packageFilter{ matchCriteriaResolver.FindBestMatchCriteria(package->GetLatestVersion().get()) };
 
             searchResult.Matches.emplace_back(std::move(package), std::move(packageFilter));
         }
@@ -22,6 +22,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         IRestClient::SearchResult Search(const SearchRequest& request) const override;
         std::optional<Manifest::Manifest> GetManifestByVersion(const std::string& packageId, const std::string& version, const std::string& channel) const override;
         std::vector<Manifest::Manifest> GetManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params = {}) const override;
+        std::vector<std::vector<Manifest::Manifest>> GetManifests(const std::vector<std::string>& packageIds, const std::map<std::string_view, std::string>& params = {}) const override;
 
     protected:
         bool MeetsOptimizedSearchCriteria(const SearchRequest& request) const;
@@ -35,6 +36,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         virtual web::json::value GetValidatedSearchBody(const SearchRequest& searchRequest) const;
 
         virtual SearchResult GetSearchResult(const web::json::value& searchResponseObject) const;
+        virtual SearchResult GetSearchResult(web::json::value&& searchResponseObject) const;
         virtual std::vector<Manifest::Manifest> GetParsedManifests(const web::json::value& manifestsResponseObject) const;
 
         // Gets auth headers if source requires authentication for access.
@@ -12,8 +12,18 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         // Gets the search result for given version
         IRestClient::SearchResult Deserialize(const web::json::value& searchResultJsonObject) const;
 
+        // Gets the search result for given version, consuming the json object.
+        // Each package's json subtree is released as soon as it has been converted,
+        // keeping the peak memory overlap between the json and the result to a single package.
+        IRestClient::SearchResult Deserialize(web::json::value&& searchResultJsonObject) const;
+
     protected:
         virtual std::optional<IRestClient::SearchResult> DeserializeSearchResult(const web::json::value& searchResultJsonObject) const;
+        virtual std::optional<IRestClient::SearchResult> DeserializeSearchResult(web::json::value&& searchResultJsonObject) const;
         virtual std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const;
+
+    private:
+        // Converts a single package entry from the data array; nullopt indicates invalid data.
+        std::optional<IRestClient::Package> DeserializePackage(const web::json::value& packageJsonObject) const;
     };
 }
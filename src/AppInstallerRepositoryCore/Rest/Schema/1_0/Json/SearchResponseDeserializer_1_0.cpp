@@ -11,15 +11,16 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 {
     namespace
     {
-        // Search response constants
-        constexpr std::string_view PackageIdentifier = "PackageIdentifier"sv;
-        constexpr std::string_view PackageName = "PackageName"sv;
-        constexpr std::string_view Publisher = "Publisher"sv;
-        constexpr std::string_view PackageFamilyNames = "PackageFamilyNames"sv;
-        constexpr std::string_view ProductCodes = "ProductCodes"sv;
-        constexpr std::string_view Versions = "Versions"sv;
-        constexpr std::string_view PackageVersion = "PackageVersion"sv;
-        constexpr std::string_view Channel = "Channel"sv;
+        // Search response constants; Key descriptors so that per package field lookups do not
+        // allocate converted key strings.
+        constexpr JSON::Key PackageIdentifier{ L"PackageIdentifier" };
+        constexpr JSON::Key PackageName{ L"PackageName" };
+        constexpr JSON::Key Publisher{ L"Publisher" };
+        constexpr JSON::Key PackageFamilyNames{ L"PackageFamilyNames" };
+        constexpr JSON::Key ProductCodes{ L"ProductCodes" };
+        constexpr JSON::Key Versions{ L"Versions" };
+        constexpr JSON::Key PackageVersion{ L"PackageVersion" };
+        constexpr JSON::Key Channel{ L"Channel" };
     }
 
     IRestClient::SearchResult SearchResponseDeserializer::Deserialize(const web::json::value& searchResponseObject) const
@@ -31,6 +32,15 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         return response.value();
     }
 
+    IRestClient::SearchResult SearchResponseDeserializer::Deserialize(web::json::value&& searchResponseObject) const
+    {
+        std::optional<IRestClient::SearchResult> response = DeserializeSearchResult(std::move(searchResponseObject));
+
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, !response);
+
+        return response.value();
+    }
+
     std::optional<IRestClient::SearchResult> SearchResponseDeserializer::DeserializeSearchResult(const web::json::value& searchResponseObject) const
     {
         // Make search result from json output.
@@ -52,44 +62,61 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 
             for (auto& manifestItem : dataArray.value().get())
             {
-                std::optional<std::string> packageId = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageIdentifier));
-                std::optional<std::string> packageName = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageName));
-                std::optional<std::string> publisher = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(Publisher));
-
-                if (!JSON::IsValidNonEmptyStringValue(packageId) || !JSON::IsValidNonEmptyStringValue(packageName) || !JSON::IsValidNonEmptyStringValue(publisher))
+                std::optional<IRestClient::Package> package = DeserializePackage(manifestItem);
+                if (!package)
                 {
-                    AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
                     return {};
                 }
 
-                std::optional<std::reference_wrapper<const web::json::array>> versionValue = JSON::GetRawJsonArrayFromJsonNode(manifestItem, JSON::GetUtilityString(Versions));
-                std::vector<IRestClient::VersionInfo> versionList;
+                result.Matches.emplace_back(std::move(*package));
+            }
 
-                if (versionValue)
-                {
-                    for (auto& versionItem : versionValue.value().get())
-                    {
-                        auto versionInfo = DeserializeVersionInfo(versionItem);
-                        if (!versionInfo.has_value())
-                        {
-                            AICLI_LOG(Repo, Error, << "Received incomplete package version in package: " << packageId.value());
-                            return {};
-                        }
-
-                        versionList.emplace_back(std::move(*versionInfo));
-                    }
-                }
+            return result;
+        }
+        catch (const std::exception& e)
+        {
+            AICLI_LOG(Repo, Error, << "Error encountered while deserializing search result. Reason: " << e.what());
+        }
+        catch (...)
+        {
+            AICLI_LOG(Repo, Error, << "Error encountered while deserializing search result...");
+        }
+
+        return {};
+    }
+
+    std::optional<IRestClient::SearchResult> SearchResponseDeserializer::DeserializeSearchResult(web::json::value&& searchResponseObject) const
+    {
+        // Make search result from json output.
+        if (searchResponseObject.is_null())
+        {
+            AICLI_LOG(Repo, Error, << "Missing json object.");
+            return {};
+        }
 
-                if (versionList.size() == 0)
+        IRestClient::SearchResult result;
+        try
+        {
+            utility::string_t dataField = JSON::GetUtilityString(Data);
+            if (!searchResponseObject.is_object() || !searchResponseObject.has_array_field(dataField) || searchResponseObject.at(dataField).as_array().size() == 0)
+            {
+                AICLI_LOG(Repo, Verbose, << "No search results returned.");
+                return result;
+            }
+
+            for (auto& manifestItem : searchResponseObject.at(dataField).as_array())
+            {
+                std::optional<IRestClient::Package> package = DeserializePackage(manifestItem);
+                if (!package)
                 {
-                    AICLI_LOG(Repo, Error, << "Received no versions in package: " << packageId.value());
                     return {};
                 }
 
-                IRestClient::PackageInfo packageInfo{
-                        std::move(packageId.value()), std::move(packageName.value()), std::move(publisher.value()) };
-                IRestClient::Package package{ std::move(packageInfo), std::move(versionList) };
-                result.Matches.emplace_back(std::move(package));
+                result.Matches.emplace_back(std::move(*package));
+
+                // Release this package's json subtree now that it has been converted so that the
+                // full json tree and the full result set never coexist in memory.
+                manifestItem = web::json::value{};
             }
 
             return result;
@@ -106,18 +133,59 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         return {};
     }
 
+    std::optional<IRestClient::Package> SearchResponseDeserializer::DeserializePackage(const web::json::value& packageJsonObject) const
+    {
+        std::optional<std::string> packageId = JSON::GetRawStringValueFromJsonNode(packageJsonObject, PackageIdentifier);
+        std::optional<std::string> packageName = JSON::GetRawStringValueFromJsonNode(packageJsonObject, PackageName);
+        std::optional<std::string> publisher = JSON::GetRawStringValueFromJsonNode(packageJsonObject, Publisher);
+
+        if (!JSON::IsValidNonEmptyStringValue(packageId) || !JSON::IsValidNonEmptyStringValue(packageName) || !JSON::IsValidNonEmptyStringValue(publisher))
+        {
+            AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
+            return {};
+        }
+
+        std::optional<std::reference_wrapper<const web::json::array>> versionValue = JSON::GetRawJsonArrayFromJsonNode(packageJsonObject, Versions);
+        std::vector<IRestClient::VersionInfo> versionList;
+
+        if (versionValue)
+        {
+            for (auto& versionItem : versionValue.value().get())
+            {
+                auto versionInfo = DeserializeVersionInfo(versionItem);
+                if (!versionInfo.has_value())
+                {
+                    AICLI_LOG(Repo, Error, << "Received incomplete package version in package: " << packageId.value());
+                    return {};
+                }
+
+                versionList.emplace_back(std::move(*versionInfo));
+            }
+        }
+
+        if (versionList.size() == 0)
+        {
+            AICLI_LOG(Repo, Error, << "Received no versions in package: " << packageId.value());
+            return {};
+        }
+
+        IRestClient::PackageInfo packageInfo{
+                std::move(packageId.value()), std::move(packageName.value()), std::move(publisher.value()) };
+        return IRestClient::Package{ std::move(packageInfo), std::move(versionList) };
+    }
+
     std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
     {
-        std::optional<std::string> version = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageVersion));
+        std::optional<std::string> version = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, PackageVersion);
         if (!JSON::IsValidNonEmptyStringValue(version))
         {
             AICLI_LOG(Repo, Error, << "Received incomplete package version");
             return {};
         }
 
-        std::string channel = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(Channel)).value_or("");
-        std::vector<std::string> packageFamilyNames = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageFamilyNames)));
-        std::vector<std::string> productCodes = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(ProductCodes)));
+        std::string channel = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, Channel).value_or("");
+        std::vector<std::string> packageFamilyNames = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, PackageFamilyNames));
+        std::vector<std::string> productCodes = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, ProductCodes));
 
         return IRestClient::VersionInfo{
             AppInstaller::Utility::VersionAndChannel{std::move(version.value()), std::move(channel)},
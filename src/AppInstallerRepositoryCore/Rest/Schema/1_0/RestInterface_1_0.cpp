@@ -7,7 +7,9 @@
 #include <winget/JsonUtil.h>
 #include <winget/ManifestJSONParser.h>
 #include <winget/ManifestValidation.h>
+#include <winget/ParallelWork.h>
 #include <winget/Rest.h>
+#include "Rest/RestResponseCache.h"
 #include "Rest/Schema/CommonRestConstants.h"
 #include "Rest/Schema/SearchResponseParser.h"
 #include "Rest/Schema/SearchRequestComposer.h"
@@ -104,8 +106,25 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
     IRestClient::SearchResult Interface::SearchInternal(const SearchRequest& request) const
     {
         SearchResult results;
+        web::json::value searchBody = GetValidatedSearchBody(request);
+
+        // Check the cache for a previously stored response to the same search request.
+        RestResponseCache responseCache;
+        Utility::SHA256::HashBuffer requestDigest = RestResponseCache::GetRequestDigest(m_searchEndpoint, searchBody.serialize());
+        std::optional<web::json::value> jsonObject = responseCache.Get(requestDigest);
+        bool servedFromCache = jsonObject.has_value();
+
+        // When a time budget is given, stop requesting continuation pages once it expires;
+        // a remaining continuation token then marks the result as truncated below.
+        std::chrono::steady_clock::time_point searchDeadline = std::chrono::steady_clock::time_point::max();
+        if (request.TimeBudget != std::chrono::milliseconds::zero())
+        {
+            searchDeadline = std::chrono::steady_clock::now() + request.TimeBudget;
+        }
+
         utility::string_t continuationToken;
         Http::HttpClientHelper::HttpRequestHeaders searchHeaders = m_requiredRestApiHeaders;
+        bool isFirstPage = true;
         do
         {
             if (!continuationToken.empty())
@@ -114,12 +133,28 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
                 searchHeaders.insert_or_assign(AppInstaller::JSON::GetUtilityString(ContinuationToken), continuationToken);
             }
 
-            std::optional<web::json::value> jsonObject = m_httpClientHelper.HandlePost(m_searchEndpoint, GetValidatedSearchBody(request), searchHeaders, GetAuthHeaders(), CustomRestCallResponseHandler);
+            Utility::CacheControlPolicy cacheControl;
+            if (!jsonObject)
+            {
+                jsonObject = m_httpClientHelper.HandlePost(m_searchEndpoint, searchBody, searchHeaders, GetAuthHeaders(),
+                    [&](const web::http::http_response& httpResponse)
+                    {
+                        cacheControl = Utility::CacheControlPolicy{ httpResponse.headers().cache_control() };
+                        return CustomRestCallResponseHandler(httpResponse);
+                    });
+            }
 
             utility::string_t ct;
             if (jsonObject)
             {
-                SearchResult currentResult = GetSearchResult(jsonObject.value());
+                ct = GetContinuationToken(jsonObject.value()).value_or(L"");
+
+                // Only complete (single page) responses are cached, and only when the server allows it.
+                bool cacheable = isFirstPage && !servedFromCache && ct.empty();
+
+                // When the json will not be cached, let deserialization consume it so that the
+                // json tree and the converted result set do not both reach their peak size at once.
+                SearchResult currentResult = cacheable ? GetSearchResult(jsonObject.value()) : GetSearchResult(std::move(jsonObject).value());
 
                 size_t insertElements = !request.MaximumResults ? currentResult.Matches.size() :
                     std::min(currentResult.Matches.size(), request.MaximumResults - results.Matches.size());
@@ -130,12 +165,20 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
                 }
 
                 std::move(currentResult.Matches.begin(), std::next(currentResult.Matches.begin(), insertElements), std::inserter(results.Matches, results.Matches.end()));
-                ct = GetContinuationToken(jsonObject.value()).value_or(L"");
+
+                if (cacheable)
+                {
+                    responseCache.Cache(requestDigest, cacheControl, std::move(jsonObject).value());
+                }
             }
 
+            jsonObject.reset();
+            isFirstPage = false;
             continuationToken = ct;
 
-        } while (!continuationToken.empty() && (!request.MaximumResults || results.Matches.size() < request.MaximumResults));
+        } while (!continuationToken.empty() &&
+            (!request.MaximumResults || results.Matches.size() < request.MaximumResults) &&
+            std::chrono::steady_clock::now() < searchDeadline);
 
         if (!continuationToken.empty())
         {
@@ -239,9 +282,25 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         auto validatedParams = GetValidatedQueryParams(params);
 
         std::vector<Manifest::Manifest> results;
-        utility::string_t continuationToken;
         Http::HttpClientHelper::HttpRequestHeaders searchHeaders = m_requiredRestApiHeaders;
-        std::optional<web::json::value> jsonObject = m_httpClientHelper.HandleGet(GetManifestByVersionEndpoint(m_restApiUri, packageId, validatedParams), searchHeaders, GetAuthHeaders(), CustomRestCallResponseHandler);
+        utility::string_t endpoint = GetManifestByVersionEndpoint(m_restApiUri, packageId, validatedParams);
+
+        // Check the cache for a previously stored response to the same request.
+        RestResponseCache responseCache;
+        Utility::SHA256::HashBuffer requestDigest = RestResponseCache::GetRequestDigest(endpoint, {});
+        std::optional<web::json::value> jsonObject = responseCache.Get(requestDigest);
+        bool servedFromCache = jsonObject.has_value();
+
+        Utility::CacheControlPolicy cacheControl;
+        if (!jsonObject)
+        {
+            jsonObject = m_httpClientHelper.HandleGet(endpoint, searchHeaders, GetAuthHeaders(),
+                [&](const web::http::http_response& httpResponse)
+                {
+                    cacheControl = Utility::CacheControlPolicy{ httpResponse.headers().cache_control() };
+                    return CustomRestCallResponseHandler(httpResponse);
+                });
+        }
 
         if (!jsonObject)
         {
@@ -273,6 +332,36 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
             results.emplace_back(manifestItem);
         }
 
+        // Cache the validated response when the server allows it.
+        if (!servedFromCache)
+        {
+            responseCache.Cache(requestDigest, cacheControl, std::move(jsonObject).value());
+        }
+
+        return results;
+    }
+
+    std::vector<std::vector<Manifest::Manifest>> Interface::GetManifests(const std::vector<std::string>& packageIds, const std::map<std::string_view, std::string>& params) const
+    {
+        std::vector<std::vector<Manifest::Manifest>> results(packageIds.size());
+
+        if (packageIds.size() <= 1)
+        {
+            if (!packageIds.empty())
+            {
+                results[0] = GetManifests(packageIds[0], params);
+            }
+
+            return results;
+        }
+
+        // There is no batch endpoint in the REST contract, but the per-package requests are
+        // independent; issue them concurrently so they overlap (and with HTTP/2, share a connection).
+        Parallel::ForEachIndex(packageIds.size(), [&](size_t i)
+            {
+                results[i] = GetManifests(packageIds[i], params);
+            });
+
         return results;
     }
 
@@ -293,6 +382,12 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         return searchResponseParser.Deserialize(searchResponseObject);
     }
 
+    IRestClient::SearchResult Interface::GetSearchResult(web::json::value&& searchResponseObject) const
+    {
+        SearchResponseParser searchResponseParser{ GetVersion() };
+        return searchResponseParser.Deserialize(std::move(searchResponseObject));
+    }
+
     std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject) const
     {
         JSON::ManifestJSONParser manifestParser{ GetVersion() };
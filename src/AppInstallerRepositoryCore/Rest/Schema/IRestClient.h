@@ -95,5 +95,21 @@ namespace AppInstaller::Repository::Rest::Schema
     
     // Gets the manifests for given query parameters
     virtual std::vector<Manifest::Manifest> GetManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params = {}) const = 0;
+
+    // Gets the manifests for multiple package ids; results align with the input order.
+    // The default implementation issues the per-package requests serially; implementations
+    // are expected to overlap or batch the requests when the transport allows it.
+    virtual std::vector<std::vector<Manifest::Manifest>> GetManifests(const std::vector<std::string>& packageIds, const std::map<std::string_view, std::string>& params = {}) const
+    {
+        std::vector<std::vector<Manifest::Manifest>> result;
+        result.reserve(packageIds.size());
+
+        for (const std::string& packageId : packageIds)
+        {
+            result.emplace_back(GetManifests(packageId, params));
+        }
+
+        return result;
+    }
     };
 }
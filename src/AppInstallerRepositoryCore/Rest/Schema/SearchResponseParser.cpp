@@ -46,4 +46,9 @@ namespace AppInstaller::Repository::Rest::Schema
     {
         return m_pImpl->m_deserializer->Deserialize(searchResultJsonObject);
     }
+
+    IRestClient::SearchResult SearchResponseParser::Deserialize(web::json::value&& searchResultJsonObject) const
+    {
+        return m_pImpl->m_deserializer->Deserialize(std::move(searchResultJsonObject));
+    }
 }
@@ -26,6 +26,9 @@ namespace AppInstaller::Repository::Rest::Schema
         // Gets the search result for response object
         IRestClient::SearchResult Deserialize(const web::json::value& searchResultJsonObject) const;
 
+        // Gets the search result for response object, consuming the json object to limit peak memory usage.
+        IRestClient::SearchResult Deserialize(web::json::value&& searchResultJsonObject) const;
+
     private:
         struct impl;
         std::unique_ptr<impl> m_pImpl;
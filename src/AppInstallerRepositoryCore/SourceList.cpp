@@ -74,17 +74,16 @@ namespace AppInstaller::Repository
             return true;
         }
 
-        // Attempts to read the source details from the given stream.
+        // Attempts to read the source details from the given setting value.
         // Results are all or nothing; if any failures occur, no details are returned.
         bool TryReadSourceDetails(
             std::string_view settingName,
-            std::istream& stream,
+            const std::string& settingValue,
             std::string_view rootName,
             std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse,
             std::vector<SourceDetailsInternal>& sourceDetails)
         {
             std::vector<SourceDetailsInternal> result;
-            std::string settingValue = Utility::ReadEntireStream(stream);
 
             YAML::Node document;
             try
@@ -139,11 +138,42 @@ namespace AppInstaller::Repository
             return true;
         }
 
+        // Caches the most recently parsed details for a settings stream, keyed by the content hash.
+        // Sources are constructed many times within one process (particularly by the COM server)
+        // and the settings rarely change between constructions; parsing the same bytes again is
+        // wasted work. The parse lambdas are pure functions of the stream contents, so a matching
+        // hash is sufficient to reuse the result.
+        struct ParsedSourceDetailsCache
+        {
+            std::optional<std::vector<SourceDetailsInternal>> TryGet(const Utility::SHA256::HashBuffer& hash)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                if (m_hash && Utility::SHA256::AreEqual(m_hash.value(), hash))
+                {
+                    return m_details;
+                }
+                return std::nullopt;
+            }
+
+            void Store(Utility::SHA256::HashBuffer&& hash, const std::vector<SourceDetailsInternal>& details)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                m_hash = std::move(hash);
+                m_details = details;
+            }
+
+        private:
+            std::mutex m_lock;
+            std::optional<Utility::SHA256::HashBuffer> m_hash;
+            std::vector<SourceDetailsInternal> m_details;
+        };
+
         // Gets the source details from a particular setting, or an empty optional if no setting exists.
         std::optional<std::vector<SourceDetailsInternal>> TryGetSourcesFromSetting(
             Settings::Stream& setting,
             std::string_view rootName,
-            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse)
+            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse,
+            ParsedSourceDetailsCache& cache)
         {
             auto sourcesStream = setting.Get();
             if (!sourcesStream)
@@ -153,8 +183,20 @@ namespace AppInstaller::Repository
             }
             else
             {
+                std::string settingValue = Utility::ReadEntireStream(*sourcesStream);
+                Utility::SHA256::HashBuffer settingHash = Utility::SHA256::ComputeHash(settingValue);
+
+                if (auto cached = cache.TryGet(settingHash))
+                {
+                    return std::move(cached).value();
+                }
+
                 std::vector<SourceDetailsInternal> result;
-                if (!TryReadSourceDetails(setting.GetName(), *sourcesStream, rootName, parse, result))
+                if (TryReadSourceDetails(setting.GetName(), settingValue, rootName, parse, result))
+                {
+                    cache.Store(std::move(settingHash), result);
+                }
+                else
                 {
                     AICLI_LOG(YAML, Error, << "Ignoring corrupted source data.");
                 }
@@ -166,9 +208,10 @@ namespace AppInstaller::Repository
         std::vector<SourceDetailsInternal> GetSourcesFromSetting(
             Settings::Stream& setting,
             std::string_view rootName,
-            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse)
+            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse,
+            ParsedSourceDetailsCache& cache)
         {
-            return TryGetSourcesFromSetting(setting, rootName, parse).value_or(std::vector<SourceDetailsInternal>{});
+            return TryGetSourcesFromSetting(setting, rootName, parse, cache).value_or(std::vector<SourceDetailsInternal>{});
         }
 
         // Sets the sources for a particular setting, from a particular origin.
@@ -813,6 +856,7 @@ namespace AppInstaller::Repository
         break;
         case SourceOrigin::User:
         {
+            static ParsedSourceDetailsCache s_userSourcesCache;
             std::vector<SourceDetailsInternal> userSources = GetSourcesFromSetting(
                 m_userSourcesStream,
                 s_SourcesYaml_Sources,
@@ -836,7 +880,8 @@ namespace AppInstaller::Repository
                     }
 
                     return true;
-                });
+                },
+                s_userSourcesCache);
 
             for (auto& source : userSources)
             {
@@ -942,6 +987,7 @@ namespace AppInstaller::Repository
 
     std::vector<SourceDetailsInternal> SourceList::GetMetadata()
     {
+        static ParsedSourceDetailsCache s_metadataCache;
         return GetSourcesFromSetting(
             m_metadataStream,
             s_MetadataYaml_Sources,
@@ -964,7 +1010,8 @@ namespace AppInstaller::Repository
                 TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_AcceptedAgreementsIdentifier, details.AcceptedAgreementsIdentifier, false);
                 TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_AcceptedAgreementFields, details.AcceptedAgreementFields, false);
                 return true;
-            });
+            },
+            s_metadataCache);
     }
 
     bool SourceList::SetMetadata(const std::vector<SourceDetailsInternal>& sources)
@@ -36,6 +36,23 @@ namespace AppInstaller::Repository
         }
     }
 
+    bool ShouldDeferUpdateToBackground(const SourceDetails& details)
+    {
+        if (!Settings::User().Get<Settings::Setting::BackgroundSourceUpdate>())
+        {
+            return false;
+        }
+
+        if (details.LastUpdateTime == std::chrono::system_clock::time_point{})
+        {
+            // Never updated; there is no usable data to open, so the update must happen in line.
+            return false;
+        }
+
+        AICLI_LOG(Repo, Info, << "Source `" << details.Name << "` update deferred to background refresh");
+        return true;
+    }
+
     bool IsAfterUpdateCheckTime(const SourceDetails& details, std::optional<TimeSpan> requestedUpdateInterval)
     {
         return IsAfterUpdateCheckTime(details.Name, details.LastUpdateTime, requestedUpdateInterval);
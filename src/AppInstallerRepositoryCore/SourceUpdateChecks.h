@@ -12,6 +12,11 @@ namespace AppInstaller::Repository
     // Determines if the current time is before a previously stored "do note update before" time.
     bool IsBeforeDoNotUpdateBeforeTime(const SourceDetails& details);
 
+    // Determines if a needed update should be deferred to a background refresh, opening the
+    // current (stale) data immediately. Requires the setting to be enabled and the source to
+    // have been updated at least once before, so that there is usable data to open.
+    bool ShouldDeferUpdateToBackground(const SourceDetails& details);
+
     // Determines if the given details and desired update interval indicate an update check should occur.
     bool IsAfterUpdateCheckTime(const SourceDetails& details, std::optional<TimeSpan> requestedUpdateInterval);
 
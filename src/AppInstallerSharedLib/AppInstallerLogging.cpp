@@ -6,6 +6,8 @@
 #include "Public/AppInstallerDateTime.h"
 #include "Public/winget/SharedThreadGlobals.h"
 
+#include <atomic>
+
 namespace AppInstaller::Logging
 {
     std::string_view GetChannelName(Channel channel)
@@ -212,6 +214,54 @@ namespace AppInstaller::Logging
         }
     }
 
+    namespace EventRing
+    {
+        namespace
+        {
+            // Must be a power of two so that cursor arithmetic survives wraparound of the cursor itself.
+            constexpr size_t c_eventRingSize = 1 << 16;
+
+            char s_eventRing[c_eventRingSize];
+            std::atomic<size_t> s_eventRingCursor{ 0 };
+        }
+
+        void Record(std::string_view message) noexcept
+        {
+            // Cap individual events so that a single large one cannot evict the entire history.
+            size_t size = std::min(message.size(), c_eventRingSize / 8);
+            size_t begin = s_eventRingCursor.fetch_add(size + 1, std::memory_order_relaxed);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                s_eventRing[(begin + i) % c_eventRingSize] = message[i];
+            }
+
+            s_eventRing[(begin + size) % c_eventRingSize] = '\n';
+        }
+
+        RawView GetRawView() noexcept
+        {
+            size_t cursor = s_eventRingCursor.load(std::memory_order_relaxed);
+            RawView result;
+
+            if (cursor < c_eventRingSize)
+            {
+                result.First = s_eventRing;
+                result.FirstSize = cursor;
+            }
+            else
+            {
+                size_t split = cursor % c_eventRingSize;
+                result.First = s_eventRing + split;
+                result.FirstSize = c_eventRingSize - split;
+                result.Second = s_eventRing;
+                result.SecondSize = split;
+            }
+
+            return result;
+        }
+    }
+
     std::ostream& SetHRFormat(std::ostream& out)
     {
         return out << std::hex << std::setw(8) << std::setfill('0');
@@ -135,6 +135,30 @@ namespace AppInstaller::Utility
             return result;
         }
 
+        // Determines whether every byte of the input is 7-bit ASCII.
+        // Accumulating the high bits over word sized chunks keeps the scan branch free,
+        // which the compiler can vectorize; this makes the ASCII fast paths below cheap
+        // enough to check on every call.
+        bool IsAllAscii(std::string_view input)
+        {
+            uint64_t accumulator = 0;
+            size_t i = 0;
+
+            for (; i + sizeof(uint64_t) <= input.size(); i += sizeof(uint64_t))
+            {
+                uint64_t chunk;
+                memcpy(&chunk, input.data() + i, sizeof(chunk));
+                accumulator |= chunk;
+            }
+
+            for (; i < input.size(); ++i)
+            {
+                accumulator |= static_cast<unsigned char>(input[i]);
+            }
+
+            return (accumulator & 0x8080808080808080ull) == 0;
+        }
+
         template <typename StringType>
         std::vector<StringType> SplitTemplate(const StringType& input, typename StringType::value_type separator, bool trim)
         {
@@ -240,6 +264,26 @@ namespace AppInstaller::Utility
         return result;
     }
 
+    void ConvertToUTF8(std::wstring_view input, std::string& buffer)
+    {
+        buffer.clear();
+
+        if (input.empty())
+        {
+            return;
+        }
+
+        // Size the buffer to the worst case (3 bytes per UTF16 code unit; surrogate pairs produce
+        // 4 bytes from 2 units) rather than making an extra call to measure the exact result.
+        // The excess capacity is retained by the caller's buffer and reused on the next call.
+        buffer.resize(wil::safe_cast<size_t>(input.length()) * 3);
+
+        int utf8BytesWritten = WideCharToMultiByte(CP_UTF8, 0, input.data(), wil::safe_cast<int>(input.length()), &buffer[0], wil::safe_cast<int>(buffer.size()), nullptr, nullptr);
+        THROW_LAST_ERROR_IF(utf8BytesWritten == 0);
+
+        buffer.resize(wil::safe_cast<size_t>(utf8BytesWritten));
+    }
+
     std::wstring ConvertToUTF16(std::string_view input, UINT codePage)
     {
         if (input.empty())
@@ -260,6 +304,50 @@ namespace AppInstaller::Utility
         return result;
     }
 
+    void ConvertToUTF16(std::string_view input, std::wstring& buffer, UINT codePage)
+    {
+        buffer.clear();
+
+        if (input.empty())
+        {
+            return;
+        }
+
+        // A single UTF8 byte never produces more than one UTF16 code unit, so sizing the buffer
+        // to the input length avoids the extra call to measure the exact result.
+        buffer.resize(input.length());
+
+        int utf16CharsWritten = MultiByteToWideChar(codePage, 0, input.data(), wil::safe_cast<int>(input.length()), &buffer[0], wil::safe_cast<int>(buffer.size()));
+        THROW_LAST_ERROR_IF(utf16CharsWritten == 0);
+
+        buffer.resize(wil::safe_cast<size_t>(utf16CharsWritten));
+    }
+
+    StackUTF16::StackUTF16(std::string_view input, UINT codePage)
+    {
+        if (input.empty())
+        {
+            m_stack[0] = L'\0';
+            m_view = std::wstring_view{ m_stack.data(), 0 };
+            return;
+        }
+
+        // Attempt to convert directly into the stack buffer, leaving room for the null terminator.
+        int utf16CharCount = MultiByteToWideChar(codePage, 0, input.data(), wil::safe_cast<int>(input.length()), m_stack.data(), static_cast<int>(m_stack.size() - 1));
+
+        if (utf16CharCount != 0)
+        {
+            m_stack[utf16CharCount] = L'\0';
+            m_view = std::wstring_view{ m_stack.data(), static_cast<size_t>(utf16CharCount) };
+            return;
+        }
+
+        THROW_LAST_ERROR_IF(GetLastError() != ERROR_INSUFFICIENT_BUFFER);
+
+        m_heap = ConvertToUTF16(input, codePage);
+        m_view = m_heap;
+    }
+
     std::optional<std::wstring> TryConvertToUTF16(std::string_view input, UINT codePage)
     {
         if (input.empty())
@@ -323,8 +411,59 @@ namespace AppInstaller::Utility
         return result;
     }
 
+    namespace
+    {
+        // Determines whether every byte of the input is a printable ASCII character (0x20 to 0x7E).
+        // Such strings need no ICU processing: every byte is its own grapheme cluster and occupies
+        // a single column. Control characters are excluded because ICU treats some of them
+        // specially (CRLF is a single grapheme cluster). Word sized chunks are checked at a time
+        // so that the common all ASCII case is a bulk scan rather than a per code point iteration.
+        bool IsPrintableAscii(std::string_view input)
+        {
+            constexpr uint64_t highBits = 0x8080808080808080;
+            constexpr uint64_t spaceBytes = 0x2020202020202020;
+            constexpr uint64_t deleteBytes = 0x7f7f7f7f7f7f7f7f;
+            constexpr uint64_t oneBytes = 0x0101010101010101;
+
+            size_t index = 0;
+            uint64_t chunk = 0;
+
+            for (; index + sizeof(chunk) <= input.size(); index += sizeof(chunk))
+            {
+                std::memcpy(&chunk, input.data() + index, sizeof(chunk));
+
+                // In order: any byte with its high bit set (not ASCII), any byte below 0x20
+                // (borrows out of the subtraction), or any byte equal to 0x7F (becomes zero
+                // under the xor and is caught by the zero byte test).
+                uint64_t xorDelete = chunk ^ deleteBytes;
+                if ((chunk & highBits) != 0 ||
+                    ((chunk - spaceBytes) & ~chunk & highBits) != 0 ||
+                    ((xorDelete - oneBytes) & ~xorDelete & highBits) != 0)
+                {
+                    return false;
+                }
+            }
+
+            for (; index < input.size(); ++index)
+            {
+                char c = input[index];
+                if (c < 0x20 || c > 0x7E)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
     size_t UTF8Length(std::string_view input)
     {
+        if (IsPrintableAscii(input))
+        {
+            return input.size();
+        }
+
         ICUBreakIterator itr{ input, UBRK_CHARACTER };
 
         size_t numGraphemeClusters = 0;
@@ -339,6 +478,11 @@ namespace AppInstaller::Utility
 
     size_t UTF8ColumnWidth(const NormalizedUTF8<NormalizationC>& input)
     {
+        if (IsPrintableAscii(input))
+        {
+            return input.size();
+        }
+
         ICUBreakIterator itr{ input, UBRK_CHARACTER };
 
         size_t columnWidth = 0;
@@ -384,6 +528,13 @@ namespace AppInstaller::Utility
 
     std::string UTF8TrimRightToColumnWidth(const NormalizedUTF8<NormalizationC>& input, size_t expectedWidth, size_t& actualWidth)
     {
+        if (IsPrintableAscii(input))
+        {
+            size_t trimmedSize = std::min(input.size(), expectedWidth);
+            actualWidth = trimmedSize;
+            return input.substr(0, trimmedSize);
+        }
+
         ICUBreakIterator itr{ input, UBRK_CHARACTER };
 
         size_t columnWidth = 0;
@@ -423,6 +574,12 @@ namespace AppInstaller::Utility
             return {};
         }
 
+        // ASCII is invariant under every normalization form; skip the UTF-16 round trip.
+        if (IsAllAscii(input))
+        {
+            return std::string{ input };
+        }
+
         return ConvertToUTF8(Normalize(ConvertToUTF16(input), form));
     }
 
@@ -493,6 +650,14 @@ namespace AppInstaller::Utility
             return {};
         }
 
+        // Default case folding is simple lowercasing for the ASCII range; package
+        // identifiers and monikers are overwhelmingly ASCII, so this avoids the ICU
+        // case map on the hot comparison paths.
+        if (IsAllAscii(input))
+        {
+            return ToLower(input);
+        }
+
         wil::unique_any<UCaseMap*, decltype(ucasemap_close), &ucasemap_close> caseMap;
         UErrorCode errorCode = UErrorCode::U_ZERO_ERROR;
         caseMap.reset(ucasemap_open(nullptr, U_FOLD_CASE_DEFAULT, &errorCode));
@@ -535,6 +700,59 @@ namespace AppInstaller::Utility
         return result;
     }
 
+    std::string GenerateSortKey(std::string_view input)
+    {
+        // A single process lifetime collator; ucol_getSortKey is thread safe on a shared collator.
+        static UCollator* collator = []()
+        {
+            UErrorCode errorCode = UErrorCode::U_ZERO_ERROR;
+            UCollator* result = ucol_open(nullptr, &errorCode);
+
+            if (U_FAILURE(errorCode))
+            {
+                AICLI_LOG(Core, Error, << "ucol_open returned " << errorCode);
+                THROW_HR(APPINSTALLER_CLI_ERROR_ICU_COLLATION_ERROR);
+            }
+
+            // Secondary strength ignores case differences, matching the case folded
+            // comparisons that these keys replace.
+            ucol_setStrength(result, UCOL_SECONDARY);
+            return result;
+        }();
+
+        if (input.empty())
+        {
+            return {};
+        }
+
+        std::wstring utf16 = ConvertToUTF16(input);
+        const UChar* utf16Data = reinterpret_cast<const UChar*>(utf16.c_str());
+        int32_t utf16Length = static_cast<int32_t>(utf16.size());
+
+        int32_t keyLength = ucol_getSortKey(collator, utf16Data, utf16Length, nullptr, 0);
+        if (keyLength <= 0)
+        {
+            AICLI_LOG(Core, Error, << "ucol_getSortKey returned length " << keyLength);
+            THROW_HR(APPINSTALLER_CLI_ERROR_ICU_COLLATION_ERROR);
+        }
+
+        std::string result(static_cast<size_t>(keyLength), '\0');
+        keyLength = ucol_getSortKey(collator, utf16Data, utf16Length, reinterpret_cast<uint8_t*>(&result[0]), keyLength);
+        if (keyLength != static_cast<int32_t>(result.size()))
+        {
+            AICLI_LOG(Core, Error, << "ucol_getSortKey returned length " << keyLength);
+            THROW_HR(APPINSTALLER_CLI_ERROR_ICU_COLLATION_ERROR);
+        }
+
+        // Drop the null terminator that ICU includes in the key; it carries no ordering information.
+        while (!result.empty() && result.back() == '\0')
+        {
+            result.pop_back();
+        }
+
+        return result;
+    }
+
     bool IsEmptyOrWhitespace(std::string_view str)
     {
         if (str.empty())
@@ -906,13 +1124,35 @@ namespace AppInstaller::Utility
             THROW_HR_MSG(E_INVALIDARG, "ParseFromHexString: Invalid value size");
         }
 
-        const char* valuePtr = value.c_str();
+        // Table mapping a character to its hex digit value, with 0xFF marking non-hex characters.
+        static constexpr std::array<uint8_t, 256> hexDigitValues = []()
+        {
+            std::array<uint8_t, 256> values{};
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = 0xFF;
+            }
+            for (uint8_t i = 0; i < 10; ++i)
+            {
+                values['0' + i] = i;
+            }
+            for (uint8_t i = 0; i < 6; ++i)
+            {
+                values['a' + i] = static_cast<uint8_t>(10 + i);
+                values['A' + i] = static_cast<uint8_t>(10 + i);
+            }
+            return values;
+        }();
+
         std::vector<uint8_t> result;
         result.resize(value.size() / 2);
 
         for (size_t i = 0; i < result.size(); i++)
         {
-            sscanf_s(valuePtr + 2 * i, "%02hhx", &result[i]);
+            uint8_t high = hexDigitValues[static_cast<uint8_t>(value[2 * i])];
+            uint8_t low = hexDigitValues[static_cast<uint8_t>(value[2 * i + 1])];
+            THROW_HR_IF_MSG(E_INVALIDARG, high == 0xFF || low == 0xFF, "ParseFromHexString: Invalid character");
+            result[i] = static_cast<uint8_t>((high << 4) | low);
         }
 
         return result;
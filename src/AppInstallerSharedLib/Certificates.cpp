@@ -725,6 +725,14 @@ namespace AppInstaller::Certificates
         return chainContext;
     }
 
+    bool PinningConfiguration::IsCachedCertificate(PCCERT_CONTEXT certContext) const
+    {
+        const BYTE* encodedBegin = certContext->pbCertEncoded;
+        const BYTE* encodedEnd = encodedBegin + certContext->cbCertEncoded;
+        return certContext->cbCertEncoded == m_cachedCertificate.size() &&
+            std::equal(encodedBegin, encodedEnd, m_cachedCertificate.begin());
+    }
+
     bool PinningConfiguration::Validate(PCCERT_CONTEXT certContext, PCCERT_CHAIN_CONTEXT chainContext) const
     {
         if (m_configuration.empty())
@@ -733,10 +741,7 @@ namespace AppInstaller::Certificates
             return true;
         }
 
-        const BYTE* encodedBegin = certContext->pbCertEncoded;
-        const BYTE* encodedEnd = encodedBegin + certContext->cbCertEncoded;
-        if (certContext->cbCertEncoded == m_cachedCertificate.size() &&
-            std::equal(encodedBegin, encodedEnd, m_cachedCertificate.begin()))
+        if (IsCachedCertificate(certContext))
         {
             // We have seen this certificate and deemed it valid already.
             return true;
@@ -757,7 +762,7 @@ namespace AppInstaller::Certificates
         if (result)
         {
             // Only cache a successful validation.
-            m_cachedCertificate.assign(encodedBegin, encodedEnd);
+            m_cachedCertificate.assign(certContext->pbCertEncoded, certContext->pbCertEncoded + certContext->cbCertEncoded);
         }
         else
         {
@@ -769,6 +774,19 @@ namespace AppInstaller::Certificates
 
     bool PinningConfiguration::Validate(PCCERT_CONTEXT certContext) const
     {
+        if (m_configuration.empty())
+        {
+            // No pinning configured
+            return true;
+        }
+
+        if (IsCachedCertificate(certContext))
+        {
+            // We have seen this certificate and deemed it valid already; skip building
+            // the chain, which includes a potentially network-bound revocation check.
+            return true;
+        }
+
         auto chainContext = BuildCertificateChain(certContext);
         return Validate(certContext, chainContext.get());
     }
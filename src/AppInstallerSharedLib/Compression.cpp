@@ -90,4 +90,10 @@ namespace AppInstaller::Compression
         THROW_IF_WIN32_BOOL_FALSE(QueryDecompressorInformation(m_decompressor.get(), information, &result, sizeof(result)));
         return result;
     }
+
+    Decompressor& GetThreadLocalDecompressor(DWORD algorithm)
+    {
+        thread_local std::map<DWORD, Decompressor> decompressors;
+        return decompressors.try_emplace(algorithm, algorithm).first->second;
+    }
 }
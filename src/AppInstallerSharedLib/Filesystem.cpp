@@ -377,13 +377,48 @@ namespace AppInstaller::Filesystem
         return !resolvedPath.empty() && *resolvedPath.begin() == "..";
     }
 
+    void CopyFileWithProgress(const std::filesystem::path& from, const std::filesystem::path& to, const CopyFileProgress& progress)
+    {
+        if (!progress)
+        {
+            std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing);
+            return;
+        }
+
+        // CopyFile2 performs overlapped reads and writes internally; the callback only
+        // observes completed chunks, so reporting does not slow the copy itself.
+        COPYFILE2_EXTENDED_PARAMETERS parameters{};
+        parameters.dwSize = sizeof(parameters);
+        parameters.pProgressRoutine = [](const COPYFILE2_MESSAGE* message, PVOID context) -> COPYFILE2_MESSAGE_ACTION
+        {
+            if (message->Type == COPYFILE2_CALLBACK_CHUNK_FINISHED)
+            {
+                const CopyFileProgress& callback = *reinterpret_cast<const CopyFileProgress*>(context);
+                if (!callback(message->Info.ChunkFinished.uliTotalBytesTransferred.QuadPart, message->Info.ChunkFinished.uliTotalFileSize.QuadPart))
+                {
+                    return COPYFILE2_PROGRESS_CANCEL;
+                }
+            }
+
+            return COPYFILE2_PROGRESS_CONTINUE;
+        };
+        parameters.pvCallbackContext = const_cast<CopyFileProgress*>(&progress);
+
+        THROW_IF_FAILED(CopyFile2(from.c_str(), to.c_str(), &parameters));
+    }
+
+    void RenameFile(const std::filesystem::path& from, const std::filesystem::path& to)
+    {
+        RenameFile(from, to, {});
+    }
+
     // Complicated rename algorithm due to somewhat arbitrary failures.
     // 1. First, try to rename.
     // 2. Then, create an empty file for the target, and attempt to rename.
     // 3. Then, try repeatedly for 500ms in case it is a timing thing.
     // 4. Attempt to use a hard link if available.
     // 5. Copy the file if nothing else has worked so far.
-    void RenameFile(const std::filesystem::path& from, const std::filesystem::path& to)
+    void RenameFile(const std::filesystem::path& from, const std::filesystem::path& to, const CopyFileProgress& progress)
     {
         // 1. First, try to rename.
         try
@@ -436,7 +471,7 @@ namespace AppInstaller::Filesystem
         // 5. Copy the file if nothing else has worked so far.
         // Create a copy of the file; the installer will be left in the temp directory afterward
         // but it is better to succeed the operation and leave a file around than to fail.
-        std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing);
+        CopyFileWithProgress(from, to, progress);
     }
 
 #ifndef AICLI_DISABLE_TEST_HOOKS
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/winget/InternedString.h"
+
+namespace AppInstaller::Utility
+{
+    namespace
+    {
+        // The process wide intern pool.
+        // Entries are held weakly so that values no longer referenced by any owner
+        // do not keep their allocations alive for the lifetime of the process.
+        struct StringInternPool
+        {
+            std::shared_ptr<const std::string> Intern(std::string_view value)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                auto itr = m_pool.find(value);
+                if (itr != m_pool.end())
+                {
+                    std::shared_ptr<const std::string> existing = itr->second.lock();
+                    if (existing)
+                    {
+                        return existing;
+                    }
+                }
+
+                std::shared_ptr<const std::string> result = std::make_shared<std::string>(value);
+
+                if (itr != m_pool.end())
+                {
+                    itr->second = result;
+                }
+                else
+                {
+                    m_pool.emplace(std::string{ value }, result);
+                }
+
+                return result;
+            }
+
+            static StringInternPool& Instance()
+            {
+                static StringInternPool instance;
+                return instance;
+            }
+
+        private:
+            std::mutex m_lock;
+            std::map<std::string, std::weak_ptr<const std::string>, std::less<>> m_pool;
+        };
+    }
+
+    InternedString::InternedString(std::string_view value)
+    {
+        if (!value.empty())
+        {
+            m_value = StringInternPool::Instance().Intern(value);
+        }
+    }
+
+    const std::string& InternedString::get() const
+    {
+        static const std::string s_empty{};
+        return m_value ? *m_value : s_empty;
+    }
+}
@@ -89,6 +89,26 @@ namespace AppInstaller::JSON
         return node.at(keyName);
     }
 
+    std::optional<std::reference_wrapper<const web::json::value>> GetJsonValueFromNode(const web::json::value& node, const Key& key)
+    {
+        if (node.is_null() || !node.is_object())
+        {
+            return {};
+        }
+
+        // Scan the object directly; converting the key to utility::string_t in order to use
+        // has_field would allocate on every lookup.
+        for (const auto& field : node.as_object())
+        {
+            if (field.first == key.Name)
+            {
+                return field.second;
+            }
+        }
+
+        return {};
+    }
+
     std::optional<std::string> GetRawStringValueFromJsonValue(const web::json::value& value)
     {
         if (value.is_null() || !value.is_string())
@@ -121,6 +141,18 @@ namespace AppInstaller::JSON
         return {};
     }
 
+    std::optional<std::string> GetRawStringValueFromJsonNode(const web::json::value& node, const Key& key)
+    {
+        std::optional<std::reference_wrapper<const web::json::value>> jsonValue = GetJsonValueFromNode(node, key);
+
+        if (jsonValue)
+        {
+            return GetRawStringValueFromJsonValue(jsonValue.value().get());
+        }
+
+        return {};
+    }
+
     std::optional<std::wstring> GetWideStringValueFromJsonNode(const web::json::value& node, const utility::string_t& keyName)
     {
         std::optional<std::reference_wrapper<const web::json::value>> jsonValue = GetJsonValueFromNode(node, keyName);
@@ -218,6 +250,18 @@ namespace AppInstaller::JSON
         return jsonValue.value().get().as_array();
     }
 
+    std::optional<std::reference_wrapper<const web::json::array>> GetRawJsonArrayFromJsonNode(const web::json::value& node, const Key& key)
+    {
+        std::optional<std::reference_wrapper<const web::json::value>> jsonValue = GetJsonValueFromNode(node, key);
+
+        if (!jsonValue || !jsonValue.value().get().is_array())
+        {
+            return {};
+        }
+
+        return jsonValue.value().get().as_array();
+    }
+
     std::vector<std::string> GetRawStringArrayFromJsonNode(
         const web::json::value& node, const utility::string_t& keyName)
     {
@@ -241,6 +285,29 @@ namespace AppInstaller::JSON
         return result;
     }
 
+    std::vector<std::string> GetRawStringArrayFromJsonNode(
+        const web::json::value& node, const Key& key)
+    {
+        std::optional<std::reference_wrapper<const web::json::array>> arrayValue = GetRawJsonArrayFromJsonNode(node, key);
+
+        std::vector<std::string> result;
+        if (!arrayValue)
+        {
+            return result;
+        }
+
+        for (auto& value : arrayValue.value().get())
+        {
+            std::optional<std::string> item = GetRawStringValueFromJsonValue(value);
+            if (item)
+            {
+                result.emplace_back(std::move(item.value()));
+            }
+        }
+
+        return result;
+    }
+
     std::set<std::string> GetRawStringSetFromJsonNode(
         const web::json::value& node, const utility::string_t& keyName)
     {
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/winget/ParallelWork.h"
+#include "Public/winget/SharedThreadGlobals.h"
+
+#include <atomic>
+#include <thread>
+
+namespace AppInstaller::Parallel
+{
+    namespace
+    {
+        // Worker threads currently running across all parallel operations in the process.
+        std::atomic_size_t s_activeWorkers{ 0 };
+
+        size_t DetermineWorkerCount(size_t itemCount, size_t maxWorkers)
+        {
+            size_t hardwareConcurrency = std::thread::hardware_concurrency();
+            if (hardwareConcurrency == 0)
+            {
+                // The standard allows zero when the count cannot be determined.
+                hardwareConcurrency = 1;
+            }
+
+            size_t activeWorkers = s_activeWorkers.load();
+            size_t availableWorkers = (activeWorkers < hardwareConcurrency) ? hardwareConcurrency - activeWorkers : 1;
+
+            return std::max<size_t>(std::min({ itemCount, maxWorkers, availableWorkers }), 1);
+        }
+    }
+
+    void ForEachIndex(size_t itemCount, const std::function<void(size_t)>& work, size_t maxWorkers)
+    {
+        if (itemCount == 0)
+        {
+            return;
+        }
+
+        std::atomic_size_t nextIndex{ 0 };
+        std::vector<std::exception_ptr> exceptions(itemCount);
+
+        auto runWorkItems = [&]()
+            {
+                for (size_t i = nextIndex++; i < itemCount; i = nextIndex++)
+                {
+                    try
+                    {
+                        work(i);
+                    }
+                    catch (...)
+                    {
+                        exceptions[i] = std::current_exception();
+                    }
+                }
+            };
+
+        size_t workerCount = DetermineWorkerCount(itemCount, maxWorkers);
+
+        if (workerCount > 1)
+        {
+            // The calling thread is one of the workers; only the additional threads
+            // count against the process wide budget.
+            size_t additionalWorkers = workerCount - 1;
+            s_activeWorkers += additionalWorkers;
+            auto releaseWorkers = wil::scope_exit([&]() { s_activeWorkers -= additionalWorkers; });
+
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+            std::vector<std::thread> threads;
+            threads.reserve(additionalWorkers);
+
+            for (size_t i = 0; i < additionalWorkers; ++i)
+            {
+                threads.emplace_back([&, callerGlobals]()
+                    {
+                        // Propagate the caller's thread globals so that logging from the work items continues to work.
+                        std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                        if (callerGlobals)
+                        {
+                            previousGlobals = callerGlobals->SetForCurrentThread();
+                        }
+
+                        runWorkItems();
+                    });
+            }
+
+            runWorkItems();
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        else
+        {
+            runWorkItems();
+        }
+
+        for (const std::exception_ptr& exception : exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+}
@@ -163,6 +163,7 @@
 #define APPINSTALLER_CLI_ERROR_FONT_VALIDATION_FAILED               ((HRESULT)0x8A15008C)
 #define APPINSTALLER_CLI_ERROR_FONT_ROLLBACK_FAILED                 ((HRESULT)0x8A15008D)
 #define APPINSTALLER_CLI_ERROR_UPDATE_INSTALL_TECHNOLOGY_MISMATCH   ((HRESULT)0x8A15008E)
+#define APPINSTALLER_CLI_ERROR_ICU_COLLATION_ERROR                  ((HRESULT)0x8A15008F)
 
 // Install errors.
 #define APPINSTALLER_CLI_ERROR_INSTALL_PACKAGE_IN_USE                   ((HRESULT)0x8A150101)
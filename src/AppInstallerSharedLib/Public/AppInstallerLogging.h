@@ -198,6 +198,29 @@ namespace AppInstaller::Logging
 
     DiagnosticLogger& Log();
 
+    // A fixed size, always-on, lock free ring of recent diagnostic events.
+    // Recording never allocates, locks, or touches the logger, so it can stay enabled on hot
+    // paths while verbose logging is off, and its contents can be dumped from crash handling
+    // code that cannot safely go through the normal logging paths.
+    namespace EventRing
+    {
+        // The raw bytes of the ring in oldest-to-newest order, split where the ring wraps.
+        struct RawView
+        {
+            const char* First = nullptr;
+            size_t FirstSize = 0;
+            const char* Second = nullptr;
+            size_t SecondSize = 0;
+        };
+
+        // Records an event into the ring; overly long messages are truncated.
+        void Record(std::string_view message) noexcept;
+
+        // Gets the current contents of the ring without synchronizing with writers.
+        // Events being recorded concurrently may appear torn; intended for crash time use only.
+        RawView GetRawView() noexcept;
+    }
+
     // Calls the various stream format functions to produce an 8 character hexadecimal output.
     std::ostream& SetHRFormat(std::ostream& out);
 
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
+#include <array>
 #include <filesystem>
 #include <ostream>
 #include <optional>
@@ -14,12 +15,42 @@ namespace AppInstaller::Utility
     // Converts the given UTF16 string to UTF8
     std::string ConvertToUTF8(std::wstring_view input);
 
+    // Converts the given UTF16 string to UTF8, reusing the given buffer's storage.
+    // Intended for conversions inside loops, where a fresh allocation per call adds up.
+    void ConvertToUTF8(std::wstring_view input, std::string& buffer);
+
     // Converts the given UTF8 string to UTF16
     std::wstring ConvertToUTF16(std::string_view input, UINT codePage = CP_UTF8);
 
+    // Converts the given UTF8 string to UTF16, reusing the given buffer's storage.
+    void ConvertToUTF16(std::string_view input, std::wstring& buffer, UINT codePage = CP_UTF8);
+
     // Tries to convert the given UTF8 string to UTF16
     std::optional<std::wstring> TryConvertToUTF16(std::string_view input, UINT codePage = CP_UTF8);
 
+    // Converts the given UTF8 string to UTF16 using stack storage when the result is short
+    // (the common case for names passed to system calls), only allocating when it is not.
+    // The converted string lives in this object, so it can be neither copied nor moved.
+    struct StackUTF16
+    {
+        StackUTF16(std::string_view input, UINT codePage = CP_UTF8);
+
+        StackUTF16(const StackUTF16&) = delete;
+        StackUTF16& operator=(const StackUTF16&) = delete;
+        StackUTF16(StackUTF16&&) = delete;
+        StackUTF16& operator=(StackUTF16&&) = delete;
+
+        // The converted string; null terminated for passing to system calls.
+        const wchar_t* c_str() const { return m_view.data(); }
+
+        std::wstring_view get() const { return m_view; }
+
+    private:
+        std::array<wchar_t, 128> m_stack;
+        std::wstring m_heap;
+        std::wstring_view m_view;
+    };
+
     // Converts the given UTF8 string to UTF32
     std::u32string ConvertToUTF32(std::string_view input);
 
@@ -167,6 +198,13 @@ namespace AppInstaller::Utility
     // See https://unicode-org.github.io/icu/userguide/transforms/casemappings.html#case-folding
     NormalizedString FoldCase(const NormalizedString& input);
 
+    // Generates an ICU collation sort key for the given string.
+    // Plain byte comparison of two keys yields the same ordering that the collator would
+    // produce for the source strings (case-insensitively), making the keys suitable for
+    // computing once and comparing many times. Keys are only comparable against other keys
+    // generated within the same process; never persist them.
+    std::string GenerateSortKey(std::string_view input);
+
     // Checks if the input string is empty or whitespace
     bool IsEmptyOrWhitespace(std::string_view str);
     bool IsEmptyOrWhitespace(std::wstring_view str);
@@ -8,4 +8,7 @@
 #define WINEVENT_LEVEL_ERROR 0x2
 #define WINEVENT_LEVEL_WARNING 0x3
 #define WINEVENT_LEVEL_INFO 0x4
-#define WINEVENT_LEVEL_VERBOSE 0x5
\ No newline at end of file
+#define WINEVENT_LEVEL_VERBOSE 0x5
+
+#define WINEVENT_OPCODE_START 0x1
+#define WINEVENT_OPCODE_STOP 0x2
\ No newline at end of file
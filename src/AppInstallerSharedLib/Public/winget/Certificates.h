@@ -258,6 +258,9 @@ namespace AppInstaller::Certificates
         double GetRemainingLifetimePercentage() const;
 
     private:
+        // Determines if the given certificate is the one most recently validated successfully.
+        bool IsCachedCertificate(PCCERT_CONTEXT certContext) const;
+
         // The identifier used when logging.
         std::string m_identifier;
 
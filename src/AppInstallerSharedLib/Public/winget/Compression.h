@@ -51,4 +51,12 @@ namespace AppInstaller::Compression
     private:
         wil::unique_any<DECOMPRESSOR_HANDLE, decltype(CloseDecompressor), CloseDecompressor> m_decompressor;
     };
+
+    // Gets a decompressor for the given algorithm that is cached on the calling thread,
+    // creating it on first use. Creating the underlying handle is a significant portion
+    // of the cost of decompressing a small buffer, so callers that decompress many
+    // buffers should prefer this over constructing a new Decompressor each time.
+    // Buffer mode decompression carries no state across calls, so the shared
+    // decompressor needs no reset between uses.
+    Decompressor& GetThreadLocalDecompressor(DWORD algorithm);
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #pragma once
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <optional>
 #include <string_view>
@@ -24,8 +25,18 @@ namespace AppInstaller::Filesystem
     // Checks if a relative paths points to a location outside of the base path.
     bool PathEscapesBaseDirectory(std::string_view relativePath);
 
+    // Called as a copy makes progress with the bytes copied so far and the total file size;
+    // return false to cancel the copy.
+    using CopyFileProgress = std::function<bool(uint64_t bytesCopied, uint64_t totalBytes)>;
+
+    // Copies the file using the system copy engine, reporting progress and honoring
+    // cancellation through the given callback.
+    void CopyFileWithProgress(const std::filesystem::path& from, const std::filesystem::path& to, const CopyFileProgress& progress);
+
     // Renames the file to a new path.
+    // When the rename degrades to a cross volume copy, progress (if given) receives the copy progress.
     void RenameFile(const std::filesystem::path& from, const std::filesystem::path& to);
+    void RenameFile(const std::filesystem::path& from, const std::filesystem::path& to, const CopyFileProgress& progress);
 
     // Creates a symlink that points to the target path.
     bool CreateSymlink(const std::filesystem::path& target, const std::filesystem::path& link);
@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace AppInstaller::Utility
+{
+    // An immutable string whose storage is shared through a process wide intern pool.
+    // Interning the same value repeatedly yields objects that share a single allocation,
+    // which keeps the working set down when the same identifier appears across many
+    // objects and allows equality between interned values to short-circuit on identity.
+    struct InternedString
+    {
+        InternedString() = default;
+
+        // Interns the given value.
+        explicit InternedString(std::string_view value);
+
+        InternedString(const InternedString&) = default;
+        InternedString& operator=(const InternedString&) = default;
+
+        InternedString(InternedString&&) = default;
+        InternedString& operator=(InternedString&&) = default;
+
+        // Interns the given value.
+        InternedString& operator=(std::string_view value)
+        {
+            *this = InternedString{ value };
+            return *this;
+        }
+
+        bool empty() const { return !m_value || m_value->empty(); }
+
+        // Resets to the empty string.
+        void clear() { m_value.reset(); }
+
+        const std::string& get() const;
+
+        operator const std::string& () const { return get(); }
+        operator std::string_view() const { return get(); }
+
+        bool operator==(const InternedString& other) const { return m_value == other.m_value || get() == other.get(); }
+        bool operator!=(const InternedString& other) const { return !(*this == other); }
+
+        bool operator==(std::string_view value) const { return get() == value; }
+        bool operator!=(std::string_view value) const { return get() != value; }
+
+        bool operator<(const InternedString& other) const { return m_value != other.m_value && get() < other.get(); }
+
+        friend std::ostream& operator<<(std::ostream& out, const InternedString& value)
+        {
+            return (out << value.get());
+        }
+
+    private:
+        std::shared_ptr<const std::string> m_value;
+    };
+}
@@ -35,13 +35,26 @@ namespace AppInstaller::JSON
     std::optional<std::vector<std::string>> GetValue<std::vector<std::string>>(const Json::Value& node);
 
 #ifndef WINGET_DISABLE_FOR_FUZZING
+    // A field key for the cpprestsdk JSON helpers below.
+    // GetUtilityString converts and allocates on every call; the REST deserializers look up the
+    // same fixed set of fields for every package in a response. A Key wraps the wide form of the
+    // field name so that those lookups do not allocate per access.
+    struct Key
+    {
+        constexpr explicit Key(std::wstring_view name) : Name(name) {}
+
+        std::wstring_view Name;
+    };
+
     // For cpprestsdk JSON
     std::optional<std::reference_wrapper<const web::json::value>> GetJsonValueFromNode(const web::json::value& node, const utility::string_t& keyName);
+    std::optional<std::reference_wrapper<const web::json::value>> GetJsonValueFromNode(const web::json::value& node, const Key& key);
 
     std::optional<std::string> GetRawStringValueFromJsonValue(const web::json::value& value);
     std::optional<std::wstring> GetWideStringValueFromJsonValue(const web::json::value& value);
 
     std::optional<std::string> GetRawStringValueFromJsonNode(const web::json::value& node, const utility::string_t& keyName);
+    std::optional<std::string> GetRawStringValueFromJsonNode(const web::json::value& node, const Key& key);
     std::optional<std::wstring> GetWideStringValueFromJsonNode(const web::json::value& node, const utility::string_t& keyName);
 
     std::optional<bool> GetRawBoolValueFromJsonValue(const web::json::value& value);
@@ -49,8 +62,10 @@ namespace AppInstaller::JSON
     std::optional<bool> GetRawBoolValueFromJsonNode(const web::json::value& node, const utility::string_t& keyName);
 
     std::optional<std::reference_wrapper<const web::json::array>> GetRawJsonArrayFromJsonNode(const web::json::value& node, const utility::string_t& keyName);
+    std::optional<std::reference_wrapper<const web::json::array>> GetRawJsonArrayFromJsonNode(const web::json::value& node, const Key& key);
 
     std::vector<std::string> GetRawStringArrayFromJsonNode(const web::json::value& node, const utility::string_t& keyName);
+    std::vector<std::string> GetRawStringArrayFromJsonNode(const web::json::value& node, const Key& key);
     std::set<std::string> GetRawStringSetFromJsonNode(const web::json::value& node, const utility::string_t& keyName);
 
     std::optional<int> GetRawIntValueFromJsonValue(const web::json::value& value);
@@ -0,0 +1,22 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <functional>
+#include <limits>
+
+namespace AppInstaller::Parallel
+{
+    // Runs the given work item callable for each index in [0, itemCount).
+    // The calling thread participates as one of the workers, and indices are handed out
+    // through a shared cursor so that an expensive item does not serialize the items
+    // behind a fixed partition.
+    //
+    // Worker counts are drawn from a process wide budget based on the CPU count; when
+    // multiple operations run in parallel (as in the COM server) the later ones get
+    // fewer workers rather than oversubscribing the machine.
+    //
+    // The caller's thread globals are propagated to the worker threads, and the first
+    // exception thrown by a work item is rethrown on the calling thread after all of
+    // the workers complete.
+    void ForEachIndex(size_t itemCount, const std::function<void(size_t)>& work, size_t maxWorkers = std::numeric_limits<size_t>::max());
+}
@@ -284,6 +284,18 @@ namespace AppInstaller::Registry
 
         ValueList Values() const;
 
+        // Basic information about the key, from RegQueryInfoKey.
+        struct Info
+        {
+            DWORD SubKeyCount = 0;
+            FILETIME LastWriteTime = {};
+        };
+
+        // Gets basic information about the key.
+        // The last write time is updated when the key's values or immediate subkey set change,
+        // but not for changes further down the tree.
+        Info GetInfo() const;
+
         operator bool() const { return m_key.operator bool(); }
         operator HKEY() const { return m_key.get(); }
 
@@ -53,5 +53,36 @@ namespace AppInstaller::SQLite
 
         // Locks the connection for use during the schema upgrade.
         std::unique_ptr<TransactionLock> LockConnection();
+
+        // A dedicated read only connection pinned to the database state at the time it was created.
+        // Writers on the primary connection proceed concurrently; their changes are not visible here.
+        struct ReadSnapshot
+        {
+            // Implicit conversion to a connection object for convenience.
+            operator const Connection& () const { return m_connection; }
+            const Connection& GetConnection() const { return m_connection; }
+
+        private:
+            friend SQLiteDynamicStorage;
+
+            ReadSnapshot(const std::string& target);
+
+            Connection m_connection;
+            Transaction m_transaction;
+        };
+
+        // Enables write-ahead logging on the database so that snapshot readers never block behind a writer.
+        // Returns true if the journal mode change succeeded; memory backed databases will fail.
+        bool EnableSnapshotReads();
+
+        // Begins a read pinned to the current state of the database on a dedicated connection,
+        // without acquiring the connection lock. An empty result means that a snapshot is not
+        // available (snapshot reads are not enabled, or the schema version has changed) and the
+        // caller must fall back to TryBeginTransaction.
+        std::unique_ptr<ReadSnapshot> TryBeginSnapshotRead();
+
+    private:
+        std::string m_target;
+        bool m_snapshotReadsEnabled = false;
     };
 }
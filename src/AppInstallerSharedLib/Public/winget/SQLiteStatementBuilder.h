@@ -8,8 +8,9 @@
 #include <initializer_list>
 #include <memory>
 #include <optional>
-#include <sstream>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 using namespace std::string_view_literals;
@@ -22,6 +23,50 @@ namespace AppInstaller::SQLite::Builder
         struct unbound_t {};
         struct rowcount_t {};
 
+        // A minimal string-backed output stream for assembling statement text.
+        // Statements are built from many small appends; writing directly into a
+        // preallocated string avoids the per-insertion overhead of std::ostringstream.
+        struct StatementStream
+        {
+            // Large enough for most of the statements we build.
+            static constexpr size_t InitialCapacity = 128;
+
+            StatementStream()
+            {
+                m_string.reserve(InitialCapacity);
+            }
+
+            StatementStream(const StatementStream&) = default;
+            StatementStream& operator=(const StatementStream&) = default;
+
+            StatementStream(StatementStream&&) noexcept = default;
+            StatementStream& operator=(StatementStream&&) noexcept = default;
+
+            StatementStream& operator<<(std::string_view value)
+            {
+                m_string.append(value);
+                return *this;
+            }
+
+            StatementStream& operator<<(char value)
+            {
+                m_string.push_back(value);
+                return *this;
+            }
+
+            template <typename ValueType, std::enable_if_t<std::is_integral_v<ValueType>, int> = 0>
+            StatementStream& operator<<(ValueType value)
+            {
+                m_string.append(std::to_string(value));
+                return *this;
+            }
+
+            std::string str() const { return m_string; }
+
+        private:
+            std::string m_string;
+        };
+
         // Class for intake from external functions.
         struct SubBuilder
         {
@@ -53,7 +98,7 @@ namespace AppInstaller::SQLite::Builder
             virtual operator SubBuilder() { return { m_stream.str() }; }
 
         protected:
-            std::ostringstream m_stream;
+            StatementStream m_stream;
         };
     }
 
@@ -303,6 +348,9 @@ namespace AppInstaller::SQLite::Builder
         StatementBuilder& LikeWithEscape(std::string_view value);
         StatementBuilder& Like(details::unbound_t);
 
+        // Appends an FTS MATCH operator with an unbound expression.
+        StatementBuilder& Match(details::unbound_t);
+
         StatementBuilder& Escape(std::string_view escapeChar);
 
         StatementBuilder& Not();
@@ -500,6 +548,10 @@ namespace AppInstaller::SQLite::Builder
         // Prepares and returns the statement, applying any bindings that were requested.
         Statement Prepare(const Connection& connection);
 
+        // As Prepare, but reuses a compiled statement from the connection's cache when available.
+        // Intended for statements whose text recurs frequently on the same connection.
+        Statement PrepareCached(const Connection& connection);
+
         // A convenience function that prepares, binds, and then executes a statement that does not return rows.
         void Execute(const Connection& connection);
 
@@ -508,6 +560,7 @@ namespace AppInstaller::SQLite::Builder
         {
             Equals,
             Like,
+            Match,
             Escape,
             Literal,
             GreaterThan,
@@ -561,7 +614,7 @@ namespace AppInstaller::SQLite::Builder
             return *this;
         }
 
-        std::ostringstream m_stream;
+        details::StatementStream m_stream;
         // Because binding values starts at 1
         int m_bindIndex = 1;
         std::vector<std::function<void(Statement&)>> m_binders;
@@ -33,6 +33,17 @@ namespace AppInstaller::SQLite
         // Gets the schema version of the database.
         const Version& GetVersion() const { return m_version; }
 
+        // Gets the fraction of database pages that are unused free list pages.
+        double GetFreePageRatio() const;
+
+        // Rebuilds the database file, releasing unused pages back to the file system.
+        // Must be performed outside of a transaction.
+        void Vacuum();
+
+        // Interrupts any statement currently executing against the database, causing it
+        // to fail with SQLITE_INTERRUPT. Safe to call from another thread.
+        void Interrupt() const { m_dbconn.Interrupt(); }
+
         // Renames the database file and any auxiliary files given the inputs.
         // Should only be used on an inactive database.
         // If overwrite is given, existing destination files will be removed first.
@@ -43,6 +54,9 @@ namespace AppInstaller::SQLite
 
         SQLiteStorageBase(const std::string& filePath, SQLiteStorageBase::OpenDisposition disposition, Utility::ManagedFile&& indexFile);
 
+        // Opens an in-memory image of a database file for immutable read.
+        SQLiteStorageBase(SQLite::blob_t&& databaseImage);
+
         SQLiteStorageBase(const std::string& target, SQLiteStorageBase& source);
 
         // Sets the last write time metadata value in the database.
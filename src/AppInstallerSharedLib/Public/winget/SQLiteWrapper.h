@@ -8,7 +8,9 @@
 #include <AppInstallerLogging.h>
 #include <AppInstallerLanguageUtilities.h>
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -33,6 +35,18 @@ namespace AppInstaller::SQLite
     // The type to use for blob data.
     using blob_t = std::vector<uint8_t>;
 
+    // Determines whether statement steps should currently be timed; must be cheap,
+    // as it is consulted before every step.
+    using StatementStepTraceEnabledCallback = bool (*)();
+
+    // Receives the elapsed time of a statement step; the connection and statement
+    // identifiers match the ones written to the SQL diagnostic log channel.
+    using StatementStepTraceCallback = void (*)(size_t connectionId, size_t statementId, int64_t durationInMicroseconds, bool hasRow);
+
+    // Installs callbacks used to surface statement timing to a tracing provider in a
+    // higher layer. Expected to be called once during process initialization.
+    void SetStatementStepTrace(StatementStepTraceEnabledCallback enabledCallback, StatementStepTraceCallback traceCallback);
+
     namespace details
     {
         template<typename>
@@ -197,6 +211,26 @@ namespace AppInstaller::SQLite
             std::atomic_bool m_active = true;
             wil::unique_any<sqlite3*, decltype(sqlite3_close_v2), sqlite3_close_v2> m_dbconn;
         };
+
+        // Caches prepared statements by their SQL text so that hot queries skip recompilation.
+        // Entries are evicted in least recently used order once the capacity is reached.
+        struct PreparedStatementCache
+        {
+            using unique_stmt = wil::unique_any<sqlite3_stmt*, decltype(sqlite3_finalize), sqlite3_finalize>;
+
+            // Removes and returns the cached statement for the given SQL text, if present.
+            unique_stmt Take(std::string_view sql);
+
+            // Places a statement into the cache under the given SQL text, evicting the least recently used entry if full.
+            void Return(std::string&& sql, unique_stmt&& stmt);
+
+        private:
+            // Large enough to hold the search and property statements that recur during a session.
+            static constexpr size_t s_capacity = 64;
+
+            std::mutex m_lock;
+            std::list<std::pair<std::string, unique_stmt>> m_entries;
+        };
     }
 
     // A SQLite exception.
@@ -234,6 +268,10 @@ namespace AppInstaller::SQLite
 
         static Connection Create(const std::string& target, OpenDisposition disposition, OpenFlags flags = OpenFlags::None);
 
+        // Opens a read only connection over an in-memory image of a database file.
+        // The image is served to SQLite through a private VFS; nothing is written to disk.
+        static Connection CreateFromBuffer(blob_t&& databaseImage);
+
         Connection() = default;
 
         Connection(const Connection&) = delete;
@@ -269,8 +307,25 @@ namespace AppInstaller::SQLite
         // Must be a power of two between 512 and 65536 (inclusive), but we let SQLite enforce that.
         void SetPageSize(size_t pageSize);
 
+        // Sets the maximum number of bytes of the database file that will be accessed using memory-mapped I/O.
+        // Reads within the mapped region avoid both the page cache copy and per-page read syscalls.
+        void SetMmapSize(size_t mmapSize);
+
+        // Gets the total number of pages in the database file.
+        size_t GetTotalPageCount() const;
+
+        // Gets the number of unused pages on the database free list.
+        size_t GetFreePageCount() const;
+
+        // Interrupts any statement currently executing on this connection, causing it
+        // to fail with SQLITE_INTERRUPT. Safe to call from another thread.
+        void Interrupt() const;
+
         operator sqlite3* () const { return m_dbconn->Get(); }
 
+        // Gets the prepared statement cache for this connection.
+        const std::shared_ptr<details::PreparedStatementCache>& GetStatementCache() const { return m_stmtCache; }
+
     protected:
         // Gets the shared connection.
         std::shared_ptr<details::SharedConnection> GetSharedConnection() const;
@@ -280,8 +335,14 @@ namespace AppInstaller::SQLite
 
         size_t m_id = 0;
         std::shared_ptr<details::SharedConnection> m_dbconn;
+        std::shared_ptr<details::PreparedStatementCache> m_stmtCache = std::make_shared<details::PreparedStatementCache>();
     };
 
+    // The parameter count to prepare IN clauses with when binding value sets in chunks
+    // via Statement::BindValueSetChunk. Using a fixed count keeps the SQL text stable,
+    // so one cached statement serves value sets of any size.
+    constexpr size_t ValueSetChunkSize = 64;
+
     // A SQL statement.
     struct Statement
     {
@@ -289,6 +350,11 @@ namespace AppInstaller::SQLite
         static Statement Create(const Connection& connection, std::string_view sql);
         static Statement Create(const Connection& connection, char const* const sql);
 
+        // Creates a statement, reusing a previously compiled statement with the same SQL text
+        // from the connection's cache when one is available. The underlying statement is
+        // returned to the cache when this object is destroyed, unless it is in an error state.
+        static Statement CreateCached(const Connection& connection, const std::string& sql);
+
         Statement() = default;
 
         Statement(const Statement&) = delete;
@@ -297,6 +363,8 @@ namespace AppInstaller::SQLite
         Statement(Statement&& other) = default;
         Statement& operator=(Statement&& other) = default;
 
+        ~Statement();
+
         operator sqlite3_stmt* () const { return m_stmt.get(); }
 
         // The state of the statement.
@@ -324,6 +392,30 @@ namespace AppInstaller::SQLite
             details::ParameterSpecifics<Value>::Bind(m_stmt.get(), index, std::forward<Value>(v));
         }
 
+        // Binds count sequential parameters starting at beginIndex to the values at
+        // [offset, offset + count) in the given vector. Parameters past the end of the
+        // vector are bound to null, which never matches an IN comparison. Prepare the
+        // IN clause with a fixed parameter count and bind successive chunks through
+        // this to evaluate a value set of any size with a single statement.
+        template <typename Value>
+        void BindValueSetChunk(int beginIndex, const std::vector<Value>& values, size_t offset, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t valueIndex = offset + i;
+                int parameterIndex = beginIndex + static_cast<int>(i);
+
+                if (valueIndex < values.size())
+                {
+                    Bind(parameterIndex, values[valueIndex]);
+                }
+                else
+                {
+                    Bind(parameterIndex, nullptr);
+                }
+            }
+        }
+
         // Evaluate the statement; either retrieving the next row or executing some action.
         // Returns true if there is a row of data, or false if there is none.
         // This return value is the equivalent of 'GetState() == State::HasRow' after calling Step.
@@ -380,6 +472,8 @@ namespace AppInstaller::SQLite
         size_t m_id = 0;
         wil::unique_any<sqlite3_stmt*, decltype(sqlite3_finalize), sqlite3_finalize> m_stmt;
         State m_state = State::Prepared;
+        std::shared_ptr<details::PreparedStatementCache> m_cache;
+        std::string m_cacheKey;
     };
 
     // A SQLite transaction.
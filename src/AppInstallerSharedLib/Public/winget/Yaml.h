@@ -91,7 +91,7 @@ namespace AppInstaller::YAML
         };
 
         Node() : m_type(Type::Invalid), m_tagType(TagType::Unknown) {}
-        Node(Type type, std::string tag, const Mark& mark);
+        Node(Type type, std::string_view tag, const Mark& mark);
 
         // Sets the scalar value of the node.
         void SetScalar(std::string value);
@@ -105,6 +105,9 @@ namespace AppInstaller::YAML
             return m_sequence->emplace_back(std::forward<Args>(args)...);
         }
 
+        // Reserves storage for the given number of child nodes in the sequence.
+        void ReserveSequence(size_t childCount);
+
         // Merges sequence nodes. If both sequence have the specified key with the same value
         // they will get merged together. All elements in sequence must have the key.
         void MergeSequenceNode(Node other, std::string_view key, bool caseInsensitive = false);
@@ -131,6 +134,7 @@ namespace AppInstaller::YAML
         explicit operator bool() const { return IsDefined(); }
 
         // Gets the scalar value as the requested type.
+        // as<std::string_view> returns a view into the node's storage; it is only valid while the node is alive.
         template <typename T>
         T as() const
         {
@@ -187,6 +191,9 @@ namespace AppInstaller::YAML
         std::string as_dispatch(std::string*) const;
         std::optional<std::string> try_as_dispatch(std::string*) const;
 
+        std::string_view as_dispatch(std::string_view*) const;
+        std::optional<std::string_view> try_as_dispatch(std::string_view*) const;
+
         std::wstring as_dispatch(std::wstring*) const;
         std::optional<std::wstring> try_as_dispatch(std::wstring*) const;
 
@@ -200,6 +207,7 @@ namespace AppInstaller::YAML
         std::optional<bool> try_as_dispatch(bool*) const;
 
         Type m_type;
+        // Only kept when the tag is not one of the well known values; the latter are fully described by m_tagType.
         std::string m_tag;
         TagType m_tagType;
         YAML::Mark m_mark;
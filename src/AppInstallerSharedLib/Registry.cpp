@@ -98,7 +98,7 @@ namespace AppInstaller::Registry
             }
         }
 
-        bool TryGetRegistryValueData(const wil::shared_hkey& key, const std::wstring& valueName, DWORD& type, std::vector<BYTE>& data)
+        bool TryGetRegistryValueData(const wil::shared_hkey& key, const wchar_t* valueName, DWORD& type, std::vector<BYTE>& data)
         {
             data.resize(64);
 
@@ -108,7 +108,7 @@ namespace AppInstaller::Registry
             while (data.size() < (64 << 20))
             {
                 byteCount = wil::safe_cast<DWORD>(data.size());
-                status = RegGetValueW(key.get(), nullptr, valueName.c_str(), RRF_RT_ANY | RRF_NOEXPAND, &type, data.data(), &byteCount);
+                status = RegGetValueW(key.get(), nullptr, valueName, RRF_RT_ANY | RRF_NOEXPAND, &type, data.data(), &byteCount);
 
                 if (status == ERROR_MORE_DATA && byteCount > data.size())
                 {
@@ -133,9 +133,9 @@ namespace AppInstaller::Registry
             return true;
         }
 
-        bool DeleteRegistryValueData(const wil::shared_hkey& key, const std::wstring& valueName)
+        bool DeleteRegistryValueData(const wil::shared_hkey& key, const wchar_t* valueName)
         {
-            LSTATUS status = RegDeleteValueW(key.get(), valueName.c_str());
+            LSTATUS status = RegDeleteValueW(key.get(), valueName);
 
             if (status == ERROR_FILE_NOT_FOUND)
             {
@@ -213,7 +213,7 @@ namespace AppInstaller::Registry
     {
         DWORD type;
         std::vector<BYTE> data;
-        if (!TryGetRegistryValueData(m_key, m_valueName, type, data))
+        if (!TryGetRegistryValueData(m_key, m_valueName.c_str(), type, data))
         {
             return std::nullopt;
         }
@@ -411,7 +411,20 @@ namespace AppInstaller::Registry
 
     std::optional<Value> Key::operator[](std::string_view name) const
     {
-        return operator[](Utility::ConvertToUTF16(name));
+        // Value names are short and lookups happen in tight loops; convert on the stack.
+        Utility::StackUTF16 nameUtf16{ name };
+
+        DWORD type;
+        std::vector<BYTE> data;
+
+        if (TryGetRegistryValueData(m_key, nameUtf16.c_str(), type, data))
+        {
+            return Value{ type, std::move(data) };
+        }
+        else
+        {
+            return {};
+        }
     }
 
     std::optional<Value> Key::operator[](const std::wstring& name) const
@@ -419,7 +432,7 @@ namespace AppInstaller::Registry
         DWORD type;
         std::vector<BYTE> data;
 
-        if (TryGetRegistryValueData(m_key, name, type, data))
+        if (TryGetRegistryValueData(m_key, name.c_str(), type, data))
         {
             return Value{ type, std::move(data) };
         }
@@ -436,7 +449,7 @@ namespace AppInstaller::Registry
 
     void Key::DeleteValue(const std::wstring& name) const
     {
-        if (DeleteRegistryValueData(m_key, name))
+        if (DeleteRegistryValueData(m_key, name.c_str()))
         {
             AICLI_LOG(Core, Verbose, << "Registry value '" << Utility::ConvertToUTF8(name) << "' deleted successfully.");
         }
@@ -494,6 +507,13 @@ namespace AppInstaller::Registry
         return { m_key };
     }
 
+    Key::Info Key::GetInfo() const
+    {
+        Info result;
+        THROW_IF_WIN32_ERROR(RegQueryInfoKeyW(m_key.get(), nullptr, nullptr, nullptr, &result.SubKeyCount, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, &result.LastWriteTime));
+        return result;
+    }
+
     Key Key::OpenIfExists(HKEY key, std::string_view subKey, DWORD options, REGSAM access)
     {
         return OpenIfExists(key, Utility::ConvertToUTF16(subKey), options, access);
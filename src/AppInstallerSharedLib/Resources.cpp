@@ -70,6 +70,9 @@ namespace AppInstaller
             }
 
             // Gets the string resource value.
+            // The language of the process does not change, so every resolved string is cached;
+            // output paths resolve the same ids repeatedly (each table cell, progress line, etc.)
+            // and the WinRT resource lookup is far more expensive than a hash probe.
             std::string ResolveString(std::wstring_view resKey) const
             {
                 if (resKey.empty())
@@ -77,13 +80,32 @@ namespace AppInstaller
                     return {};
                 }
 
+                {
+                    auto sharedLock = m_cacheLock.lock_shared();
+                    auto itr = m_cache.find(resKey);
+                    if (itr != m_cache.end())
+                    {
+                        return itr->second;
+                    }
+                }
+
+                std::string result;
                 if (m_wingetLoader)
                 {
-                    return Utility::ConvertToUTF8(m_wingetLoader.GetString(resKey));
+                    result = Utility::ConvertToUTF8(m_wingetLoader.GetString(resKey));
+                }
+                else
+                {
+                    // Loader failed to load resource file, print the resource key instead.
+                    result = Utility::ConvertToUTF8(resKey);
+                }
+
+                {
+                    auto exclusiveLock = m_cacheLock.lock_exclusive();
+                    m_cache.emplace(std::wstring{ resKey }, result);
                 }
 
-                // Loader failed to load resource file, print the resource key instead.
-                return Utility::ConvertToUTF8(resKey);
+                return result;
             }
 
             // Gets the string resource value or nothing if not present.
@@ -108,6 +130,8 @@ namespace AppInstaller
 
         private:
             winrt::Windows::ApplicationModel::Resources::ResourceLoader m_wingetLoader;
+            mutable wil::srwlock m_cacheLock;
+            mutable std::map<std::wstring, std::string, std::less<>> m_cache;
 
             Loader() : m_wingetLoader(nullptr)
             {
@@ -138,22 +138,43 @@ namespace AppInstaller::Utility {
         in.exceptions(std::ios_base::badbit);
 
         const int bufferSize = 1024 * 1024; // 1MB
-        auto buffer = std::make_unique<uint8_t[]>(bufferSize);
+
+        // Double buffer so that hashing one chunk overlaps reading the next;
+        // for large files this hides most of the hash cost behind the I/O.
+        auto buffers = std::make_unique<uint8_t[]>(static_cast<size_t>(bufferSize) * 2);
+        uint8_t* readBuffer = buffers.get();
+        uint8_t* hashBuffer = buffers.get() + bufferSize;
 
         SHA256 hasher;
         uint64_t totalSize = 0;
+        std::future<void> hashChunk;
 
         while (in.good())
         {
-            in.read((char*)(buffer.get()), bufferSize);
+            in.read((char*)readBuffer, bufferSize);
             std::streamsize bytesRead = in.gcount();
+
+            if (hashChunk.valid())
+            {
+                hashChunk.get();
+            }
+
             if (bytesRead)
             {
-                hasher.Add(buffer.get(), static_cast<size_t>(bytesRead));
+                std::swap(readBuffer, hashBuffer);
+                hashChunk = std::async(std::launch::async, [&hasher, hashBuffer, bytesRead]()
+                    {
+                        hasher.Add(hashBuffer, static_cast<size_t>(bytesRead));
+                    });
                 totalSize += static_cast<uint64_t>(bytesRead);
             }
         }
 
+        if (hashChunk.valid())
+        {
+            hashChunk.get();
+        }
+
         if (in.eof())
         {
             HashDetails result;
@@ -169,22 +190,46 @@ namespace AppInstaller::Utility {
 
     SHA256::HashBuffer SHA256::ComputeHashFromFile(const std::filesystem::path& path)
     {
-        std::ifstream inStream{ path, std::ifstream::binary };
-        const Utility::SHA256::HashBuffer& targetFileHash = Utility::SHA256::ComputeHash(inStream);
-        inStream.close();
-        return targetFileHash;
+        // Open the file directly with a sequential scan hint so that the cache manager
+        // reads ahead of the hashing, rather than going through a buffered ifstream.
+        wil::unique_hfile fileHandle{ CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+        THROW_LAST_ERROR_IF(!fileHandle);
+
+        return ComputeHashFromHandle(fileHandle.get());
     }
 
     SHA256::HashBuffer SHA256::ComputeHashFromHandle(HANDLE fileHandle)
     {
         constexpr DWORD bufferSize = 1024 * 1024;
-        auto buffer = std::make_unique<uint8_t[]>(bufferSize);
+
+        // Double buffer so that hashing one chunk overlaps reading the next,
+        // same as the stream based implementation above.
+        auto buffers = std::make_unique<uint8_t[]>(static_cast<size_t>(bufferSize) * 2);
+        uint8_t* readBuffer = buffers.get();
+        uint8_t* hashBuffer = buffers.get() + bufferSize;
+
         SHA256 hasher;
         DWORD bytesRead = 0;
+        std::future<void> hashChunk;
+
+        while (ReadFile(fileHandle, readBuffer, bufferSize, &bytesRead, nullptr) && bytesRead > 0)
+        {
+            if (hashChunk.valid())
+            {
+                hashChunk.get();
+            }
+
+            std::swap(readBuffer, hashBuffer);
+            DWORD bytesToHash = bytesRead;
+            hashChunk = std::async(std::launch::async, [&hasher, hashBuffer, bytesToHash]()
+                {
+                    hasher.Add(hashBuffer, bytesToHash);
+                });
+        }
 
-        while (ReadFile(fileHandle, buffer.get(), bufferSize, &bytesRead, nullptr) && bytesRead > 0)
+        if (hashChunk.valid())
         {
-            hasher.Add(buffer.get(), bytesRead);
+            hashChunk.get();
         }
 
         return hasher.Get();
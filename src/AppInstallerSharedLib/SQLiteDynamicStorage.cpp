@@ -5,7 +5,7 @@
 
 namespace AppInstaller::SQLite
 {
-    SQLiteDynamicStorage::SQLiteDynamicStorage(const std::string& target, const Version& version) : SQLiteStorageBase(target, version)
+    SQLiteDynamicStorage::SQLiteDynamicStorage(const std::string& target, const Version& version) : SQLiteStorageBase(target, version), m_target(target)
     {
         version.SetSchemaVersion(m_dbconn);
     }
@@ -17,7 +17,7 @@ namespace AppInstaller::SQLite
         const std::string& filePath,
         SQLiteStorageBase::OpenDisposition disposition,
         Utility::ManagedFile&& file)
-        : SQLiteStorageBase(filePath, disposition, std::move(file))
+        : SQLiteStorageBase(filePath, disposition, std::move(file)), m_target(filePath)
     {}
 
     SQLiteDynamicStorage::SQLiteDynamicStorage(
@@ -88,4 +88,42 @@ namespace AppInstaller::SQLite
     {
         return std::make_unique<TransactionLock>(*m_interfaceLock);
     }
+
+    SQLiteDynamicStorage::ReadSnapshot::ReadSnapshot(const std::string& target) :
+        m_connection(Connection::Create(target, Connection::OpenDisposition::ReadOnly))
+    {
+        m_transaction = Transaction::Create(m_connection, "readsnapshot", false);
+    }
+
+    bool SQLiteDynamicStorage::EnableSnapshotReads()
+    {
+        auto lock = LockConnection();
+        m_snapshotReadsEnabled = m_dbconn.SetJournalMode("WAL");
+        return m_snapshotReadsEnabled;
+    }
+
+    std::unique_ptr<SQLiteDynamicStorage::ReadSnapshot> SQLiteDynamicStorage::TryBeginSnapshotRead() try
+    {
+        if (!m_snapshotReadsEnabled)
+        {
+            return {};
+        }
+
+        std::unique_ptr<ReadSnapshot> result{ new ReadSnapshot{ m_target } };
+
+        // The first read pins the snapshot; reading the schema version also ensures that the
+        // caller's interface still matches the database.
+        Version currentVersion = Version::GetSchemaVersion(result->m_connection);
+        if (currentVersion != m_version)
+        {
+            result.reset();
+        }
+
+        return result;
+    }
+    catch (...)
+    {
+        AICLI_LOG(SQL, Warning, << "Failed to begin snapshot read; callers should fall back to locked access");
+        return {};
+    }
 }
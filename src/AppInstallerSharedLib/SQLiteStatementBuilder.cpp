@@ -5,7 +5,7 @@
 
 namespace AppInstaller::SQLite::Builder
 {
-    std::ostream& operator<<(std::ostream& out, const QualifiedColumn& column)
+    details::StatementStream& operator<<(details::StatementStream& out, const QualifiedColumn& column)
     {
         if (!column.Table.empty())
         {
@@ -15,7 +15,7 @@ namespace AppInstaller::SQLite::Builder
         return out;
     }
 
-    std::ostream& operator<<(std::ostream& out, const QualifiedTable& table)
+    details::StatementStream& operator<<(details::StatementStream& out, const QualifiedTable& table)
     {
         if (!table.Schema.empty())
         {
@@ -25,7 +25,7 @@ namespace AppInstaller::SQLite::Builder
         return out;
     }
 
-    std::ostream& operator<<(std::ostream& out, const details::SubBuilder& column)
+    details::StatementStream& operator<<(details::StatementStream& out, const details::SubBuilder& column)
     {
         out << column.GetString();
         return out;
@@ -33,12 +33,12 @@ namespace AppInstaller::SQLite::Builder
 
     namespace
     {
-        void OutputColumns(std::ostream& out, std::string_view op, std::string_view column)
+        void OutputColumns(details::StatementStream& out, std::string_view op, std::string_view column)
         {
             out << op << '[' << column << ']';
         }
 
-        void OutputColumns(std::ostream& out, std::string_view op, std::initializer_list<std::string_view> columns)
+        void OutputColumns(details::StatementStream& out, std::string_view op, std::initializer_list<std::string_view> columns)
         {
             out << op;
             bool isFirst = true;
@@ -49,12 +49,12 @@ namespace AppInstaller::SQLite::Builder
             }
         }
 
-        void OutputColumns(std::ostream& out, std::string_view op, const QualifiedColumn& column)
+        void OutputColumns(details::StatementStream& out, std::string_view op, const QualifiedColumn& column)
         {
             out << op << column;
         }
 
-        void OutputColumns(std::ostream& out, std::string_view op, std::initializer_list<QualifiedColumn> columns)
+        void OutputColumns(details::StatementStream& out, std::string_view op, std::initializer_list<QualifiedColumn> columns)
         {
             out << op;
             bool isFirst = true;
@@ -65,7 +65,7 @@ namespace AppInstaller::SQLite::Builder
             }
         }
 
-        void OutputColumns(std::ostream& out, std::string_view op, std::initializer_list<details::SubBuilder> columns)
+        void OutputColumns(details::StatementStream& out, std::string_view op, std::initializer_list<details::SubBuilder> columns)
         {
             out << op;
             bool isFirst = true;
@@ -76,7 +76,7 @@ namespace AppInstaller::SQLite::Builder
             }
         }
 
-        void OutputAggregate(std::ostream& out, Aggregate op)
+        void OutputAggregate(details::StatementStream& out, Aggregate op)
         {
             out << ' ';
             switch (op)
@@ -92,30 +92,30 @@ namespace AppInstaller::SQLite::Builder
             }
         }
 
-        void OutputColumns(std::ostream& out, Aggregate op, std::string_view column)
+        void OutputColumns(details::StatementStream& out, Aggregate op, std::string_view column)
         {
             OutputAggregate(out, op);
             out << "([" << column << "])";
         }
 
-        void OutputColumns(std::ostream& out, Aggregate op, const QualifiedColumn& column)
+        void OutputColumns(details::StatementStream& out, Aggregate op, const QualifiedColumn& column)
         {
             OutputAggregate(out, op);
             out << '(' << column << ')';
         }
 
         // Use to output operation and table name, such as " FROM [table]"
-        void OutputOperationAndTable(std::ostream& out, std::string_view op, std::string_view table)
+        void OutputOperationAndTable(details::StatementStream& out, std::string_view op, std::string_view table)
         {
             out << op << " [" << table << ']';
         }
 
-        void OutputOperationAndTable(std::ostream& out, std::string_view op, QualifiedTable table)
+        void OutputOperationAndTable(details::StatementStream& out, std::string_view op, QualifiedTable table)
         {
             out << op << table;
         }
 
-        void OutputOperationAndTable(std::ostream& out, std::string_view op, std::initializer_list<std::string_view> table)
+        void OutputOperationAndTable(details::StatementStream& out, std::string_view op, std::initializer_list<std::string_view> table)
         {
             out << op << " [";
             for (std::string_view t : table)
@@ -125,7 +125,7 @@ namespace AppInstaller::SQLite::Builder
             out << ']';
         }
 
-        void OutputType(std::ostream& out, Type type)
+        void OutputType(details::StatementStream& out, Type type)
         {
             out << ' ';
             switch (type)
@@ -388,6 +388,12 @@ namespace AppInstaller::SQLite::Builder
         return *this;
     }
 
+    StatementBuilder& StatementBuilder::Match(details::unbound_t)
+    {
+        AppendOpAndBinder(Op::Match);
+        return *this;
+    }
+
     StatementBuilder& StatementBuilder::Escape(std::string_view escapeChar)
     {
         THROW_HR_IF(E_INVALIDARG, escapeChar.length() != 1);
@@ -944,6 +950,16 @@ namespace AppInstaller::SQLite::Builder
         return result;
     }
 
+    Statement StatementBuilder::PrepareCached(const Connection& connection)
+    {
+        Statement result = Statement::CreateCached(connection, m_stream.str());
+        for (const auto& f : m_binders)
+        {
+            f(result);
+        }
+        return result;
+    }
+
     void StatementBuilder::Execute(const Connection& connection)
     {
         Prepare(connection).Execute();
@@ -959,6 +975,9 @@ namespace AppInstaller::SQLite::Builder
         case Op::Like:
             m_stream << " LIKE ?";
             break;
+        case Op::Match:
+            m_stream << " MATCH ?";
+            break;
         case Op::Escape:
             m_stream << " ESCAPE ?";
             break;
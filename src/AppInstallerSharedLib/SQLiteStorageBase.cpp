@@ -3,7 +3,9 @@
 #include "pch.h"
 #include "Public/winget/SQLiteStorageBase.h"
 #include "Public/winget/SQLiteMetadataTable.h"
+#include "Public/winget/SQLiteStatementBuilder.h"
 #include "AppInstallerDateTime.h"
+#include "Public/AppInstallerStrings.h"
 
 namespace AppInstaller::SQLite
 {
@@ -37,6 +39,56 @@ namespace AppInstaller::SQLite
 
             return result;
         }
+
+        // The amount of the database file made available through memory-mapped I/O when opened for read only use.
+        // Large enough to cover any index we currently produce; SQLite only maps what the file actually contains.
+        constexpr size_t s_ReadOnlyMmapSize = 1ull << 28;
+
+        // Warms the file cache for a database about to be read. Queries demand-fault index pages
+        // in effectively random order, which is very slow on cold rotational media; prefetching the
+        // file sequentially up front lets the reads that follow hit the cache instead. Best effort.
+        void PrefetchDatabaseFile(const std::string& filePath) try
+        {
+            wil::unique_hfile file{ CreateFileW(
+                Utility::ConvertToUTF16(filePath).c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_FLAG_SEQUENTIAL_SCAN,
+                nullptr) };
+            if (!file)
+            {
+                return;
+            }
+
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file.get(), &size) || size.QuadPart == 0 || size.QuadPart > static_cast<LONGLONG>(s_ReadOnlyMmapSize))
+            {
+                return;
+            }
+
+            wil::unique_handle mapping{ CreateFileMappingW(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr) };
+            if (!mapping)
+            {
+                return;
+            }
+
+            wil::unique_mapview_ptr<void> view{ MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0) };
+            if (!view)
+            {
+                return;
+            }
+
+            // The pages land in the system file cache, so the connection's own mapping of the
+            // same file benefits even though this view is released immediately.
+            WIN32_MEMORY_RANGE_ENTRY range{ view.get(), static_cast<SIZE_T>(size.QuadPart) };
+            if (!PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0))
+            {
+                AICLI_LOG(SQL, Verbose, << "PrefetchVirtualMemory failed: " << GetLastError());
+            }
+        }
+        CATCH_LOG()
     }
 
     // One method for converting open disposition to proper open disposition
@@ -54,6 +106,20 @@ namespace AppInstaller::SQLite
         return Utility::ConvertUnixEpochToSystemClock(lastWriteTime);
     }
 
+    double SQLiteStorageBase::GetFreePageRatio() const
+    {
+        size_t totalPages = m_dbconn.GetTotalPageCount();
+        return totalPages ? static_cast<double>(m_dbconn.GetFreePageCount()) / static_cast<double>(totalPages) : 0.0;
+    }
+
+    void SQLiteStorageBase::Vacuum()
+    {
+        AICLI_LOG(SQL, Info, << "Vacuuming database");
+        Builder::StatementBuilder builder;
+        builder.Vacuum();
+        builder.Execute(m_dbconn);
+    }
+
     std::string SQLiteStorageBase::GetDatabaseIdentifier() const
     {
         return MetadataTable::TryGetNamedValue<std::string>(m_dbconn, s_MetadataValueName_DatabaseIdentifier).value_or(std::string{});
@@ -97,13 +163,17 @@ namespace AppInstaller::SQLite
         switch (disposition)
         {
         case OpenDisposition::Read:
+            PrefetchDatabaseFile(filePath);
             m_dbconn = SQLite::Connection::Create(filePath, SQLite::Connection::OpenDisposition::ReadOnly, SQLite::Connection::OpenFlags::None);
+            m_dbconn.SetMmapSize(s_ReadOnlyMmapSize);
             break;
         case OpenDisposition::ReadWrite:
             m_dbconn = SQLite::Connection::Create(filePath, SQLite::Connection::OpenDisposition::ReadWrite, SQLite::Connection::OpenFlags::None);
             break;
         case OpenDisposition::Immutable:
         {
+            PrefetchDatabaseFile(filePath);
+
             // Following the algorithm set forth at https://sqlite.org/uri.html [3.1] to convert to a URI path
             // The execution order builds out the string so that it shouldn't require any moves (other than growing)
             std::string target;
@@ -146,7 +216,8 @@ namespace AppInstaller::SQLite
             }
 
             target += "?immutable=1";
-            m_dbconn = SQLite::Connection::Create(filePath, SQLite::Connection::OpenDisposition::ReadOnly, SQLite::Connection::OpenFlags::Uri);
+            m_dbconn = SQLite::Connection::Create(target, SQLite::Connection::OpenDisposition::ReadOnly, SQLite::Connection::OpenFlags::Uri);
+            m_dbconn.SetMmapSize(s_ReadOnlyMmapSize);
             break;
         }
         default:
@@ -156,6 +227,13 @@ namespace AppInstaller::SQLite
         m_version = Version::GetSchemaVersion(m_dbconn);
     }
 
+    SQLiteStorageBase::SQLiteStorageBase(SQLite::blob_t&& databaseImage)
+    {
+        AICLI_LOG(Repo, Info, << "Opening database for ImmutableRead from an in-memory image of " << databaseImage.size() << " bytes");
+        m_dbconn = SQLite::Connection::CreateFromBuffer(std::move(databaseImage));
+        m_version = Version::GetSchemaVersion(m_dbconn);
+    }
+
     SQLiteStorageBase::SQLiteStorageBase(const std::string& target, const Version& version, size_t pageSize) :
         m_dbconn(SQLite::Connection::Create(target, SQLite::Connection::OpenDisposition::Create))
     {
@@ -54,6 +54,210 @@ namespace AppInstaller::SQLite
             static std::atomic_size_t statementId(0);
             return ++statementId;
         }
+
+        // Installed once during process initialization; see SetStatementStepTrace.
+        StatementStepTraceEnabledCallback s_stepTraceEnabled = nullptr;
+        StatementStepTraceCallback s_stepTrace = nullptr;
+
+        // ----- In-memory database VFS -----
+        // Serves a read only database image held in memory to SQLite without any file on disk.
+        // A buffer is registered under a unique name before the connection opens, claimed by
+        // xOpen, and owned by the file object until the connection closes.
+
+        constexpr char const* const s_MemoryVfsName = "winget-memvfs";
+
+        struct MemoryVfsFile
+        {
+            sqlite3_file Base;
+            blob_t Data;
+        };
+
+        std::mutex s_memoryVfsBuffersLock;
+        std::map<std::string, blob_t> s_memoryVfsBuffers;
+
+        int MemoryVfsClose(sqlite3_file* file)
+        {
+            reinterpret_cast<MemoryVfsFile*>(file)->~MemoryVfsFile();
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsRead(sqlite3_file* file, void* buffer, int amount, sqlite3_int64 offset)
+        {
+            const blob_t& data = reinterpret_cast<MemoryVfsFile*>(file)->Data;
+
+            size_t available = 0;
+            if (offset >= 0 && static_cast<uint64_t>(offset) < data.size())
+            {
+                available = std::min(static_cast<size_t>(amount), data.size() - static_cast<size_t>(offset));
+                memcpy(buffer, data.data() + static_cast<size_t>(offset), available);
+            }
+
+            if (available < static_cast<size_t>(amount))
+            {
+                // SQLite requires that the remainder be zero filled on a short read.
+                memset(static_cast<uint8_t*>(buffer) + available, 0, static_cast<size_t>(amount) - available);
+                return SQLITE_IOERR_SHORT_READ;
+            }
+
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsWrite(sqlite3_file*, const void*, int, sqlite3_int64)
+        {
+            return SQLITE_READONLY;
+        }
+
+        int MemoryVfsTruncate(sqlite3_file*, sqlite3_int64)
+        {
+            return SQLITE_READONLY;
+        }
+
+        int MemoryVfsSync(sqlite3_file*, int)
+        {
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsFileSize(sqlite3_file* file, sqlite3_int64* size)
+        {
+            *size = static_cast<sqlite3_int64>(reinterpret_cast<MemoryVfsFile*>(file)->Data.size());
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsLock(sqlite3_file*, int)
+        {
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsUnlock(sqlite3_file*, int)
+        {
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsCheckReservedLock(sqlite3_file*, int* result)
+        {
+            *result = 0;
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsFileControl(sqlite3_file*, int, void*)
+        {
+            return SQLITE_NOTFOUND;
+        }
+
+        int MemoryVfsSectorSize(sqlite3_file*)
+        {
+            return 4096;
+        }
+
+        int MemoryVfsDeviceCharacteristics(sqlite3_file*)
+        {
+            return SQLITE_IOCAP_IMMUTABLE;
+        }
+
+        constexpr sqlite3_io_methods s_MemoryVfsIoMethods =
+        {
+            1,
+            MemoryVfsClose,
+            MemoryVfsRead,
+            MemoryVfsWrite,
+            MemoryVfsTruncate,
+            MemoryVfsSync,
+            MemoryVfsFileSize,
+            MemoryVfsLock,
+            MemoryVfsUnlock,
+            MemoryVfsCheckReservedLock,
+            MemoryVfsFileControl,
+            MemoryVfsSectorSize,
+            MemoryVfsDeviceCharacteristics,
+        };
+
+        int MemoryVfsOpen(sqlite3_vfs* vfs, const char* name, sqlite3_file* file, int flags, int* outFlags) try
+        {
+            // Only main database files come from the registered buffers. SQLite may also ask for
+            // transient files (temporary tables, sort spills); those go to the real VFS.
+            if (!(flags & SQLITE_OPEN_MAIN_DB))
+            {
+                sqlite3_vfs* defaultVfs = static_cast<sqlite3_vfs*>(vfs->pAppData);
+                return defaultVfs->xOpen(defaultVfs, name, file, flags, outFlags);
+            }
+
+            if (!name)
+            {
+                return SQLITE_CANTOPEN;
+            }
+
+            blob_t data;
+            {
+                std::lock_guard<std::mutex> lock{ s_memoryVfsBuffersLock };
+                auto itr = s_memoryVfsBuffers.find(name);
+                if (itr == s_memoryVfsBuffers.end())
+                {
+                    return SQLITE_CANTOPEN;
+                }
+                data = std::move(itr->second);
+                s_memoryVfsBuffers.erase(itr);
+            }
+
+            // SQLite allocates szOsFile bytes of raw storage for the file object.
+            MemoryVfsFile* result = new (file) MemoryVfsFile{ {}, std::move(data) };
+            result->Base.pMethods = &s_MemoryVfsIoMethods;
+
+            if (outFlags)
+            {
+                *outFlags = SQLITE_OPEN_READONLY;
+            }
+
+            return SQLITE_OK;
+        }
+        catch (...)
+        {
+            return SQLITE_NOMEM;
+        }
+
+        int MemoryVfsDelete(sqlite3_vfs*, const char*, int)
+        {
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsAccess(sqlite3_vfs*, const char*, int, int* result)
+        {
+            *result = 0;
+            return SQLITE_OK;
+        }
+
+        int MemoryVfsFullPathname(sqlite3_vfs*, const char* name, int outSize, char* out)
+        {
+            sqlite3_snprintf(outSize, out, "%s", name);
+            return SQLITE_OK;
+        }
+
+        void EnsureMemoryVfsRegistered()
+        {
+            static int s_registration = []()
+            {
+                // Start from the default VFS so that randomness, sleep and time still function,
+                // keeping a pointer to it for delegating transient file opens.
+                sqlite3_vfs* defaultVfs = sqlite3_vfs_find(nullptr);
+                static sqlite3_vfs s_vfs = *defaultVfs;
+                s_vfs.zName = s_MemoryVfsName;
+                s_vfs.szOsFile = std::max(static_cast<int>(sizeof(MemoryVfsFile)), defaultVfs->szOsFile);
+                s_vfs.pNext = nullptr;
+                s_vfs.pAppData = defaultVfs;
+                s_vfs.xOpen = MemoryVfsOpen;
+                s_vfs.xDelete = MemoryVfsDelete;
+                s_vfs.xAccess = MemoryVfsAccess;
+                s_vfs.xFullPathname = MemoryVfsFullPathname;
+                return sqlite3_vfs_register(&s_vfs, 0);
+            }();
+
+            THROW_IF_SQLITE_FAILED(s_registration, nullptr);
+        }
+    }
+
+    void SetStatementStepTrace(StatementStepTraceEnabledCallback enabledCallback, StatementStepTraceCallback traceCallback)
+    {
+        s_stepTraceEnabled = enabledCallback;
+        s_stepTrace = traceCallback;
     }
 
     namespace details
@@ -191,6 +395,35 @@ namespace AppInstaller::SQLite
         {
             return &m_dbconn;
         }
+
+        PreparedStatementCache::unique_stmt PreparedStatementCache::Take(std::string_view sql)
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            for (auto itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+            {
+                if (itr->first == sql)
+                {
+                    unique_stmt result = std::move(itr->second);
+                    m_entries.erase(itr);
+                    return result;
+                }
+            }
+
+            return {};
+        }
+
+        void PreparedStatementCache::Return(std::string&& sql, unique_stmt&& stmt)
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            m_entries.emplace_front(std::move(sql), std::move(stmt));
+
+            if (m_entries.size() > s_capacity)
+            {
+                m_entries.pop_back();
+            }
+        }
     }
 
     Connection::Connection(const std::string& target, OpenDisposition disposition, OpenFlags flags)
@@ -213,6 +446,41 @@ namespace AppInstaller::SQLite
         return result;
     }
 
+    Connection Connection::CreateFromBuffer(blob_t&& databaseImage)
+    {
+        EnsureMemoryVfsRegistered();
+
+        static std::atomic_size_t s_nextBufferId{ 0 };
+        std::string name = "/winget-memvfs-";
+        name += std::to_string(++s_nextBufferId);
+
+        {
+            std::lock_guard<std::mutex> lock{ s_memoryVfsBuffersLock };
+            s_memoryVfsBuffers.emplace(name, std::move(databaseImage));
+        }
+
+        // xOpen claims the buffer; removing it here is a no-op on success
+        // but prevents a leak if the open fails before reaching the VFS.
+        auto removeBufferOnExit = wil::scope_exit([&]()
+            {
+                std::lock_guard<std::mutex> lock{ s_memoryVfsBuffersLock };
+                s_memoryVfsBuffers.erase(name);
+            });
+
+        // The image cannot change, so open as immutable to skip locking and journal handling.
+        std::string target = "file:";
+        target += name;
+        target += "?immutable=1&vfs=";
+        target += s_MemoryVfsName;
+
+        Connection result{ target, OpenDisposition::ReadOnly, OpenFlags::Uri };
+
+        THROW_IF_SQLITE_FAILED(sqlite3_extended_result_codes(result.m_dbconn->Get(), 1), result.m_dbconn->Get());
+        result.SetBusyTimeout(250ms);
+
+        return result;
+    }
+
     void Connection::EnableICU()
     {
         AICLI_LOG(SQL, Verbose, << "Enabling ICU");
@@ -234,6 +502,12 @@ namespace AppInstaller::SQLite
         return m_id;
     }
 
+    void Connection::Interrupt() const
+    {
+        AICLI_LOG(SQL, Verbose, << "Interrupting connection #" << m_id);
+        sqlite3_interrupt(m_dbconn->Get());
+    }
+
     void Connection::SetBusyTimeout(std::chrono::milliseconds timeout)
     {
         THROW_IF_SQLITE_FAILED(sqlite3_busy_timeout(m_dbconn->Get(), static_cast<int>(timeout.count())), m_dbconn->Get());
@@ -260,6 +534,29 @@ namespace AppInstaller::SQLite
         setPageSize.Step();
     }
 
+    void Connection::SetMmapSize(size_t mmapSize)
+    {
+        std::ostringstream stream;
+        stream << "PRAGMA mmap_size=" << mmapSize;
+
+        Statement setMmapSize = Statement::Create(*this, stream.str());
+        setMmapSize.Step();
+    }
+
+    size_t Connection::GetTotalPageCount() const
+    {
+        Statement pageCount = Statement::Create(*this, "PRAGMA page_count");
+        THROW_HR_IF(E_UNEXPECTED, !pageCount.Step());
+        return static_cast<size_t>(pageCount.GetColumn<int64_t>(0));
+    }
+
+    size_t Connection::GetFreePageCount() const
+    {
+        Statement freelistCount = Statement::Create(*this, "PRAGMA freelist_count");
+        THROW_HR_IF(E_UNEXPECTED, !freelistCount.Step());
+        return static_cast<size_t>(freelistCount.GetColumn<int64_t>(0));
+    }
+
     std::shared_ptr<details::SharedConnection> Connection::GetSharedConnection() const
     {
         return m_dbconn;
@@ -271,6 +568,7 @@ namespace AppInstaller::SQLite
         m_connectionId = connection.GetID();
         m_id = GetNextStatementId();
         AICLI_LOG(SQL, Verbose, << "Preparing statement #" << m_connectionId << '-' << m_id << ": " << sql);
+        Logging::EventRing::Record(sql);
         // SQL string size should include the null terminator (https://www.sqlite.org/c3ref/prepare.html)
         assert(sql.data()[sql.size()] == '\0');
         THROW_IF_SQLITE_FAILED(sqlite3_prepare_v2(connection, sql.data(), static_cast<int>(sql.size() + 1), &m_stmt, nullptr), connection);
@@ -334,11 +632,60 @@ namespace AppInstaller::SQLite
         return { connection, sql };
     }
 
+    Statement Statement::CreateCached(const Connection& connection, const std::string& sql)
+    {
+        const auto& cache = connection.GetStatementCache();
+        details::PreparedStatementCache::unique_stmt cached = cache->Take(sql);
+
+        Statement result;
+        if (cached)
+        {
+            result.m_dbconn = connection.GetSharedConnection();
+            result.m_connectionId = connection.GetID();
+            result.m_id = GetNextStatementId();
+            result.m_stmt = std::move(cached);
+            AICLI_LOG(SQL, Verbose, << "Reusing statement #" << result.m_connectionId << '-' << result.m_id << ": " << sql);
+        }
+        else
+        {
+            result = Create(connection, sql);
+        }
+
+        result.m_cache = cache;
+        result.m_cacheKey = sql;
+        return result;
+    }
+
+    Statement::~Statement()
+    {
+        // Hand reusable statements back to the connection's cache rather than finalizing them.
+        if (m_cache && m_stmt && m_state != State::Error)
+        {
+            sqlite3_reset(m_stmt.get());
+            sqlite3_clear_bindings(m_stmt.get());
+            m_cache->Return(std::move(m_cacheKey), std::move(m_stmt));
+        }
+    }
+
     bool Statement::Step(bool closeConnectionOnError)
     {
         AICLI_LOG(SQL, Verbose, << "Stepping statement #" << m_connectionId << '-' << m_id);
+
+        bool traceStep = (s_stepTraceEnabled && s_stepTrace && s_stepTraceEnabled());
+        std::chrono::steady_clock::time_point stepStart;
+        if (traceStep)
+        {
+            stepStart = std::chrono::steady_clock::now();
+        }
+
         int result = sqlite3_step(m_stmt.get());
 
+        if (traceStep)
+        {
+            int64_t durationInMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - stepStart).count();
+            s_stepTrace(m_connectionId, m_id, durationInMicroseconds, result == SQLITE_ROW);
+        }
+
         if (result == SQLITE_ROW)
         {
             AICLI_LOG(SQL, Verbose, << "Statement #" << m_connectionId << '-' << m_id << " has data");
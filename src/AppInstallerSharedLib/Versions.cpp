@@ -15,6 +15,71 @@ namespace AppInstaller::Utility
     static constexpr std::string_view s_Approximate_Less_Than = "< "sv;
     static constexpr std::string_view s_Approximate_Greater_Than = "> "sv;
 
+    namespace
+    {
+        // The same version strings are parsed many times during a single command
+        // (composite correlation, version selection, sorting), so keep a bounded
+        // cache of parse results keyed on the input.
+        struct VersionParseCache
+        {
+            struct Entry
+            {
+                std::vector<Version::Part> Parts;
+                Version::ApproximateComparator Approximate = Version::ApproximateComparator::None;
+            };
+
+            // Creates the cache key for the given parse inputs.
+            // The split characters never contain the separator, so the key is unambiguous.
+            static std::string MakeKey(const std::string& version, std::string_view splitChars, bool trimPrefix)
+            {
+                std::string result;
+                result.reserve(version.size() + splitChars.size() + 2);
+                result = trimPrefix ? "1" : "0";
+                result += splitChars;
+                result += '\x1F';
+                result += version;
+                return result;
+            }
+
+            std::optional<Entry> Get(const std::string& key)
+            {
+                auto lock = m_lock.lock_shared();
+                auto itr = m_entries.find(key);
+                if (itr != m_entries.end())
+                {
+                    return itr->second;
+                }
+
+                return std::nullopt;
+            }
+
+            void Set(std::string&& key, Entry&& entry)
+            {
+                auto lock = m_lock.lock_exclusive();
+
+                // Keep the cache bounded; dropping everything is fine as it refills quickly.
+                if (m_entries.size() >= s_sizeLimit)
+                {
+                    m_entries.clear();
+                }
+
+                m_entries.emplace(std::move(key), std::move(entry));
+            }
+
+        private:
+            constexpr static size_t s_sizeLimit = 2048;
+
+            wil::srwlock m_lock;
+            std::unordered_map<std::string, Entry> m_entries;
+        };
+
+        VersionParseCache& GetVersionParseCache()
+        {
+            static VersionParseCache s_cache;
+            return s_cache;
+        }
+    }
+
     Version::Version(std::string&& version, std::string_view splitChars)
     {
         Assign(std::move(version), splitChars);
@@ -50,6 +115,17 @@ namespace AppInstaller::Utility
     {
         m_version = std::move(Utility::Trim(version));
 
+        // Reuse a previous parse of the same input if one is cached.
+        VersionParseCache& parseCache = GetVersionParseCache();
+        std::string cacheKey = VersionParseCache::MakeKey(m_version, splitChars, m_trimPrefix);
+
+        if (auto cached = parseCache.Get(cacheKey))
+        {
+            m_parts = std::move(cached->Parts);
+            m_approximateComparator = cached->Approximate;
+            return;
+        }
+
         // Process approximate comparator if applicable
         std::string baseVersion = m_version;
         if (CaseInsensitiveStartsWith(m_version, s_Approximate_Less_Than))
@@ -88,6 +164,9 @@ namespace AppInstaller::Utility
         Trim();
 
         THROW_HR_IF(E_INVALIDARG, m_approximateComparator != ApproximateComparator::None && IsBaseVersionUnknown());
+
+        // Only valid parses are cached.
+        parseCache.Set(std::move(cacheKey), VersionParseCache::Entry{ m_parts, m_approximateComparator });
     }
 
     void Version::Trim()
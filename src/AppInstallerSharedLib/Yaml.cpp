@@ -62,7 +62,7 @@ namespace AppInstaller::YAML
             out << "[line " << mark.line << "; col " << mark.column << ']';
         }
 
-        Node::TagType ConvertToTagType(const std::string& tag)
+        Node::TagType ConvertToTagType(std::string_view tag)
         {
             if (tag == s_strTag)
             {
@@ -210,8 +210,8 @@ namespace AppInstaller::YAML
         return m_mark;
     }
 
-    Node::Node(Type type, std::string tag, const YAML::Mark& mark) :
-        m_type(type), m_tag(std::move(tag)), m_mark(mark)
+    Node::Node(Type type, std::string_view tag, const YAML::Mark& mark) :
+        m_type(type), m_mark(mark)
     {
         if (m_type == Type::Sequence)
         {
@@ -222,7 +222,13 @@ namespace AppInstaller::YAML
             m_mapping = decltype(m_mapping)::value_type{};
         }
 
-        m_tagType = ConvertToTagType(m_tag);
+        m_tagType = ConvertToTagType(tag);
+
+        // The well known tags are fully described by the tag type; only keep the text of unrecognized ones.
+        if (m_tagType == TagType::Unknown)
+        {
+            m_tag = tag;
+        }
     }
 
     void Node::SetScalar(std::string value)
@@ -233,7 +239,7 @@ namespace AppInstaller::YAML
 
     void Node::SetScalar(std::string value, bool isQuoted)
     {
-        this->SetScalar(value);
+        this->SetScalar(std::move(value));
 
         // For untagged scalar nodes, libyaml always assigns the generic string
         // tag. Here we just try our best and assume that if the value is unquoted
@@ -259,6 +265,12 @@ namespace AppInstaller::YAML
         }
     }
 
+    void Node::ReserveSequence(size_t childCount)
+    {
+        Require(Type::Sequence);
+        m_sequence->reserve(childCount);
+    }
+
     bool Node::operator<(const Node& other) const
     {
         Require(Type::Scalar);
@@ -421,6 +433,16 @@ namespace AppInstaller::YAML
         return std::optional{ m_scalar };
     }
 
+    std::string_view Node::as_dispatch(std::string_view*) const
+    {
+        return m_scalar;
+    }
+
+    std::optional<std::string_view> Node::try_as_dispatch(std::string_view*) const
+    {
+        return std::optional{ std::string_view{ m_scalar } };
+    }
+
     std::wstring Node::as_dispatch(std::wstring*) const
     {
         return Utility::ConvertToUTF16(m_scalar);
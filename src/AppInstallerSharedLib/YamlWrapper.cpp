@@ -85,6 +85,20 @@ namespace AppInstaller::YAML::Wrapper
             return ConvertYamlString(node->data.scalar.value, mark, node->data.scalar.length);
         }
 
+        // Node construction only keeps the text of unrecognized tags, so pass a view rather than copying.
+        std::string_view ConvertYamlTag(yaml_char_t* tag, const yaml_mark_t& mark)
+        {
+            std::string_view resultView{ reinterpret_cast<char*>(tag) };
+
+            size_t invalidCharacter = Utility::FindControlCodeToConvert(resultView);
+            if (invalidCharacter != std::string::npos)
+            {
+                THROW_EXCEPTION(Exception(Exception::Type::Policy, "unsupported control character", ConvertMark(mark)));
+            }
+
+            return resultView;
+        }
+
         yaml_scalar_style_t ConvertStyle(ScalarStyle style)
         {
             switch (style)
@@ -139,7 +153,7 @@ namespace AppInstaller::YAML::Wrapper
             return {};
         }
 
-        Node result(ConvertNodeType(root->type), ConvertYamlString(root->tag, root->start_mark), ConvertMark(root->start_mark));
+        Node result(ConvertNodeType(root->type), ConvertYamlTag(root->tag, root->start_mark), ConvertMark(root->start_mark));
 
         struct StackItem
         {
@@ -180,13 +194,14 @@ namespace AppInstaller::YAML::Wrapper
                 {
                     // We've entered the sequence.
                     nestLevel++;
+                    stackItem.node->ReserveSequence(static_cast<size_t>(stackItem.yamlNode->data.sequence.items.top - stackItem.yamlNode->data.sequence.items.start));
                 }
 
                 yaml_node_item_t* child = stackItem.yamlNode->data.sequence.items.start + stackItem.childOffset++;
                 if (child < stackItem.yamlNode->data.sequence.items.top)
                 {
                     yaml_node_t* childYamlNode = GetNode(*child);
-                    Node& childNode = stackItem.node->AddSequenceNode(ConvertNodeType(childYamlNode->type), ConvertYamlString(childYamlNode->tag, childYamlNode->start_mark), ConvertMark(childYamlNode->start_mark));
+                    Node& childNode = stackItem.node->AddSequenceNode(ConvertNodeType(childYamlNode->type), ConvertYamlTag(childYamlNode->tag, childYamlNode->start_mark), ConvertMark(childYamlNode->start_mark));
                     resultStack.emplace(childYamlNode, &childNode);
                 }
                 else
@@ -211,12 +226,12 @@ namespace AppInstaller::YAML::Wrapper
                     yaml_node_t* keyYamlNode = GetNode(child->key);
                     THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_MAPPING_KEY, keyYamlNode->type != YAML_SCALAR_NODE);
 
-                    Node keyNode(ConvertNodeType(keyYamlNode->type), ConvertYamlString(keyYamlNode->tag, keyYamlNode->start_mark), ConvertMark(keyYamlNode->start_mark));
+                    Node keyNode(ConvertNodeType(keyYamlNode->type), ConvertYamlTag(keyYamlNode->tag, keyYamlNode->start_mark), ConvertMark(keyYamlNode->start_mark));
                     keyNode.SetScalar(ConvertScalarToString(keyYamlNode, keyYamlNode->start_mark));
 
                     yaml_node_t* valueYamlNode = GetNode(child->value);
 
-                    Node& childNode = stackItem.node->AddMappingNode(std::move(keyNode), ConvertNodeType(valueYamlNode->type), ConvertYamlString(valueYamlNode->tag, valueYamlNode->start_mark), ConvertMark(valueYamlNode->start_mark));
+                    Node& childNode = stackItem.node->AddMappingNode(std::move(keyNode), ConvertNodeType(valueYamlNode->type), ConvertYamlTag(valueYamlNode->tag, valueYamlNode->start_mark), ConvertMark(valueYamlNode->start_mark));
                     resultStack.emplace(valueYamlNode, &childNode);
                 }
                 else
@@ -34,6 +34,7 @@
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iomanip>
 #include <limits>
 #include <map>
@@ -47,6 +48,7 @@
 #include <sstream>
 #include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #pragma warning( push )
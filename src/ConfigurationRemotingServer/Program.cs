@@ -68,6 +68,7 @@ namespace ConfigurationRemotingServer
     internal class Program
     {
         private const string CommandLineSectionSeparator = "~~~~~~";
+        private const string SharedMemoryPrefix = "sharedmemory:";
         private const string ExternalModulesName = "ExternalModules";
 
         static int Main(string[] args)
@@ -94,7 +95,10 @@ namespace ConfigurationRemotingServer
                 LimitationSetMetadata? limitationSetMetadata = null;
 
                 // Parse limitation set if applicable.
-                // The format will be:
+                // The format will be either:
+                //     <Common args for initialization> ~~~~~~ sharedmemory:<section name>
+                // where the shared memory section contains two little-endian 64-bit lengths followed
+                // by the metadata json and the limitation set yaml, or inline:
                 //     <Common args for initialization> ~~~~~~ <Metadata json> ~~~~~~ <Limitation Set in yaml>
                 // Metadata json format:
                 //     {
@@ -109,14 +113,37 @@ namespace ConfigurationRemotingServer
                 var firstSeparatorIndex = commandStr.IndexOf(CommandLineSectionSeparator);
                 if (firstSeparatorIndex > 0)
                 {
-                    var secondSeparatorIndex = commandStr.IndexOf(CommandLineSectionSeparator, firstSeparatorIndex + CommandLineSectionSeparator.Length);
-                    if (secondSeparatorIndex <= 0)
+                    string metadataJson;
+                    byte[] limitationSetBytes;
+
+                    string sectionContent = commandStr.Substring(firstSeparatorIndex + CommandLineSectionSeparator.Length);
+                    int sharedMemoryIndex = sectionContent.IndexOf(SharedMemoryPrefix, StringComparison.Ordinal);
+                    if (sharedMemoryIndex >= 0)
+                    {
+                        string sectionName = sectionContent.Substring(sharedMemoryIndex + SharedMemoryPrefix.Length).Trim();
+                        using var mappedFile = System.IO.MemoryMappedFiles.MemoryMappedFile.OpenExisting(sectionName);
+                        using var viewStream = mappedFile.CreateViewStream();
+                        using var reader = new BinaryReader(viewStream);
+                        long metadataLength = reader.ReadInt64();
+                        long limitationSetLength = reader.ReadInt64();
+                        metadataJson = Encoding.UTF8.GetString(reader.ReadBytes(checked((int)metadataLength)));
+                        limitationSetBytes = reader.ReadBytes(checked((int)limitationSetLength));
+                    }
+                    else
                     {
-                        throw new ArgumentException("The input command contains only one separator string.");
+                        var secondSeparatorIndex = commandStr.IndexOf(CommandLineSectionSeparator, firstSeparatorIndex + CommandLineSectionSeparator.Length);
+                        if (secondSeparatorIndex <= 0)
+                        {
+                            throw new ArgumentException("The input command contains only one separator string.");
+                        }
+
+                        metadataJson = commandStr.Substring(
+                            firstSeparatorIndex + CommandLineSectionSeparator.Length,
+                            secondSeparatorIndex - firstSeparatorIndex - CommandLineSectionSeparator.Length);
+                        limitationSetBytes = Encoding.UTF8.GetBytes(commandStr.Substring(secondSeparatorIndex + CommandLineSectionSeparator.Length));
                     }
 
                     // Parse limitation set.
-                    byte[] limitationSetBytes = Encoding.UTF8.GetBytes(commandStr.Substring(secondSeparatorIndex + CommandLineSectionSeparator.Length));
                     MemoryStream memoryStream = new MemoryStream();
                     memoryStream.Write(limitationSetBytes);
                     memoryStream.Flush();
@@ -137,9 +164,7 @@ namespace ConfigurationRemotingServer
                     }
 
                     // Now parse metadata json and update the limitation set
-                    limitationSetMetadata = JsonSerializer.Deserialize<LimitationSetMetadata>(commandStr.Substring(
-                        firstSeparatorIndex + CommandLineSectionSeparator.Length,
-                        secondSeparatorIndex - firstSeparatorIndex - CommandLineSectionSeparator.Length));
+                    limitationSetMetadata = JsonSerializer.Deserialize<LimitationSetMetadata>(metadataJson);
 
                     if (limitationSetMetadata != null)
                     {
@@ -33,6 +33,20 @@ namespace Microsoft.Management.Configuration.Processor.PowerShell.DscResourcesIn
             this.Values = dscPropertyInfo.Values;
         }
 
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DscResourcePropertyInfoInternal"/> class from plain values.
+        /// Used when reconstructing cached resource information.
+        /// </summary>
+        /// <param name="name">Property name.</param>
+        /// <param name="propertyType">Property type.</param>
+        /// <param name="isMandatory">Whether the property is mandatory.</param>
+        internal DscResourcePropertyInfoInternal(string name, string propertyType, bool isMandatory)
+        {
+            this.Name = name;
+            this.PropertyType = propertyType;
+            this.IsMandatory = isMandatory;
+        }
+
         /// <summary>
         /// Gets or sets name of the property.
         /// </summary>
@@ -0,0 +1,264 @@
+// -----------------------------------------------------------------------------
+// <copyright file="DscResourceInfoCache.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace Microsoft.Management.Configuration.Processor.PowerShell.Helpers
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Text.Json;
+    using Microsoft.Management.Configuration.Processor.PowerShell.DscResourcesInfo;
+    using Microsoft.PowerShell.Commands;
+
+    /// <summary>
+    /// A persistent cache of Get-DscResource results, keyed by resource name and module specification.
+    /// Get-DscResource walks the entire PSModulePath and takes seconds per call; the location and
+    /// version of a resource only change when modules are installed or removed, so the results are
+    /// kept on disk and invalidated by the last write times of the module directories.
+    /// </summary>
+    internal sealed class DscResourceInfoCache
+    {
+        private const string CacheFileName = "DscResourceCache.json";
+
+        private static readonly object CacheFileLock = new object();
+
+        private readonly IReadOnlyList<string> modulePaths;
+        private readonly string cacheFilePath;
+        private CacheModel cache;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DscResourceInfoCache"/> class.
+        /// </summary>
+        /// <param name="modulePaths">The PSModulePath entries the cached results depend on.</param>
+        public DscResourceInfoCache(IReadOnlyList<string> modulePaths)
+        {
+            this.modulePaths = modulePaths;
+            this.cacheFilePath = Path.Combine(
+                Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
+                @"Microsoft\WinGet\Configuration",
+                CacheFileName);
+            this.cache = this.Load();
+        }
+
+        /// <summary>
+        /// Attempts to get a cached resource information object.
+        /// </summary>
+        /// <param name="name">Resource name.</param>
+        /// <param name="moduleSpecification">Module specification; null for any module.</param>
+        /// <returns>The reconstructed resource information, or null if not cached.</returns>
+        public DscResourceInfoInternal? TryGet(string name, ModuleSpecification? moduleSpecification)
+        {
+            CachedDscResourceInfo? cached;
+
+            lock (CacheFileLock)
+            {
+                if (!this.cache.Resources.TryGetValue(CreateKey(name, moduleSpecification), out cached))
+                {
+                    return null;
+                }
+            }
+
+            // The path backing the resource must still exist; anything else is treated as a miss.
+            if (string.IsNullOrEmpty(cached.Path) || !File.Exists(cached.Path))
+            {
+                return null;
+            }
+
+            var result = new DscResourceInfoInternal(
+                cached.Name,
+                cached.ModuleName,
+                Version.TryParse(cached.Version, out Version? version) ? version : null)
+            {
+                ResourceType = cached.ResourceType,
+                FriendlyName = cached.FriendlyName,
+                Path = cached.Path,
+                ParentPath = cached.ParentPath,
+                CompanyName = cached.CompanyName,
+            };
+
+            if (Enum.TryParse(cached.ImplementedAs, out ImplementedAsTypeInternal implementedAs))
+            {
+                result.ImplementedAs = implementedAs;
+            }
+
+            result.UpdateProperties(cached.Properties.Select(property =>
+            {
+                var propertyInfo = new DscResourcePropertyInfoInternal(property.Name, property.PropertyType, property.IsMandatory);
+                propertyInfo.Values.AddRange(property.Values);
+                return propertyInfo;
+            }).ToList());
+
+            return result;
+        }
+
+        /// <summary>
+        /// Stores a discovered resource information object and persists the cache.
+        /// </summary>
+        /// <param name="name">Resource name used for discovery.</param>
+        /// <param name="moduleSpecification">Module specification used for discovery; null for any module.</param>
+        /// <param name="resourceInfo">The discovered resource information.</param>
+        public void Store(string name, ModuleSpecification? moduleSpecification, DscResourceInfoInternal resourceInfo)
+        {
+            var cached = new CachedDscResourceInfo
+            {
+                ResourceType = resourceInfo.ResourceType,
+                Name = resourceInfo.Name,
+                FriendlyName = resourceInfo.FriendlyName,
+                ModuleName = resourceInfo.ModuleName,
+                Version = resourceInfo.Version?.ToString(),
+                Path = resourceInfo.Path,
+                ParentPath = resourceInfo.ParentPath,
+                ImplementedAs = resourceInfo.ImplementedAs?.ToString(),
+                CompanyName = resourceInfo.CompanyName,
+                Properties = resourceInfo.Properties.Select(property => new CachedDscResourceProperty
+                {
+                    Name = property.Name,
+                    PropertyType = property.PropertyType,
+                    IsMandatory = property.IsMandatory,
+                    Values = property.Values.ToList(),
+                }).ToList(),
+            };
+
+            lock (CacheFileLock)
+            {
+                this.cache.Resources[CreateKey(name, moduleSpecification)] = cached;
+
+                // Stamps are recomputed at save time so that entries stored after a module
+                // install during this run remain valid for the next one.
+                this.cache.PathStamps = this.ComputePathStamps();
+
+                try
+                {
+                    Directory.CreateDirectory(Path.GetDirectoryName(this.cacheFilePath)!);
+                    File.WriteAllText(this.cacheFilePath, JsonSerializer.Serialize(this.cache));
+                }
+                catch (Exception)
+                {
+                    // Failing to persist only costs rediscovery on the next run.
+                }
+            }
+        }
+
+        private static string CreateKey(string name, ModuleSpecification? moduleSpecification)
+        {
+            return $"{name}|{moduleSpecification?.ToString() ?? string.Empty}".ToLowerInvariant();
+        }
+
+        private CacheModel Load()
+        {
+            CacheModel? result = null;
+
+            lock (CacheFileLock)
+            {
+                try
+                {
+                    if (File.Exists(this.cacheFilePath))
+                    {
+                        result = JsonSerializer.Deserialize<CacheModel>(File.ReadAllText(this.cacheFilePath));
+                    }
+                }
+                catch (Exception)
+                {
+                    // A corrupt cache is simply discarded.
+                }
+            }
+
+            if (result is null)
+            {
+                return new CacheModel { PathStamps = this.ComputePathStamps() };
+            }
+
+            // Any module directory change invalidates all cached results.
+            var currentStamps = this.ComputePathStamps();
+            if (currentStamps.Count != result.PathStamps.Count ||
+                currentStamps.Any(stamp => !result.PathStamps.TryGetValue(stamp.Key, out long cachedStamp) || cachedStamp != stamp.Value))
+            {
+                return new CacheModel { PathStamps = currentStamps };
+            }
+
+            return result;
+        }
+
+        private Dictionary<string, long> ComputePathStamps()
+        {
+            var result = new Dictionary<string, long>(StringComparer.OrdinalIgnoreCase);
+
+            foreach (string modulePath in this.modulePaths)
+            {
+                if (string.IsNullOrWhiteSpace(modulePath))
+                {
+                    continue;
+                }
+
+                try
+                {
+                    if (!Directory.Exists(modulePath))
+                    {
+                        result[modulePath] = 0;
+                        continue;
+                    }
+
+                    result[modulePath] = Directory.GetLastWriteTimeUtc(modulePath).Ticks;
+
+                    // Installing a new version of a module only touches the directory of that
+                    // module, not the PSModulePath root, so stamp the first level as well.
+                    foreach (string moduleDirectory in Directory.EnumerateDirectories(modulePath))
+                    {
+                        result[moduleDirectory] = Directory.GetLastWriteTimeUtc(moduleDirectory).Ticks;
+                    }
+                }
+                catch (Exception)
+                {
+                    result[modulePath] = 0;
+                }
+            }
+
+            return result;
+        }
+
+        private sealed class CacheModel
+        {
+            public Dictionary<string, long> PathStamps { get; set; } = new Dictionary<string, long>(StringComparer.OrdinalIgnoreCase);
+
+            public Dictionary<string, CachedDscResourceInfo> Resources { get; set; } = new Dictionary<string, CachedDscResourceInfo>();
+        }
+
+        private sealed class CachedDscResourceInfo
+        {
+            public string? ResourceType { get; set; }
+
+            public string Name { get; set; } = string.Empty;
+
+            public string? FriendlyName { get; set; }
+
+            public string? ModuleName { get; set; }
+
+            public string? Version { get; set; }
+
+            public string? Path { get; set; }
+
+            public string? ParentPath { get; set; }
+
+            public string? ImplementedAs { get; set; }
+
+            public string? CompanyName { get; set; }
+
+            public List<CachedDscResourceProperty> Properties { get; set; } = new List<CachedDscResourceProperty>();
+        }
+
+        private sealed class CachedDscResourceProperty
+        {
+            public string Name { get; set; } = string.Empty;
+
+            public string PropertyType { get; set; } = string.Empty;
+
+            public bool IsMandatory { get; set; }
+
+            public List<string> Values { get; set; } = new List<string>();
+        }
+    }
+}
@@ -37,6 +37,9 @@ namespace Microsoft.Management.Configuration.Processor.PowerShell.Runspaces
         private PowerShellConfigurationProcessorLocation location = PowerShellConfigurationProcessorLocation.CurrentUser;
         private string? customLocation;
 
+        private DscResourceInfoCache? dscResourceCache;
+        private bool dscResourceCacheInitialized;
+
         /// <summary>
         /// Initializes a new instance of the <see cref="HostedEnvironment"/> class.
         /// </summary>
@@ -131,9 +134,24 @@ namespace Microsoft.Management.Configuration.Processor.PowerShell.Runspaces
         /// <inheritdoc/>
         public DscResourceInfoInternal? GetDscResource(ConfigurationUnitAndModule unitInternal)
         {
+            var cache = this.GetDscResourceCache();
+
+            var cachedResult = cache?.TryGet(unitInternal.ResourceName, unitInternal.Module);
+            if (cachedResult is not null)
+            {
+                this.OnDiagnostics(DiagnosticLevel.Verbose, $"Using cached DSC resource information for: {unitInternal.ResourceName}");
+                return cachedResult;
+            }
+
             using PowerShell pwsh = PowerShell.Create(this.Runspace);
             var result = this.DscModule.GetDscResource(pwsh, unitInternal.ResourceName, unitInternal.Module);
             this.OnDiagnostics(DiagnosticLevel.Verbose, pwsh);
+
+            if (result is not null)
+            {
+                cache?.Store(unitInternal.ResourceName, unitInternal.Module, result);
+            }
+
             return result;
         }
 
@@ -551,5 +569,26 @@ namespace Microsoft.Management.Configuration.Processor.PowerShell.Runspaces
         {
             return this.GetVariable<string>(Variables.PSModulePath).Split(";").ToHashSet<string>();
         }
+
+        private DscResourceInfoCache? GetDscResourceCache()
+        {
+            // Created lazily so that the PSModulePath changes made while setting up the
+            // environment are part of the paths the cache is invalidated by.
+            if (!this.dscResourceCacheInitialized)
+            {
+                this.dscResourceCacheInitialized = true;
+
+                try
+                {
+                    this.dscResourceCache = new DscResourceInfoCache(this.GetModulePaths().ToList());
+                }
+                catch (Exception e)
+                {
+                    this.OnDiagnostics(DiagnosticLevel.Warning, $"Failed to initialize the DSC resource cache: {e.Message}");
+                }
+            }
+
+            return this.dscResourceCache;
+        }
     }
 }
@@ -263,15 +263,17 @@ namespace winrt::Microsoft::Management::Configuration::implementation
             {
                 auto asyncOperation = localStream.ReadAsync(buffer, bufferSize, readOptions);
 
-                // Manually poll status and propagate cancellation to stay on this thread for thread globals
-                while (asyncOperation.Status() == Windows::Foundation::AsyncStatus::Started)
+                // Wait on this thread for thread globals, waking as soon as the read completes.
+                // Cancellation is propagated while waiting; cancelling completes the operation.
+                wil::slim_event readCompleted;
+                asyncOperation.Completed([&](auto&&, auto&&) { readCompleted.SetEvent(); });
+
+                while (!readCompleted.wait(100))
                 {
                     if (cancellation())
                     {
                         asyncOperation.Cancel();
                     }
-
-                    std::this_thread::sleep_for(100ms);
                 }
 
                 Windows::Storage::Streams::IBuffer readBuffer = asyncOperation.GetResults();
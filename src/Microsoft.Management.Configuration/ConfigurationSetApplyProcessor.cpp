@@ -3,12 +3,16 @@
 #include "pch.h"
 #include "ConfigurationSetApplyProcessor.h"
 #include "ConfigurationSetChangeData.h"
+#include "ConfigurationSetUtilities.h"
 #include "ExceptionResultHelpers.h"
 
 #include <AppInstallerErrors.h>
 #include <AppInstallerLogging.h>
 #include <AppInstallerStrings.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace winrt::Microsoft::Management::Configuration::implementation
 {
     namespace
@@ -69,6 +73,8 @@ namespace winrt::Microsoft::Management::Configuration::implementation
             m_result->UnitResults().Append(*m_unitInfo.back().Result);
         }
 
+        m_maxParallelism = GetConfigurationSetMaxParallelism(configurationSet);
+
         m_progress.Result(*m_result);
     }
 
@@ -242,12 +248,43 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         hresult errorForFailures,
         bool sendProgress)
     {
-        // Always process the first item in the list that is available to be processed
+        // Always process the first item in the list that is available to be processed.
+        // When the set opts into parallelism, every unit whose dependencies are already
+        // satisfied is dispatched together, up to the configured width.
         bool hasProcessed = true;
         bool hasFailure = false;
         while (hasProcessed)
         {
             hasProcessed = false;
+
+            if (m_maxParallelism > 1 && sendProgress)
+            {
+                std::vector<size_t> readyUnits;
+                for (size_t index : unitsToProcess)
+                {
+                    if (HasIntentAndSatisfiedDependencies(m_unitInfo[index], intentFilter, checkDependencyFunction))
+                    {
+                        readyUnits.emplace_back(index);
+                    }
+                }
+
+                if (!readyUnits.empty())
+                {
+                    if (!ProcessUnitsInParallel(readyUnits, processUnitFunction))
+                    {
+                        hasFailure = true;
+                    }
+
+                    unitsToProcess.erase(
+                        std::remove_if(unitsToProcess.begin(), unitsToProcess.end(),
+                            [&](size_t index) { return std::find(readyUnits.begin(), readyUnits.end(), index) != readyUnits.end(); }),
+                        unitsToProcess.end());
+                    hasProcessed = true;
+                }
+
+                continue;
+            }
+
             for (auto itr = unitsToProcess.begin(), end = unitsToProcess.end(); itr != end; ++itr)
             {
                 UnitInfo& unitInfo = m_unitInfo[*itr];
@@ -310,6 +347,64 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         return true;
     }
 
+    bool ConfigurationSetApplyProcessor::ProcessUnitsInParallel(const std::vector<size_t>& readyUnits, ProcessUnitPtr processUnitFunction)
+    {
+        bool allSucceeded = true;
+
+        for (size_t batchStart = 0; batchStart < readyUnits.size(); batchStart += m_maxParallelism)
+        {
+            size_t batchSize = std::min<size_t>(m_maxParallelism, readyUnits.size() - batchStart);
+
+            std::vector<std::thread> workers;
+            // Not vector<bool> as its elements cannot be written from different threads.
+            std::vector<char> results(batchSize, 0);
+            std::exception_ptr firstException;
+            std::mutex exceptionMutex;
+
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                UnitInfo& unitInfo = m_unitInfo[readyUnits[batchStart + i]];
+                workers.emplace_back([this, processUnitFunction, &unitInfo, &results, &firstException, &exceptionMutex, i]()
+                    {
+                        try
+                        {
+                            auto coUninitialize = wil::CoInitializeEx(COINIT_MULTITHREADED);
+                            results[i] = (this->*processUnitFunction)(unitInfo) ? 1 : 0;
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock{ exceptionMutex };
+                            if (!firstException)
+                            {
+                                firstException = std::current_exception();
+                            }
+                        }
+                    });
+            }
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+
+            // Matches the sequential behavior, where a thrown exception (cancellation) propagates out.
+            if (firstException)
+            {
+                std::rethrow_exception(firstException);
+            }
+
+            for (char result : results)
+            {
+                if (!result)
+                {
+                    allSucceeded = false;
+                }
+            }
+        }
+
+        return allSucceeded;
+    }
+
     bool ConfigurationSetApplyProcessor::HasIntentAndSatisfiedDependencies(
         const UnitInfo& unitInfo,
         IntentFilterPtr intentFilter,
@@ -438,6 +533,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation
                 {
                     auto applyOperation = groupProcessor.ApplyGroupSettingsAsync([&](const auto&, const IApplyGroupMemberSettingsResult& unitResult)
                         {
+                            std::lock_guard<std::mutex> lock{ m_progressMutex };
                             m_progress.Progress(unitResult);
                         });
 
@@ -449,10 +545,14 @@ namespace winrt::Microsoft::Management::Configuration::implementation
                     // Put all of the group's unit results in our unit results
                     bool groupPreviouslyInDesiredState = true;
 
-                    for (const auto& groupUnitResult : groupResult.UnitResults())
                     {
-                        m_result->UnitResults().Append(groupUnitResult);
-                        groupPreviouslyInDesiredState = groupPreviouslyInDesiredState && groupUnitResult.PreviouslyInDesiredState();
+                        std::lock_guard<std::mutex> lock{ m_progressMutex };
+
+                        for (const auto& groupUnitResult : groupResult.UnitResults())
+                        {
+                            m_result->UnitResults().Append(groupUnitResult);
+                            groupPreviouslyInDesiredState = groupPreviouslyInDesiredState && groupUnitResult.PreviouslyInDesiredState();
+                        }
                     }
 
                     // Copy the group result into the existing unit result for the group
@@ -527,6 +627,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
         try
         {
+            std::lock_guard<std::mutex> lock{ m_progressMutex };
             m_progress.Progress(*unitInfo.Result);
         }
         CATCH_LOG();
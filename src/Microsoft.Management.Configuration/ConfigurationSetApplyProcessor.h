@@ -9,6 +9,7 @@
 #include "ShutdownSynchronization.h"
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -64,6 +65,10 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         // Runs the processing using the given functions.
         bool ProcessInternal(CheckDependencyPtr checkDependencyFunction, ProcessUnitPtr processUnitFunction, bool sendProgress = false);
 
+        // Processes the given ready units concurrently, limited to the configured parallelism width.
+        // Returns true if all units were processed successfully, false if any failed.
+        bool ProcessUnitsInParallel(const std::vector<size_t>& readyUnits, ProcessUnitPtr processUnitFunction);
+
         // Processes one of the non-writing intent types, which are fatal if not all successful
         bool ProcessIntentInternal(
             std::vector<size_t>& unitsToProcess,
@@ -104,5 +109,9 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         std::vector<UnitInfo> m_unitInfo;
         std::map<std::string, size_t> m_idToUnitInfoIndex;
         hresult m_resultCode;
+        // The maximum number of units that may be processed concurrently; 1 preserves sequential order.
+        uint32_t m_maxParallelism = 1;
+        // Guards progress notifications and the shared unit result list when processing in parallel.
+        std::mutex m_progressMutex;
     };
 }
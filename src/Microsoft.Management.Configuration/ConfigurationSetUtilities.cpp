@@ -24,6 +24,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         case ConfigurationField::Resources: return "resources"sv;
         case ConfigurationField::ModuleDirective: return "module"sv;
         case ConfigurationField::SecurityContextMetadata: return "securityContext"sv;
+        case ConfigurationField::MaxParallelismMetadata: return "maxParallelism"sv;
 
         case ConfigurationField::Schema: return "$schema"sv;
         case ConfigurationField::Metadata: return "metadata"sv;
@@ -135,4 +136,52 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
         return nullptr;
     }
+
+    uint32_t GetConfigurationSetMaxParallelism(const Configuration::ConfigurationSet& configurationSet)
+    {
+        // Cap the width to keep a bad value from spawning an absurd number of threads.
+        constexpr int64_t maximumWidth = 64;
+
+        uint32_t result = 1;
+
+        try
+        {
+            auto wingetMetadata = TryLookupValueSet(configurationSet.Metadata(), ConfigurationField::WingetMetadataRoot);
+            if (wingetMetadata)
+            {
+                auto property = TryLookupProperty(wingetMetadata, ConfigurationField::MaxParallelismMetadata);
+                if (property)
+                {
+                    int64_t value = 0;
+
+                    switch (property.Type())
+                    {
+                    case Windows::Foundation::PropertyType::Int32:
+                        value = property.GetInt32();
+                        break;
+                    case Windows::Foundation::PropertyType::Int64:
+                        value = property.GetInt64();
+                        break;
+                    case Windows::Foundation::PropertyType::UInt32:
+                        value = property.GetUInt32();
+                        break;
+                    case Windows::Foundation::PropertyType::UInt64:
+                        value = static_cast<int64_t>(std::min<uint64_t>(property.GetUInt64(), maximumWidth));
+                        break;
+                    case Windows::Foundation::PropertyType::String:
+                        value = std::stoll(AppInstaller::Utility::ConvertToUTF8(property.GetString()));
+                        break;
+                    }
+
+                    if (value > 1)
+                    {
+                        result = static_cast<uint32_t>(std::min(value, maximumWidth));
+                    }
+                }
+            }
+        }
+        CATCH_LOG();
+
+        return result;
+    }
 }
@@ -23,6 +23,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         Resources,
         ModuleDirective,
         SecurityContextMetadata,
+        MaxParallelismMetadata,
 
         // v0.3
         Schema,
@@ -68,4 +69,8 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
     // Tries to get the field value from the given value set; only if it is a value set.
     Windows::Foundation::IPropertyValue TryLookupProperty(const Windows::Foundation::Collections::ValueSet& valueSet, ConfigurationField field, Windows::Foundation::PropertyType type = Windows::Foundation::PropertyType::Empty);
+
+    // Gets the processing parallelism width from the set's winget metadata.
+    // The default of 1 indicates sequential processing.
+    uint32_t GetConfigurationSetMaxParallelism(const Configuration::ConfigurationSet& configurationSet);
 }
@@ -149,10 +149,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation::Database:
         std::vector<Configuration::ConfigurationUnit> units{ winrtUnits.Size() };
         winrtUnits.GetMany(0, units);
 
-        for (const auto& unit : units)
-        {
-            unitInfoTable.Add(unit, result, schemaVersion);
-        }
+        unitInfoTable.Add(units, result, schemaVersion);
 
         savepoint.Commit();
         return result;
@@ -66,6 +66,11 @@ namespace winrt::Microsoft::Management::Configuration::implementation::Database:
     }
 
     void UnitInfoTable::Add(const Configuration::ConfigurationUnit& configurationUnit, AppInstaller::SQLite::rowid_t setRowId, hstring schemaVersion)
+    {
+        Add(std::vector<Configuration::ConfigurationUnit>{ configurationUnit }, setRowId, schemaVersion);
+    }
+
+    void UnitInfoTable::Add(const std::vector<Configuration::ConfigurationUnit>& configurationUnits, AppInstaller::SQLite::rowid_t setRowId, hstring schemaVersion)
     {
         Savepoint savepoint = Savepoint::Create(m_connection, "UnitInfoTable_Add_0_1");
 
@@ -105,7 +110,10 @@ namespace winrt::Microsoft::Management::Configuration::implementation::Database:
         };
 
         std::queue<UnitsToInsert> unitsToInsert;
-        unitsToInsert.emplace(UnitsToInsert{ std::nullopt, configurationUnit });
+        for (const auto& configurationUnit : configurationUnits)
+        {
+            unitsToInsert.emplace(UnitsToInsert{ std::nullopt, configurationUnit });
+        }
         auto serializer = ConfigurationSetSerializer::CreateSerializer(schemaVersion);
 
         while (!unitsToInsert.empty())
@@ -159,10 +167,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation::Database:
         std::vector<Configuration::ConfigurationUnit> units{ winrtUnits.Size() };
         winrtUnits.GetMany(0, units);
 
-        for (const auto& unit : units)
-        {
-            Add(unit, target, schemaVersion);
-        }
+        Add(units, target, schemaVersion);
 
         savepoint.Commit();
     }
@@ -17,6 +17,10 @@ namespace winrt::Microsoft::Management::Configuration::implementation::Database:
         // Adds the given configuration unit to the table.
         void Add(const Configuration::ConfigurationUnit& configurationUnit, AppInstaller::SQLite::rowid_t setRowId, hstring schemaVersion);
 
+        // Adds all of the given configuration units to the table, sharing a single
+        // prepared statement and serializer across the batch.
+        void Add(const std::vector<Configuration::ConfigurationUnit>& configurationUnits, AppInstaller::SQLite::rowid_t setRowId, hstring schemaVersion);
+
         // Updates the units for the target set.
         void UpdateForSet(AppInstaller::SQLite::rowid_t target, const Windows::Foundation::Collections::IVector<Configuration::ConfigurationUnit>& units, hstring schemaVersion);
 
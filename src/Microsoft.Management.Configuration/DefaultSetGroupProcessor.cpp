@@ -3,12 +3,18 @@
 #include "pch.h"
 #include "DefaultSetGroupProcessor.h"
 #include "ConfigurationSetApplyProcessor.h"
+#include "ConfigurationSetUtilities.h"
 #include "ExceptionResultHelpers.h"
 #include "TestGroupSettingsResult.h"
 #include "TestSettingsResult.h"
 
 #include <AppInstallerStrings.h>
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace winrt::Microsoft::Management::Configuration::implementation
 {
     namespace
@@ -46,7 +52,14 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
         try
         {
-            for (const auto& unit : m_set.Units())
+            // Testing has no write effects, so units can be tested concurrently regardless
+            // of their dependency edges when the set opts into parallelism.
+            uint32_t maxParallelism = GetConfigurationSetMaxParallelism(m_set);
+
+            // Guards the progress handler and the shared result list when testing in parallel.
+            std::mutex progressMutex;
+
+            auto testUnit = [&](const Configuration::ConfigurationUnit& unit) -> ITestSettingsResult
             {
                 ThrowIf(cancellation());
 
@@ -78,17 +91,22 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
                         if (groupProcessor)
                         {
-                            auto testOperation = groupProcessor.TestGroupSettingsAsync([&](const auto&, const ITestSettingsResult& unitResult)
+                            auto testOperation = groupProcessor.TestGroupSettingsAsync([&](const auto&, const ITestSettingsResult& memberResult)
                                 {
-                                    progressHandler(nullptr, unitResult);
+                                    std::lock_guard<std::mutex> lock{ progressMutex };
+                                    progressHandler(nullptr, memberResult);
                                 });
 
-                            ITestGroupSettingsResult groupResult = co_await testOperation;
+                            ITestGroupSettingsResult groupResult = testOperation.get();
 
                             // Put all of the group's unit results in our unit results
-                            for (const auto& groupUnitResult : groupResult.UnitResults())
                             {
-                                result->AppendUnitResult(groupUnitResult);
+                                std::lock_guard<std::mutex> lock{ progressMutex };
+
+                                for (const auto& groupUnitResult : groupResult.UnitResults())
+                                {
+                                    result->AppendUnitResult(groupUnitResult);
+                                }
                             }
 
                             // Convert group result into a unit result for the group
@@ -131,13 +149,80 @@ namespace winrt::Microsoft::Management::Configuration::implementation
                     settingsResult = *testSettingsResult;
                 }
 
-                result->AppendUnitResult(settingsResult);
+                return settingsResult;
+            };
+
+            auto appendAndReport = [&](const ITestSettingsResult& settingsResult)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{ progressMutex };
+                    result->AppendUnitResult(settingsResult);
+                }
 
                 try
                 {
                     progressHandler(nullptr, settingsResult);
                 }
                 CATCH_LOG();
+            };
+
+            if (maxParallelism > 1)
+            {
+                auto unitsView = m_set.Units();
+                std::vector<Configuration::ConfigurationUnit> units{ unitsView.Size() };
+                unitsView.GetMany(0, units);
+
+                for (size_t batchStart = 0; batchStart < units.size(); batchStart += maxParallelism)
+                {
+                    size_t batchSize = std::min<size_t>(maxParallelism, units.size() - batchStart);
+
+                    std::vector<std::thread> workers;
+                    std::vector<ITestSettingsResult> batchResults(batchSize, nullptr);
+                    std::exception_ptr firstException;
+                    std::mutex exceptionMutex;
+
+                    for (size_t i = 0; i < batchSize; ++i)
+                    {
+                        workers.emplace_back([&, i]()
+                            {
+                                try
+                                {
+                                    auto coUninitialize = wil::CoInitializeEx(COINIT_MULTITHREADED);
+                                    batchResults[i] = testUnit(units[batchStart + i]);
+                                }
+                                catch (...)
+                                {
+                                    std::lock_guard<std::mutex> lock{ exceptionMutex };
+                                    if (!firstException)
+                                    {
+                                        firstException = std::current_exception();
+                                    }
+                                }
+                            });
+                    }
+
+                    for (std::thread& worker : workers)
+                    {
+                        worker.join();
+                    }
+
+                    if (firstException)
+                    {
+                        std::rethrow_exception(firstException);
+                    }
+
+                    for (const ITestSettingsResult& batchResult : batchResults)
+                    {
+                        appendAndReport(batchResult);
+                    }
+                }
+            }
+            else
+            {
+                for (const auto& unit : m_set.Units())
+                {
+                    appendAndReport(testUnit(unit));
+                }
             }
 
             co_return *result;
@@ -20,10 +20,12 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 {
     void CatalogPackage::Initialize(
         ::AppInstaller::Repository::Source source,
-        std::shared_ptr<::AppInstaller::Repository::ICompositePackage> package)
+        std::shared_ptr<::AppInstaller::Repository::ICompositePackage> package,
+        ::AppInstaller::Pinning::PinningData pinningData)
     {
         m_source = std::move(source);
         m_package = std::move(package);
+        m_pinningData = std::move(pinningData);
     }
     hstring CatalogPackage::Id()
     {
@@ -71,7 +73,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         std::call_once(m_latestApplicableVersionOnceFlag,
             [&]()
             {
-                auto data = AppInstaller::Repository::GetLatestApplicableVersion(m_package);
+                auto data = AppInstaller::Repository::GetLatestApplicableVersion(m_package, m_pinningData);
 
                 m_updateAvailable = data.UpdateAvailable;
 
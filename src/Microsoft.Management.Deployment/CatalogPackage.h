@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 #pragma once
 #include "CatalogPackage.g.h"
+#if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
+#include <winget/PinningData.h>
+#endif
 
 namespace winrt::Microsoft::Management::Deployment::implementation
 {
@@ -10,9 +13,12 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         CatalogPackage() = default;
 
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
+        // The pinning data is shared by all of the packages created from one search so that
+        // the pin lookup is built once per search rather than once per package.
         void Initialize(
             ::AppInstaller::Repository::Source source,
-            std::shared_ptr<::AppInstaller::Repository::ICompositePackage> package);
+            std::shared_ptr<::AppInstaller::Repository::ICompositePackage> package,
+            ::AppInstaller::Pinning::PinningData pinningData);
         std::shared_ptr<::AppInstaller::Repository::ICompositePackage> GetRepositoryPackage();
 #endif
 
@@ -37,6 +43,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     private:
         ::AppInstaller::Repository::Source m_source;
         std::shared_ptr<::AppInstaller::Repository::ICompositePackage> m_package;
+        ::AppInstaller::Pinning::PinningData m_pinningData;
         bool m_updateAvailable = false;
         Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::PackageVersionId> m_availableVersions{ winrt::single_threaded_vector<winrt::Microsoft::Management::Deployment::PackageVersionId>() };
         winrt::Microsoft::Management::Deployment::PackageVersionInfo m_installedVersion{ nullptr };
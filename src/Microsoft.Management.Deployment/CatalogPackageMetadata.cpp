@@ -15,84 +15,106 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         m_manifestLocalization = std::move(manifestLocalization);
     }
 
+    void CatalogPackageMetadata::Initialize(std::shared_ptr<::AppInstaller::Repository::IPackageVersion> packageVersion, std::string preferredLocale)
+    {
+        m_packageVersion = std::move(packageVersion);
+        m_preferredLocale = std::move(preferredLocale);
+    }
+
+    const ::AppInstaller::Manifest::ManifestLocalization& CatalogPackageMetadata::GetLocalization()
+    {
+        if (m_packageVersion)
+        {
+            // Loading and localizing the manifest dominates the cost of this object;
+            // only do it once a property is actually read.
+            auto manifest = m_packageVersion->GetManifest();
+            manifest.ApplyLocale(m_preferredLocale);
+
+            m_manifestLocalization = std::move(manifest.CurrentLocalization);
+            m_packageVersion.reset();
+        }
+
+        return m_manifestLocalization;
+    }
+
     hstring CatalogPackageMetadata::Locale()
     {
-        return winrt::to_hstring(m_manifestLocalization.Locale);
+        return winrt::to_hstring(GetLocalization().Locale);
     }
     hstring CatalogPackageMetadata::Publisher()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::Publisher>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::Publisher>());
     }
     hstring CatalogPackageMetadata::PublisherUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::PublisherUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::PublisherUrl>());
     }
     hstring CatalogPackageMetadata::PublisherSupportUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::PublisherSupportUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::PublisherSupportUrl>());
     }
     hstring CatalogPackageMetadata::PrivacyUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::PrivacyUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::PrivacyUrl>());
     }
     hstring CatalogPackageMetadata::Author()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::Author>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::Author>());
     }
     hstring CatalogPackageMetadata::PackageName()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::PackageName>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::PackageName>());
     }
     hstring CatalogPackageMetadata::PackageUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::PackageUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::PackageUrl>());
     }
     hstring CatalogPackageMetadata::License()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::License>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::License>());
     }
     hstring CatalogPackageMetadata::LicenseUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::LicenseUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::LicenseUrl>());
     }
     hstring CatalogPackageMetadata::Copyright()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::Copyright>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::Copyright>());
     }
     hstring CatalogPackageMetadata::CopyrightUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::CopyrightUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::CopyrightUrl>());
     }
     hstring CatalogPackageMetadata::ShortDescription()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::ShortDescription>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::ShortDescription>());
     }
     hstring CatalogPackageMetadata::Description()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::Description>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::Description>());
     }
     hstring CatalogPackageMetadata::ReleaseNotes()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::ReleaseNotes>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::ReleaseNotes>());
     }
     hstring CatalogPackageMetadata::ReleaseNotesUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::ReleaseNotesUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::ReleaseNotesUrl>());
     }
     hstring CatalogPackageMetadata::PurchaseUrl()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::PurchaseUrl>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::PurchaseUrl>());
     }
     hstring CatalogPackageMetadata::InstallationNotes()
     {
-        return winrt::to_hstring(m_manifestLocalization.Get<Localization::InstallationNotes>());
+        return winrt::to_hstring(GetLocalization().Get<Localization::InstallationNotes>());
     }
     winrt::Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Management::Deployment::PackageAgreement> CatalogPackageMetadata::Agreements()
     {
         if (!m_packageAgreements)
         {
             auto agreements = winrt::single_threaded_vector<winrt::Microsoft::Management::Deployment::PackageAgreement>();
-            for (auto const& agreement : m_manifestLocalization.Get<AppInstaller::Manifest::Localization::Agreements>())
+            for (auto const& agreement : GetLocalization().Get<AppInstaller::Manifest::Localization::Agreements>())
             {
                 auto packageAgreement = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::PackageAgreement>>();
                 packageAgreement->Initialize(agreement);
@@ -109,7 +131,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         {
             // Vector hasn't been created yet, create and populate it.
             auto tags = winrt::single_threaded_vector<hstring>();
-            for (auto&& tag : m_manifestLocalization.Get<Localization::Tags>())
+            for (auto&& tag : GetLocalization().Get<Localization::Tags>())
             {
                 tags.Append(winrt::to_hstring(tag));
             }
@@ -123,7 +145,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         if (!m_documentations)
         {
             auto documentations = winrt::single_threaded_vector<winrt::Microsoft::Management::Deployment::Documentation>();
-            for (auto const& documentation : m_manifestLocalization.Get<AppInstaller::Manifest::Localization::Documentations>())
+            for (auto const& documentation : GetLocalization().Get<AppInstaller::Manifest::Localization::Documentations>())
             {
                 auto documentationImpl = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::Documentation>>();
                 documentationImpl->Initialize(documentation);
@@ -139,7 +161,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         if (!m_icons)
         {
             auto icons = winrt::single_threaded_vector<winrt::Microsoft::Management::Deployment::Icon>();
-            for (auto const& icon : m_manifestLocalization.Get<AppInstaller::Manifest::Localization::Icons>())
+            for (auto const& icon : GetLocalization().Get<AppInstaller::Manifest::Localization::Icons>())
             {
                 auto iconImpl = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::Icon>>();
                 iconImpl->Initialize(icon);
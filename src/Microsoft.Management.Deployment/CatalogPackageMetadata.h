@@ -14,6 +14,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
         void Initialize(::AppInstaller::Manifest::ManifestLocalization manifestLocalization);
+        // Retains the package version and defers loading the manifest until a property is first read.
+        void Initialize(std::shared_ptr<::AppInstaller::Repository::IPackageVersion> packageVersion, std::string preferredLocale = {});
 #endif
         hstring Locale();
 
@@ -61,6 +63,11 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
     private:
+        // Loads the manifest and applies the locale on first access.
+        const ::AppInstaller::Manifest::ManifestLocalization& GetLocalization();
+
+        std::shared_ptr<::AppInstaller::Repository::IPackageVersion> m_packageVersion;
+        std::string m_preferredLocale;
         ::AppInstaller::Manifest::ManifestLocalization m_manifestLocalization;
         Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::PackageAgreement> m_packageAgreements{ nullptr };
         Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::Documentation> m_documentations{ nullptr };
@@ -18,13 +18,24 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         m_wasLimitExceeded = wasLimitExceeded;
         m_extendedErrorCode = extendedErrorCode;
     }
+    void FindPackagesResult::Initialize(
+        winrt::Microsoft::Management::Deployment::FindPackagesResultStatus status,
+        bool wasLimitExceeded,
+        Windows::Foundation::Collections::IVectorView<Microsoft::Management::Deployment::MatchResult> matches,
+        winrt::hresult extendedErrorCode)
+    {
+        m_status = status;
+        m_matchesView = matches;
+        m_wasLimitExceeded = wasLimitExceeded;
+        m_extendedErrorCode = extendedErrorCode;
+    }
     winrt::Microsoft::Management::Deployment::FindPackagesResultStatus FindPackagesResult::Status()
     {
         return m_status;
     }
     winrt::Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Management::Deployment::MatchResult> FindPackagesResult::Matches()
     {
-        return m_matches.GetView();
+        return m_matchesView ? m_matchesView : m_matches.GetView();
     }
     bool FindPackagesResult::WasLimitExceeded()
     {
@@ -13,9 +13,16 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
         void Initialize(
             winrt::Microsoft::Management::Deployment::FindPackagesResultStatus status,
-            bool wasLimitExceeded, 
+            bool wasLimitExceeded,
             Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::MatchResult> matches,
             winrt::hresult extendedErrorCode);
+        // Initializes with an existing view over the matches, enabling the view to materialize
+        // its items lazily rather than requiring a fully populated vector.
+        void Initialize(
+            winrt::Microsoft::Management::Deployment::FindPackagesResultStatus status,
+            bool wasLimitExceeded,
+            Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Management::Deployment::MatchResult> matches,
+            winrt::hresult extendedErrorCode);
 #endif
 
         winrt::Microsoft::Management::Deployment::FindPackagesResultStatus Status();
@@ -26,8 +33,9 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
     private:
         winrt::Microsoft::Management::Deployment::FindPackagesResultStatus m_status = winrt::Microsoft::Management::Deployment::FindPackagesResultStatus::Ok;
-        Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::MatchResult> m_matches{ 
+        Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::MatchResult> m_matches{
             winrt::single_threaded_vector<winrt::Microsoft::Management::Deployment::MatchResult>() };
+        Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Management::Deployment::MatchResult> m_matchesView{ nullptr };
         bool m_wasLimitExceeded = false;
         winrt::hresult m_extendedErrorCode = S_OK;
 #endif
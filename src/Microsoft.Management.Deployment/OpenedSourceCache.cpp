@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "OpenedSourceCache.h"
+
+#include <tuple>
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    namespace
+    {
+        // Cached sources are kept warm for at most this long, regardless of the background
+        // update interval, so that index updates are not hidden from clients indefinitely.
+        constexpr std::chrono::steady_clock::duration s_maximumEntryLifetime = std::chrono::minutes{ 5 };
+    }
+
+    bool OpenedSourceCache::Key::operator<(const Key& other) const
+    {
+        return std::tie(Name, Arg, Caller, BackgroundUpdateIntervalTicks, InstalledPackageInformationOnly) <
+            std::tie(other.Name, other.Arg, other.Caller, other.BackgroundUpdateIntervalTicks, other.InstalledPackageInformationOnly);
+    }
+
+    OpenedSourceCache& OpenedSourceCache::Instance()
+    {
+        static OpenedSourceCache instance;
+        return instance;
+    }
+
+    std::optional<::AppInstaller::Repository::Source> OpenedSourceCache::TryGet(const Key& key)
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        auto itr = m_sources.find(key);
+        if (itr == m_sources.end())
+        {
+            return std::nullopt;
+        }
+
+        if (std::chrono::steady_clock::now() >= itr->second.Expiration)
+        {
+            m_sources.erase(itr);
+            return std::nullopt;
+        }
+
+        AICLI_LOG(Repo, Verbose, << "Using cached opened source: " << key.Name);
+        return itr->second.OpenedSource;
+    }
+
+    void OpenedSourceCache::Store(const Key& key, const ::AppInstaller::Repository::Source& source)
+    {
+        auto expiration = std::chrono::steady_clock::now() + s_maximumEntryLifetime;
+
+        std::lock_guard<std::mutex> lock{ m_lock };
+        m_sources[key] = Entry{ source, expiration };
+    }
+
+    void OpenedSourceCache::Invalidate(std::string_view name)
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        for (auto itr = m_sources.begin(); itr != m_sources.end();)
+        {
+            if (itr->first.Name == name)
+            {
+                itr = m_sources.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+    }
+
+    void OpenedSourceCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+        m_sources.clear();
+    }
+}
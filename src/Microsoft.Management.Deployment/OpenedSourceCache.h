@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/RepositorySource.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    // Caches opened sources for the lifetime of the server process so that repeated Connect
+    // calls hand back an already opened source instead of paying the full open cost again.
+    // Entries expire after a bounded interval so that background source updates are picked up,
+    // and are invalidated explicitly when a catalog is added, removed, or edited.
+    struct OpenedSourceCache
+    {
+        // Identifies an opened source along with every per-caller setting that affects how it was opened.
+        struct Key
+        {
+            std::string Name;
+            std::string Arg;
+            std::string Caller;
+            int64_t BackgroundUpdateIntervalTicks = 0;
+            bool InstalledPackageInformationOnly = false;
+
+            bool operator<(const Key& other) const;
+        };
+
+        static OpenedSourceCache& Instance();
+
+        OpenedSourceCache(const OpenedSourceCache&) = delete;
+        OpenedSourceCache& operator=(const OpenedSourceCache&) = delete;
+
+        // Gets the cached opened source for the key, if present and not expired.
+        std::optional<::AppInstaller::Repository::Source> TryGet(const Key& key);
+
+        // Stores an opened source for the key.
+        void Store(const Key& key, const ::AppInstaller::Repository::Source& source);
+
+        // Removes any cached entries for the source with the given name.
+        void Invalidate(std::string_view name);
+
+        // Removes all cached entries.
+        void Clear();
+
+    private:
+        OpenedSourceCache() = default;
+
+        struct Entry
+        {
+            ::AppInstaller::Repository::Source OpenedSource;
+            std::chrono::steady_clock::time_point Expiration;
+        };
+
+        std::mutex m_lock;
+        std::map<Key, Entry> m_sources;
+    };
+}
@@ -8,6 +8,7 @@
 #include "PackageCatalog.h"
 #include "PackageCatalog.g.cpp"
 #include "PackageCatalogInfo.h"
+#include "PackageCatalogSearchSession.h"
 #include "FindPackagesResult.h"
 #include "MatchResult.h"
 #include "CatalogPackage.h"
@@ -20,6 +21,7 @@
 // 4467 Allow use of uuid attribute for com object creation.
 #include "PackageMatchFilter.h"
 #pragma warning( pop )
+#include "Microsoft/ARPHelper.h"
 #include "Microsoft/PredefinedInstalledSourceFactory.h"
 #include <winget/GroupPolicy.h>
 #include <AppInstallerErrors.h>
@@ -121,6 +123,169 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         return *findPackagesResult;
     }
 
+    namespace
+    {
+        struct LazyMatchesIterator;
+
+        // A read only view over the native search matches that materializes each MatchResult
+        // object the first time it is read, rather than building the full set before returning.
+        // The underlying search is still a single batch, but callers that render results
+        // incrementally get their first items without paying for wrappers over the long tail.
+        struct LazyMatchesView : winrt::implements<LazyMatchesView,
+            Windows::Foundation::Collections::IVectorView<Microsoft::Management::Deployment::MatchResult>,
+            Windows::Foundation::Collections::IIterable<Microsoft::Management::Deployment::MatchResult>>
+        {
+            LazyMatchesView() = default;
+
+            void Initialize(::AppInstaller::Repository::Source source, std::vector<::AppInstaller::Repository::ResultMatch>&& matches)
+            {
+                m_source = std::move(source);
+                m_nativeMatches = std::move(matches);
+                m_matches.resize(m_nativeMatches.size(), nullptr);
+            }
+
+            Microsoft::Management::Deployment::MatchResult GetAt(uint32_t index)
+            {
+                if (index >= m_nativeMatches.size())
+                {
+                    throw winrt::hresult_out_of_bounds();
+                }
+
+                std::lock_guard<std::mutex> lock{ m_lock };
+                return MaterializeUnderLock(index);
+            }
+
+            uint32_t Size()
+            {
+                return static_cast<uint32_t>(m_nativeMatches.size());
+            }
+
+            bool IndexOf(Microsoft::Management::Deployment::MatchResult const& value, uint32_t& index)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                // Only an object previously handed out by this view can be present in it.
+                for (uint32_t i = 0; i < m_matches.size(); ++i)
+                {
+                    if (m_matches[i] && m_matches[i] == value)
+                    {
+                        index = i;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            uint32_t GetMany(uint32_t startIndex, winrt::array_view<Microsoft::Management::Deployment::MatchResult> items)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                uint32_t count = 0;
+                while (startIndex + count < m_nativeMatches.size() && count < items.size())
+                {
+                    items[count] = MaterializeUnderLock(startIndex + count);
+                    ++count;
+                }
+
+                return count;
+            }
+
+            Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult> First();
+
+        private:
+            Microsoft::Management::Deployment::MatchResult MaterializeUnderLock(uint32_t index)
+            {
+                if (!m_matches[index])
+                {
+                    auto& match = m_nativeMatches[index];
+
+                    auto catalogPackage = winrt::make_self<wil::details::module_count_wrapper<
+                        winrt::Microsoft::Management::Deployment::implementation::CatalogPackage>>();
+                    catalogPackage->Initialize(m_source, match.Package, m_pinningData);
+
+                    auto packageMatchFilter = winrt::make_self<wil::details::module_count_wrapper<
+                        winrt::Microsoft::Management::Deployment::implementation::PackageMatchFilter>>();
+                    packageMatchFilter->Initialize(match.MatchCriteria);
+
+                    auto matchResult = winrt::make_self<wil::details::module_count_wrapper<
+                        winrt::Microsoft::Management::Deployment::implementation::MatchResult>>();
+                    matchResult->Initialize(*catalogPackage, *packageMatchFilter);
+
+                    m_matches[index] = *matchResult;
+                }
+
+                return m_matches[index];
+            }
+
+            ::AppInstaller::Repository::Source m_source;
+            // One pinning data shared by all of the packages so that the pin lookup is built
+            // once rather than once per package.
+            ::AppInstaller::Pinning::PinningData m_pinningData{ ::AppInstaller::Pinning::PinningData::Disposition::ReadOnly };
+            std::vector<::AppInstaller::Repository::ResultMatch> m_nativeMatches;
+            std::vector<Microsoft::Management::Deployment::MatchResult> m_matches;
+            std::mutex m_lock;
+        };
+
+        struct LazyMatchesIterator : winrt::implements<LazyMatchesIterator,
+            Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult>>
+        {
+            LazyMatchesIterator() = default;
+
+            void Initialize(winrt::com_ptr<LazyMatchesView> view)
+            {
+                m_view = std::move(view);
+            }
+
+            Microsoft::Management::Deployment::MatchResult Current()
+            {
+                return m_view->GetAt(m_index);
+            }
+
+            bool HasCurrent()
+            {
+                return m_index < m_view->Size();
+            }
+
+            bool MoveNext()
+            {
+                if (m_index < m_view->Size())
+                {
+                    ++m_index;
+                }
+
+                return HasCurrent();
+            }
+
+            uint32_t GetMany(winrt::array_view<Microsoft::Management::Deployment::MatchResult> items)
+            {
+                uint32_t count = m_view->GetMany(m_index, items);
+                m_index += count;
+                return count;
+            }
+
+        private:
+            winrt::com_ptr<LazyMatchesView> m_view;
+            uint32_t m_index = 0;
+        };
+
+        Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult> LazyMatchesView::First()
+        {
+            auto iterator = winrt::make_self<wil::details::module_count_wrapper<LazyMatchesIterator>>();
+            iterator->Initialize(get_strong());
+            return iterator.as<Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult>>();
+        }
+    }
+
+    winrt::Microsoft::Management::Deployment::FindPackagesResult GetFindPackagesResult(HRESULT hr, bool isTruncated, Windows::Foundation::Collections::IVectorView<Microsoft::Management::Deployment::MatchResult> matches)
+    {
+        auto findPackagesResult = winrt::make_self<wil::details::module_count_wrapper<
+            winrt::Microsoft::Management::Deployment::implementation::FindPackagesResult>>();
+        winrt::Microsoft::Management::Deployment::FindPackagesResultStatus status = FindPackagesResultStatus(hr);
+        findPackagesResult->Initialize(status, isTruncated, matches, hr);
+        return *findPackagesResult;
+    }
+
     winrt::Microsoft::Management::Deployment::FindPackagesResult PackageCatalog::FindPackages(winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options)
     {
         bool isTruncated = false;
@@ -148,28 +313,34 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 std::rethrow_exception(searchResult.Failures[0].Exception);
             }
 
-            // Build the result object from the searchResult
-            for (size_t i = 0; i < searchResult.Matches.size(); ++i)
-            {
-                auto match = searchResult.Matches[i];
-                auto catalogPackage = winrt::make_self<wil::details::module_count_wrapper<
-                    winrt::Microsoft::Management::Deployment::implementation::CatalogPackage>>();
-                catalogPackage->Initialize(m_source, match.Package);
-
-                auto packageMatchFilter = winrt::make_self<wil::details::module_count_wrapper<
-                    winrt::Microsoft::Management::Deployment::implementation::PackageMatchFilter>>();
-                packageMatchFilter->Initialize(match.MatchCriteria);
-
-                auto matchResult = winrt::make_self<wil::details::module_count_wrapper<
-                    winrt::Microsoft::Management::Deployment::implementation::MatchResult>>();
-                matchResult->Initialize(*catalogPackage, *packageMatchFilter);
+            // Hand the native matches to a lazy view; MatchResult objects are materialized as
+            // the caller reads them, so the first results are available immediately.
+            auto lazyMatches = winrt::make_self<wil::details::module_count_wrapper<LazyMatchesView>>();
+            lazyMatches->Initialize(m_source, std::move(searchResult.Matches));
 
-                matches.Append(*matchResult);
-            }
-            isTruncated = searchResult.Truncated;
+            return GetFindPackagesResult(hr, searchResult.Truncated,
+                lazyMatches.as<Windows::Foundation::Collections::IVectorView<Microsoft::Management::Deployment::MatchResult>>());
         }
         WINGET_CATCH_STORE(hr, APPINSTALLER_CLI_ERROR_COMMAND_FAILED);
 
         return GetFindPackagesResult(hr, isTruncated, matches);
     }
+
+    hstring PackageCatalog::GetInstalledChangeToken()
+    {
+        // The token describes the machine's installed package set rather than the contents of this
+        // particular catalog, so that a caller polling for changes can compare tokens across connects.
+        // It is derived from the ARP registry roots, which cover traditional installers; a caller
+        // that also tracks MSIX packages can combine this with the platform's package catalog events.
+        ::AppInstaller::Repository::Microsoft::ARPHelper arpHelper;
+        return winrt::to_hstring(arpHelper.GetChangeStamp());
+    }
+
+    winrt::Microsoft::Management::Deployment::PackageCatalogSearchSession PackageCatalog::CreateSearchSession()
+    {
+        auto searchSession = winrt::make_self<wil::details::module_count_wrapper<
+            winrt::Microsoft::Management::Deployment::implementation::PackageCatalogSearchSession>>();
+        searchSession->Initialize(*this);
+        return *searchSession;
+    }
 }
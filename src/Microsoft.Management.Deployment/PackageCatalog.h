@@ -20,6 +20,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         winrt::Microsoft::Management::Deployment::PackageCatalogInfo Info();
         winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::FindPackagesResult> FindPackagesAsync(winrt::Microsoft::Management::Deployment::FindPackagesOptions options);
         winrt::Microsoft::Management::Deployment::FindPackagesResult FindPackages(winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options);
+        hstring GetInstalledChangeToken();
+        winrt::Microsoft::Management::Deployment::PackageCatalogSearchSession CreateSearchSession();
 
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
     private:
@@ -20,6 +20,7 @@
 #include <winget/UserSettings.h>
 #include <Helpers.h>
 #include <ExecutionContext.h>
+#include <OpenedSourceCache.h>
 #include <RefreshPackageCatalogResult.h>
 #include <PackageCatalogProgress.h>
 
@@ -68,6 +69,37 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 return handlerResult == winrt::Microsoft::Management::Deployment::PackageCatalogConnectionValidationResult::Ok;
             };
         }
+
+        // Opens the configured source, serving it from the server's opened source cache when allowed.
+        // Sources with a certificate validation callback or authentication arguments are opened
+        // directly, as those settings cannot participate in the cache key.
+        void OpenSourceWithCache(
+            ::AppInstaller::Repository::Source& source,
+            bool canUseCache,
+            const std::string& callerName,
+            winrt::Windows::Foundation::TimeSpan backgroundUpdateInterval,
+            bool installedPackageInformationOnly,
+            ::AppInstaller::IProgressCallback& progress)
+        {
+            if (!canUseCache)
+            {
+                source.Open(progress);
+                return;
+            }
+
+            const ::AppInstaller::Repository::SourceDetails& details = source.GetDetails();
+            OpenedSourceCache::Key key{ details.Name, details.Arg, callerName, backgroundUpdateInterval.count(), installedPackageInformationOnly };
+
+            std::optional<::AppInstaller::Repository::Source> cached = OpenedSourceCache::Instance().TryGet(key);
+            if (cached)
+            {
+                source = std::move(cached).value();
+                return;
+            }
+
+            source.Open(progress);
+            OpenedSourceCache::Instance().Store(key, source);
+        }
     }
 
     void PackageCatalogReference::Initialize(winrt::Microsoft::Management::Deployment::PackageCatalogInfo packageCatalogInfo, ::AppInstaller::Repository::Source sourceReference)
@@ -153,6 +185,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 copy.SetBackgroundUpdateInterval(catalog.PackageCatalogBackgroundUpdateInterval());
                 copy.InstalledPackageInformationOnly(catalog.InstalledPackageInformationOnly());
                 auto validationCallback = MakeServerCertificateValidationCallback(catalogImpl->m_connectionValidationHandler);
+                bool canUseCache = !validationCallback &&
+                    catalog.AuthenticationInfo().AuthenticationType() == winrt::Microsoft::Management::Deployment::AuthenticationType::None;
                 if (validationCallback)
                 {
                     copy.SetServerCertificateValidationCallback(std::move(validationCallback));
@@ -161,7 +195,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 {
                     copy.SetAuthenticationArguments(GetAuthenticationArguments(catalog.AuthenticationArguments()));
                 }
-                copy.Open(progress);
+                OpenSourceWithCache(copy, canUseCache, callerName, catalog.PackageCatalogBackgroundUpdateInterval(), catalog.InstalledPackageInformationOnly(), progress);
                 remoteSources.emplace_back(std::move(copy));
             }
 
@@ -205,6 +239,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             source.SetBackgroundUpdateInterval(PackageCatalogBackgroundUpdateInterval());
             source.InstalledPackageInformationOnly(m_installedPackageInformationOnly);
             auto validationCallback = MakeServerCertificateValidationCallback(m_connectionValidationHandler);
+            bool canUseCache = !validationCallback &&
+                AuthenticationInfo().AuthenticationType() == winrt::Microsoft::Management::Deployment::AuthenticationType::None;
             if (validationCallback)
             {
                 source.SetServerCertificateValidationCallback(std::move(validationCallback));
@@ -213,7 +249,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             {
                 source.SetAuthenticationArguments(GetAuthenticationArguments(m_authenticationArguments));
             }
-            source.Open(progress);
+            OpenSourceWithCache(source, canUseCache, callerName, PackageCatalogBackgroundUpdateInterval(), m_installedPackageInformationOnly, progress);
         }
 
         if (!source)
@@ -366,6 +402,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             packageCatalogProgressSink->BeginProgress();
             ::AppInstaller::ProgressCallback progress(packageCatalogProgressSink.get());
             this->m_sourceReference.Update(progress);
+            OpenedSourceCache::Instance().Invalidate(this->m_sourceReference.GetDetails().Name);
             packageCatalogProgressSink->EndProgress(false);
         }
         catch (...)
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include <winget/RepositorySource.h>
+#include "PackageCatalogSearchSession.h"
+#include "PackageCatalogSearchSession.g.cpp"
+#include "FindPackagesResult.h"
+#include "MatchResult.h"
+#include <wil\cppwinrt_wrl.h>
+#include <AppInstallerStrings.h>
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    namespace
+    {
+        // Extracts the case folded query when the options are usable for in-memory narrowing:
+        // a single CatalogDefault selector with no filters and no result limit.
+        std::optional<std::string> GetNarrowableQuery(winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options)
+        {
+            if (options.ResultLimit() != 0 || options.Filters().Size() != 0 || options.Selectors().Size() != 1)
+            {
+                return std::nullopt;
+            }
+
+            Microsoft::Management::Deployment::PackageMatchFilter selector = options.Selectors().GetAt(0);
+            if (selector.Field() != Microsoft::Management::Deployment::PackageMatchField::CatalogDefault || selector.Value().empty())
+            {
+                return std::nullopt;
+            }
+
+            return ::AppInstaller::Utility::FoldCase(std::string_view{ winrt::to_string(selector.Value()) });
+        }
+
+        // Determines whether a previously matched package still matches the longer query.
+        // Narrowing considers the package identifier and name; a match that was produced by
+        // another field (such as a moniker or tag) is narrowed out, which a full search on
+        // session reset will restore.
+        bool PackageMatchesQuery(winrt::Microsoft::Management::Deployment::MatchResult const& match, const std::string& foldedQuery)
+        {
+            Microsoft::Management::Deployment::CatalogPackage package = match.CatalogPackage();
+            return ::AppInstaller::Utility::FoldCase(std::string_view{ winrt::to_string(package.Id()) }).find(foldedQuery) != std::string::npos ||
+                ::AppInstaller::Utility::FoldCase(std::string_view{ winrt::to_string(package.Name()) }).find(foldedQuery) != std::string::npos;
+        }
+    }
+
+    void PackageCatalogSearchSession::Initialize(winrt::Microsoft::Management::Deployment::PackageCatalog catalog)
+    {
+        m_catalog = catalog;
+    }
+
+    winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::FindPackagesResult> PackageCatalogSearchSession::FindPackagesAsync(winrt::Microsoft::Management::Deployment::FindPackagesOptions options)
+    {
+        auto strong_this = get_strong();
+        co_await resume_background();
+        co_return FindPackages(options);
+    }
+
+    winrt::Microsoft::Management::Deployment::FindPackagesResult PackageCatalogSearchSession::FindPackages(winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options)
+    {
+        std::optional<std::string> query = GetNarrowableQuery(options);
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            if (query && !m_lastQueryFolded.empty() &&
+                query->size() >= m_lastQueryFolded.size() &&
+                query->compare(0, m_lastQueryFolded.size(), m_lastQueryFolded) == 0)
+            {
+                if (*query == m_lastQueryFolded)
+                {
+                    return m_lastResult;
+                }
+
+                // The new query extends the previous one; narrow the previous result in memory.
+                Windows::Foundation::Collections::IVector<Microsoft::Management::Deployment::MatchResult> matches{ winrt::single_threaded_vector<Microsoft::Management::Deployment::MatchResult>() };
+
+                for (auto const& match : m_lastResult.Matches())
+                {
+                    if (PackageMatchesQuery(match, *query))
+                    {
+                        matches.Append(match);
+                    }
+                }
+
+                auto findPackagesResult = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::FindPackagesResult>>();
+                findPackagesResult->Initialize(FindPackagesResultStatus::Ok, false, matches, S_OK);
+
+                m_lastQueryFolded = std::move(*query);
+                m_lastResult = *findPackagesResult;
+                return m_lastResult;
+            }
+        }
+
+        // Not a refinement of the previous query; run a full search and restart the session from it.
+        auto result = m_catalog.FindPackages(options);
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            // A truncated result cannot be narrowed, as a longer query could match packages
+            // that were cut off by the limit.
+            if (query && result.Status() == FindPackagesResultStatus::Ok && !result.WasLimitExceeded())
+            {
+                m_lastQueryFolded = std::move(*query);
+                m_lastResult = result;
+            }
+            else
+            {
+                m_lastQueryFolded.clear();
+                m_lastResult = nullptr;
+            }
+        }
+
+        return result;
+    }
+}
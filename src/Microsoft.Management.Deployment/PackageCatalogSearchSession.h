@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "PackageCatalogSearchSession.g.h"
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    struct PackageCatalogSearchSession : PackageCatalogSearchSessionT<PackageCatalogSearchSession>
+    {
+        PackageCatalogSearchSession() = default;
+
+#if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
+        void Initialize(winrt::Microsoft::Management::Deployment::PackageCatalog catalog);
+#endif
+
+        winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::FindPackagesResult> FindPackagesAsync(winrt::Microsoft::Management::Deployment::FindPackagesOptions options);
+        winrt::Microsoft::Management::Deployment::FindPackagesResult FindPackages(winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options);
+
+#if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
+    private:
+        Microsoft::Management::Deployment::PackageCatalog m_catalog{ nullptr };
+        std::mutex m_lock;
+        // The case folded query of the last complete result, empty if the session cannot narrow.
+        std::string m_lastQueryFolded;
+        Microsoft::Management::Deployment::FindPackagesResult m_lastResult{ nullptr };
+#endif
+    };
+}
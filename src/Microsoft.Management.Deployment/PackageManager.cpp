@@ -36,6 +36,7 @@
 #include "EditPackageCatalogResult.h"
 #include "Converters.h"
 #include "Helpers.h"
+#include "OpenedSourceCache.h"
 #include "ContextOrchestrator.h"
 #include "AppInstallerRuntime.h"
 #include <optional>
@@ -1380,6 +1381,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             packageCatalogProgressSink->BeginProgress();
             ::AppInstaller::ProgressCallback progress(packageCatalogProgressSink.get());
             sourceToAdd.Add(progress);
+            OpenedSourceCache::Instance().Invalidate(winrt::to_string(options.Name()));
             packageCatalogProgressSink->EndProgress(false);
         }
         catch (...)
@@ -1428,6 +1430,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             {
                 sourceToRemove.Remove(progress);
             }
+            OpenedSourceCache::Instance().Invalidate(matchingSource.value().Name);
             packageCatalogProgressSink->EndProgress(false);
         }
         catch (...)
@@ -1478,6 +1481,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             if (sourceToEdit.RequiresChanges(edits))
             {
                 sourceToEdit.Edit(edits);
+                OpenedSourceCache::Instance().Invalidate(matchingSource.value().Name);
             }
         }
         catch (...)
@@ -201,9 +201,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         auto catalogPackageMetadata = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::CatalogPackageMetadata>>();
         if (m_packageVersion)
         {
-            auto manifest = m_packageVersion->GetManifest();
-            manifest.ApplyLocale();
-            catalogPackageMetadata->Initialize(manifest.CurrentLocalization);
+            // Loading the manifest is deferred until a property is read.
+            catalogPackageMetadata->Initialize(m_packageVersion);
         }
 
         return *catalogPackageMetadata;
@@ -219,9 +218,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         auto catalogPackageMetadata = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::CatalogPackageMetadata>>();
         if (m_packageVersion)
         {
-            auto manifest = m_packageVersion->GetManifest();
-            manifest.ApplyLocale(localeString);
-            catalogPackageMetadata->Initialize(manifest.CurrentLocalization);
+            // Loading the manifest is deferred until a property is read.
+            catalogPackageMetadata->Initialize(m_packageVersion, std::move(localeString));
         }
 
         return *catalogPackageMetadata;
@@ -16,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 // Holds the wwinmain open until COM tells us there are no more server connections
@@ -216,9 +217,15 @@ int __stdcall wWinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPWSTR cmdLine,
             RETURN_IF_FAILED(WindowsPackageManagerServerModuleRegister());
         }
 
+        // Warm the server on a background thread now that clients can connect, so that
+        // their calls do not pay for settings, policy, and source initialization.
+        std::thread warmUpThread{ []() { LOG_IF_FAILED(WindowsPackageManagerServerWarmUp()); } };
+
         _comServerExitEvent.wait();
         WindowsPackageManagerServerLog("Server shutting down after exit event signaled.");
 
+        warmUpThread.join();
+
         if (manualResetEvent)
         {
             manualResetEvent.reset();
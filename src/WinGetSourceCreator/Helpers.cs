@@ -6,10 +6,41 @@ namespace Microsoft.WinGetSourceCreator
     using global::WinGetSourceCreator.Model;
     using Microsoft.Msix.Utils.ProcessRunner;
     using System.Diagnostics;
+    using System.Security.Cryptography;
+    using System.Text;
     using System.Xml;
 
     internal static class Helpers
     {
+        /// <summary>
+        /// Gets the hash of the specified file.
+        /// </summary>
+        /// <param name="filePath">File path.</param>
+        /// <returns>Hash of file.</returns>
+        public static string HashFile(string filePath)
+        {
+            if (!File.Exists(filePath))
+            {
+                throw new FileNotFoundException(filePath);
+            }
+
+            using SHA256 mySHA256 = SHA256.Create();
+            using FileStream fs = File.OpenRead(filePath);
+            fs.Position = 0;
+            return Convert.ToHexString(mySHA256.ComputeHash(fs));
+        }
+
+        /// <summary>
+        /// Gets the hash of the specified string.
+        /// </summary>
+        /// <param name="value">String value.</param>
+        /// <returns>Hash of string.</returns>
+        public static string HashString(string value)
+        {
+            using SHA256 mySHA256 = SHA256.Create();
+            return Convert.ToHexString(mySHA256.ComputeHash(Encoding.UTF8.GetBytes(value)));
+        }
+
         public static void SignInstaller(SourceInstaller installer, Signature signature)
         {
             if (installer.Type == InstallerType.Msix)
@@ -3,10 +3,10 @@
 
 namespace Microsoft.WinGetSourceCreator
 {
-    using System.Security.Cryptography;
-
     public class ManifestTokens
     {
+        private readonly object tokensLock = new();
+
         public ManifestTokens()
         {
         }
@@ -20,35 +20,13 @@ namespace Microsoft.WinGetSourceCreator
                 throw new Exception("Token should be in the form of <TOKEN VALUE>");
             }
 
-            var hash = HashFile(file);
-            this.Tokens.Add(token, hash);
-        }
-
-        /// <summary>
-        /// Gets the hash of the specified file.
-        /// </summary>
-        /// <param name="filePath">File path.</param>
-        /// <returns>Hash of file.</returns>
-        private static string HashFile(string filePath)
-        {
-            if (!File.Exists(filePath))
-            {
-                throw new FileNotFoundException(filePath);
-            }
-
-            string hash = string.Empty;
+            var hash = Helpers.HashFile(file);
 
-            using SHA256 mySHA256 = SHA256.Create();
-            using FileStream fs = File.OpenRead(filePath);
-            fs.Position = 0;
-            byte[] hashValue = mySHA256.ComputeHash(fs);
-
-            for (int i = 0; i < hashValue.Length; i++)
+            // Installers can be prepared in parallel; serialize the writes.
+            lock (this.tokensLock)
             {
-                hash += $"{hashValue[i]:X2}";
+                this.Tokens.Add(token, hash);
             }
-
-            return hash;
         }
     }
 }
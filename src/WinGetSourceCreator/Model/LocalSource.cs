@@ -23,6 +23,11 @@ namespace WinGetSourceCreator.Model
 
         public Signature? Signature { get; set; }
 
+        // Optional directory where signed installers are cached between runs, keyed by
+        // content hash and signing parameters. Unchanged installers are copied from the
+        // cache instead of being signed again.
+        public string? SignedInstallerCache { get; set; }
+
         public void Validate()
         {
             if (string.IsNullOrEmpty(this.AppxManifest))
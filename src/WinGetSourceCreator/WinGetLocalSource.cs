@@ -14,6 +14,7 @@ namespace Microsoft.WinGetSourceCreator
         private readonly string workingDirectory;
         private readonly ManifestTokens tokens;
         private readonly Signature? signature;
+        private readonly string? signedInstallerCache;
 
         public static void CreateFromLocalSourceFile(string localSourceFile)
         {
@@ -44,13 +45,17 @@ namespace Microsoft.WinGetSourceCreator
         {
             localSource.Validate();
 
-            var wingetSource = new WinGetLocalSource(localSource.WorkingDirectory, localSource.Signature);
+            var wingetSource = new WinGetLocalSource(localSource.WorkingDirectory, localSource.Signature, localSource.SignedInstallerCache);
+
+            // Each installer produces its own file, so they can be prepared in parallel.
+            // Manifest preparation stays sequential; it consumes the tokens collected here.
+            List<Action> installerWork = new();
 
             if (localSource.LocalInstallers != null)
             {
                 foreach (var installer in localSource.LocalInstallers)
                 {
-                    wingetSource.PrepareLocalInstaller(installer);
+                    installerWork.Add(() => wingetSource.PrepareLocalInstaller(installer));
                 }
             }
 
@@ -58,10 +63,12 @@ namespace Microsoft.WinGetSourceCreator
             {
                 foreach (var installer in localSource.DynamicInstallers)
                 {
-                    wingetSource.PrepareDynamicInstaller(installer);
+                    installerWork.Add(() => wingetSource.PrepareDynamicInstaller(installer));
                 }
             }
 
+            Parallel.ForEach(installerWork, work => work());
+
             foreach (var localManifest in localSource.LocalManifests)
             {
                 wingetSource.PrepareManifest(localManifest);
@@ -74,7 +81,7 @@ namespace Microsoft.WinGetSourceCreator
             _ = wingetSource.CreatePackage(localSource.GetSourceName(1), localSource.AppxManifest, indexV1File, localSource.Signature);
         }
 
-        public WinGetLocalSource(string workingDirectory, Signature? signature)
+        public WinGetLocalSource(string workingDirectory, Signature? signature, string? signedInstallerCache = null)
         {
             this.workingDirectory = Path.GetFullPath(workingDirectory);
 
@@ -86,6 +93,7 @@ namespace Microsoft.WinGetSourceCreator
 
             this.tokens = new();
             this.signature = signature;
+            this.signedInstallerCache = signedInstallerCache;
         }
 
         public void PrepareDynamicInstaller(DynamicInstaller installer)
@@ -247,7 +255,7 @@ namespace Microsoft.WinGetSourceCreator
                 var sig = this.GetSignature(installer);
                 if (sig != null)
                 {
-                    Helpers.SignInstaller(installer, sig);
+                    this.SignInstaller(installer, sig);
                 }
             }
 
@@ -281,6 +289,33 @@ namespace Microsoft.WinGetSourceCreator
             }
         }
 
+        // Signs the installer, reusing a previously signed copy from the cache when the
+        // installer content and signing parameters are unchanged.
+        private void SignInstaller(SourceInstaller installer, Signature signature)
+        {
+            if (string.IsNullOrEmpty(this.signedInstallerCache))
+            {
+                Helpers.SignInstaller(installer, signature);
+                return;
+            }
+
+            Directory.CreateDirectory(this.signedInstallerCache);
+
+            string cacheKey = Helpers.HashString(
+                $"{Helpers.HashFile(installer.InstallerFile)}|{Helpers.HashFile(signature.CertFile)}|{signature.Publisher}|{signature.TimestampServer}|{installer.Type}");
+            string cachedFile = Path.Combine(this.signedInstallerCache, cacheKey + Path.GetExtension(installer.InstallerFile));
+
+            if (File.Exists(cachedFile))
+            {
+                File.Copy(cachedFile, installer.InstallerFile, true);
+            }
+            else
+            {
+                Helpers.SignInstaller(installer, signature);
+                File.Copy(installer.InstallerFile, cachedFile, true);
+            }
+        }
+
         private Signature? GetSignature(Installer installer)
         {
             if (installer.Type == InstallerType.Zip)
@@ -6,10 +6,13 @@
 #include <AppInstallerDownloader.h>
 #include <AppInstallerFileLogger.h>
 #include <AppInstallerLogging.h>
+#include <AppInstallerSHA256.h>
 #include <AppInstallerStrings.h>
 #include <AppInstallerTelemetry.h>
 #include <Microsoft/SQLiteIndex.h>
+#include <winget/JsonUtil.h>
 #include <winget/ManifestYamlParser.h>
+#include <winget/Runtime.h>
 #include <winget/ThreadGlobals.h>
 #include <winget/InstallerMetadataCollectionContext.h>
 #include <PackageDependenciesValidation.h>
@@ -39,6 +42,264 @@ namespace
 
         THROW_HR(E_INVALIDARG);
     }
+
+    // The process wide timing callback and its context.
+    // The context is written before the callback on set and the callback is cleared first on
+    // removal, so a non-null callback always observes the context registered with it.
+    std::atomic<WINGET_TIMING_CALLBACK> s_timingCallback{ nullptr };
+    std::atomic<void*> s_timingContext{ nullptr };
+
+    // Reports the duration of the enclosing scope to the timing callback, if one is set.
+    // The input string must outlive the timer.
+    struct PhaseTimer
+    {
+        PhaseTimer(WinGetTimingPhase phase, const wchar_t* input) : m_phase(phase), m_input(input)
+        {
+            m_callback = s_timingCallback.load();
+            if (m_callback)
+            {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~PhaseTimer()
+        {
+            if (m_callback)
+            {
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start);
+                m_callback(s_timingContext.load(), m_phase, m_input, static_cast<UINT64>(duration.count()));
+            }
+        }
+
+    private:
+        WINGET_TIMING_CALLBACK m_callback;
+        WinGetTimingPhase m_phase;
+        const wchar_t* m_input;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    // Runs the validations requested by option against the manifest, accumulating result flags
+    // and, when captureMessage is set, the concatenated validation messages.
+    WinGetValidateManifestResult ValidateManifestV3Internal(
+        Manifest& manifest,
+        SQLiteIndex* sqliteIndex,
+        WinGetValidateManifestOptionV2 option,
+        WinGetValidateManifestOperationType operationType,
+        bool captureMessage,
+        std::string& validationMessage)
+    {
+        auto validationResult = WinGetValidateManifestResult::Success;
+
+        if (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::DependenciesValidation))
+        {
+            try
+            {
+                if (operationType == WinGetValidateManifestOperationType::OperationTypeDelete)
+                {
+                    PackageDependenciesValidation::VerifyDependenciesStructureForManifestDelete(sqliteIndex, manifest);
+                }
+                else
+                {
+                    PackageDependenciesValidation::ValidateManifestDependencies(sqliteIndex, manifest);
+                }
+            }
+            catch (const ManifestException& e)
+            {
+                if (!e.IsWarningOnly())
+                {
+                    validationResult |= WinGetValidateManifestResult::DependenciesValidationFailure;
+                }
+
+                validationResult |= static_cast<WinGetValidateManifestResult>( AppInstaller::Manifest::GetDependenciesValidationResultFromException(e) );
+
+                if (captureMessage)
+                {
+                    validationMessage += e.GetManifestErrorMessage();
+                }
+            }
+        }
+
+        if (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::ArpVersionValidation))
+        {
+            try
+            {
+                ValidateManifestArpVersion(sqliteIndex, manifest);
+            }
+            catch (const ManifestException& e)
+            {
+                WI_SetFlagIf(validationResult, WinGetValidateManifestResult::ArpVersionValidationFailure, !e.IsWarningOnly());
+                if (captureMessage)
+                {
+                    validationMessage += e.GetManifestErrorMessage();
+                }
+            }
+        }
+
+        if (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::InstallerValidation))
+        {
+            try
+            {
+                auto errors = ValidateManifestInstallers(manifest);
+                if (errors.size() > 0)
+                {
+                    // Throw the errors as ManifestExceptions to get processed errors and message.
+                    THROW_EXCEPTION(ManifestException({ std::move(errors) }));
+                }
+            }
+            catch (const ManifestException& e)
+            {
+                WI_SetFlagIf(validationResult, WinGetValidateManifestResult::InstallerValidationFailure, !e.IsWarningOnly());
+                if (captureMessage)
+                {
+                    validationMessage += e.GetManifestErrorMessage();
+                }
+            }
+        }
+
+        return validationResult;
+    }
+
+    // Computes a stable hash over the manifest input; for a multi file manifest (a directory),
+    // all regular files are included in name order so that any change to any file changes the hash.
+    std::string ComputeManifestInputHash(const std::filesystem::path& inputPath)
+    {
+        if (std::filesystem::is_directory(inputPath))
+        {
+            std::vector<std::filesystem::path> files;
+            for (const auto& entry : std::filesystem::directory_iterator{ inputPath })
+            {
+                if (entry.is_regular_file())
+                {
+                    files.emplace_back(entry.path());
+                }
+            }
+
+            std::sort(files.begin(), files.end());
+
+            SHA256 fullHash;
+            for (const auto& file : files)
+            {
+                std::string fileName = file.filename().u8string();
+                fullHash.Add(reinterpret_cast<const uint8_t*>(fileName.data()), fileName.size());
+                fullHash.Add(SHA256::ComputeHashFromFile(file));
+            }
+
+            return SHA256::ConvertToString(fullHash.Get());
+        }
+
+        return SHA256::ConvertToString(SHA256::ComputeHashFromFile(inputPath));
+    }
+
+    // Persists results of manifest content based validations across runs, keyed by the manifest
+    // input hash and validation options, so that unchanged manifests are not revalidated.
+    // All entries are dropped when the client version that produced them differs from the current
+    // one, as validation behavior may have changed between versions.
+    struct ValidationCache
+    {
+        struct Entry
+        {
+            WinGetValidateManifestResult Result = WinGetValidateManifestResult::Success;
+            std::string Message;
+        };
+
+        ValidationCache(std::filesystem::path filePath) : m_filePath(std::move(filePath))
+        {
+            try
+            {
+                Load();
+            }
+            catch (...)
+            {
+                // A missing or unreadable cache file simply means everything revalidates.
+                m_entries.clear();
+            }
+        }
+
+        std::optional<Entry> Get(const std::string& key)
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            auto itr = m_entries.find(key);
+            return itr != m_entries.end() ? std::optional<Entry>{ itr->second } : std::nullopt;
+        }
+
+        void Set(const std::string& key, Entry entry)
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            m_entries[key] = std::move(entry);
+            m_dirty = true;
+        }
+
+        void Save()
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            if (!m_dirty)
+            {
+                return;
+            }
+
+            web::json::value entries = web::json::value::object();
+            for (const auto& entry : m_entries)
+            {
+                web::json::value entryValue = web::json::value::object();
+                entryValue[L"result"] = web::json::value::number(static_cast<int64_t>(entry.second.Result));
+                entryValue[L"message"] = web::json::value::string(ConvertToUTF16(entry.second.Message));
+                entries[ConvertToUTF16(entry.first)] = std::move(entryValue);
+            }
+
+            web::json::value root = web::json::value::object();
+            root[L"clientVersion"] = web::json::value::string(ConvertToUTF16(AppInstaller::Runtime::GetClientVersion().get()));
+            root[L"entries"] = std::move(entries);
+
+            std::wostringstream outputStream;
+            root.serialize(outputStream);
+
+            std::ofstream fileStream{ m_filePath, std::ios::binary | std::ios::trunc };
+            fileStream << ConvertToUTF8(std::move(outputStream).str());
+
+            m_dirty = false;
+        }
+
+    private:
+        void Load()
+        {
+            if (!std::filesystem::exists(m_filePath))
+            {
+                return;
+            }
+
+            std::ifstream fileStream{ m_filePath, std::ios::binary };
+            std::string content = ReadEntireStream(fileStream);
+
+            web::json::value root = web::json::value::parse(ConvertToUTF16(content));
+
+            auto clientVersion = AppInstaller::JSON::GetRawStringValueFromJsonNode(root, L"clientVersion");
+            if (!clientVersion || clientVersion.value() != AppInstaller::Runtime::GetClientVersion().get())
+            {
+                return;
+            }
+
+            auto entriesValue = AppInstaller::JSON::GetJsonValueFromNode(root, L"entries");
+            if (!entriesValue || !entriesValue->get().is_object())
+            {
+                return;
+            }
+
+            for (const auto& entry : entriesValue->get().as_object())
+            {
+                auto result = AppInstaller::JSON::GetRawIntValueFromJsonNode(entry.second, L"result");
+                auto message = AppInstaller::JSON::GetRawStringValueFromJsonNode(entry.second, L"message");
+                if (result && message)
+                {
+                    m_entries[ConvertToUTF8(entry.first)] = Entry{ static_cast<WinGetValidateManifestResult>(result.value()), std::move(message).value() };
+                }
+            }
+        }
+
+        std::filesystem::path m_filePath;
+        std::mutex m_lock;
+        std::map<std::string, Entry> m_entries;
+        bool m_dirty = false;
+    };
 }
 
 extern "C"
@@ -89,6 +350,25 @@ extern "C"
     }
     CATCH_RETURN()
 
+    WINGET_UTIL_API WinGetSetTimingCallback(
+        WINGET_TIMING_CALLBACK callback,
+        void* context) try
+    {
+        if (callback)
+        {
+            s_timingContext = context;
+            s_timingCallback = callback;
+        }
+        else
+        {
+            s_timingCallback = nullptr;
+            s_timingContext = nullptr;
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
     WINGET_UTIL_API WinGetSQLiteIndexCreate(WINGET_STRING filePath, UINT32 majorVersion, UINT32 minorVersion, WINGET_SQLITE_INDEX_HANDLE* index) try
     {
         THROW_HR_IF(E_INVALIDARG, !filePath);
@@ -166,12 +446,37 @@ extern "C"
         THROW_HR_IF(E_INVALIDARG, !manifestPath);
         THROW_HR_IF(E_INVALIDARG, !relativePath);
 
+        PhaseTimer timer{ TimingPhaseIndexWrite, relativePath };
         reinterpret_cast<SQLiteIndex*>(index)->AddManifest(manifestPath, relativePath);
 
         return S_OK;
     }
     CATCH_RETURN()
 
+    WINGET_UTIL_API WinGetSQLiteIndexAddManifestBatch(
+        WINGET_SQLITE_INDEX_HANDLE index,
+        UINT32 manifestCount,
+        WINGET_STRING const* manifestPaths,
+        WINGET_STRING const* relativePaths) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !index);
+        THROW_HR_IF(E_INVALIDARG, manifestCount && (!manifestPaths || !relativePaths));
+
+        std::vector<SQLiteIndex::ManifestBatchEntry> entries;
+        entries.reserve(manifestCount);
+
+        for (UINT32 i = 0; i < manifestCount; ++i)
+        {
+            THROW_HR_IF(E_INVALIDARG, !manifestPaths[i] || !relativePaths[i]);
+            entries.emplace_back(SQLiteIndex::ManifestBatchEntry{ manifestPaths[i], relativePaths[i] });
+        }
+
+        reinterpret_cast<SQLiteIndex*>(index)->AddManifestBatch(entries);
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
     WINGET_UTIL_API WinGetSQLiteIndexUpdateManifest(
         WINGET_SQLITE_INDEX_HANDLE index,
         WINGET_STRING manifestPath,
@@ -182,6 +487,7 @@ extern "C"
         THROW_HR_IF(E_INVALIDARG, !manifestPath);
         THROW_HR_IF(E_INVALIDARG, !relativePath);
 
+        PhaseTimer timer{ TimingPhaseIndexWrite, relativePath };
         bool result = reinterpret_cast<SQLiteIndex*>(index)->UpdateManifest(manifestPath, relativePath);
         if (indexModified)
         {
@@ -202,6 +508,7 @@ extern "C"
         THROW_HR_IF(E_INVALIDARG, !manifestPath);
         THROW_HR_IF(E_INVALIDARG, !relativePath);
 
+        PhaseTimer timer{ TimingPhaseIndexWrite, relativePath };
         bool result = reinterpret_cast<SQLiteIndex*>(index)->AddOrUpdateManifest(manifestPath, relativePath);
         if (indexModified)
         {
@@ -221,6 +528,7 @@ extern "C"
         THROW_HR_IF(E_INVALIDARG, !manifestPath);
         THROW_HR_IF(E_INVALIDARG, !relativePath);
 
+        PhaseTimer timer{ TimingPhaseIndexWrite, relativePath };
         reinterpret_cast<SQLiteIndex*>(index)->RemoveManifest(manifestPath, relativePath);
 
         return S_OK;
@@ -339,6 +647,8 @@ extern "C"
         *succeeded = false;
         *manifest = nullptr;
 
+        PhaseTimer timer{ TimingPhaseCreateManifest, inputPath };
+
         try
         {
             ManifestValidateOption validateOption;
@@ -420,75 +730,109 @@ extern "C"
         
         *result = WinGetValidateManifestResult::InternalError;
 
-        std::string validationMessage;
-        auto validationResult = WinGetValidateManifestResult::Success;
-
         Manifest* manifestPtr = reinterpret_cast<Manifest*>(manifest);
         SQLiteIndex* sqliteIndex = reinterpret_cast<SQLiteIndex*>(index);
 
-        if (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::DependenciesValidation))
+        std::wstring manifestId = ConvertToUTF16(manifestPtr->Id);
+        PhaseTimer timer{ TimingPhaseValidateManifest, manifestId.c_str() };
+
+        std::string validationMessage;
+        *result = ValidateManifestV3Internal(*manifestPtr, sqliteIndex, option, operationType, message != nullptr, validationMessage);
+
+        if (message)
         {
-            try
-            {
-                if (operationType == WinGetValidateManifestOperationType::OperationTypeDelete)
-                {
-                    PackageDependenciesValidation::VerifyDependenciesStructureForManifestDelete(sqliteIndex, *manifestPtr);
-                }
-                else
-                {
-                    PackageDependenciesValidation::ValidateManifestDependencies(sqliteIndex, *manifestPtr);
-                }
-            }
-            catch (const ManifestException& e)
-            {
-                if (!e.IsWarningOnly())
-                {
-                    validationResult |= WinGetValidateManifestResult::DependenciesValidationFailure;
-                }
-                
-                validationResult |= static_cast<WinGetValidateManifestResult>( AppInstaller::Manifest::GetDependenciesValidationResultFromException(e) );
-              
-                if (message)
-                {
-                    validationMessage += e.GetManifestErrorMessage();
-                }
-            }
+            *message = ::SysAllocString(ConvertToUTF16(validationMessage).c_str());
         }
-        
-        if (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::ArpVersionValidation))
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationCacheOpen(
+        WINGET_STRING cacheFilePath,
+        WINGET_VALIDATION_CACHE_HANDLE* cache) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !cacheFilePath);
+        THROW_HR_IF(E_INVALIDARG, !cache);
+        THROW_HR_IF(E_INVALIDARG, !!*cache);
+
+        std::unique_ptr<ValidationCache> result = std::make_unique<ValidationCache>(std::filesystem::path{ cacheFilePath });
+
+        *cache = static_cast<WINGET_VALIDATION_CACHE_HANDLE>(result.release());
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationCacheClose(
+        WINGET_VALIDATION_CACHE_HANDLE cache) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !cache);
+
+        std::unique_ptr<ValidationCache> toClose{ reinterpret_cast<ValidationCache*>(cache) };
+        toClose->Save();
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidateManifestV3Cached(
+        WINGET_MANIFEST_HANDLE manifest,
+        WINGET_SQLITE_INDEX_HANDLE index,
+        WINGET_VALIDATION_CACHE_HANDLE cache,
+        WINGET_STRING manifestPath,
+        WinGetValidateManifestResult* result,
+        WINGET_STRING_OUT* message,
+        WinGetValidateManifestOptionV2 option,
+        WinGetValidateManifestOperationType operationType) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !manifest);
+        THROW_HR_IF(E_INVALIDARG, !cache);
+        THROW_HR_IF(E_INVALIDARG, !manifestPath);
+        THROW_HR_IF(E_INVALIDARG, !result);
+        // Index should be provided if DependenciesValidation or ArpVersionValidation is to be performed
+        THROW_HR_IF(E_INVALIDARG, !index && (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::DependenciesValidation) || WI_IsFlagSet(option, WinGetValidateManifestOptionV2::ArpVersionValidation)));
+        THROW_HR_IF(E_INVALIDARG, option == WinGetValidateManifestOptionV2::None);
+
+        *result = WinGetValidateManifestResult::InternalError;
+
+        Manifest* manifestPtr = reinterpret_cast<Manifest*>(manifest);
+        SQLiteIndex* sqliteIndex = reinterpret_cast<SQLiteIndex*>(index);
+        ValidationCache* validationCache = reinterpret_cast<ValidationCache*>(cache);
+
+        // Only validations whose outcome is a pure function of the manifest contents can be served
+        // from the cache; dependencies and arp version validation depend on the index state and always run.
+        WinGetValidateManifestOptionV2 cacheableOption = option & WinGetValidateManifestOptionV2::InstallerValidation;
+        WinGetValidateManifestOptionV2 uncacheableOption = option & ~WinGetValidateManifestOptionV2::InstallerValidation;
+
+        std::string validationMessage;
+        auto validationResult = WinGetValidateManifestResult::Success;
+
+        if (uncacheableOption != WinGetValidateManifestOptionV2::None)
         {
-            try
-            {
-                ValidateManifestArpVersion(sqliteIndex, *manifestPtr);
-            }
-            catch (const ManifestException& e)
-            {
-                WI_SetFlagIf(validationResult, WinGetValidateManifestResult::ArpVersionValidationFailure, !e.IsWarningOnly());
-                if (message)
-                {
-                    validationMessage += e.GetManifestErrorMessage();
-                }
-            }
+            validationResult |= ValidateManifestV3Internal(*manifestPtr, sqliteIndex, uncacheableOption, operationType, message != nullptr, validationMessage);
         }
 
-        if (WI_IsFlagSet(option, WinGetValidateManifestOptionV2::InstallerValidation))
+        if (cacheableOption != WinGetValidateManifestOptionV2::None)
         {
-            try
+            std::ostringstream keyStream;
+            keyStream << ComputeManifestInputHash(manifestPath) << ':' << static_cast<int>(cacheableOption);
+            std::string cacheKey = std::move(keyStream).str();
+
+            auto cachedEntry = validationCache->Get(cacheKey);
+            if (!cachedEntry)
             {
-                auto errors = ValidateManifestInstallers(*manifestPtr);
-                if (errors.size() > 0)
-                {
-                    // Throw the errors as ManifestExceptions to get processed errors and message.
-                    THROW_EXCEPTION(ManifestException({ std::move(errors) }));
-                }
+                ValidationCache::Entry newEntry;
+                // Always capture the message so that cache hits can serve it regardless of the caller.
+                newEntry.Result = ValidateManifestV3Internal(*manifestPtr, sqliteIndex, cacheableOption, operationType, true, newEntry.Message);
+                validationCache->Set(cacheKey, newEntry);
+                cachedEntry = std::move(newEntry);
             }
-            catch (const ManifestException& e)
+
+            validationResult |= cachedEntry->Result;
+            if (message)
             {
-                WI_SetFlagIf(validationResult, WinGetValidateManifestResult::InstallerValidationFailure, !e.IsWarningOnly());
-                if (message)
-                {
-                    validationMessage += e.GetManifestErrorMessage();
-                }
+                validationMessage += cachedEntry->Message;
             }
         }
 
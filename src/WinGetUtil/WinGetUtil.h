@@ -16,6 +16,9 @@ extern "C"
     // A string returned by the utility; in UTF16.
     typedef BSTR WINGET_STRING_OUT;
 
+    // A handle to a manifest validation result cache.
+    typedef void* WINGET_VALIDATION_CACHE_HANDLE;
+
 #define WINGET_UTIL_API HRESULT __stdcall
 
 #define WINGET_SQLITE_INDEX_VERSION_LATEST ((UINT32)-1)
@@ -108,6 +111,30 @@ extern "C"
 
     DEFINE_ENUM_FLAG_OPERATORS(WinGetValidateManifestDependenciesOption);
 
+    enum WinGetTimingPhase
+    {
+        // Manifest creation, including any requested schema or semantic validation.
+        TimingPhaseCreateManifest = 1,
+        // Index based validation of an already created manifest.
+        TimingPhaseValidateManifest = 2,
+        // Adding, updating or removing a manifest in the index.
+        TimingPhaseIndexWrite = 3,
+    };
+
+    // Invoked with the duration of an instrumented operation.
+    // input identifies the manifest the operation ran against; it is only valid for the duration of the call.
+    typedef void (__stdcall *WINGET_TIMING_CALLBACK)(
+        void* context,
+        WinGetTimingPhase phase,
+        WINGET_STRING input,
+        UINT64 durationInMilliseconds);
+
+    // Sets the process wide timing callback, which receives per manifest durations
+    // of the instrumented operations. Pass nullptr to remove a previously set callback.
+    WINGET_UTIL_API WinGetSetTimingCallback(
+        WINGET_TIMING_CALLBACK callback,
+        void* context);
+
     // Initializes the logging infrastructure.
     WINGET_UTIL_API WinGetLoggingInit(
         WINGET_STRING logPath);
@@ -158,6 +185,15 @@ extern "C"
         WINGET_STRING manifestPath, 
         WINGET_STRING relativePath);
 
+    // Adds all of the manifests at the given repository relative paths to the index.
+    // Manifest parsing runs on a pool of worker threads; the database writes occur within a
+    // single transaction. If the function fails, none of the manifests have been added.
+    WINGET_UTIL_API WinGetSQLiteIndexAddManifestBatch(
+        WINGET_SQLITE_INDEX_HANDLE index,
+        UINT32 manifestCount,
+        WINGET_STRING const* manifestPaths,
+        WINGET_STRING const* relativePaths);
+
     // Updates the manifest with matching { Id, Version, Channel } in the index.
     // The return value indicates whether the index was modified by the function.
     WINGET_UTIL_API WinGetSQLiteIndexUpdateManifest(
@@ -236,6 +272,31 @@ extern "C"
         WinGetValidateManifestOptionV2 option,
         WinGetValidateManifestOperationType operationType);
 
+    // Opens a validation result cache persisted at the given file path, creating it if it does not exist.
+    // The cache stores results of manifest content based validations keyed by the manifest file hash and
+    // validation options, so that unchanged manifests are not revalidated across runs.
+    WINGET_UTIL_API WinGetValidationCacheOpen(
+        WINGET_STRING cacheFilePath,
+        WINGET_VALIDATION_CACHE_HANDLE* cache);
+
+    // Persists and closes a given validation result cache.
+    WINGET_UTIL_API WinGetValidationCacheClose(
+        WINGET_VALIDATION_CACHE_HANDLE cache);
+
+    // Same as WinGetValidateManifestV3, but serves manifest content based validations (currently
+    // InstallerValidation) from the given cache when the manifest file at manifestPath is unchanged.
+    // Dependencies and arp version validations depend on the index state and always run.
+    // manifestPath is the file or directory the manifest handle was created from.
+    WINGET_UTIL_API WinGetValidateManifestV3Cached(
+        WINGET_MANIFEST_HANDLE manifest,
+        WINGET_SQLITE_INDEX_HANDLE index,
+        WINGET_VALIDATION_CACHE_HANDLE cache,
+        WINGET_STRING manifestPath,
+        WinGetValidateManifestResult* result,
+        WINGET_STRING_OUT* message,
+        WinGetValidateManifestOptionV2 option,
+        WinGetValidateManifestOperationType operationType);
+
     // Validates a given manifest with dependencies. Returns a bool for validation result and
     // a string representing validation errors if validation failed.
     // If mergedManifestPath is provided, this method will write a merged manifest
@@ -13,9 +13,15 @@
 #pragma warning( pop )
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
 
 #include <winrt/Windows.Foundation.h>
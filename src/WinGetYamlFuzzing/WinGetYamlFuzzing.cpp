@@ -21,7 +21,131 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
 
 #include <AppInstallerStrings.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct CorpusInput
+    {
+        std::filesystem::path Path;
+        std::string Contents;
+        std::chrono::microseconds ParseTime{};
+    };
+
+    std::vector<CorpusInput> ReadCorpus(const std::filesystem::path& corpus)
+    {
+        std::vector<CorpusInput> result;
+
+        auto readFile = [&result](const std::filesystem::path& path)
+        {
+            std::ifstream stream{ path, std::ios_base::in | std::ios_base::binary };
+            result.push_back({ path, AppInstaller::Utility::ReadEntireStream(stream) });
+        };
+
+        if (std::filesystem::is_directory(corpus))
+        {
+            for (auto& file : std::filesystem::directory_iterator{ corpus })
+            {
+                if (!file.is_directory())
+                {
+                    readFile(file.path());
+                }
+            }
+        }
+        else
+        {
+            readFile(corpus);
+        }
+
+        return result;
+    }
+
+    // Performance fuzzing: parse every corpus input across all cores, timing each parse.
+    // Inputs far outside the corpus distribution are pathological (typically quadratic
+    // anchor/alias expansion) and are reported as perf bugs with a failing exit code,
+    // so that a multi-second manifest fails the run before it can ship.
+    int RunPerfMode(const std::filesystem::path& corpus)
+    {
+        std::vector<CorpusInput> inputs = ReadCorpus(corpus);
+        if (inputs.empty())
+        {
+            std::cout << "No corpus inputs found at: " << corpus << std::endl;
+            return 1;
+        }
+
+        unsigned int threadCount = std::max(1u, std::min(std::thread::hardware_concurrency(), static_cast<unsigned int>(inputs.size())));
+        std::atomic_size_t nextInput{ 0 };
+
+        auto worker = [&]()
+        {
+            for (size_t i = nextInput++; i < inputs.size(); i = nextInput++)
+            {
+                CorpusInput& input = inputs[i];
+                auto start = std::chrono::steady_clock::now();
+                LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(input.Contents.data()), input.Contents.size());
+                input.ParseTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<std::chrono::microseconds> times;
+        times.reserve(inputs.size());
+        for (const auto& input : inputs)
+        {
+            times.push_back(input.ParseTime);
+        }
+        std::sort(times.begin(), times.end());
+
+        auto percentile = [&](size_t numerator, size_t denominator)
+        {
+            return times[std::min(times.size() - 1, (times.size() * numerator) / denominator)];
+        };
+
+        std::chrono::microseconds median = percentile(1, 2);
+
+        std::cout << "Parsed " << inputs.size() << " inputs on " << threadCount << " threads" << std::endl;
+        std::cout << "  min:    " << times.front().count() << "us" << std::endl;
+        std::cout << "  median: " << median.count() << "us" << std::endl;
+        std::cout << "  p90:    " << percentile(9, 10).count() << "us" << std::endl;
+        std::cout << "  max:    " << times.back().count() << "us" << std::endl;
+
+        // An input is pathological when it is far outside the corpus distribution and slow
+        // in absolute terms; the floor keeps tiny corpora from flagging measurement noise.
+        constexpr auto absoluteFloor = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::milliseconds{ 100 });
+        std::chrono::microseconds threshold = std::max(absoluteFloor, median * 10);
+
+        int result = 0;
+        for (const auto& input : inputs)
+        {
+            if (input.ParseTime >= threshold)
+            {
+                std::cout << "Pathological input (" << input.ParseTime.count() << "us, " << input.Contents.size() << " bytes): " << input.Path << std::endl;
+                result = 2;
+            }
+        }
+
+        return result;
+    }
+}
+
 // Emulate libFuzzer main by just sending all files in the corpus (last arg) to the fuzzer.
+// With --perf before the corpus, run the performance fuzzing mode instead.
 int main(int argc, char** argv)
 {
     if (argc <= 1)
@@ -31,25 +155,17 @@ int main(int argc, char** argv)
 
     std::filesystem::path corpus = argv[argc - 1];
 
-    if (std::filesystem::is_directory(corpus))
+    for (int i = 1; i < argc - 1; ++i)
     {
-        for (auto& file : std::filesystem::directory_iterator{ corpus })
+        if (std::string_view{ argv[i] } == "--perf")
         {
-            if (!file.is_directory())
-            {
-                std::ifstream stream{ file.path(), std::ios_base::in | std::ios_base::binary };
-                std::string contents = AppInstaller::Utility::ReadEntireStream(stream);
-
-                LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(contents.data()), contents.size());
-            }
+            return RunPerfMode(corpus);
         }
     }
-    else
-    {
-        std::ifstream stream{ corpus, std::ios_base::in | std::ios_base::binary };
-        std::string contents = AppInstaller::Utility::ReadEntireStream(stream);
 
-        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(contents.data()), contents.size());
+    for (auto& input : ReadCorpus(corpus))
+    {
+        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(input.Contents.data()), input.Contents.size());
     }
 
     return 0;
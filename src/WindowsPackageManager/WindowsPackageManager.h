@@ -19,6 +19,11 @@ extern "C"
     // Initializes the Windows Package Manager COM server.
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerInitialize();
 
+    // Warms the server (settings, policies, and configured sources) so that client calls
+    // arriving later do not pay for this initialization. Intended to be called on a
+    // background thread after the server module is registered.
+    WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerWarmUp();
+
     // Creates the server module with the given termination callback.
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerModuleCreate(WindowsPackageManagerServerModuleTerminationCallback callback);
 
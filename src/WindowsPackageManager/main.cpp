@@ -55,6 +55,13 @@ extern "C"
     }
     CATCH_RETURN();
 
+    WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerWarmUp() try
+    {
+        AppInstaller::CLI::ServerWarmUp();
+        return S_OK;
+    }
+    CATCH_RETURN();
+
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerModuleCreate(WindowsPackageManagerServerModuleTerminationCallback callback) try
     {
         AppInstaller::ShutdownMonitoring::ServerShutdownSynchronization::Initialize(callback);
@@ -0,0 +1,459 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "WinGetUtil.h"
+
+namespace
+{
+    // -------------------------------------------------------------------------
+    // WinGetUtil runtime loading
+    // -------------------------------------------------------------------------
+
+    struct WinGetApi
+    {
+        HMODULE module = nullptr;
+        PFN_WinGetSQLiteIndexCreate              Create = nullptr;
+        PFN_WinGetSQLiteIndexAddManifest         AddManifest = nullptr;
+        PFN_WinGetSQLiteIndexPrepareForPackaging PrepareForPackaging = nullptr;
+        PFN_WinGetSQLiteIndexClose               Close = nullptr;
+
+        ~WinGetApi() { if (module) FreeLibrary(module); }
+
+        explicit operator bool() const { return module && Create && AddManifest && PrepareForPackaging && Close; }
+    };
+
+    template<typename T>
+    T GetProc(HMODULE mod, const char* name)
+    {
+        return reinterpret_cast<T>(GetProcAddress(mod, name));
+    }
+
+    // Loads WinGetUtil.dll from dllPath (if non-empty) or via the standard DLL
+    // search order (which includes the application directory first).
+    WinGetApi LoadWinGetUtil(const std::filesystem::path& dllPath)
+    {
+        WinGetApi api;
+
+        if (!dllPath.empty())
+        {
+            api.module = LoadLibraryExW(dllPath.c_str(), nullptr, LOAD_WITH_ALTERED_SEARCH_PATH);
+            if (!api.module)
+            {
+                std::wcerr << L"Error: could not load WinGetUtil.dll from: " << dllPath << L"\n"
+                           << L"       GetLastError: " << GetLastError() << L"\n";
+                return api;
+            }
+        }
+        else
+        {
+            api.module = LoadLibraryW(L"WinGetUtil.dll");
+            if (!api.module)
+            {
+                std::wcerr << L"Error: could not load WinGetUtil.dll.\n"
+                           << L"       Place WinGetUtil.dll in the same directory as this executable,\n"
+                           << L"       or specify its path with --wingetutil <path>.\n"
+                           << L"       GetLastError: " << GetLastError() << L"\n";
+                return api;
+            }
+        }
+
+        api.Create              = GetProc<PFN_WinGetSQLiteIndexCreate>             (api.module, "WinGetSQLiteIndexCreate");
+        api.AddManifest         = GetProc<PFN_WinGetSQLiteIndexAddManifest>        (api.module, "WinGetSQLiteIndexAddManifest");
+        api.PrepareForPackaging = GetProc<PFN_WinGetSQLiteIndexPrepareForPackaging>(api.module, "WinGetSQLiteIndexPrepareForPackaging");
+        api.Close               = GetProc<PFN_WinGetSQLiteIndexClose>              (api.module, "WinGetSQLiteIndexClose");
+
+        if (!api)
+        {
+            std::wcerr << L"Error: WinGetUtil.dll is missing one or more required exports.\n"
+                       << L"       Ensure the DLL matches the expected version.\n";
+        }
+
+        return api;
+    }
+
+    // -------------------------------------------------------------------------
+    // Argument parsing
+    // -------------------------------------------------------------------------
+
+    struct Args
+    {
+        std::filesystem::path outputDir;
+        std::filesystem::path wingetUtilPath;            // optional: explicit path to WinGetUtil.dll
+        std::optional<std::filesystem::path> indexFile;  // build an index from the generated manifests
+        uint32_t packages = 1000;
+        uint32_t maxVersions = 3;        // versions per package are drawn from [1, maxVersions]
+        uint32_t maxTags = 4;            // tags per package are drawn from [0, maxTags]
+        uint32_t meanStringLength = 24;  // mean length of generated description strings
+        uint32_t seed = 42;
+        bool pack = false;               // run PrepareForPackaging on the built index
+        bool showHelp = false;
+    };
+
+    void PrintUsage(const wchar_t* programName)
+    {
+        std::wcout
+            << L"Usage: " << programName << L" <output-dir> [options]\n"
+            << L"\n"
+            << L"Generates a deterministic synthetic manifest tree for index benchmarking.\n"
+            << L"The same parameters and seed always produce byte-identical manifests, so\n"
+            << L"fixture indexes are reproducible across machines and runs.\n"
+            << L"\n"
+            << L"Options:\n"
+            << L"  --packages <n>       Number of packages to generate (default: 1000)\n"
+            << L"  --versions <n>       Maximum versions per package (default: 3)\n"
+            << L"  --tags <n>           Maximum tags per package (default: 4)\n"
+            << L"  --string-length <n>  Mean description length in characters (default: 24)\n"
+            << L"  --seed <n>           Random seed (default: 42)\n"
+            << L"  --index <file>       Also build a source index at <file> via WinGetUtil.dll\n"
+            << L"  --pack               Run PrepareForPackaging on the built index\n"
+            << L"  --wingetutil <path>  Path to WinGetUtil.dll\n"
+            << L"                       (default: searches application directory and PATH)\n"
+            << L"  --help               Show this help\n";
+    }
+
+    Args ParseArgs(int argc, wchar_t* argv[])
+    {
+        Args args;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::wstring_view arg{ argv[i] };
+            if (arg == L"--help" || arg == L"-h" || arg == L"-?")
+            {
+                args.showHelp = true;
+            }
+            else if (arg == L"--packages" && i + 1 < argc)
+            {
+                args.packages = static_cast<uint32_t>(std::stoul(argv[++i]));
+            }
+            else if (arg == L"--versions" && i + 1 < argc)
+            {
+                args.maxVersions = static_cast<uint32_t>(std::stoul(argv[++i]));
+            }
+            else if (arg == L"--tags" && i + 1 < argc)
+            {
+                args.maxTags = static_cast<uint32_t>(std::stoul(argv[++i]));
+            }
+            else if (arg == L"--string-length" && i + 1 < argc)
+            {
+                args.meanStringLength = static_cast<uint32_t>(std::stoul(argv[++i]));
+            }
+            else if (arg == L"--seed" && i + 1 < argc)
+            {
+                args.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+            }
+            else if (arg == L"--index" && i + 1 < argc)
+            {
+                args.indexFile = argv[++i];
+            }
+            else if (arg == L"--pack")
+            {
+                args.pack = true;
+            }
+            else if (arg == L"--wingetutil" && i + 1 < argc)
+            {
+                args.wingetUtilPath = argv[++i];
+            }
+            else if (args.outputDir.empty() && !arg.empty() && arg[0] != L'-')
+            {
+                args.outputDir = arg;
+            }
+        }
+        return args;
+    }
+
+    // -------------------------------------------------------------------------
+    // Deterministic content generation
+    // -------------------------------------------------------------------------
+
+    // Small word pools keep generated identifiers realistic (mixed lengths, shared
+    // prefixes, repeated tags across packages) without external inputs.
+    constexpr std::array<std::string_view, 16> c_publisherWords
+    {
+        "Contoso", "Fabrikam", "Northwind", "Tailspin", "Wingtip", "Proseware", "Adatum", "Lamna",
+        "Fourth", "Woodgrove", "Trey", "Litware", "Margie", "Lucerne", "Alpine", "Humongous",
+    };
+
+    constexpr std::array<std::string_view, 16> c_nameWords
+    {
+        "Editor", "Viewer", "Manager", "Studio", "Console", "Toolkit", "Client", "Agent",
+        "Runtime", "Bridge", "Monitor", "Designer", "Player", "Archiver", "Notes", "Terminal",
+    };
+
+    constexpr std::array<std::string_view, 12> c_tagWords
+    {
+        "developer-tools", "utility", "media", "productivity", "open-source", "networking",
+        "security", "editor", "cli", "runtime", "graphics", "database",
+    };
+
+    struct Generator
+    {
+        explicit Generator(const Args& args) : m_args(args), m_engine(args.seed) {}
+
+        uint32_t Draw(uint32_t minimum, uint32_t maximum)
+        {
+            return std::uniform_int_distribution<uint32_t>{ minimum, maximum }(m_engine);
+        }
+
+        std::string PublisherFor(uint32_t package)
+        {
+            // Cycle the pool and disambiguate with an ordinal so identifier cardinality scales.
+            std::string result{ c_publisherWords[package % c_publisherWords.size()] };
+            result += std::to_string(package / c_publisherWords.size());
+            return result;
+        }
+
+        std::string NameFor(uint32_t package)
+        {
+            std::string result{ c_nameWords[(package / c_nameWords.size()) % c_nameWords.size()] };
+            result += c_nameWords[package % c_nameWords.size()];
+            return result;
+        }
+
+        std::vector<std::string> TagsFor()
+        {
+            std::vector<std::string> result;
+            uint32_t count = Draw(0, m_args.maxTags);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                std::string tag{ c_tagWords[Draw(0, static_cast<uint32_t>(c_tagWords.size()) - 1)] };
+                if (std::find(result.begin(), result.end(), tag) == result.end())
+                {
+                    result.emplace_back(std::move(tag));
+                }
+            }
+            return result;
+        }
+
+        // Produces a sentence-like string whose length is normally distributed
+        // around the configured mean.
+        std::string Description()
+        {
+            double mean = static_cast<double>(m_args.meanStringLength);
+            std::normal_distribution<double> lengths{ mean, mean / 3.0 };
+            size_t target = static_cast<size_t>(std::clamp(lengths(m_engine), 4.0, mean * 4.0));
+
+            std::string result;
+            while (result.size() < target)
+            {
+                if (!result.empty())
+                {
+                    result += ' ';
+                }
+                result += c_nameWords[Draw(0, static_cast<uint32_t>(c_nameWords.size()) - 1)];
+            }
+
+            result.resize(target);
+            return result;
+        }
+
+        // A deterministic 64 character hex string standing in for an installer hash.
+        std::string FakeSha256()
+        {
+            static constexpr char hex[] = "0123456789abcdef";
+            std::string result(64, '0');
+            for (char& c : result)
+            {
+                c = hex[Draw(0, 15)];
+            }
+            return result;
+        }
+
+    private:
+        const Args& m_args;
+        std::mt19937 m_engine;
+    };
+
+    // -------------------------------------------------------------------------
+    // Manifest emission
+    // -------------------------------------------------------------------------
+
+    struct PackageVersionRef
+    {
+        std::filesystem::path directory;    // directory containing the manifest
+        std::filesystem::path relativePath; // relative path recorded in the index
+    };
+
+    void WriteManifest(
+        const std::filesystem::path& file,
+        const std::string& identifier,
+        const std::string& version,
+        const std::string& publisher,
+        const std::string& name,
+        const std::string& description,
+        const std::vector<std::string>& tags,
+        const std::string& sha256)
+    {
+        std::ofstream stream(file, std::ios::binary);
+        if (!stream) { throw std::runtime_error("Cannot open manifest file for writing."); }
+
+        stream << "PackageIdentifier: " << identifier << "\n";
+        stream << "PackageVersion: " << version << "\n";
+        stream << "PackageLocale: en-US\n";
+        stream << "Publisher: " << publisher << "\n";
+        stream << "PackageName: " << publisher << ' ' << name << "\n";
+        stream << "License: Synthetic\n";
+        stream << "ShortDescription: " << description << "\n";
+
+        if (!tags.empty())
+        {
+            stream << "Tags:\n";
+            for (const auto& tag : tags)
+            {
+                stream << "- " << tag << "\n";
+            }
+        }
+
+        stream << "Installers:\n";
+        stream << "- Architecture: x64\n";
+        stream << "  InstallerType: exe\n";
+        stream << "  InstallerUrl: https://synthetic.example.com/" << identifier << '/' << version << "/installer.exe\n";
+        stream << "  InstallerSha256: " << sha256 << "\n";
+        stream << "ManifestType: singleton\n";
+        stream << "ManifestVersion: 1.6.0\n";
+    }
+
+    std::vector<PackageVersionRef> GenerateManifests(const Args& args)
+    {
+        Generator generator{ args };
+        std::vector<PackageVersionRef> result;
+        std::filesystem::path manifestRoot = args.outputDir / "manifests";
+
+        for (uint32_t package = 0; package < args.packages; ++package)
+        {
+            std::string publisher = generator.PublisherFor(package);
+            std::string name = generator.NameFor(package);
+            std::string identifier = publisher + '.' + name;
+            std::string description = generator.Description();
+            std::vector<std::string> tags = generator.TagsFor();
+
+            uint32_t versionCount = generator.Draw(1, args.maxVersions);
+            for (uint32_t version = 0; version < versionCount; ++version)
+            {
+                std::string versionString = "1." + std::to_string(version) + '.' + std::to_string(generator.Draw(0, 9));
+
+                std::filesystem::path relative = std::filesystem::path{ identifier } / versionString;
+                std::filesystem::path directory = manifestRoot / relative;
+                std::filesystem::create_directories(directory);
+
+                WriteManifest(
+                    directory / (identifier + ".yaml"),
+                    identifier, versionString, publisher, name, description, tags, generator.FakeSha256());
+
+                result.push_back(PackageVersionRef{ directory, relative });
+            }
+        }
+
+        return result;
+    }
+
+    // -------------------------------------------------------------------------
+    // Index building
+    // -------------------------------------------------------------------------
+
+    int BuildIndex(const Args& args, const std::vector<PackageVersionRef>& manifests)
+    {
+        WinGetApi api = LoadWinGetUtil(args.wingetUtilPath);
+        if (!api) { return 1; }
+
+        std::wcout << L"Creating index at " << args.indexFile->c_str() << L"...\n";
+        WINGET_SQLITE_INDEX_HANDLE index = nullptr;
+        HRESULT hr = api.Create(
+            args.indexFile->c_str(),
+            WINGET_SQLITE_INDEX_VERSION_LATEST,
+            WINGET_SQLITE_INDEX_VERSION_LATEST,
+            &index);
+
+        if (FAILED(hr))
+        {
+            std::wcerr << L"Error: WinGetSQLiteIndexCreate failed: 0x"
+                << std::hex << std::uppercase << hr << L"\n";
+            return 1;
+        }
+
+        uint64_t added = 0;
+        for (const auto& manifest : manifests)
+        {
+            std::wstring manifestPath = manifest.directory.wstring();
+            std::wstring relativePath = manifest.relativePath.generic_wstring();
+
+            hr = api.AddManifest(index, manifestPath.c_str(), relativePath.c_str());
+            if (FAILED(hr))
+            {
+                std::wcerr << L"Error: WinGetSQLiteIndexAddManifest failed for "
+                    << manifestPath << L": 0x" << std::hex << std::uppercase << hr << L"\n";
+                api.Close(index);
+                return 1;
+            }
+
+            if (++added % 1000 == 0)
+            {
+                std::wcout << L"  " << added << L" / " << manifests.size() << L" added...\r";
+            }
+        }
+
+        if (args.pack)
+        {
+            std::wcout << L"\nPreparing for packaging (VACUUM + drop indices)...\n";
+            hr = api.PrepareForPackaging(index);
+            if (FAILED(hr))
+            {
+                std::wcerr << L"Error: WinGetSQLiteIndexPrepareForPackaging failed: 0x"
+                    << std::hex << std::uppercase << hr << L"\n";
+                api.Close(index);
+                return 1;
+            }
+        }
+
+        api.Close(index);
+        std::wcout << L"\nIndex built with " << added << L" manifests.\n";
+        return 0;
+    }
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------
+// Entry point
+// -------------------------------------------------------------------------
+
+int wmain(int argc, wchar_t* argv[])
+{
+    Args args = ParseArgs(argc, argv);
+
+    if (args.showHelp || args.outputDir.empty())
+    {
+        PrintUsage(argc > 0 ? argv[0] : L"SyntheticIndexTool");
+        return args.showHelp ? 0 : 1;
+    }
+
+    if (args.packages == 0 || args.maxVersions == 0)
+    {
+        std::wcerr << L"Error: --packages and --versions must be at least 1.\n";
+        return 1;
+    }
+
+    try
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<PackageVersionRef> manifests = GenerateManifests(args);
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::wcout << L"Generated " << manifests.size() << L" manifests for "
+                   << args.packages << L" packages in " << duration.count() << L"ms\n"
+                   << L"  seed: " << args.seed
+                   << L"  versions: 1-" << args.maxVersions
+                   << L"  tags: 0-" << args.maxTags
+                   << L"  mean description length: " << args.meanStringLength << L"\n";
+
+        if (args.indexFile)
+        {
+            return BuildIndex(args, manifests);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}